@@ -141,6 +141,24 @@ standard names. */
 
 /* USER CODE BEGIN Defines */
 /* Section where parameter definitions can be added (for instance, to override default ones in FreeRTOS.h) */
+/* run time stats, use DWT cycle counter as time base (see bsp_dwt.c / task_monitor.c) */
+#define configUSE_TRACE_FACILITY                 1
+#define configGENERATE_RUN_TIME_STATS            1
+#define configUSE_APPLICATION_TASK_TAG           1
+#define INCLUDE_xTaskGetIdleTaskHandle           1
+
+#if defined(__ICCARM__) || defined(__CC_ARM) || defined(__GNUC__)
+    extern void dwt_init(void);
+    extern uint32_t dwt_get_cycle(void);
+    extern void TaskMonitorTraceReady(void * tag);
+    extern void TaskMonitorTraceSwitchedIn(void * tag);
+#endif
+
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() dwt_init()
+#define portGET_RUN_TIME_COUNTER_VALUE()         dwt_get_cycle()
+
+#define traceMOVED_TASK_TO_READY_STATE( pxTCB )  TaskMonitorTraceReady( ( void * )( pxTCB )->pxTaskTag )
+#define traceTASK_SWITCHED_IN()                  TaskMonitorTraceSwitchedIn( ( void * )pxCurrentTCB->pxTaskTag )
 /* USER CODE END Defines */
 
 #endif /* FREERTOS_CONFIG_H */
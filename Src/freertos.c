@@ -28,12 +28,16 @@
 /* USER CODE BEGIN Includes */
 #include "robot_param.h"
 
+#include "blackbox.h"
+
 #include "chassis_task.h"
 #include "detect_task.h"
 #include "gimbal_task.h"
 #include "IMU_task.h"
 #include "led_flow_task.h"
+#include "mem_pool.h"
 #include "oled_task.h"
+#include "param_store.h"
 #include "referee_usart_task.h"
 #include "usb_task.h"
 #include "voltage_task.h"
@@ -99,6 +103,12 @@ osThreadId ps2_task_handle;
 
 osThreadId battery_voltage_handle;
 
+#if BLACKBOX_ENABLE
+osThreadId blackbox_handle;
+#endif
+
+osThreadId param_store_handle;
+
 
 
 
@@ -195,6 +205,7 @@ void MX_FREERTOS_Init(void) {
 
   /* USER CODE BEGIN RTOS_THREADS */
   /* add threads, ... */
+    // 会在初始化时发布数据的任务先登记，全部初始化完成后冻结内存池
     osThreadDef(DETECT, detect_task, osPriorityNormal, 0, 256);
     detect_handle = osThreadCreate(osThread(DETECT), NULL);
 
@@ -202,26 +213,31 @@ void MX_FREERTOS_Init(void) {
     communication_handle = osThreadCreate(osThread(COMMUNICATION), NULL);
 
 #if (CHASSIS_TYPE != CHASSIS_NONE)
+    mem_pool_init_hold();
     osThreadDef(ChassisTask, chassis_task, osPriorityAboveNormal, 0, 512);
     chassisTaskHandle = osThreadCreate(osThread(ChassisTask), NULL);
 #endif
 
 #if (GIMBAL_TYPE != GIMBAL_NONE)
+    mem_pool_init_hold();
     osThreadDef(gimbalTask, gimbal_task, osPriorityHigh, 0, 512);
     gimbalTaskHandle = osThreadCreate(osThread(gimbalTask), NULL);
 #endif
 
 #if (SHOOT_TYPE != SHOOT_NONE)
+    mem_pool_init_hold();
     osThreadDef(shootTask, shoot_task, osPriorityHigh, 0, 512);
     shootTaskHandle = osThreadCreate(osThread(shootTask), NULL);
 #endif
 
 #if (MECHANICAL_ARM_TYPE != MECHANICAL_ARM_NONE)
+    mem_pool_init_hold();
     osThreadDef(mechanical_armTask, mechanical_arm_task, osPriorityHigh, 0, 512);
     mechanical_armTaskHandle = osThreadCreate(osThread(mechanical_armTask), NULL);
 #endif
 
 #if (CUSTOM_CONTROLLER_TYPE != CUSTOM_CONTROLLER_NONE)
+    mem_pool_init_hold();
     osThreadDef(customControllerTask, custom_controller_task, osPriorityHigh, 0, 512);
     customControllerTaskHandle = osThreadCreate(osThread(customControllerTask), NULL);
 #endif
@@ -235,6 +251,7 @@ void MX_FREERTOS_Init(void) {
 #endif
 
 
+    mem_pool_init_hold();
     osThreadDef(imuTask, IMU_task, osPriorityRealtime, 0, 1024);
     imuTaskHandle = osThreadCreate(osThread(imuTask), NULL);
 
@@ -249,6 +266,7 @@ void MX_FREERTOS_Init(void) {
     osThreadDef(REFEREE, referee_usart_task, osPriorityNormal, 0, 128);
     referee_usart_task_handle = osThreadCreate(osThread(REFEREE), NULL);
 
+    mem_pool_init_hold();
     osThreadDef(USB_Task, usb_task, osPriorityNormal, 0, 128);
     usb_task_handle = osThreadCreate(osThread(USB_Task), NULL);
 
@@ -260,6 +278,14 @@ void MX_FREERTOS_Init(void) {
     osThreadDef(BATTERY_VOLTAGE, battery_voltage_task, osPriorityNormal, 0, 128);
     battery_voltage_handle = osThreadCreate(osThread(BATTERY_VOLTAGE), NULL);
 
+#if BLACKBOX_ENABLE
+    osThreadDef(BLACKBOX, blackbox_task, osPriorityLow, 0, 128);
+    blackbox_handle = osThreadCreate(osThread(BLACKBOX), NULL);
+#endif
+
+    osThreadDef(PARAM_STORE, param_store_task, osPriorityLow, 0, 128);
+    param_store_handle = osThreadCreate(osThread(PARAM_STORE), NULL);
+
 
 
 
@@ -36,9 +36,11 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "blackbox.h"
 #include "bsp_can.h"
 #include "bsp_delay.h"
 #include "bsp_usart.h"
+#include "param_store.h"
 #include "remote_control.h"
 
 #include "chassis_task.h"
@@ -144,6 +146,8 @@ int main(void)
     delay_init();
     remote_control_init();
     usart1_tx_dma_init();
+    ParamStoreInit();
+    BlackboxInit();
   /* USER CODE END 2 */
 
   /* Call init function for freertos objects (in freertos.c) */
@@ -14,10 +14,19 @@
   *  V2.0.0     Nov-11-2019     RM              1. support bmi088, but don't support mpu6500
   *  V3.0.0     Apr-05-2025     Penguin         1. 采用王工开源的陀螺仪EKF解算
   *                                             2. 删除了大量旧代码
+  *  V3.0.1     Oct-19-2026     Penguin         1. 陀螺仪和加速度计零偏从param_store读取
+  *  V3.0.2     Oct-19-2026     Penguin         1. 每次更新后释放到期的控制任务
+  *  V3.0.3     Oct-19-2026     Penguin         1. 添加静止时的陀螺仪零偏校准，结果保存到param_store
+  *  V3.0.4     Oct-19-2026     Penguin         1. 校准结果只请求提交，不在IMU任务中写flash
   *
   @verbatim
   ==============================================================================
-
+    陀螺仪零偏校准：
+      调用 ImuGyroCaliStart() 后，IMU任务累加 GYRO_CALI_COUNT 次陀螺仪数据，
+      期间任一轴超过 GYRO_CALI_MAX_RATE 时认为机器人在动，重新开始累加。
+      完成后将平均值从零偏中扣除后暂存，并调用 ParamCommitRequest() 请求提交，
+      由 param_store_task 在允许时写入flash，写入后新的零偏才生效。
+      IMU任务不写flash，提交完成前再次调用 ImuGyroCaliStart() 无效。
   ==============================================================================
   @endverbatim
   ****************************(C) COPYRIGHT 2025 PolarBear****************************
@@ -32,11 +41,14 @@
 #include "bsp_imu_pwm.h"
 #include "bsp_spi.h"
 #include "cmsis_os.h"
+#include "control_timer.h"
 #include "data_exchange.h"
 #include "detect_task.h"
 #include "ist8310driver.h"
 #include "main.h"
 #include "math.h"
+#include "mem_pool.h"
+#include "param_store.h"
 #include "pid.h"
 #include "robot_param.h"
 #include "usb_debug.h"
@@ -83,6 +95,7 @@ static void imu_rotate(fp32 gyro[3], fp32 accel[3], fp32 mag[3], bmi088_real_dat
 static void board_rotate(fp32 gyro[3], fp32 accel[3]);
 
 static void UpdateImuData(void);
+static void GyroCaliUpdate(const fp32 gyro[3]);
 
 extern SPI_HandleTypeDef hspi1;
 
@@ -128,6 +141,13 @@ static pid_type_def imu_temp_pid;
 
 static const float timing_time = 0.001f;   //tast run time , unit s.任务运行的时间 单位 s
 
+#define GYRO_CALI_COUNT 1000      // 零偏校准的采样次数，约1s
+#define GYRO_CALI_MAX_RATE 0.05f  // (rad/s)零偏校准时允许的最大角速度
+
+static volatile bool_t gyro_cali_request = 0;
+static uint16_t gyro_cali_cnt = 0;
+static fp32 gyro_cali_sum[3];
+
 
 
 
@@ -153,6 +173,7 @@ void IMU_task(void const * pvParameters)
 {
     // 发布IMU数据
     Publish(&IMU_DATA, IMU_NAME);
+    mem_pool_init_release();
 
     // clang-format off
     //wait a time
@@ -224,6 +245,10 @@ void IMU_task(void const * pvParameters)
         
         // rotate
         imu_rotate(INS_gyro, INS_accel, INS_mag, &bmi088_real_data, &ist8310_real_data);
+        if (gyro_cali_request)
+        {
+            GyroCaliUpdate(INS_gyro);
+        }
         board_rotate(INS_gyro, INS_accel);
 
         // 更新加速度
@@ -237,6 +262,8 @@ void IMU_task(void const * pvParameters)
         // clang-format on
 
         UpdateImuData();
+        // 释放到期的控制任务
+        ControlTimerImuUpdate();
     }
 }
 
@@ -255,6 +282,51 @@ static void UpdateImuData(void)
     IMU_DATA.accel[AX_Z] = gVec[AX_Z];
 }
 
+/**
+ * @brief          累加一次陀螺仪数据(安装方向旋转前)，累加完成后暂存零偏并请求提交
+ * @param[in]      gyro 加上当前零偏后的陀螺仪数据
+ * @retval         none
+ */
+static void GyroCaliUpdate(const fp32 gyro[3])
+{
+    for (uint8_t i = 0; i < 3; i++) {
+        if (fabsf(gyro[i]) > GYRO_CALI_MAX_RATE) {
+            gyro_cali_cnt = 0;
+            return;
+        }
+    }
+
+    if (gyro_cali_cnt == 0) {
+        gyro_cali_sum[0] = gyro_cali_sum[1] = gyro_cali_sum[2] = 0.0f;
+    }
+    for (uint8_t i = 0; i < 3; i++) {
+        gyro_cali_sum[i] += gyro[i];
+    }
+    if (++gyro_cali_cnt < GYRO_CALI_COUNT) {
+        return;
+    }
+
+    for (uint8_t i = 0; i < 3; i++) {
+        ParamId_e id = (ParamId_e)(PARAM_GYRO_OFFSET_X + i);
+        ParamSet(id, PARAM(id) - gyro_cali_sum[i] / GYRO_CALI_COUNT);
+    }
+    ParamCommitRequest();  // 提交前零偏保持不变
+    gyro_cali_cnt = 0;
+    gyro_cali_request = 0;
+}
+
+/**
+ * @brief          开始陀螺仪零偏校准，机器人需保持静止约1s，上一次的结果提交前调用无效
+ * @retval         none
+ */
+void ImuGyroCaliStart(void)
+{
+    // 未提交时 PARAM() 仍是旧零偏，再次校准会与暂存的结果重复扣除
+    if (!ParamCommitPending()) {
+        gyro_cali_request = 1;  // 未校准时计数一定为0
+    }
+}
+
 // clang-format off
 
 /**
@@ -270,8 +342,8 @@ static void imu_rotate(fp32 gyro[3], fp32 accel[3], fp32 mag[3], bmi088_real_dat
 {
     for (uint8_t i = 0; i < 3; i++)
     {
-        gyro[i] = bmi088->gyro[0] * gyro_scale_factor[i][0] + bmi088->gyro[1] * gyro_scale_factor[i][1] + bmi088->gyro[2] * gyro_scale_factor[i][2];
-        accel[i] = bmi088->accel[0] * accel_scale_factor[i][0] + bmi088->accel[1] * accel_scale_factor[i][1] + bmi088->accel[2] * accel_scale_factor[i][2];
+        gyro[i] = bmi088->gyro[0] * gyro_scale_factor[i][0] + bmi088->gyro[1] * gyro_scale_factor[i][1] + bmi088->gyro[2] * gyro_scale_factor[i][2] + PARAM(PARAM_GYRO_OFFSET_X + i);
+        accel[i] = bmi088->accel[0] * accel_scale_factor[i][0] + bmi088->accel[1] * accel_scale_factor[i][1] + bmi088->accel[2] * accel_scale_factor[i][2] + PARAM(PARAM_ACCEL_OFFSET_X + i);
         mag[i] = ist8310->mag[0] * mag_scale_factor[i][0] + ist8310->mag[1] * mag_scale_factor[i][1] + ist8310->mag[2] * mag_scale_factor[i][2];
     }
 }
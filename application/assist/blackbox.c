@@ -0,0 +1,260 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       blackbox.c/h
+  * @brief      黑匣子，记录平衡底盘倒地前的控制状态，触发后保存到片内flash
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *  V1.0.1     Oct-19-2026     Penguin         1. 后台任务每ms只写入一个字，原来每ms写入一整帧
+  *
+  @verbatim
+  ==============================================================================
+    写flash时CPU暂停取指，单个字的编程约16us。只有触发后才写flash，
+    后台任务每ms只写入一个字(按 magic、各帧、记录信息的顺序)，控制任务每ms最多被推迟约16us。
+    写满256帧约需3.6s，期间缓冲区冻结，不记录新的帧。
+    擦除扇区会阻塞1~2s，因此只在上电初始化时(任务启动前)进行。
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include "blackbox.h"
+
+#if BLACKBOX_ENABLE
+
+#include <string.h>
+
+#include "bsp_crc32.h"
+#include "bsp_flash.h"
+#include "cmsis_os.h"
+#include "stm32f4xx_hal.h"
+
+#define BLACKBOX_TASK_TIME_MS 1
+
+#define BLACKBOX_HEADER_WORDS (sizeof(BlackboxHeader_t) / 4)
+#define BLACKBOX_FRAME_WORDS (sizeof(BlackboxFrame_t) / 4)
+#define BLACKBOX_FRAME_ADDR (sizeof(BlackboxHeader_t))  // 第一帧在槽位中的偏移
+
+typedef char BlackboxSlotCheck_t
+    [(sizeof(BlackboxHeader_t) + BLACKBOX_FRAME_NUM * sizeof(BlackboxFrame_t) <=
+      BLACKBOX_SLOT_SIZE) &&
+             (sizeof(BlackboxFrame_t) % 4 == 0)
+         ? 1
+         : -1];
+
+typedef enum {
+    BLACKBOX_RECORDING = 0,  // 正常记录
+    BLACKBOX_POST_TRIGGER,   // 已触发，记录触发后的帧
+    BLACKBOX_FLUSHING,       // 缓冲区已冻结，正在写入flash
+    BLACKBOX_FULL,           // flash已写满，停止记录
+} BlackboxState_e;
+
+#define BLACKBOX_SCALE_VALUE(name, scale) scale,
+static const float CHANNEL_SCALE[BLACKBOX_CHANNEL_NUM] = {
+    BLACKBOX_CHANNEL_LIST(BLACKBOX_SCALE_VALUE)};
+#undef BLACKBOX_SCALE_VALUE
+
+static BlackboxFrame_t RING[BLACKBOX_FRAME_NUM];
+static uint16_t HEAD = 0;   // 下一帧写入位置
+static uint16_t COUNT = 0;  // 有效帧数
+static uint8_t DECIMATION_CNT = 0;
+static uint16_t POST_COUNT = 0;
+
+static volatile BlackboxState_e STATE = BLACKBOX_FULL;
+static uint8_t REASON = BLACKBOX_TRIGGER_NONE;
+static uint32_t TRIGGER_TIME = 0;
+
+static uint32_t SLOT_ADDR = 0;   // 当前使用的槽位地址
+static uint32_t FLUSH_WORD = 0;  // 已写入flash的字数，0为magic，之后为各帧和记录信息
+
+/*-------------------- Private functions --------------------*/
+
+/**
+ * @brief          寻找第一个未使用的槽位
+ * @param[in]      start 开始搜索的槽位地址
+ * @retval         槽位地址，没有空闲槽位时返回0
+ */
+static uint32_t FindFreeSlot(uint32_t start)
+{
+    for (uint32_t addr = start; addr < BLACKBOX_SECTOR_ADDR + BLACKBOX_SECTOR_SIZE;
+         addr += BLACKBOX_SLOT_SIZE) {
+        if (*(volatile uint32_t *)addr == 0xFFFFFFFF) {
+            return addr;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief          写入一个字。先写入magic占用槽位，再写入各帧，最后写入完整的记录信息(crc在最后)
+ * @retval         全部写入完成返回1
+ */
+static bool_t FlushStep(void)
+{
+    uint32_t frame_words = (uint32_t)COUNT * BLACKBOX_FRAME_WORDS;
+    uint32_t word;
+    uint32_t addr;
+
+    if (FLUSH_WORD == 0) {
+        word = BLACKBOX_MAGIC;
+        addr = SLOT_ADDR;
+    } else if (FLUSH_WORD <= frame_words) {
+        uint32_t n = FLUSH_WORD - 1;
+        uint16_t frame = n / BLACKBOX_FRAME_WORDS;
+        uint16_t index = (HEAD + BLACKBOX_FRAME_NUM - COUNT + frame) % BLACKBOX_FRAME_NUM;
+        word = ((const uint32_t *)&RING[index])[n % BLACKBOX_FRAME_WORDS];
+        addr = SLOT_ADDR + BLACKBOX_FRAME_ADDR + n * 4;
+    } else {
+        // magic已经写入，从第二个字开始
+        uint32_t n = FLUSH_WORD - frame_words;
+        BlackboxHeader_t header = {
+            .magic = BLACKBOX_MAGIC,
+            .version = BLACKBOX_VERSION,
+            .reason = REASON,
+            .channel_num = BLACKBOX_CHANNEL_NUM,
+            .frame_size = sizeof(BlackboxFrame_t),
+            .frame_num = COUNT,
+            .trigger_time = TRIGGER_TIME,
+            .reserved = {0},
+            .crc = 0,
+        };
+        append_crc32_check_sum((uint32_t *)&header, BLACKBOX_HEADER_WORDS);
+        word = ((const uint32_t *)&header)[n];
+        addr = SLOT_ADDR + n * 4;
+    }
+
+    flash_write_single_address(addr, &word, 1);
+    FLUSH_WORD++;
+    return FLUSH_WORD >= frame_words + BLACKBOX_HEADER_WORDS;
+}
+
+/**
+ * @brief          一次记录写入完成，切换到下一个槽位并重新开始记录
+ */
+static void FlushDone(void)
+{
+    SLOT_ADDR = FindFreeSlot(SLOT_ADDR + BLACKBOX_SLOT_SIZE);
+    HEAD = 0;
+    COUNT = 0;
+    FLUSH_WORD = 0;
+    STATE = (SLOT_ADDR == 0) ? BLACKBOX_FULL : BLACKBOX_RECORDING;
+}
+
+/*-------------------- Public functions --------------------*/
+
+/**
+ * @brief          查找空闲槽位，没有时擦除整个扇区，需在任务启动前调用
+ * @retval         none
+ */
+void BlackboxInit(void)
+{
+    SLOT_ADDR = FindFreeSlot(BLACKBOX_SECTOR_ADDR);
+    if (SLOT_ADDR == 0) {
+        if (flash_erase_address(BLACKBOX_SECTOR_ADDR, 1) != 0) {
+            STATE = BLACKBOX_FULL;  // 擦除失败时不记录，避免写入未擦除的flash
+            return;
+        }
+        SLOT_ADDR = BLACKBOX_SECTOR_ADDR;
+    }
+    HEAD = 0;
+    COUNT = 0;
+    FLUSH_WORD = 0;
+    STATE = BLACKBOX_RECORDING;
+}
+
+/**
+ * @brief          按通道比例转换并限幅后写入帧
+ * @param[out]     frame 帧
+ * @param[in]      channel 通道
+ * @param[in]      value 物理量
+ * @retval         none
+ */
+void BlackboxSet(BlackboxFrame_t * frame, BlackboxChannel_e channel, float value)
+{
+    float raw = value * CHANNEL_SCALE[channel];
+    if (raw > 32767.0f) {
+        raw = 32767.0f;
+    } else if (raw < -32768.0f) {
+        raw = -32768.0f;
+    }
+    frame->data[channel] = (int16_t)raw;
+}
+
+/**
+ * @brief          记录一帧，在控制任务中每个周期调用
+ * @param[in]      frame 帧
+ * @retval         none
+ */
+void BlackboxRecord(const BlackboxFrame_t * frame)
+{
+    if (STATE != BLACKBOX_RECORDING && STATE != BLACKBOX_POST_TRIGGER) {
+        return;
+    }
+    if (++DECIMATION_CNT < BLACKBOX_DECIMATION) {
+        return;
+    }
+    DECIMATION_CNT = 0;
+
+    RING[HEAD] = *frame;
+    HEAD = (HEAD + 1) % BLACKBOX_FRAME_NUM;
+    if (COUNT < BLACKBOX_FRAME_NUM) {
+        COUNT++;
+    }
+
+    if (STATE == BLACKBOX_POST_TRIGGER && --POST_COUNT == 0) {
+        STATE = BLACKBOX_FLUSHING;
+    }
+}
+
+/**
+ * @brief          触发一次记录，正在保存上一次记录时忽略
+ * @param[in]      reason 触发原因
+ * @retval         none
+ */
+void BlackboxTrigger(BlackboxTrigger_e reason)
+{
+    if (STATE != BLACKBOX_RECORDING || COUNT == 0) {
+        return;
+    }
+    REASON = reason;
+    TRIGGER_TIME = HAL_GetTick();
+    POST_COUNT = BLACKBOX_POST_FRAMES;
+    STATE = BLACKBOX_POST_TRIGGER;
+}
+
+/**
+ * @brief          在HardFault中调用，立即冻结缓冲区并同步写入flash
+ * @retval         none
+ */
+void BlackboxFaultDump(void)
+{
+    if (STATE == BLACKBOX_FULL || COUNT == 0) {
+        return;
+    }
+    if (STATE != BLACKBOX_FLUSHING) {
+        REASON = BLACKBOX_TRIGGER_HARD_FAULT;
+        TRIGGER_TIME = HAL_GetTick();
+        STATE = BLACKBOX_FLUSHING;
+    }
+    while (!FlushStep()) {
+    }
+    STATE = BLACKBOX_FULL;
+}
+
+/**
+ * @brief          黑匣子任务，在后台将冻结的缓冲区每ms一个字写入flash
+ * @param[in]      pvParameters: 空
+ * @retval         none
+ */
+void blackbox_task(void const * pvParameters)
+{
+    while (1) {
+        if (STATE == BLACKBOX_FLUSHING && FlushStep()) {
+            FlushDone();
+        }
+        osDelay(BLACKBOX_TASK_TIME_MS);
+    }
+}
+
+#endif  // BLACKBOX_ENABLE
+/*------------------------------ End of File ------------------------------*/
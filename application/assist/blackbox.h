@@ -0,0 +1,126 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       blackbox.c/h
+  * @brief      黑匣子，记录平衡底盘倒地前的控制状态，触发后保存到片内flash
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *  V1.0.1     Oct-19-2026     Penguin         1. 后台任务每ms只写入一个字
+  *
+  @verbatim
+  ==============================================================================
+    使用方法：
+    1. 控制任务每个周期填写一帧 BlackboxFrame_t，调用 BlackboxRecord 写入RAM环形缓冲区
+    2. 发生异常时调用 BlackboxTrigger，再记录 BLACKBOX_POST_FRAMES 帧后冻结缓冲区，
+       由 blackbox_task 在后台每ms写入一个字到 sector 9，控制任务每ms最多被推迟约16us
+    3. HardFault 中调用 BlackboxFaultDump 直接同步写入
+    4. 用调试器读出 sector 9(0x080A0000, 128KB)，
+       使用 application/assist/tools/blackbox_decode.c 转换为csv
+    sector 9 可保存 BLACKBOX_SLOT_NUM 次记录，写满后在下次上电时擦除
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#ifndef BLACKBOX_H
+#define BLACKBOX_H
+
+#ifndef BLACKBOX_ENABLE
+#include "robot_param.h"
+#define BLACKBOX_ENABLE (CHASSIS_TYPE == CHASSIS_BALANCE)
+#endif
+
+#include "struct_typedef.h"
+
+#define BLACKBOX_FRAME_NUM 256   // 环形缓冲区帧数
+#define BLACKBOX_DECIMATION 2    // 每隔几次调用记录一帧
+#define BLACKBOX_POST_FRAMES 32  // 触发后继续记录的帧数
+
+#define BLACKBOX_SECTOR_ADDR ((uint32_t)0x080A0000)  // sector 9
+#define BLACKBOX_SECTOR_SIZE ((uint32_t)0x20000)
+#define BLACKBOX_SLOT_SIZE ((uint32_t)0x4000)
+#define BLACKBOX_SLOT_NUM (BLACKBOX_SECTOR_SIZE / BLACKBOX_SLOT_SIZE)
+#define BLACKBOX_MAGIC ((uint32_t)0x58424B42)  // "BKBX"
+#define BLACKBOX_VERSION 1
+
+// clang-format off
+// X(通道名, 比例)，flash中保存的值为 int16(物理量 * 比例)
+#define BLACKBOX_CHANNEL_LIST(X)       \
+    X(THETA_L,        10000)           \
+    X(THETA_DOT_L,    1000)            \
+    X(X_L,            1000)            \
+    X(X_DOT_L,        1000)            \
+    X(PHI_L,          10000)           \
+    X(PHI_DOT_L,      1000)            \
+    X(THETA_R,        10000)           \
+    X(THETA_DOT_R,    1000)            \
+    X(X_R,            1000)            \
+    X(X_DOT_R,        1000)            \
+    X(PHI_R,          10000)           \
+    X(PHI_DOT_R,      1000)            \
+    X(L0_L,           10000)           \
+    X(L0_R,           10000)           \
+    X(JOINT_T0,       500)             \
+    X(JOINT_T1,       500)             \
+    X(JOINT_T2,       500)             \
+    X(JOINT_T3,       500)             \
+    X(WHEEL_T_L,      1000)            \
+    X(WHEEL_T_R,      1000)            \
+    X(ROLL,           10000)           \
+    X(PITCH,          10000)           \
+    X(YAW,            10000)           \
+    X(PITCH_DOT,      1000)
+// clang-format on
+
+#define BLACKBOX_CHANNEL_ENUM(name, scale) BLACKBOX_##name,
+typedef enum {
+    BLACKBOX_CHANNEL_LIST(BLACKBOX_CHANNEL_ENUM)
+    BLACKBOX_CHANNEL_NUM
+} BlackboxChannel_e;
+#undef BLACKBOX_CHANNEL_ENUM
+
+typedef enum {
+    BLACKBOX_TRIGGER_NONE = 0,
+    BLACKBOX_TRIGGER_SAFE,           // 进入CHASSIS_SAFE
+    BLACKBOX_TRIGGER_TAKE_OFF,       // 离地
+    BLACKBOX_TRIGGER_MOTOR_OFFLINE,  // 电机离线
+    BLACKBOX_TRIGGER_HARD_FAULT,     // HardFault
+} BlackboxTrigger_e;
+
+typedef struct
+{
+    uint32_t time;        // (ms)
+    uint8_t mode;         // 底盘模式
+    int8_t step;          // 底盘运行步骤号
+    uint16_t online;      // 电机在线标志，bit0-3关节电机，bit4-5驱动轮电机
+    int16_t data[BLACKBOX_CHANNEL_NUM];
+} BlackboxFrame_t;
+
+// 每个槽位开头的记录信息，magic最先写入表示槽位已占用，crc最后写入表示记录完整
+typedef struct
+{
+    uint32_t magic;
+    uint16_t version;
+    uint8_t reason;       // BlackboxTrigger_e
+    uint8_t channel_num;
+    uint16_t frame_size;  // (byte)
+    uint16_t frame_num;
+    uint32_t trigger_time;  // (ms)
+    uint32_t reserved[3];
+    uint32_t crc;  // 前7个字的crc32
+} BlackboxHeader_t;
+
+#if BLACKBOX_ENABLE
+extern void BlackboxInit(void);
+extern void BlackboxSet(BlackboxFrame_t * frame, BlackboxChannel_e channel, float value);
+extern void BlackboxRecord(const BlackboxFrame_t * frame);
+extern void BlackboxTrigger(BlackboxTrigger_e reason);
+extern void BlackboxFaultDump(void);
+extern void blackbox_task(void const * pvParameters);
+#else
+#define BlackboxInit()
+#define BlackboxFaultDump()
+#endif
+
+#endif  // BLACKBOX_H
+/*------------------------------ End of File ------------------------------*/
@@ -0,0 +1,115 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       clock_sync.c/h
+  * @brief      两块板之间的时钟同步，由双向时间戳估计对方时钟的偏移和漂移
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include "clock_sync.h"
+
+#include "math.h"
+#include "string.h"
+
+#define CLOCK_SYNC_MAX_DELAY 5000.0f   // (us)往返延迟超过该值的测量直接丢弃
+#define CLOCK_SYNC_DELAY_GATE 30.0f    // (us)往返延迟超出最小值的允许量
+#define CLOCK_SYNC_DELAY_LEAK 0.05f    // (us/次)往返延迟最小值每次测量上浮的量
+#define CLOCK_SYNC_KP 0.1f             // 偏移修正增益
+#define CLOCK_SYNC_KI 0.002f           // 漂移修正增益
+#define CLOCK_SYNC_MAX_SKEW 5e-4f      // 晶振频率差的上限(500ppm)
+#define CLOCK_SYNC_JITTER_ALPHA 0.95f
+
+/**
+ * @brief          初始化
+ * @param[out]     cs 同步状态
+ * @retval         none
+ */
+void ClockSyncInit(ClockSync_s * cs) { memset(cs, 0, sizeof(ClockSync_s)); }
+
+/**
+ * @brief          加入一次双向测量
+ * @param[in,out]  cs 同步状态
+ * @param[in]      t1 (us,本板)发出时刻
+ * @param[in]      t2 (us,对方)收到时刻
+ * @param[in]      t3 (us,对方)回复时刻
+ * @param[in]      t4 (us,本板)收到回复时刻
+ * @retval         none
+ */
+void ClockSyncUpdate(ClockSync_s * cs, uint32_t t1, uint32_t t2, uint32_t t3, uint32_t t4)
+{
+    fp32 delay = (fp32)(int32_t)(t4 - t1) - (fp32)(int32_t)(t3 - t2);
+    cs->delay = delay;
+    if (delay < 0.0f || delay > CLOCK_SYNC_MAX_DELAY) {
+        cs->reject++;
+        return;
+    }
+
+    if (!cs->synced) {
+        // 第一次测量，偏移的整数部分作为基准
+        cs->base = (int32_t)(t2 - t1) / 2 + (int32_t)(t3 - t4) / 2;
+        cs->offset = 0.5f * ((fp32)(int32_t)(t2 - t1 - cs->base) +
+                             (fp32)(int32_t)(t3 - t4 - cs->base));
+        cs->skew = 0.0f;
+        cs->t_ref = t4;
+        cs->delay_min = delay;
+        cs->jitter = 0.0f;
+        cs->count = 1;
+        cs->synced = 1;
+        return;
+    }
+
+    cs->delay_min = fminf(cs->delay_min + CLOCK_SYNC_DELAY_LEAK, delay);
+    if (delay > cs->delay_min + CLOCK_SYNC_DELAY_GATE) {
+        cs->reject++;
+        return;
+    }
+
+    // 相对基准的测量值，(t - base)先按整数计算，避免大偏移损失浮点精度
+    fp32 theta =
+        0.5f * ((fp32)(int32_t)(t2 - t1 - cs->base) + (fp32)(int32_t)(t3 - t4 - cs->base));
+    fp32 dt = (fp32)(int32_t)(t4 - cs->t_ref);
+    fp32 predict = cs->offset + cs->skew * dt;
+    fp32 err = theta - predict;
+
+    cs->offset = predict + CLOCK_SYNC_KP * err;
+    if (dt > 0.0f) {
+        cs->skew += CLOCK_SYNC_KI * err / dt;
+        if (cs->skew > CLOCK_SYNC_MAX_SKEW) cs->skew = CLOCK_SYNC_MAX_SKEW;
+        if (cs->skew < -CLOCK_SYNC_MAX_SKEW) cs->skew = -CLOCK_SYNC_MAX_SKEW;
+    }
+    cs->t_ref = t4;
+
+    // 整数部分移入基准
+    int32_t whole = (int32_t)cs->offset;
+    cs->base += whole;
+    cs->offset -= (fp32)whole;
+
+    cs->jitter =
+        CLOCK_SYNC_JITTER_ALPHA * cs->jitter + (1.0f - CLOCK_SYNC_JITTER_ALPHA) * fabsf(err);
+    cs->count++;
+}
+
+/**
+ * @brief          本板时刻换算为对方时钟
+ * @param[in]      cs 同步状态
+ * @param[in]      local_us (us,本板)时刻
+ * @retval         (us,对方)时刻，未同步时原样返回
+ */
+uint32_t ClockSyncToPeer(const ClockSync_s * cs, uint32_t local_us)
+{
+    if (!cs->synced) {
+        return local_us;
+    }
+    fp32 dt = (fp32)(int32_t)(local_us - cs->t_ref);
+    int32_t offset = (int32_t)floorf(cs->offset + cs->skew * dt + 0.5f);
+    return local_us + (uint32_t)(cs->base + offset);
+}
+/*------------------------------ End of File ------------------------------*/
@@ -0,0 +1,52 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       clock_sync.c/h
+  * @brief      两块板之间的时钟同步，由双向时间戳估计对方时钟的偏移和漂移
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+    时间戳(均为us，各自的本地时钟)：
+      t1 本板发出某一帧的时刻        t2 对方收到该帧的时刻
+      t3 对方发出回复帧的时刻        t4 本板收到回复帧的时刻
+    一次测量(NTP)：
+      delay  = (t4 - t1) - (t3 - t2)
+      offset = ((t2 - t1) + (t3 - t4)) / 2，即 对方时钟 - 本板时钟
+    过滤：
+      delay 超过其最小值 CLOCK_SYNC_DELAY_GATE 的测量含有排队延迟，只统计不使用；
+      偏移和漂移用二阶锁相环(PI)跟踪，漂移即两块晶振的频率差。
+    换算：
+      ClockSyncToPeer(local) = local + offset + skew * (local - t_ref)
+    偏移的整数部分单独保存，32位时间戳回绕和两块板上电时间相差很大时精度不受影响。
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#ifndef CLOCK_SYNC_H
+#define CLOCK_SYNC_H
+#include "struct_typedef.h"
+
+typedef struct
+{
+    bool_t synced;      // 已完成第一次测量
+    int32_t base;       // (us)偏移的整数部分
+    fp32 offset;        // (us)t_ref时刻偏移的其余部分
+    fp32 skew;          // 对方时钟相对本板时钟的频率差
+    uint32_t t_ref;     // (us)本板时钟，最近一次使用的测量的t4
+
+    fp32 delay;         // (us)最近一次测量的往返延迟
+    fp32 delay_min;     // (us)往返延迟的最小值，缓慢上浮
+    fp32 jitter;        // (us)偏移测量残差绝对值的EWMA
+    uint32_t count;     // 使用的测量次数
+    uint32_t reject;    // 因延迟过大丢弃的测量次数
+} ClockSync_s;
+
+extern void ClockSyncInit(ClockSync_s * cs);
+extern void ClockSyncUpdate(ClockSync_s * cs, uint32_t t1, uint32_t t2, uint32_t t3, uint32_t t4);
+extern uint32_t ClockSyncToPeer(const ClockSync_s * cs, uint32_t local_us);
+
+#endif  // CLOCK_SYNC_H
+/*------------------------------ End of File ------------------------------*/
@@ -0,0 +1,232 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       control_timer.c/h
+  * @brief      控制任务的节拍同步调度，保证各控制任务严格按周期和相位释放，并提供高分辨率dt
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *  V1.1.0     Oct-19-2026     Penguin         1. 按IMU更新释放，底盘和云台按固定顺序运行
+  *
+  @verbatim
+  ==============================================================================
+    释放方式：
+      IMU运行时，IMU任务每完成一次更新调用 ControlTimerImuUpdate，到期的控制任务由此释放，
+      控制周期和相位以IMU更新次数计(CONTROL_TIMER_IMU_RATE 为1kHz时与ms相同)。
+      CONTROL_CHAIN 中的任务在同一次IMU更新中都到期时按表中顺序依次释放，前一级进入
+      ControlTimerWait 时释放后一级，实现 IMU -> 底盘 -> 云台 的顺序。
+      超过 CONTROL_TIMER_IMU_TIMEOUT 没有IMU更新时(IMU未启动或故障)，回到基于 vTaskDelayUntil
+      的系统tick释放，控制任务不会因IMU停止而停止。
+    dt 由DWT周期计数器测量，分辨率为 1/168MHz。
+    任务执行时间超过一个周期时记为一次超时，跳过错过的释放点，不连续地追赶。
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include "control_timer.h"
+
+#include "bsp_dwt.h"
+#include "cmsis_os.h"
+#include "task_monitor.h"
+
+#define CONTROL_TIMER_IMU_RATE 1000  // (Hz)IMU更新频率，与陀螺仪输出频率相同
+#define CONTROL_TIMER_IMU_TIMEOUT 2  // (tick)超过该时间没有IMU更新时按系统tick释放
+
+typedef struct
+{
+    TaskHandle_t task;        // 控制任务，未初始化时为NULL
+    TickType_t last_wake;     // (tick)上次释放时刻
+    TickType_t period;        // (tick)释放周期
+    uint32_t imu_period;      // (IMU更新次数)释放周期
+    uint32_t imu_phase;       // (IMU更新次数)相位偏移
+    uint8_t pending;          // 已到期，等待链上前一级完成后释放
+    uint32_t last_cycle;      // (cycle)上次实际开始运行的时刻
+    fp32 dt;                  // (s)上一周期实际时长
+    uint32_t miss;            // 超时次数
+} ControlTimer_t;
+
+static ControlTimer_t CONTROL_TIMER[CONTROL_TIMER_NUM];
+
+// 同一次IMU更新中按此顺序释放
+static const ControlTimerId_e CONTROL_CHAIN[] = {CONTROL_TIMER_CHASSIS, CONTROL_TIMER_GIMBAL};
+#define CONTROL_CHAIN_LEN (sizeof(CONTROL_CHAIN) / sizeof(CONTROL_CHAIN[0]))
+
+static volatile uint32_t IMU_COUNT = 0;     // IMU更新次数
+static volatile TickType_t IMU_TICK = 0;    // (tick)最近一次IMU更新的时刻
+static volatile uint8_t IMU_RUNNING = 0;
+
+/**
+ * @brief          控制任务是否在本次IMU更新到期
+ * @param[in]      timer 控制定时器
+ * @param[in]      count IMU更新次数
+ * @retval         是否到期
+ */
+static bool_t ImuDue(const ControlTimer_t * timer, uint32_t count)
+{
+    return timer->task != NULL && count % timer->imu_period == timer->imu_phase;
+}
+
+/**
+ * @brief          控制任务在链中的位置
+ * @param[in]      id 定时器id
+ * @retval         序号，不在链中时为 CONTROL_CHAIN_LEN
+ */
+static uint8_t ChainIndex(ControlTimerId_e id)
+{
+    uint8_t i;
+    for (i = 0; i < CONTROL_CHAIN_LEN; i++) {
+        if (CONTROL_CHAIN[i] == id) {
+            break;
+        }
+    }
+    return i;
+}
+
+/**
+ * @brief          链上一级完成后释放等待中的下一级
+ * @param[in]      id 刚完成的定时器id
+ * @retval         none
+ */
+static void ChainReleaseNext(ControlTimerId_e id)
+{
+    uint8_t i = ChainIndex(id);
+    ControlTimer_t * next;
+
+    for (i++; i < CONTROL_CHAIN_LEN; i++) {
+        next = &CONTROL_TIMER[CONTROL_CHAIN[i]];
+        taskENTER_CRITICAL();
+        if (next->pending) {
+            next->pending = 0;
+            taskEXIT_CRITICAL();
+            xTaskNotifyGive(next->task);
+            return;
+        }
+        taskEXIT_CRITICAL();
+    }
+}
+
+/**
+ * @brief          初始化控制定时器，将释放时刻对齐到 周期整数倍 + 相位偏移
+ * @param[in]      id 定时器id
+ * @param[in]      period_ms 控制周期
+ * @param[in]      phase_ms 相位偏移，取值 [0, period_ms)
+ * @retval         none
+ */
+void ControlTimerInit(ControlTimerId_e id, uint32_t period_ms, uint32_t phase_ms)
+{
+    ControlTimer_t * timer = &CONTROL_TIMER[id];
+    TickType_t now = xTaskGetTickCount();
+
+    timer->period = pdMS_TO_TICKS(period_ms);
+    if (timer->period == 0) {
+        timer->period = 1;
+    }
+
+    timer->last_wake = now - now % timer->period + pdMS_TO_TICKS(phase_ms) % timer->period;
+    // vTaskDelayUntil 要求上次释放时刻不晚于当前时刻
+    if (timer->last_wake > now) {
+        timer->last_wake -= timer->period;
+    }
+
+    timer->imu_period = period_ms * CONTROL_TIMER_IMU_RATE / 1000;
+    if (timer->imu_period == 0) {
+        timer->imu_period = 1;
+    }
+    timer->imu_phase = phase_ms * CONTROL_TIMER_IMU_RATE / 1000 % timer->imu_period;
+    timer->pending = 0;
+
+    timer->last_cycle = dwt_get_cycle();
+    timer->dt = period_ms * 0.001f;
+    timer->miss = 0;
+    timer->task = xTaskGetCurrentTaskHandle();
+}
+
+/**
+ * @brief          IMU完成一次更新，释放到期的控制任务，在IMU任务中调用
+ * @retval         none
+ */
+void ControlTimerImuUpdate(void)
+{
+    uint32_t count = ++IMU_COUNT;
+    bool_t chain_released = 0;
+    ControlTimer_t * timer;
+    uint8_t i;
+
+    IMU_TICK = xTaskGetTickCount();
+    IMU_RUNNING = 1;
+
+    // 链上第一个到期的任务直接释放，其余的等待前一级完成
+    for (i = 0; i < CONTROL_CHAIN_LEN; i++) {
+        timer = &CONTROL_TIMER[CONTROL_CHAIN[i]];
+        if (!ImuDue(timer, count)) {
+            continue;
+        }
+        if (chain_released) {
+            taskENTER_CRITICAL();
+            timer->pending = 1;
+            taskEXIT_CRITICAL();
+        } else {
+            chain_released = 1;
+            xTaskNotifyGive(timer->task);
+        }
+    }
+
+    for (i = 0; i < CONTROL_TIMER_NUM; i++) {
+        timer = &CONTROL_TIMER[i];
+        if (ChainIndex((ControlTimerId_e)i) == CONTROL_CHAIN_LEN && ImuDue(timer, count)) {
+            xTaskNotifyGive(timer->task);
+        }
+    }
+}
+
+/**
+ * @brief          等待到下一个释放时刻，并更新dt，替代循环末尾的 vTaskDelay
+ * @param[in]      id 定时器id
+ * @retval         none
+ */
+void ControlTimerWait(ControlTimerId_e id)
+{
+    ControlTimer_t * timer = &CONTROL_TIMER[id];
+    TickType_t now = xTaskGetTickCount();
+    uint32_t cycle;
+
+    ChainReleaseNext(id);
+
+    if (IMU_RUNNING && now - IMU_TICK <= CONTROL_TIMER_IMU_TIMEOUT) {
+        // 本周期运行期间已经到了下一个释放点，跳过，等待之后的释放点
+        if (ulTaskNotifyTake(pdTRUE, 0) > 0) {
+            timer->miss++;
+            TaskMonitorDeadlineMiss();
+        }
+        ulTaskNotifyTake(pdTRUE, timer->period + CONTROL_TIMER_IMU_TIMEOUT);
+        timer->last_wake = xTaskGetTickCount();
+    } else {
+        TickType_t elapsed = now - timer->last_wake;
+        if (elapsed > timer->period) {
+            // 已错过下一个释放点，跳过错过的周期，保持相位不变
+            timer->miss++;
+            TaskMonitorDeadlineMiss();
+            timer->last_wake = now - elapsed % timer->period;
+        }
+        vTaskDelayUntil(&timer->last_wake, timer->period);
+    }
+
+    cycle = dwt_get_cycle();
+    timer->dt = dwt_cycle_to_s(cycle - timer->last_cycle);
+    timer->last_cycle = cycle;
+}
+
+/**
+ * @brief          获取上一控制周期的实际时长
+ * @param[in]      id 定时器id
+ * @retval         (s)dt
+ */
+fp32 GetControlDt(ControlTimerId_e id) { return CONTROL_TIMER[id].dt; }
+
+/**
+ * @brief          获取控制任务的累计超时次数
+ * @param[in]      id 定时器id
+ * @retval         超时次数
+ */
+uint32_t GetControlDeadlineMiss(ControlTimerId_e id) { return CONTROL_TIMER[id].miss; }
+/*------------------------------ End of File ------------------------------*/
@@ -0,0 +1,49 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       control_timer.c/h
+  * @brief      控制任务的节拍同步调度，保证各控制任务严格按周期和相位释放，并提供高分辨率dt
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *  V1.1.0     Oct-19-2026     Penguin         1. 按IMU更新释放，底盘和云台按固定顺序运行
+  *
+  @verbatim
+  ==============================================================================
+    使用方法：
+    1. 在任务进入循环前调用 ControlTimerInit(id, 周期ms, 相位ms)
+    2. 用 ControlTimerWait(id) 替换循环末尾的 vTaskDelay
+    3. 模块中通过 GetControlDt(id) 获取上一周期的实际时长(s)
+
+    4. IMU任务每完成一次更新调用 ControlTimerImuUpdate()
+
+    释放顺序：
+    IMU运行时，控制任务在IMU更新完成后按 周期整数倍 + 相位偏移 释放，
+    同一次更新中到期的底盘和云台按 IMU -> 底盘 -> 云台 的顺序依次运行，
+    其余控制任务按优先级运行。IMU未运行时按系统tick释放。
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#ifndef CONTROL_TIMER_H
+#define CONTROL_TIMER_H
+#include "struct_typedef.h"
+
+typedef enum {
+    CONTROL_TIMER_CHASSIS = 0,
+    CONTROL_TIMER_GIMBAL,
+    CONTROL_TIMER_SHOOT,
+    CONTROL_TIMER_MECHANICAL_ARM,
+    CONTROL_TIMER_CUSTOM_CONTROLLER,
+    CONTROL_TIMER_NUM,
+} ControlTimerId_e;
+
+extern void ControlTimerInit(ControlTimerId_e id, uint32_t period_ms, uint32_t phase_ms);
+extern void ControlTimerWait(ControlTimerId_e id);
+extern void ControlTimerImuUpdate(void);
+
+extern fp32 GetControlDt(ControlTimerId_e id);
+extern uint32_t GetControlDeadlineMiss(ControlTimerId_e id);
+
+#endif  // CONTROL_TIMER_H
+/*------------------------------ End of File ------------------------------*/
@@ -5,6 +5,7 @@
   * @history
   *  Version    Date            Author          Modification
   *  V1.0.0     May-22-2024     Penguin         1. 完成。
+  *  V1.0.1     Oct-19-2026     Penguin         1. 使用内存池代替malloc
   *
   @verbatim
   ==============================================================================
@@ -17,7 +18,7 @@
 #include "data_exchange.h"
 
 #include "clist.h"
-#include "stdlib.h"
+#include "mem_pool.h"
 #include "string.h"
 
 #define DATA_LIST_LEN 10
@@ -56,7 +57,10 @@ uint8_t Publish(void * address, char * name)
     }
 
     // 保存数据
-    Data_t * data = (Data_t *)malloc(sizeof(Data_t));
+    Data_t * data = (Data_t *)mem_pool_alloc(sizeof(Data_t));
+    if (data == NULL) {
+        return PUBLISH_ALREADY_FULL;
+    }
     memcpy(&data->data_address, &address, 4);
     memcpy(data->data_name, name, NAME_LEN);
     USED_LEN++;
@@ -9,6 +9,9 @@
   *  Version    Date            Author          Modification
   *  V1.0.0     Dec-26-2018     RM              1. done
   *  V1.1.0     Nov-11-2019     RM              1. add oled, gyro accel and mag sensors
+  *  V1.2.0     Oct-19-2026     Penguin         1. deadline driven, error bitmask, receive rate EWMA
+  *  V1.2.1     Oct-19-2026     Penguin         1. deadline wheel, only expired slots are visited
+  *  V1.2.2     Oct-19-2026     Penguin         1. check at compile time that the list fits the mask
   *
   @verbatim
   ==============================================================================
@@ -51,9 +54,12 @@
   */
   
 #include "detect_task.h"
+#include "bsp_dwt.h"
 #include "cmsis_os.h"
 #include "robot_param.h"
 #include "communication.h"
+#include "string.h"
+#include "task_monitor.h"
 
 /**
   * @brief          init error_list, assign  offline_time, online_time, priority.
@@ -67,10 +73,30 @@
   */
 static void detect_init(uint32_t time);
 
+static void detect_arm(uint8_t toe, uint32_t deadline);
+static void detect_disarm(uint8_t toe);
+static void detect_expire(uint8_t toe, uint32_t time);
+static uint32_t detect_next_wake(uint32_t time);
 
 
+//deadline wheel, one slot per tick, must be 32 so that the busy slots fit in a word
+//截止时间轮，每个槽对应1个tick，槽数必须为32，非空槽用一个字的位表示
+#define DETECT_WHEEL_SIZE 32
+#define DETECT_WHEEL_MASK (DETECT_WHEEL_SIZE - 1)
 
 error_t error_list[ERROR_LIST_LENGHT + 1];
+static volatile uint32_t ERROR_MASK = 0;
+
+//one bit of ERROR_MASK per device, fails to compile past 32 (ARMCC C99 has no _Static_assert)
+//ERROR_MASK每个设备占一位，设备数超过32时编译报错(ARMCC的C99模式没有_Static_assert)
+typedef char ERROR_MASK_CHECK[(ERROR_LIST_LENGHT <= 32) ? 1 : -1];
+
+//bit n of DETECT_WHEEL[s] set means the deadline of device n falls in slot s
+//DETECT_WHEEL[s]的第n位为1表示设备n的截止时间落在槽s
+static volatile uint32_t DETECT_WHEEL[DETECT_WHEEL_SIZE];
+static volatile uint32_t WHEEL_BUSY = 0;
+static volatile uint32_t ARMED_MASK = 0;
+static uint8_t DETECT_SLOT[ERROR_LIST_LENGHT];
 
 
 #if INCLUDE_uxTaskGetStackHighWaterMark
@@ -91,94 +117,185 @@ uint32_t detect_task_stack;
 void detect_task(void const *pvParameters)
 {
     static uint32_t system_time;
+    uint32_t last_time, time, due;
     system_time = xTaskGetTickCount();
     //init,初始化
     detect_init(system_time);
     //wait a time.空闲一段时间
     vTaskDelay(DETECT_TASK_INIT_TIME);
+    last_time = system_time;
 
     while (1)
     {
-        static uint8_t error_num_display = 0;
         system_time = xTaskGetTickCount();
 
-        error_num_display = ERROR_LIST_LENGHT;
-        error_list[ERROR_LIST_LENGHT].is_lost = 0;
-        error_list[ERROR_LIST_LENGHT].error_exist = 0;
-
-        for (int i = 0; i < ERROR_LIST_LENGHT; i++)
+        //visit only the slots passed since last wake up, at most one round
+        //只访问上次唤醒之后经过的槽，最多一圈
+        if (system_time - last_time > DETECT_WHEEL_SIZE)
         {
-            //disable, continue
-            //未使能，跳过
-            if (error_list[i].enable == 0)
-            {
-                continue;
-            }
-
-            //judge offline.判断掉线
-            if (system_time - error_list[i].new_time > error_list[i].set_offline_time)
-            {
-                if (error_list[i].error_exist == 0)
-                {
-                    //record error and time
-                    //记录错误以及掉线时间
-                    error_list[i].is_lost = 1;
-                    error_list[i].error_exist = 1;
-                    error_list[i].lost_time = system_time;
-                }
-                //judge the priority,save the highest priority ,
-                //判断错误优先级， 保存优先级最高的错误码
-                if (error_list[i].priority > error_list[error_num_display].priority)
-                {
-                    error_num_display = i;
-                }
-                
-
-                error_list[ERROR_LIST_LENGHT].is_lost = 1;
-                error_list[ERROR_LIST_LENGHT].error_exist = 1;
-                //if solve_lost_fun != NULL, run it
-                //如果提供解决函数，运行解决函数
-                if (error_list[i].solve_lost_fun != NULL)
-                {
-                    error_list[i].solve_lost_fun();
-                }
-            }
-            else if (system_time - error_list[i].work_time < error_list[i].set_online_time)
-            {
-                //just online, maybe unstable, only record
-                //刚刚上线，可能存在数据不稳定，只记录不丢失，
-                error_list[i].is_lost = 0;
-                error_list[i].error_exist = 1;
-            }
-            else
+            last_time = system_time - DETECT_WHEEL_SIZE;
+        }
+        for (time = last_time + 1; time != system_time + 1; time++)
+        {
+            due = DETECT_WHEEL[time & DETECT_WHEEL_MASK];
+            while (due)
             {
-                error_list[i].is_lost = 0;
-                //判断是否存在数据错误
-                //judge if exist data error
-                if (error_list[i].data_is_error != NULL)
-                {
-                    error_list[i].error_exist = 1;
-                }
-                else
-                {
-                    error_list[i].error_exist = 0;
-                }
-                //calc frequency
-                //计算频率
-                if (error_list[i].new_time > error_list[i].last_time)
-                {
-                    error_list[i].frequency = configTICK_RATE_HZ / (fp32)(error_list[i].new_time - error_list[i].last_time);
-                }
+                uint8_t i = __CLZ(__RBIT(due));
+                due &= due - 1;
+                detect_expire(i, system_time);
             }
         }
+        last_time = system_time;
 
-        vTaskDelay(DETECT_CONTROL_TIME);
+        error_list[ERROR_LIST_LENGHT].is_lost = (ERROR_MASK != 0);
+        error_list[ERROR_LIST_LENGHT].error_exist = (ERROR_MASK != 0);
+
+        //settle the task statistics window
+        //结算任务运行统计窗口
+        TaskMonitorUpdate();
+
+        vTaskDelay(detect_next_wake(system_time));
 #if INCLUDE_uxTaskGetStackHighWaterMark
         detect_task_stack = uxTaskGetStackHighWaterMark(NULL);
 #endif
     }
 }
 
+/**
+  * @brief          device deadline passed, judge offline, call in detect task
+  * @param[in]      toe: table of equipment
+  * @param[in]      time: system time
+  * @retval         none
+  */
+/**
+  * @brief          设备截止时间到达，判断掉线，在检测任务中调用
+  * @param[in]      toe:设备目录
+  * @param[in]      time:系统时间
+  * @retval         none
+  */
+static void detect_expire(uint8_t toe, uint32_t time)
+{
+    uint8_t solve_lost = 0;
+    UBaseType_t status;
+
+    status = taskENTER_CRITICAL_FROM_ISR();
+    //re-armed by detect_hook or deadline in a later round, skip
+    //已被 detect_hook 重新设置，或截止时间在之后的一圈，跳过
+    if (((ARMED_MASK >> toe) & 1) && (int32_t)(time - error_list[toe].deadline) >= 0)
+    {
+        if (error_list[toe].is_lost == 0)
+        {
+            //record error and time
+            //记录错误以及掉线时间
+            error_list[toe].is_lost = 1;
+            error_list[toe].error_exist = 1;
+            error_list[toe].lost_time = time;
+            ERROR_MASK |= (1UL << toe);
+        }
+
+        //retry the solve function every DETECT_CONTROL_TIME, otherwise leave the wheel
+        //每隔 DETECT_CONTROL_TIME 重试一次解决函数，没有解决函数的设备离开时间轮
+        if (error_list[toe].solve_lost_fun != NULL)
+        {
+            detect_arm(toe, time + DETECT_CONTROL_TIME);
+            solve_lost = 1;
+        }
+        else
+        {
+            detect_disarm(toe);
+        }
+    }
+    taskEXIT_CRITICAL_FROM_ISR(status);
+
+    //if solve_lost_fun != NULL, run it
+    //如果提供解决函数，运行解决函数
+    if (solve_lost)
+    {
+        error_list[toe].solve_lost_fun();
+    }
+}
+
+/**
+  * @brief          ticks to sleep until the nearest busy slot, at most DETECT_CONTROL_TIME
+  * @param[in]      time: system time
+  * @retval         ticks to sleep
+  */
+/**
+  * @brief          距离最近的非空槽的tick数，最多 DETECT_CONTROL_TIME
+  * @param[in]      time:系统时间
+  * @retval         需要等待的tick数
+  */
+static uint32_t detect_next_wake(uint32_t time)
+{
+    uint32_t shift = (time + 1) & DETECT_WHEEL_MASK;
+    uint32_t busy = WHEEL_BUSY;
+    uint32_t wait;
+
+    //rotate so that bit 0 is the slot of time + 1
+    //循环移位使第0位对应 time + 1 所在的槽
+    busy = shift ? (busy >> shift) | (busy << (DETECT_WHEEL_SIZE - shift)) : busy;
+    if (busy == 0)
+    {
+        return DETECT_CONTROL_TIME;
+    }
+    wait = __CLZ(__RBIT(busy)) + 1;
+    return wait < DETECT_CONTROL_TIME ? wait : DETECT_CONTROL_TIME;
+}
+
+/**
+  * @brief          put device into the slot of deadline, call in critical section
+  * @param[in]      toe: table of equipment
+  * @param[in]      deadline: offline deadline
+  * @retval         none
+  */
+/**
+  * @brief          将设备放入截止时间所在的槽，在临界区中调用
+  * @param[in]      toe:设备目录
+  * @param[in]      deadline:掉线截止时间
+  * @retval         none
+  */
+static void detect_arm(uint8_t toe, uint32_t deadline)
+{
+    uint8_t slot = deadline & DETECT_WHEEL_MASK;
+
+    error_list[toe].deadline = deadline;
+    if (((ARMED_MASK >> toe) & 1) && DETECT_SLOT[toe] == slot)
+    {
+        return;
+    }
+    detect_disarm(toe);
+    DETECT_SLOT[toe] = slot;
+    DETECT_WHEEL[slot] |= (1UL << toe);
+    WHEEL_BUSY |= (1UL << slot);
+    ARMED_MASK |= (1UL << toe);
+}
+
+/**
+  * @brief          remove device from the wheel, call in critical section
+  * @param[in]      toe: table of equipment
+  * @retval         none
+  */
+/**
+  * @brief          将设备移出时间轮，在临界区中调用
+  * @param[in]      toe:设备目录
+  * @retval         none
+  */
+static void detect_disarm(uint8_t toe)
+{
+    uint8_t slot = DETECT_SLOT[toe];
+
+    if (((ARMED_MASK >> toe) & 1) == 0)
+    {
+        return;
+    }
+    DETECT_WHEEL[slot] &= ~(1UL << toe);
+    if (DETECT_WHEEL[slot] == 0)
+    {
+        WHEEL_BUSY &= ~(1UL << slot);
+    }
+    ARMED_MASK &= ~(1UL << toe);
+}
+
 
 /**
   * @brief          get toe error status
@@ -199,7 +316,37 @@ bool_t toe_is_error(uint8_t toe)
     }
 #endif
 
-    return (error_list[toe].error_exist == 1);
+    return (ERROR_MASK >> toe) & 1;
+}
+
+/**
+  * @brief          get error bitmask, bit n set means device n is in error
+  * @param[in]      none
+  * @retval         error bitmask
+  */
+/**
+  * @brief          获取错误位掩码，第n位为1表示设备n存在错误
+  * @param[in]      none
+  * @retval         错误位掩码
+  */
+uint32_t get_error_mask(void)
+{
+    return ERROR_MASK;
+}
+
+/**
+  * @brief          get data receive rate of device
+  * @param[in]      toe: table of equipment
+  * @retval         rate (Hz), EWMA of receive interval
+  */
+/**
+  * @brief          获取设备数据接收频率
+  * @param[in]      toe:设备目录
+  * @retval         频率(Hz)，由接收间隔的EWMA计算
+  */
+uint16_t get_detect_rate(uint8_t toe)
+{
+    return RateMonitorGetHz(&error_list[toe].rate);
 }
 
 /**
@@ -214,35 +361,53 @@ bool_t toe_is_error(uint8_t toe)
   */
 void detect_hook(uint8_t toe)
 {
+    uint32_t now = xTaskGetTickCount();
+    uint8_t data_is_error = 0;
+    UBaseType_t status;
+
+    if (error_list[toe].data_is_error_fun != NULL)
+    {
+        data_is_error = error_list[toe].data_is_error_fun();
+    }
+
+    //can be called in interrupt, use the ISR version of critical section
+    //可能在中断中调用，使用中断版本的临界区
+    status = taskENTER_CRITICAL_FROM_ISR();
     error_list[toe].last_time = error_list[toe].new_time;
-    error_list[toe].new_time = xTaskGetTickCount();
-    
+    error_list[toe].new_time = now;
+    RateMonitorUpdate(&error_list[toe].rate, dwt_get_cycle());
+
     if (error_list[toe].is_lost)
     {
         error_list[toe].is_lost = 0;
-        error_list[toe].work_time = error_list[toe].new_time;
+        error_list[toe].work_time = now;
     }
-    
-    if (error_list[toe].data_is_error_fun != NULL)
-    {
-        if (error_list[toe].data_is_error_fun())
-        {
-            error_list[toe].error_exist = 1;
-            error_list[toe].data_is_error = 1;
+    error_list[toe].data_is_error = data_is_error;
 
-            if (error_list[toe].solve_data_error_fun != NULL)
-            {
-                error_list[toe].solve_data_error_fun();
-            }
-        }
-        else
-        {
-            error_list[toe].data_is_error = 0;
-        }
+    //just online, maybe unstable, keep error until set_online_time passed
+    //刚刚上线，可能存在数据不稳定，在 set_online_time 之后才清除错误
+    if (data_is_error || now - error_list[toe].work_time < error_list[toe].set_online_time)
+    {
+        error_list[toe].error_exist = 1;
+        ERROR_MASK |= (1UL << toe);
     }
     else
     {
-        error_list[toe].data_is_error = 0;
+        error_list[toe].error_exist = 0;
+        ERROR_MASK &= ~(1UL << toe);
+    }
+
+    //re-arm the deadline
+    //重新设置掉线截止时间
+    if (error_list[toe].enable)
+    {
+        detect_arm(toe, now + error_list[toe].set_offline_time + 1);
+    }
+    taskEXIT_CRITICAL_FROM_ISR(status);
+
+    if (data_is_error && error_list[toe].solve_data_error_fun != NULL)
+    {
+        error_list[toe].solve_data_error_fun();
     }
 }
 
@@ -296,12 +461,16 @@ static void detect_init(uint32_t time)
         error_list[i].error_exist = 1;
         error_list[i].is_lost = 1;
         error_list[i].data_is_error = 1;
-        error_list[i].frequency = 0.0f;
+        memset(&error_list[i].rate, 0, sizeof(RateMonitor_t));
         error_list[i].new_time = time;
         error_list[i].last_time = time;
         error_list[i].lost_time = time;
         error_list[i].work_time = time;
+        taskENTER_CRITICAL();
+        detect_arm(i, time + error_list[i].set_offline_time + 1);
+        taskEXIT_CRITICAL();
     }
+    ERROR_MASK = 0xFFFFFFFFUL >> (32 - ERROR_LIST_LENGHT);
 
     error_list[OLED_TOE].data_is_error_fun = NULL;
     error_list[OLED_TOE].solve_lost_fun = OLED_com_reset;
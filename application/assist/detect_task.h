@@ -53,6 +53,7 @@
 #ifndef DETECT_TASK_H
 #define DETECT_TASK_H
 #include "struct_typedef.h"
+#include "user_lib.h"
 
 
 #define DETECT_TASK_INIT_TIME 57
@@ -84,6 +85,7 @@ typedef __packed struct
     uint32_t last_time;
     uint32_t lost_time;
     uint32_t work_time;
+    uint32_t deadline;
     uint16_t set_offline_time : 12;
     uint16_t set_online_time : 12;
     uint8_t enable : 1;
@@ -92,7 +94,7 @@ typedef __packed struct
     uint8_t is_lost : 1;
     uint8_t data_is_error : 1;
 
-    fp32 frequency;
+    RateMonitor_t rate;
     bool_t (*data_is_error_fun)(void);
     void (*solve_lost_fun)(void);
     void (*solve_data_error_fun)(void);
@@ -135,6 +137,30 @@ extern bool_t toe_is_error(uint8_t err);
   */
 extern void detect_hook(uint8_t toe);
 
+/**
+  * @brief          get error bitmask, bit n set means device n is in error
+  * @param[in]      none
+  * @retval         error bitmask
+  */
+/**
+  * @brief          获取错误位掩码，第n位为1表示设备n存在错误
+  * @param[in]      none
+  * @retval         错误位掩码
+  */
+extern uint32_t get_error_mask(void);
+
+/**
+  * @brief          get data receive rate of device
+  * @param[in]      toe: table of equipment
+  * @retval         rate (Hz), EWMA of receive interval
+  */
+/**
+  * @brief          获取设备数据接收频率
+  * @param[in]      toe:设备目录
+  * @retval         频率(Hz)，由接收间隔的EWMA计算
+  */
+extern uint16_t get_detect_rate(uint8_t toe);
+
 /**
   * @brief          get error list
   * @param[in]      none
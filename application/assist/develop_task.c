@@ -11,9 +11,22 @@
 #include "task.h"
 #include "tim.h"
 #include "usb_debug.h"
+#include "usb_typdef.h"
 #include "chassis_balance.h"
 #include "IMU.h"
 #include "CAN_communication.h"
+#include "bsp_dwt.h"
+#include "pid.h"
+#include "pid_bank.h"
+#include "arm_dynamics.h"
+#include "joint_observer.h"
+
+// 置1时在任务开始时测量对应模块的耗时(周期数)，结果通过USB调试数据发送，每项占用一个数据槽
+#define DEVELOP_PID_BANK_BENCH 0        // 多通道PID
+#define DEVELOP_ARM_DYNAMICS_BENCH 0    // 机械臂逆动力学
+#define DEVELOP_JOINT_OBSERVER_BENCH 0  // 多关节观测器
+#define DEVELOP_BENCH \
+    (DEVELOP_PID_BANK_BENCH || DEVELOP_ARM_DYNAMICS_BENCH || DEVELOP_JOINT_OBSERVER_BENCH)
 
 const SBUS_t * SBUS;
 
@@ -22,6 +35,186 @@ extern Ps2_s ps2;
 // Ps2Button_t ps2_btn_select = {.last = false, .now = false};
 // Ps2Buttons_t ps2_btns = {0};
 
+#if DEVELOP_BENCH
+#define BENCH_LOOP_NUM 1000
+
+typedef struct
+{
+    void (*run)(void);  // 被测函数，执行一次计算
+    uint8_t unit;       // 一次计算包含的控制器或关节数，结果为每个的平均周期数
+    const char * name;  // 调试数据名称
+} DevelopBench_s;
+#endif
+
+#if DEVELOP_PID_BANK_BENCH
+#define BENCH_CHANNEL_NUM 8
+
+static pid_type_def BENCH_PID[BENCH_CHANNEL_NUM];
+static PidBank_s BENCH_BANK_POS, BENCH_BANK_DELTA;
+static PidBankQ31_s BENCH_BANK_Q31;
+static PidBankQ15_s BENCH_BANK_Q15;
+static fp32 BENCH_FDB[BENCH_CHANNEL_NUM], BENCH_SET[BENCH_CHANNEL_NUM];
+static fp32 BENCH_OUT[BENCH_CHANNEL_NUM];
+static q31_t BENCH_FDB_Q31[BENCH_CHANNEL_NUM], BENCH_SET_Q31[BENCH_CHANNEL_NUM];
+static q31_t BENCH_OUT_Q31[BENCH_CHANNEL_NUM];
+static q15_t BENCH_FDB_Q15[BENCH_CHANNEL_NUM], BENCH_SET_Q15[BENCH_CHANNEL_NUM];
+static q15_t BENCH_OUT_Q15[BENCH_CHANNEL_NUM];
+
+static void PidBankBenchInit(void)
+{
+    const fp32 PID[3] = {0.5f, 0.05f, 0.1f};
+
+    for (uint8_t i = 0; i < BENCH_CHANNEL_NUM; i++) {
+        PID_init(&BENCH_PID[i], PID_POSITION, PID, 1.0f, 0.5f);
+        BENCH_FDB[i] = 0.1f * i;
+        BENCH_SET[i] = 0.05f;
+        BENCH_FDB_Q31[i] = (q31_t)(BENCH_FDB[i] * 0x7FFFFFFF);
+        BENCH_SET_Q31[i] = (q31_t)(BENCH_SET[i] * 0x7FFFFFFF);
+        BENCH_FDB_Q15[i] = (q15_t)(BENCH_FDB[i] * 0x7FFF);
+        BENCH_SET_Q15[i] = (q15_t)(BENCH_SET[i] * 0x7FFF);
+    }
+    PidBankInit(&BENCH_BANK_POS, PID_POSITION, BENCH_CHANNEL_NUM, PID, 1.0f, 0.5f);
+    PidBankInit(&BENCH_BANK_DELTA, PID_DELTA, BENCH_CHANNEL_NUM, PID, 1.0f, 0.5f);
+    PidBankQ31Init(&BENCH_BANK_Q31, BENCH_CHANNEL_NUM, PID, 0.9f);
+    PidBankQ15Init(&BENCH_BANK_Q15, BENCH_CHANNEL_NUM, PID, 0.9f);
+}
+
+static void BenchPidCalc(void)
+{
+    for (uint8_t i = 0; i < BENCH_CHANNEL_NUM; i++) {
+        BENCH_OUT[i] = PID_calc(&BENCH_PID[i], BENCH_FDB[i], BENCH_SET[i]);
+    }
+}
+
+static void BenchBankPos(void) { PidBankCalc(&BENCH_BANK_POS, BENCH_FDB, BENCH_SET, BENCH_OUT); }
+
+static void BenchBankDelta(void)
+{
+    PidBankCalc(&BENCH_BANK_DELTA, BENCH_FDB, BENCH_SET, BENCH_OUT);
+}
+
+static void BenchBankQ31(void)
+{
+    PidBankQ31Calc(&BENCH_BANK_Q31, BENCH_FDB_Q31, BENCH_SET_Q31, BENCH_OUT_Q31);
+}
+
+static void BenchBankQ15(void)
+{
+    PidBankQ15Calc(&BENCH_BANK_Q15, BENCH_FDB_Q15, BENCH_SET_Q15, BENCH_OUT_Q15);
+}
+#endif
+
+#if DEVELOP_ARM_DYNAMICS_BENCH
+static ArmDynamics_s BENCH_ARM_DYN;
+static ArmKineTrig_s BENCH_ARM_TRIG;
+static fp32 BENCH_ARM_Q[ARM_KINE_JOINT_NUM] = {0.3f, -0.7f, 1.1f, 0.5f, 0.9f, 0.0f};
+static const fp32 BENCH_ARM_DQ[ARM_DYN_JOINT_NUM] = {0.5f, -0.2f, 0.3f, 0.0f, 0.0f};
+static const fp32 BENCH_ARM_DDQ[ARM_DYN_JOINT_NUM] = {1.0f, 2.0f, -1.0f, 0.0f, 0.0f};
+
+static void ArmDynamicsBenchInit(void)
+{
+    const ArmDynamicsParam_s param = {
+        0.35f, 0.30f, {1.2f, 0.15f, 0.015f}, {0.8f, 0.12f, 0.008f}, 1.0f, 0.5f, 0.08f, 0.02f};
+    ArmDynamicsInit(&BENCH_ARM_DYN, &param);
+    ArmKineTrigUpdate(BENCH_ARM_Q, &BENCH_ARM_TRIG);
+}
+
+static void BenchArmTrig(void) { ArmKineTrigUpdate(BENCH_ARM_Q, &BENCH_ARM_TRIG); }
+
+static void BenchArmDyn(void)
+{
+    ArmDynamicsUpdate(&BENCH_ARM_DYN, &BENCH_ARM_TRIG, BENCH_ARM_DQ, BENCH_ARM_DDQ);
+}
+#endif
+
+#if DEVELOP_JOINT_OBSERVER_BENCH
+#define OBSERVER_BENCH_JOINT_NUM 6
+
+static JointObserver_s BENCH_OBS_LPF, BENCH_OBS_AB;
+static fp32 BENCH_RAW_POS[OBSERVER_BENCH_JOINT_NUM], BENCH_RAW_VEL[OBSERVER_BENCH_JOINT_NUM];
+
+static void JointObserverBenchInit(void)
+{
+    const fp32 gain[3] = {0.5f, 0.1f, 0.9f};
+
+    for (uint8_t i = 0; i < OBSERVER_BENCH_JOINT_NUM; i++) {
+        BENCH_RAW_POS[i] = 0.5f * i - 1.0f;
+        BENCH_RAW_VEL[i] = 10.0f;
+    }
+    JointObserverInit(
+        &BENCH_OBS_LPF, JOINT_OBSERVER_LPF, OBSERVER_BENCH_JOINT_NUM, 2 * PI, 19.0f, gain,
+        0.001f);
+    JointObserverInit(
+        &BENCH_OBS_AB, JOINT_OBSERVER_ALPHA_BETA, OBSERVER_BENCH_JOINT_NUM, 2 * PI, 19.0f, gain,
+        0.001f);
+}
+
+static void BenchObsLpf(void) { JointObserverUpdate(&BENCH_OBS_LPF, BENCH_RAW_POS, BENCH_RAW_VEL); }
+
+static void BenchObsAb(void) { JointObserverUpdate(&BENCH_OBS_AB, BENCH_RAW_POS, NULL); }
+#endif
+
+#if DEVELOP_BENCH
+// 数组下标即调试数据槽
+static const DevelopBench_s BENCH[] = {
+#if DEVELOP_PID_BANK_BENCH
+    {BenchPidCalc, BENCH_CHANNEL_NUM, "pid_calc"},
+    {BenchBankPos, BENCH_CHANNEL_NUM, "bank_pos"},
+    {BenchBankDelta, BENCH_CHANNEL_NUM, "bank_delta"},
+    {BenchBankQ31, BENCH_CHANNEL_NUM, "bank_q31"},
+    {BenchBankQ15, BENCH_CHANNEL_NUM, "bank_q15"},
+#endif
+#if DEVELOP_ARM_DYNAMICS_BENCH
+    {BenchArmTrig, 1, "arm_trig"},
+    {BenchArmDyn, 1, "arm_dyn"},
+#endif
+#if DEVELOP_JOINT_OBSERVER_BENCH
+    {BenchObsLpf, OBSERVER_BENCH_JOINT_NUM, "obs_lpf"},
+    {BenchObsAb, OBSERVER_BENCH_JOINT_NUM, "obs_ab"},
+#endif
+};
+#define BENCH_NUM (sizeof(BENCH) / sizeof(BENCH[0]))
+
+// 调试数据槽不够时编译报错(ARMCC的C99模式没有_Static_assert)
+typedef char BENCH_SLOT_CHECK[(BENCH_NUM <= DEBUG_PACKAGE_NUM) ? 1 : -1];
+
+static fp32 BENCH_RESULT[BENCH_NUM];  // (cycle/unit)
+
+static void BenchEmpty(void) {}
+
+/**
+ * @brief          依次测量 BENCH 中各项的平均周期数，扣除函数调用和循环的开销
+ * @note           在进入循环前调用一次，关中断测量以排除任务切换的影响
+ */
+static void DevelopBenchRun(void)
+{
+#if DEVELOP_PID_BANK_BENCH
+    PidBankBenchInit();
+#endif
+#if DEVELOP_ARM_DYNAMICS_BENCH
+    ArmDynamicsBenchInit();
+#endif
+#if DEVELOP_JOINT_OBSERVER_BENCH
+    JointObserverBenchInit();
+#endif
+
+    void (*volatile empty)(void) = BenchEmpty;  // 防止空函数被内联
+    taskENTER_CRITICAL();
+    uint32_t start = dwt_get_cycle();
+    for (uint16_t n = 0; n < BENCH_LOOP_NUM; n++) empty();
+    uint32_t overhead = dwt_get_cycle() - start;
+
+    for (uint8_t k = 0; k < BENCH_NUM; k++) {
+        start = dwt_get_cycle();
+        for (uint16_t n = 0; n < BENCH_LOOP_NUM; n++) BENCH[k].run();
+        uint32_t cycle = dwt_get_cycle() - start;
+        BENCH_RESULT[k] = (fp32)(cycle > overhead ? cycle - overhead : 0) /
+                          (BENCH_LOOP_NUM * BENCH[k].unit);
+    }
+    taskEXIT_CRITICAL();
+}
+#endif
+
 void develop_task(void const * pvParameters)
 {
     // 空闲一段时间
@@ -32,7 +225,16 @@ void develop_task(void const * pvParameters)
     SupCap_s p_sup_cap;
     SupCapInit(&p_sup_cap,1);
 
+#if DEVELOP_BENCH
+    DevelopBenchRun();
+#endif
+
     while (1) {
+#if DEVELOP_BENCH
+        for (uint8_t k = 0; k < BENCH_NUM; k++) {
+            ModifyDebugDataPackage(k, BENCH_RESULT[k], BENCH[k].name);
+        }
+#endif
         // ModifyDebugDataPackage(0,, "");
         // ModifyDebugDataPackage(1,, "");
         // ModifyDebugDataPackage(2,, "");
@@ -0,0 +1,432 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       param_store.c/h
+  * @brief      保存在片内flash中的参数(零点偏移、PID参数等)，掉电不丢失，修改后不需要重新烧录
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *  V1.0.1     Oct-19-2026     Penguin         1. 检查擦除结果，擦除失败时不写入并记录错误
+  *  V1.1.0     Oct-19-2026     Penguin         1. 只在调度器启动前擦除，运行中由低优先级任务提交
+  *
+  @verbatim
+  ==============================================================================
+    存储格式：
+    使用 sector 10 和 sector 11 两个扇区轮流存储(工程中的IROM大小已相应减小)
+    扇区头部 [magic][version][seq][crc32]，seq较大的有效扇区为当前扇区
+    之后为只追加的记录 [batch|key][value][crc32]，每次提交以 [batch|COMMIT][记录数][crc32] 结尾，
+    batch为提交序号，没有以COMMIT结尾的记录(写入时掉电或写入失败)在加载时被丢弃
+    当前扇区写满时，将全部参数整理到另一个扇区，最后写入扇区头部，
+    整理过程中掉电时旧扇区仍然有效，两个扇区的擦写次数相同
+    整理前检查擦除结果并确认扇区全为1，擦除失败时不写入，旧扇区保持有效
+    擦除只在 ParamStoreInit 中进行(预先擦除备用扇区)，运行中整理时备用扇区不为空则放弃
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include "param_store.h"
+
+#include <string.h>
+
+#include "attribute_typedef.h"
+#include "bsp_crc32.h"
+#include "bsp_flash.h"
+#include "cmsis_os.h"
+
+#define PARAM_SECTOR_A ADDR_FLASH_SECTOR_10
+#define PARAM_SECTOR_B ADDR_FLASH_SECTOR_11
+#define PARAM_SECTOR_SIZE ((uint32_t)0x20000)
+
+#define PARAM_STORE_MAGIC ((uint32_t)0x50524D53)  // "PRMS"
+#define PARAM_STORE_VERSION 1                      // 存储格式版本，修改格式时递增
+
+#define PARAM_HEADER_WORDS 4
+#define PARAM_RECORD_WORDS 3
+#define PARAM_RECORD_SIZE (PARAM_RECORD_WORDS * 4)
+#define PARAM_KEY_COMMIT ((uint32_t)0xFFFE)
+#define FLASH_ERASED_WORD ((uint32_t)0xFFFFFFFF)
+#define BLANK_CHECK_WORDS 16
+#define PARAM_STORE_TASK_TIME_MS 100
+
+#define PARAM_STORE_KEY(name, key) key,
+static const uint16_t PARAM_KEY[PARAM_NUM] = {PARAM_STORE_LIST(PARAM_STORE_KEY)};
+#undef PARAM_STORE_KEY
+
+fp32 PARAM_SHADOW[PARAM_NUM];
+static bool_t PARAM_SET[PARAM_NUM];
+
+static fp32 STAGE[PARAM_NUM];
+static bool_t STAGED[PARAM_NUM];
+
+static uint32_t ACTIVE_SECTOR = 0;  // 0表示flash中还没有有效的参数
+static uint32_t WRITE_ADDR = 0;
+static uint32_t SEQ = 0;
+static uint16_t BATCH = 0;
+static ParamStoreError_e ERROR_CODE = PARAM_STORE_OK;
+static volatile bool_t COMMIT_REQUEST = 0;
+
+/*-------------------- Private functions --------------------*/
+
+static uint32_t FloatToWord(fp32 value)
+{
+    uint32_t word;
+    memcpy(&word, &value, sizeof(word));
+    return word;
+}
+
+static fp32 WordToFloat(uint32_t word)
+{
+    fp32 value;
+    memcpy(&value, &word, sizeof(value));
+    return value;
+}
+
+static uint8_t FindParam(uint32_t key)
+{
+    for (uint8_t i = 0; i < PARAM_NUM; i++) {
+        if (PARAM_KEY[i] == key) {
+            return i;
+        }
+    }
+    return PARAM_NUM;
+}
+
+/**
+ * @brief          检查扇区头部
+ * @param[in]      sector 扇区地址
+ * @param[out]     seq 扇区序号
+ * @retval         扇区是否有效
+ */
+static bool_t HeaderValid(uint32_t sector, uint32_t * seq)
+{
+    uint32_t header[PARAM_HEADER_WORDS];
+    flash_read(sector, header, PARAM_HEADER_WORDS);
+
+    if (header[0] != PARAM_STORE_MAGIC || header[1] != PARAM_STORE_VERSION ||
+        !verify_crc32_check_sum(header, PARAM_HEADER_WORDS)) {
+        return 0;
+    }
+    *seq = header[2];
+    return 1;
+}
+
+/**
+ * @brief          扫描扇区中的记录，只有完整提交的记录才写入RAM副本
+ * @param[in]      sector 扇区地址
+ * @retval         第一个空闲记录的地址
+ */
+static uint32_t LoadSector(uint32_t sector)
+{
+    fp32 pending[PARAM_NUM];
+    bool_t pending_set[PARAM_NUM];
+    uint32_t pending_num = 0;
+    uint16_t pending_batch = 0;
+    uint32_t record[PARAM_RECORD_WORDS];
+    uint32_t addr = sector + PARAM_HEADER_WORDS * 4;
+
+    memset(pending_set, 0, sizeof(pending_set));
+
+    while (addr + PARAM_RECORD_SIZE <= sector + PARAM_SECTOR_SIZE) {
+        flash_read(addr, record, PARAM_RECORD_WORDS);
+        if (record[0] == FLASH_ERASED_WORD && record[1] == FLASH_ERASED_WORD &&
+            record[2] == FLASH_ERASED_WORD) {
+            break;
+        }
+        addr += PARAM_RECORD_SIZE;
+
+        if (!verify_crc32_check_sum(record, PARAM_RECORD_WORDS)) {
+            // 写入时掉电留下的残缺记录，丢弃这次提交
+            memset(pending_set, 0, sizeof(pending_set));
+            pending_num = 0;
+            continue;
+        }
+
+        uint16_t batch = record[0] >> 16;
+        uint16_t key = record[0] & 0xFFFF;
+        BATCH = batch + 1;
+
+        if (batch != pending_batch) {
+            // 新的一次提交开始，上一次未完成的提交作废
+            memset(pending_set, 0, sizeof(pending_set));
+            pending_num = 0;
+            pending_batch = batch;
+        }
+
+        if (key == PARAM_KEY_COMMIT) {
+            if (record[1] == pending_num) {
+                for (uint8_t i = 0; i < PARAM_NUM; i++) {
+                    if (pending_set[i]) {
+                        PARAM_SHADOW[i] = pending[i];
+                        PARAM_SET[i] = 1;
+                    }
+                }
+            }
+            memset(pending_set, 0, sizeof(pending_set));
+            pending_num = 0;
+            continue;
+        }
+
+        // 固件中已删除的key仍然计数，保证记录数校验正确
+        uint8_t i = FindParam(key);
+        if (i < PARAM_NUM) {
+            pending[i] = WordToFloat(record[1]);
+            pending_set[i] = 1;
+        }
+        pending_num++;
+    }
+
+    return addr;
+}
+
+/**
+ * @brief          检查扇区是否已全部擦除
+ * @param[in]      sector 扇区地址
+ * @retval         全为1返回1，否则0
+ */
+static bool_t SectorBlank(uint32_t sector)
+{
+    uint32_t buf[BLANK_CHECK_WORDS];
+
+    for (uint32_t addr = sector; addr < sector + PARAM_SECTOR_SIZE; addr += sizeof(buf)) {
+        flash_read(addr, buf, BLANK_CHECK_WORDS);
+        for (uint8_t i = 0; i < BLANK_CHECK_WORDS; i++) {
+            if (buf[i] != FLASH_ERASED_WORD) {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+static bool_t WriteRecord(uint32_t * addr, uint32_t key, uint32_t value)
+{
+    uint32_t record[PARAM_RECORD_WORDS] = {((uint32_t)BATCH << 16) | key, value, 0};
+    append_crc32_check_sum(record, PARAM_RECORD_WORDS);
+
+    // 写入失败的位置可能已被部分编程，无论成功与否都跳过
+    int8_t result = flash_write_single_address(*addr, record, PARAM_RECORD_WORDS);
+    *addr += PARAM_RECORD_SIZE;
+    if (result != 0) {
+        ERROR_CODE = PARAM_STORE_WRITE_FAIL;
+        return 0;
+    }
+    return 1;
+}
+
+static void ApplyStage(void)
+{
+    for (uint8_t i = 0; i < PARAM_NUM; i++) {
+        if (STAGED[i]) {
+            PARAM_SHADOW[i] = STAGE[i];
+            PARAM_SET[i] = 1;
+            STAGED[i] = 0;
+        }
+    }
+}
+
+/**
+ * @brief          将全部参数整理到另一个扇区，扇区头部最后写入
+ * @param[in]      allow_erase 另一个扇区不为空时是否擦除，擦除阻塞1~2s，只在调度器启动前允许
+ * @retval         成功1，失败0
+ */
+static bool_t CompactSector(bool_t allow_erase)
+{
+    uint32_t sector = (ACTIVE_SECTOR == PARAM_SECTOR_A) ? PARAM_SECTOR_B : PARAM_SECTOR_A;
+    uint32_t addr = sector + PARAM_HEADER_WORDS * 4;
+    uint32_t num = 0;
+    uint32_t header[PARAM_HEADER_WORDS] = {PARAM_STORE_MAGIC, PARAM_STORE_VERSION, SEQ + 1, 0};
+
+    if (!SectorBlank(sector)) {
+        if (!allow_erase) {
+            ERROR_CODE = PARAM_STORE_SPARE_DIRTY;
+            return 0;
+        }
+        // 擦除失败时写入的记录会与残留数据混在一起，不能继续
+        if (flash_erase_address(sector, 1) != 0 || !SectorBlank(sector)) {
+            ERROR_CODE = PARAM_STORE_ERASE_FAIL;
+            return 0;
+        }
+    }
+
+    for (uint8_t i = 0; i < PARAM_NUM; i++) {
+        if (!STAGED[i] && !PARAM_SET[i]) {
+            continue;
+        }
+        fp32 value = STAGED[i] ? STAGE[i] : PARAM_SHADOW[i];
+        if (!WriteRecord(&addr, PARAM_KEY[i], FloatToWord(value))) {
+            return 0;
+        }
+        num++;
+    }
+    if (!WriteRecord(&addr, PARAM_KEY_COMMIT, num)) {
+        return 0;
+    }
+
+    append_crc32_check_sum(header, PARAM_HEADER_WORDS);
+    if (flash_write_single_address(sector, header, PARAM_HEADER_WORDS) != 0) {
+        ERROR_CODE = PARAM_STORE_WRITE_FAIL;
+        return 0;
+    }
+
+    ACTIVE_SECTOR = sector;
+    WRITE_ADDR = addr;
+    SEQ++;
+    BATCH++;
+    return 1;
+}
+
+/*-------------------- Public functions --------------------*/
+
+/**
+ * @brief          从flash加载参数到RAM副本，并预先擦除备用扇区，需在调度器启动前调用一次
+ * @retval         none
+ */
+void ParamStoreInit(void)
+{
+    uint32_t seq_a, seq_b;
+    bool_t valid_a = HeaderValid(PARAM_SECTOR_A, &seq_a);
+    bool_t valid_b = HeaderValid(PARAM_SECTOR_B, &seq_b);
+
+    memset(PARAM_SHADOW, 0, sizeof(PARAM_SHADOW));
+    memset(PARAM_SET, 0, sizeof(PARAM_SET));
+    memset(STAGED, 0, sizeof(STAGED));
+
+    if (valid_a && (!valid_b || (int32_t)(seq_a - seq_b) > 0)) {
+        ACTIVE_SECTOR = PARAM_SECTOR_A;
+        SEQ = seq_a;
+    } else if (valid_b) {
+        ACTIVE_SECTOR = PARAM_SECTOR_B;
+        SEQ = seq_b;
+    } else {
+        ACTIVE_SECTOR = 0;
+        SEQ = 0;
+    }
+
+    if (ACTIVE_SECTOR != 0) {
+        WRITE_ADDR = LoadSector(ACTIVE_SECTOR);
+    } else {
+        CompactSector(1);  // 格式化，失败时ACTIVE_SECTOR仍为0
+    }
+
+    // 运行中整理时不再擦除，这里擦除失败只记录错误，不影响已加载的参数
+    uint32_t spare = (ACTIVE_SECTOR == PARAM_SECTOR_A) ? PARAM_SECTOR_B : PARAM_SECTOR_A;
+    if (!SectorBlank(spare) && (flash_erase_address(spare, 1) != 0 || !SectorBlank(spare))) {
+        ERROR_CODE = PARAM_STORE_ERASE_FAIL;
+    }
+}
+
+/**
+ * @brief          参数是否在flash中保存过
+ * @param[in]      id 参数id
+ * @retval         保存过1，否则0
+ */
+bool_t ParamIsSet(ParamId_e id) { return PARAM_SET[id]; }
+
+/**
+ * @brief          参数保存过时用保存的值覆盖编译时的默认值，用于初始化时读取PID参数等
+ * @param[in]      id 参数id
+ * @param[in,out]  value 默认值
+ * @retval         none
+ */
+void ParamOverride(ParamId_e id, fp32 * value)
+{
+    if (PARAM_SET[id]) {
+        *value = PARAM_SHADOW[id];
+    }
+}
+
+/**
+ * @brief          暂存参数修改，调用ParamCommit后才写入flash并生效
+ * @param[in]      id 参数id
+ * @param[in]      value 参数值
+ * @retval         none
+ */
+void ParamSet(ParamId_e id, fp32 value)
+{
+    STAGE[id] = value;
+    STAGED[id] = 1;
+}
+
+/**
+ * @brief          将暂存的参数一次性写入flash，只能在机器人静止时从低优先级任务调用，
+ *                 一般通过 ParamCommitRequest 由 param_store_task 调用
+ * @retval         成功1，失败0(失败时flash中的参数和RAM副本都保持不变)
+ */
+bool_t ParamCommit(void)
+{
+    uint32_t num = 0;
+    uint32_t addr = WRITE_ADDR;
+
+    ERROR_CODE = PARAM_STORE_OK;
+    for (uint8_t i = 0; i < PARAM_NUM; i++) {
+        num += STAGED[i];
+    }
+    if (num == 0) {
+        return 1;
+    }
+
+    if (ACTIVE_SECTOR == 0 ||
+        addr + (num + 1) * PARAM_RECORD_SIZE > ACTIVE_SECTOR + PARAM_SECTOR_SIZE) {
+        if (!CompactSector(0)) {
+            return 0;
+        }
+        ApplyStage();
+        return 1;
+    }
+
+    bool_t ok = 1;
+    for (uint8_t i = 0; i < PARAM_NUM && ok; i++) {
+        if (STAGED[i]) {
+            ok = WriteRecord(&addr, PARAM_KEY[i], FloatToWord(STAGE[i]));
+        }
+    }
+    ok = ok && WriteRecord(&addr, PARAM_KEY_COMMIT, num);
+
+    WRITE_ADDR = addr;
+    BATCH++;
+    if (ok) {
+        ApplyStage();
+    }
+    return ok;
+}
+
+/**
+ * @brief          最近一次ParamCommit的错误
+ * @retval         PARAM_STORE_OK表示成功
+ */
+ParamStoreError_e ParamGetError(void) { return ERROR_CODE; }
+
+/**
+ * @brief          请求提交暂存的参数，可在任意任务中调用，不会阻塞
+ * @retval         none
+ */
+void ParamCommitRequest(void) { COMMIT_REQUEST = 1; }
+
+/**
+ * @brief          是否有还未提交的请求
+ * @retval         有1，没有0
+ */
+bool_t ParamCommitPending(void) { return COMMIT_REQUEST; }
+
+/**
+ * @brief          当前是否允许写flash，默认不允许，由底盘模块在安全模式且电机静止时允许
+ * @retval         允许1，不允许0
+ */
+__weak bool_t ParamCommitAllowed(void) { return 0; }
+
+/**
+ * @brief          参数提交任务，写flash期间CPU无法取指，所以在低优先级任务中等待允许后提交
+ * @param[in]      pvParameters: 空
+ * @retval         none
+ */
+void param_store_task(void const * pvParameters)
+{
+    while (1) {
+        if (COMMIT_REQUEST && ParamCommitAllowed()) {
+            ParamCommit();  // 失败原因用 ParamGetError 查询
+            COMMIT_REQUEST = 0;
+        }
+        osDelay(PARAM_STORE_TASK_TIME_MS);
+    }
+}
+/*------------------------------ End of File ------------------------------*/
@@ -0,0 +1,83 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       param_store.c/h
+  * @brief      保存在片内flash中的参数(零点偏移、PID参数等)，掉电不丢失，修改后不需要重新烧录
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *  V1.0.1     Oct-19-2026     Penguin         1. 添加ParamGetError，提交失败时可查询原因
+  *  V1.1.0     Oct-19-2026     Penguin         1. 添加param_store_task，按请求在允许时提交
+  *
+  @verbatim
+  ==============================================================================
+    使用方法：
+    1. 在 PARAM_STORE_LIST 中添加参数，key 一经使用不可修改或复用
+    2. 控制代码中用 PARAM(PARAM_XXX) 读取参数，只是一次RAM读取，没有额外开销
+    3. ParamSet() 暂存修改，ParamCommitRequest() 请求提交，
+       param_store_task(低优先级)在 ParamCommitAllowed() 返回1时调用 ParamCommit() 一次性写入flash，
+       同一次提交的参数要么全部生效，要么全部不生效，失败时用 ParamGetError() 查询原因
+    4. ParamCommitAllowed() 默认返回0，由底盘模块在安全模式且电机静止时返回1
+    注意：写flash时CPU无法从flash取指，只能在机器人静止时提交。
+      擦除扇区会阻塞1~2s，只在 ParamStoreInit(调度器启动前)中进行，运行中不擦除；
+      当前扇区写满时整理到预先擦除的备用扇区，每次上电最多整理一次，
+      再次写满时返回 PARAM_STORE_SPARE_DIRTY，重新上电后再提交
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#ifndef PARAM_STORE_H
+#define PARAM_STORE_H
+
+#include "struct_typedef.h"
+
+// clang-format off
+// X(参数名, flash中的key)
+#define PARAM_STORE_LIST(X)               \
+    X(PARAM_GYRO_OFFSET_X,   0x0101)      \
+    X(PARAM_GYRO_OFFSET_Y,   0x0102)      \
+    X(PARAM_GYRO_OFFSET_Z,   0x0103)      \
+    X(PARAM_ACCEL_OFFSET_X,  0x0111)      \
+    X(PARAM_ACCEL_OFFSET_Y,  0x0112)      \
+    X(PARAM_ACCEL_OFFSET_Z,  0x0113)      \
+    X(PARAM_JOINT_OFFSET_0,  0x0201)      \
+    X(PARAM_JOINT_OFFSET_1,  0x0202)      \
+    X(PARAM_JOINT_OFFSET_2,  0x0203)      \
+    X(PARAM_JOINT_OFFSET_3,  0x0204)      \
+    X(PARAM_LEG_LENGTH_KP,   0x0301)      \
+    X(PARAM_LEG_LENGTH_KI,   0x0302)      \
+    X(PARAM_LEG_LENGTH_KD,   0x0303)
+// clang-format on
+
+#define PARAM_STORE_ENUM(name, key) name,
+typedef enum {
+    PARAM_STORE_LIST(PARAM_STORE_ENUM)
+    PARAM_NUM
+} ParamId_e;
+#undef PARAM_STORE_ENUM
+
+typedef enum {
+    PARAM_STORE_OK = 0,
+    PARAM_STORE_ERASE_FAIL,  // 擦除失败或擦除后扇区不为全1
+    PARAM_STORE_WRITE_FAIL,  // 写入失败
+    PARAM_STORE_SPARE_DIRTY, // 备用扇区本次上电已使用过，需重新上电后再提交
+} ParamStoreError_e;
+
+// 参数的RAM副本，开机时从flash加载一次，未保存过的参数为0
+extern fp32 PARAM_SHADOW[PARAM_NUM];
+
+#define PARAM(id) (PARAM_SHADOW[(id)])
+
+extern void ParamStoreInit(void);
+extern bool_t ParamIsSet(ParamId_e id);
+extern void ParamOverride(ParamId_e id, fp32 * value);
+extern void ParamSet(ParamId_e id, fp32 value);
+extern bool_t ParamCommit(void);
+extern ParamStoreError_e ParamGetError(void);
+extern void ParamCommitRequest(void);
+extern bool_t ParamCommitPending(void);
+extern bool_t ParamCommitAllowed(void);
+extern void param_store_task(void const * pvParameters);
+
+#endif  // PARAM_STORE_H
+/*------------------------------ End of File ------------------------------*/
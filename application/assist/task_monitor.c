@@ -0,0 +1,250 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       task_monitor.c/h
+  * @brief      任务运行监视器，统计各个任务的CPU占用率、栈余量、唤醒抖动和抢占延迟
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *  V1.0.1     Oct-19-2026     Penguin         1. 运行时间按任务句柄分配槽位，抖动和延迟改为32位
+  *
+  @verbatim
+  ==============================================================================
+    CPU占用率基于 configGENERATE_RUN_TIME_STATS，计数源为DWT周期计数器。
+    抢占延迟通过 traceMOVED_TASK_TO_READY_STATE/traceTASK_SWITCHED_IN 两个钩子测量，
+    只统计通过 TaskMonitorRegister 注册过的任务（任务tag指向对应的监视槽）。
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include "task_monitor.h"
+
+#include "bsp_dwt.h"
+#include "string.h"
+#include "task.h"
+
+typedef struct
+{
+    uint32_t period;       // (cycle)名义周期
+    uint32_t last_wake;    // (cycle)上次循环开始时刻
+    uint32_t ready_time;   // (cycle)进入就绪态的时刻
+    uint32_t max_jitter;   // (cycle)
+    uint32_t max_latency;  // (cycle)
+    uint16_t miss;         // 超时次数
+    uint8_t ready;         // 已就绪尚未运行
+} TaskMonitorSlot_t;
+
+static TaskMonitorSlot_t SLOTS[TASK_MONITOR_MAX_TASKS];
+static uint8_t SLOT_NUM = 0;
+
+static TaskStatus_t TASK_STATUS[TASK_MONITOR_MAX_TASKS];
+// 各任务上次的运行时间计数，首次出现时分配槽位，槽位用完后的任务不统计CPU占用率
+static TaskHandle_t RUN_TIME_HANDLE[TASK_MONITOR_MAX_TASKS];
+static uint32_t LAST_RUN_TIME[TASK_MONITOR_MAX_TASKS];
+static uint8_t RUN_TIME_NUM = 0;
+static uint32_t LAST_TOTAL_RUN_TIME = 0;
+static uint32_t LAST_UPDATE_TIME = 0;
+
+static TaskMonitorInfo_t INFO[TASK_MONITOR_MAX_TASKS];
+static uint8_t INFO_NUM = 0;
+static uint16_t CPU_LOAD = 0;
+static uint16_t MIN_STACK_FREE = 0;
+
+/**
+ * @brief          查找任务的运行时间槽位，没有时分配一个
+ * @param[in]      handle 任务句柄
+ * @retval         槽位序号，槽位已满时为 TASK_MONITOR_MAX_TASKS
+ */
+static uint8_t RunTimeSlot(TaskHandle_t handle)
+{
+    uint8_t i;
+
+    for (i = 0; i < RUN_TIME_NUM; i++) {
+        if (RUN_TIME_HANDLE[i] == handle) {
+            return i;
+        }
+    }
+    if (RUN_TIME_NUM >= TASK_MONITOR_MAX_TASKS) {
+        return TASK_MONITOR_MAX_TASKS;
+    }
+    RUN_TIME_HANDLE[RUN_TIME_NUM] = handle;
+    LAST_RUN_TIME[RUN_TIME_NUM] = 0;
+    return RUN_TIME_NUM++;
+}
+
+/**
+ * @brief          注册当前任务，之后的唤醒抖动和抢占延迟会被统计
+ * @param[in]      period_ms 任务名义周期
+ * @retval         none
+ */
+void TaskMonitorRegister(uint32_t period_ms)
+{
+    TaskMonitorSlot_t * slot;
+
+    taskENTER_CRITICAL();
+    if (SLOT_NUM >= TASK_MONITOR_MAX_TASKS) {
+        taskEXIT_CRITICAL();
+        return;
+    }
+    slot = &SLOTS[SLOT_NUM++];
+    taskEXIT_CRITICAL();
+
+    memset(slot, 0, sizeof(TaskMonitorSlot_t));
+    slot->period = period_ms * (SystemCoreClock / 1000);
+    vTaskSetApplicationTaskTag(NULL, (TaskHookFunction_t)slot);
+}
+
+/**
+ * @brief          在任务循环开始处调用，记录实际周期与名义周期的偏差
+ * @retval         none
+ */
+void TaskMonitorLoop(void)
+{
+    TaskMonitorSlot_t * slot = (TaskMonitorSlot_t *)xTaskGetApplicationTaskTag(NULL);
+    uint32_t now, interval, jitter;
+
+    if (slot == NULL) {
+        return;
+    }
+
+    now = dwt_get_cycle();
+    if (slot->last_wake != 0) {
+        interval = now - slot->last_wake;
+        jitter = interval > slot->period ? interval - slot->period : slot->period - interval;
+        if (jitter > slot->max_jitter) {
+            slot->max_jitter = jitter;
+        }
+    }
+    slot->last_wake = now;
+}
+
+/**
+ * @brief          记录当前任务的一次控制周期超时，由 ControlTimerWait 调用
+ * @retval         none
+ */
+void TaskMonitorDeadlineMiss(void)
+{
+    TaskMonitorSlot_t * slot = (TaskMonitorSlot_t *)xTaskGetApplicationTaskTag(NULL);
+
+    if (slot != NULL && slot->miss < 0xFFFF) {
+        slot->miss++;
+    }
+}
+
+/**
+ * @brief          任务进入就绪态，在内核临界区中调用，需保持简短
+ * @param[in]      tag 任务tag
+ * @retval         none
+ */
+void TaskMonitorTraceReady(void * tag)
+{
+    TaskMonitorSlot_t * slot = (TaskMonitorSlot_t *)tag;
+
+    if (slot != NULL && !slot->ready) {
+        slot->ready_time = dwt_get_cycle();
+        slot->ready = 1;
+    }
+}
+
+/**
+ * @brief          任务被切换为运行态，在内核临界区中调用，需保持简短
+ * @param[in]      tag 任务tag
+ * @retval         none
+ */
+void TaskMonitorTraceSwitchedIn(void * tag)
+{
+    TaskMonitorSlot_t * slot = (TaskMonitorSlot_t *)tag;
+    uint32_t latency;
+
+    if (slot != NULL && slot->ready) {
+        latency = dwt_get_cycle() - slot->ready_time;
+        if (latency > slot->max_latency) {
+            slot->max_latency = latency;
+        }
+        slot->ready = 0;
+    }
+}
+
+/**
+ * @brief          结算一个统计窗口，内部按 TASK_MONITOR_WINDOW_MS 限频，可在低优先级任务中周期调用
+ * @retval         none
+ */
+void TaskMonitorUpdate(void)
+{
+    UBaseType_t num, i;
+    uint32_t total_run_time, total_delta, task_delta;
+    uint8_t run_slot;
+    TaskMonitorSlot_t * slot;
+    TaskHandle_t idle = xTaskGetIdleTaskHandle();
+
+    if (xTaskGetTickCount() - LAST_UPDATE_TIME < TASK_MONITOR_WINDOW_MS) {
+        return;
+    }
+    LAST_UPDATE_TIME = xTaskGetTickCount();
+
+    num = uxTaskGetSystemState(TASK_STATUS, TASK_MONITOR_MAX_TASKS, &total_run_time);
+    total_delta = (total_run_time - LAST_TOTAL_RUN_TIME) / 1000;
+    LAST_TOTAL_RUN_TIME = total_run_time;
+    if (total_delta == 0) {
+        return;
+    }
+
+    MIN_STACK_FREE = 0xFFFF;
+    for (i = 0; i < num; i++) {
+        run_slot = RunTimeSlot(TASK_STATUS[i].xHandle);
+        task_delta = 0;
+        if (run_slot < TASK_MONITOR_MAX_TASKS) {
+            task_delta = TASK_STATUS[i].ulRunTimeCounter - LAST_RUN_TIME[run_slot];
+            LAST_RUN_TIME[run_slot] = TASK_STATUS[i].ulRunTimeCounter;
+        }
+
+        strncpy(INFO[i].name, TASK_STATUS[i].pcTaskName, TASK_MONITOR_NAME_LEN);
+        INFO[i].cpu = task_delta / total_delta;
+        INFO[i].stack_free = TASK_STATUS[i].usStackHighWaterMark;
+        INFO[i].jitter = 0;
+        INFO[i].latency = 0;
+        INFO[i].miss = 0;
+
+        slot = (TaskMonitorSlot_t *)xTaskGetApplicationTaskTag(TASK_STATUS[i].xHandle);
+        if (slot != NULL) {
+            INFO[i].jitter = dwt_cycle_to_us(slot->max_jitter);
+            INFO[i].latency = dwt_cycle_to_us(slot->max_latency);
+            INFO[i].miss = slot->miss;
+            slot->max_jitter = 0;
+            slot->max_latency = 0;
+            slot->miss = 0;
+        }
+
+        if (TASK_STATUS[i].xHandle == idle) {
+            CPU_LOAD = INFO[i].cpu < 1000 ? 1000 - INFO[i].cpu : 0;
+        }
+        if (INFO[i].stack_free < MIN_STACK_FREE) {
+            MIN_STACK_FREE = INFO[i].stack_free;
+        }
+    }
+    INFO_NUM = num;
+}
+
+/**
+ * @brief          获取最近一个统计窗口的各任务信息
+ * @param[out]     task_num 任务数量
+ * @retval         任务信息数组
+ */
+const TaskMonitorInfo_t * GetTaskMonitorInfo(uint8_t * task_num)
+{
+    *task_num = INFO_NUM;
+    return INFO;
+}
+
+/**
+ * @brief          获取CPU总占用率
+ * @retval         (0.1%)CPU总占用率
+ */
+uint16_t GetCpuLoad(void) { return CPU_LOAD; }
+
+/**
+ * @brief          获取所有任务中最小的栈余量
+ * @retval         (word)最小栈余量
+ */
+uint16_t GetMinStackFree(void) { return MIN_STACK_FREE; }
+/*------------------------------ End of File ------------------------------*/
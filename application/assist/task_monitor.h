@@ -0,0 +1,54 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       task_monitor.c/h
+  * @brief      任务运行监视器，统计各个任务的CPU占用率、栈余量、唤醒抖动和抢占延迟
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *  V1.0.1     Oct-19-2026     Penguin         1. 运行时间按任务句柄分配槽位，抖动和延迟改为32位
+  *
+  @verbatim
+  ==============================================================================
+    使用方法：
+    1. 在任务进入循环前调用 TaskMonitorRegister(周期ms) 注册任务
+    2. 在任务循环开始处调用 TaskMonitorLoop() 记录本次唤醒时间
+    3. 统计窗口内的最大抖动和最大延迟在 TaskMonitorUpdate 中结算并清零
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#ifndef TASK_MONITOR_H
+#define TASK_MONITOR_H
+#include "struct_typedef.h"
+#include "FreeRTOS.h"
+
+#define TASK_MONITOR_MAX_TASKS 24
+#define TASK_MONITOR_WINDOW_MS 1000  // (ms)统计窗口
+#define TASK_MONITOR_NAME_LEN 8
+
+typedef struct
+{
+    char name[TASK_MONITOR_NAME_LEN];
+    uint16_t cpu;         // (0.1%)CPU占用率
+    uint16_t stack_free;  // (word)栈历史最小余量
+    uint32_t jitter;      // (us)窗口内最大唤醒抖动（实际周期与名义周期之差）
+    uint32_t latency;     // (us)窗口内最大抢占延迟（进入就绪态到开始运行）
+    uint16_t miss;        // 窗口内控制周期超时次数
+} TaskMonitorInfo_t;
+
+extern void TaskMonitorRegister(uint32_t period_ms);
+extern void TaskMonitorLoop(void);
+extern void TaskMonitorUpdate(void);
+extern void TaskMonitorDeadlineMiss(void);
+
+extern const TaskMonitorInfo_t * GetTaskMonitorInfo(uint8_t * task_num);
+extern uint16_t GetCpuLoad(void);
+extern uint16_t GetMinStackFree(void);
+
+// FreeRTOS trace hooks, see FreeRTOSConfig.h
+extern void TaskMonitorTraceReady(void * tag);
+extern void TaskMonitorTraceSwitchedIn(void * tag);
+
+#endif  // TASK_MONITOR_H
+/*------------------------------ End of File ------------------------------*/
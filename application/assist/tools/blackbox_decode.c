@@ -0,0 +1,165 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       blackbox_decode.c
+  * @brief      在PC上运行的黑匣子解码程序，将flash中的记录转换为csv
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *  V1.0.1     Oct-19-2026     Penguin         1. 触发原因统一经过范围检查后再查表
+  *
+  @verbatim
+  ==============================================================================
+    编译：
+      cc -I.. -I../../typedef -DBLACKBOX_ENABLE=1 -o blackbox_decode blackbox_decode.c
+    读出flash(二选一)：
+      openocd -f interface/stlink.cfg -f target/stm32f4x.cfg \
+        -c "init; dump_image blackbox.bin 0x080A0000 0x20000; exit"
+      或使用整片flash的镜像(从0x08000000开始)
+    运行：
+      ./blackbox_decode blackbox.bin [输出文件前缀]
+    每条完整的记录输出为 <前缀>_<槽位号>.csv，物理量已按通道比例还原
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "blackbox.h"
+
+#define FLASH_BASE_ADDR 0x08000000
+
+static unsigned char SECTOR[BLACKBOX_SECTOR_SIZE];
+
+#define BLACKBOX_CHANNEL_NAME(name, scale) #name,
+static const char * CHANNEL_NAME[BLACKBOX_CHANNEL_NUM] = {
+    BLACKBOX_CHANNEL_LIST(BLACKBOX_CHANNEL_NAME)};
+#undef BLACKBOX_CHANNEL_NAME
+
+#define BLACKBOX_CHANNEL_SCALE(name, scale) scale,
+static const float CHANNEL_SCALE[BLACKBOX_CHANNEL_NUM] = {
+    BLACKBOX_CHANNEL_LIST(BLACKBOX_CHANNEL_SCALE)};
+#undef BLACKBOX_CHANNEL_SCALE
+
+static const char * REASON_NAME[] = {"NONE", "SAFE", "TAKE_OFF", "MOTOR_OFFLINE", "HARD_FAULT"};
+
+static const char * ReasonName(uint8_t reason)
+{
+    return reason < sizeof(REASON_NAME) / sizeof(REASON_NAME[0]) ? REASON_NAME[reason] : "UNKNOWN";
+}
+
+/**
+ * @brief 与STM32硬件CRC单元相同的crc32(多项式0x04C11DB7，初值0xFFFFFFFF，按字计算)
+ */
+static uint32_t Crc32(const uint32_t * data, uint32_t len)
+{
+    uint32_t crc = 0xFFFFFFFF;
+    uint32_t i, bit;
+    for (i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (bit = 0; bit < 32; bit++) {
+            crc = (crc & 0x80000000) ? (crc << 1) ^ 0x04C11DB7 : (crc << 1);
+        }
+    }
+    return crc;
+}
+
+static int DecodeSlot(uint32_t slot, const char * prefix)
+{
+    const unsigned char * base = SECTOR + slot * BLACKBOX_SLOT_SIZE;
+    BlackboxHeader_t header;
+    BlackboxFrame_t frame;
+    char path[256];
+    FILE * out;
+    uint32_t i, ch;
+
+    memcpy(&header, base, sizeof(header));
+    if (header.magic != BLACKBOX_MAGIC) {
+        return 0;
+    }
+    if (header.crc != Crc32((const uint32_t *)&header, sizeof(header) / 4 - 1)) {
+        fprintf(stderr, "slot %u: incomplete record, skipped\n", (unsigned)slot);
+        return 0;
+    }
+    if (header.version != BLACKBOX_VERSION || header.channel_num != BLACKBOX_CHANNEL_NUM ||
+        header.frame_size != sizeof(BlackboxFrame_t) ||
+        sizeof(header) + header.frame_num * sizeof(BlackboxFrame_t) > BLACKBOX_SLOT_SIZE) {
+        fprintf(stderr, "slot %u: format mismatch, rebuild this tool\n", (unsigned)slot);
+        return 0;
+    }
+
+    snprintf(path, sizeof(path), "%s_%u.csv", prefix, (unsigned)slot);
+    out = fopen(path, "w");
+    if (out == NULL) {
+        perror(path);
+        return -1;
+    }
+
+    fprintf(
+        out, "# reason=%s trigger_time=%u\n", ReasonName(header.reason),
+        (unsigned)header.trigger_time);
+    fprintf(out, "time,mode,step,online");
+    for (ch = 0; ch < BLACKBOX_CHANNEL_NUM; ch++) {
+        fprintf(out, ",%s", CHANNEL_NAME[ch]);
+    }
+    fprintf(out, "\n");
+
+    for (i = 0; i < header.frame_num; i++) {
+        memcpy(&frame, base + sizeof(header) + i * sizeof(frame), sizeof(frame));
+        fprintf(
+            out, "%u,%u,%d,0x%02X", (unsigned)frame.time, (unsigned)frame.mode, (int)frame.step,
+            (unsigned)frame.online);
+        for (ch = 0; ch < BLACKBOX_CHANNEL_NUM; ch++) {
+            fprintf(out, ",%.4f", frame.data[ch] / CHANNEL_SCALE[ch]);
+        }
+        fprintf(out, "\n");
+    }
+
+    fclose(out);
+    printf("%s: %s, %u frames\n", path, ReasonName(header.reason), (unsigned)header.frame_num);
+    return 1;
+}
+
+int main(int argc, char ** argv)
+{
+    const char * prefix = (argc > 2) ? argv[2] : "blackbox";
+    FILE * in;
+    long size;
+    uint32_t slot;
+    int num = 0;
+
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <dump.bin> [output prefix]\n", argv[0]);
+        return 1;
+    }
+
+    in = fopen(argv[1], "rb");
+    if (in == NULL) {
+        perror(argv[1]);
+        return 1;
+    }
+    fseek(in, 0, SEEK_END);
+    size = ftell(in);
+    // 整片flash镜像时跳转到黑匣子扇区
+    fseek(in, size > (long)BLACKBOX_SECTOR_SIZE ? BLACKBOX_SECTOR_ADDR - FLASH_BASE_ADDR : 0,
+          SEEK_SET);
+    if (fread(SECTOR, 1, BLACKBOX_SECTOR_SIZE, in) != BLACKBOX_SECTOR_SIZE) {
+        fprintf(stderr, "%s: file too short\n", argv[1]);
+        fclose(in);
+        return 1;
+    }
+    fclose(in);
+
+    for (slot = 0; slot < BLACKBOX_SLOT_NUM; slot++) {
+        int result = DecodeSlot(slot, prefix);
+        if (result < 0) {
+            return 1;
+        }
+        num += result;
+    }
+
+    printf("%d record(s) decoded\n", num);
+    return 0;
+}
+/*------------------------------ End of File ------------------------------*/
@@ -0,0 +1,107 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       clock_sync_test.c
+  * @brief      在PC上运行的时钟同步测试程序，模拟两块板的时钟偏移、晶振漂移和链路延迟
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+    编译运行：
+      cc -O2 -I.. -I../../typedef -o clock_sync_test clock_sync_test.c ../clock_sync.c -lm
+      ./clock_sync_test
+    模拟：
+      对方时钟 = 本板时钟 * (1 + SKEW) + 随机偏移(跨过32位回绕)，
+      每 PERIOD 交换一次时间戳，单向延迟为 BASE_DELAY 加随机抖动，
+      部分帧带有长达数百us的排队延迟，回复的等待时间随机。
+    检查项(任一不满足返回非0)：
+      1. 收敛后换算到对方时钟的最大误差小于 MAX_ERR
+      2. 估计的频率差与真实值之差小于 MAX_SKEW_ERR
+      3. 延迟过大的测量被丢弃
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include <math.h>
+#include <stdio.h>
+
+#include "clock_sync.h"
+
+#define CASE_NUM 20
+#define STEP_NUM 3000        // 每组交换次数
+#define PERIOD 10000.0       // (us)交换周期
+#define BASE_DELAY 60.0      // (us)单向固定延迟
+#define NOISE_DELAY 5.0      // (us)单向延迟抖动
+#define QUEUE_RATE 0.2       // 带排队延迟的帧的比例
+#define QUEUE_DELAY 800.0    // (us)排队延迟的上限
+#define MAX_SKEW 2e-4        // 晶振频率差的范围
+#define MAX_ERR 10.0         // (us)
+#define MAX_SKEW_ERR 2e-5    // 频率差范围的1/10
+
+static uint32_t SEED = 1;
+
+static double Rand(double min, double max)
+{
+    SEED = SEED * 1664525u + 1013904223u;
+    return min + (max - min) * (SEED >> 8) / (double)(1u << 24);
+}
+
+static double Delay(void)
+{
+    double d = BASE_DELAY + Rand(0, NOISE_DELAY);
+    if (Rand(0, 1) < QUEUE_RATE) d += Rand(0, QUEUE_DELAY);
+    return d;
+}
+
+int main(void)
+{
+    int fail = 0;
+    double max_err = 0, max_skew_err = 0;
+    uint32_t reject = 0, count = 0;
+
+    for (int c = 0; c < CASE_NUM; c++) {
+        ClockSync_s cs;
+        double skew = Rand(-MAX_SKEW, MAX_SKEW);
+        double local0 = Rand(0, 4294967296.0);
+        double peer0 = Rand(0, 4294967296.0);
+        double t = 0;  // (us)真实时间
+#define LOCAL(x) ((uint32_t)fmod(local0 + (x), 4294967296.0))
+#define PEER(x) ((uint32_t)fmod(peer0 + (x) * (1.0 + skew), 4294967296.0))
+
+        ClockSyncInit(&cs);
+        for (int n = 0; n < STEP_NUM; n++) {
+            t += PERIOD;
+            uint32_t t1 = LOCAL(t);
+            double tb = t + Delay();
+            uint32_t t2 = PEER(tb);
+            double tc = tb + Rand(0, PERIOD);
+            uint32_t t3 = PEER(tc);
+            double td = tc + Delay();
+            uint32_t t4 = LOCAL(td);
+            ClockSyncUpdate(&cs, t1, t2, t3, t4);
+
+            if (n > STEP_NUM / 2) {
+                double probe = td + Rand(0, PERIOD);
+                uint32_t peer = ClockSyncToPeer(&cs, LOCAL(probe));
+                double e = fabs((double)(int32_t)(peer - PEER(probe)));
+                if (e > max_err) max_err = e;
+            }
+        }
+        double skew_err = fabs(cs.skew - skew);
+        if (skew_err > max_skew_err) max_skew_err = skew_err;
+        reject += cs.reject;
+        count += cs.count;
+    }
+
+    printf(
+        "max error %.1f us, skew error %.2f ppm, used %u, rejected %u\n", max_err,
+        max_skew_err * 1e6, count, reject);
+    if (max_err > MAX_ERR) fail = 1;
+    if (max_skew_err > MAX_SKEW_ERR) fail = 1;
+    if (reject == 0) fail = 1;
+
+    printf(fail ? "FAIL\n" : "PASS\n");
+    return fail;
+}
@@ -10,6 +10,12 @@
   *  V1.0.2     Sep-16-2024     Penguin         1. 添加速度观测器并测试效果
   *  V1.0.3     Nov-20-2024     Penguin         1. 完善离地检测
   *  V1.1.0     Nov-20-2024     Penguin         1. 添加了展览模式的相关控制
+  *  V1.1.1     Oct-19-2026     Penguin         1. 关节零点修正量和腿长PID参数从param_store读取
+  *  V1.1.2     Oct-19-2026     Penguin         1. 控制状态写入黑匣子，进入安全模式、离地、电机离线时触发保存
+  *  V1.1.3     Oct-19-2026     Penguin         1. 添加驱动轮功率限制
+  *  V1.1.4     Oct-19-2026     Penguin         1. 关节校准完成后进行陀螺仪零偏校准
+  *  V1.1.5     Oct-19-2026     Penguin         1. 陀螺仪零偏校准改为安全模式下用遥控器手势触发
+  *                                             2. 安全模式且电机静止时才允许写flash
   *
   @verbatim
   ==============================================================================
@@ -41,15 +47,18 @@
 #if (CHASSIS_TYPE == CHASSIS_BALANCE)
 #include "CAN_communication.h"
 #include "IMU.h"
+#include "blackbox.h"
 #include "bsp_delay.h"
 #include "chassis.h"
 #include "chassis_balance_extras.h"
 #include "cmsis_os.h"
+#include "control_timer.h"
 #include "data_exchange.h"
 #include "detect_task.h"
 #include "gimbal.h"
 #include "kalman_filter.h"
 #include "macro_typedef.h"
+#include "param_store.h"
 #include "ps2.h"
 #include "signal_generator.h"
 #include "stdbool.h"
@@ -68,10 +77,18 @@
 // Parameters on ---------------------
 #define MS_TO_S 0.001f
 
+// 关节零点 = 编译时的标称值 + flash中保存的校准修正量
+#define J0_ZERO (J0_ANGLE_OFFSET + PARAM(PARAM_JOINT_OFFSET_0))
+#define J1_ZERO (J1_ANGLE_OFFSET + PARAM(PARAM_JOINT_OFFSET_1))
+#define J2_ZERO (J2_ANGLE_OFFSET + PARAM(PARAM_JOINT_OFFSET_2))
+#define J3_ZERO (J3_ANGLE_OFFSET + PARAM(PARAM_JOINT_OFFSET_3))
+
 #define CALIBRATE_STOP_VELOCITY 0.05f  // rad/s
 #define CALIBRATE_STOP_TIME 200        // ms
 #define CALIBRATE_VELOCITY 2.0f        // rad/s
 
+#define GYRO_CALI_HOLD_TIME 3000  // (ms)触发陀螺仪零偏校准的手势需要保持的时间
+
 #define VEL_PROCESS_NOISE 25   // 速度过程噪声
 #define VEL_MEASURE_NOISE 800  // 速度测量噪声
 // 同时估计加速度和速度时对加速度的噪声
@@ -172,6 +189,10 @@ void ChassisInit(void)
     MotorInit(&CHASSIS.wheel_motor[0], 1, WHEEL_CAN, MF_9025, W0_DIRECTION, 1, 0);
     MotorInit(&CHASSIS.wheel_motor[1], 2, WHEEL_CAN, MF_9025, W1_DIRECTION, 1, 0);
 
+    ChassisPowerInit(
+        &CHASSIS.power, MF9025_POWER_K_MECH, MF9025_POWER_K_CU, MF9025_POWER_K_W,
+        MF9025_POWER_K_STATIC, 2);
+
     /*-------------------- 值归零 --------------------*/
     memset(&CHASSIS.fdb, 0, sizeof(CHASSIS.fdb));
     memset(&CHASSIS.ref, 0, sizeof(CHASSIS.ref));
@@ -205,6 +226,9 @@ void ChassisInit(void)
 
     float leg_length_length_pid[3] = {
         KP_CHASSIS_LEG_LENGTH_LENGTH, KI_CHASSIS_LEG_LENGTH_LENGTH, KD_CHASSIS_LEG_LENGTH_LENGTH};
+    ParamOverride(PARAM_LEG_LENGTH_KP, &leg_length_length_pid[0]);
+    ParamOverride(PARAM_LEG_LENGTH_KI, &leg_length_length_pid[1]);
+    ParamOverride(PARAM_LEG_LENGTH_KD, &leg_length_length_pid[2]);
 
     PID_init(
         &CHASSIS.pid.roll_angle, PID_POSITION, roll_angle_pid, MAX_OUT_CHASSIS_ROLL_ANGLE,
@@ -361,6 +385,34 @@ void ChassisSetMode(void)
     }
 }
 #else
+/**
+ * @brief          安全模式下前后和旋转摇杆同时拨到最小并保持 GYRO_CALI_HOLD_TIME，
+ *                 开始陀螺仪零偏校准，松开摇杆后才能再次触发
+ * @param[in]      none
+ * @retval         none
+ */
+static void GyroCaliGesture(void)
+{
+    static uint32_t hold_start = 0;
+    static bool triggered = false;
+    uint32_t now = HAL_GetTick();
+    int16_t rc_x = GetSbusCh(CHASSIS_X_CHANNEL) - ET08A_RC_CH_VALUE_OFFSET;
+    int16_t rc_wz = GetSbusCh(CHASSIS_WZ_CHANNEL) - ET08A_RC_CH_VALUE_OFFSET;
+
+    if (rc_x > -RC_OFF_HOOK_VALUE_HOLE || rc_wz > -RC_OFF_HOOK_VALUE_HOLE) {
+        triggered = false;
+    }
+    if (triggered || !ParamCommitAllowed() || rc_x > -RC_OFF_HOOK_VALUE_HOLE ||
+        rc_wz > -RC_OFF_HOOK_VALUE_HOLE) {
+        hold_start = now;
+        return;
+    }
+    if (now - hold_start > GYRO_CALI_HOLD_TIME) {
+        ImuGyroCaliStart();
+        triggered = true;
+    }
+}
+
 /**
  * @brief          设置模式
  * @param[in]      none
@@ -423,6 +475,7 @@ void ChassisSetMode(void)
             } else if (GetSbusCh(CHASSIS_MODE_CHANNEL) > ET08A_RC_CH_VALUE_OFFSET) {
                 CHASSIS.mode = CHASSIS_SAFE;
             }
+            GyroCaliGesture();
         } break;
 
         case RC_TYPE_ESP32_TRACKER: {
@@ -463,7 +516,8 @@ static void BodyMotionObserve(void);
  */
 void ChassisObserver(void)
 {
-    CHASSIS.duration = xTaskGetTickCount() - CHASSIS.last_time;
+    CHASSIS.dt = GetControlDt(CONTROL_TIMER_CHASSIS);
+    CHASSIS.duration = (uint32_t)(CHASSIS.dt * 1000.0f + 0.5f);
     CHASSIS.last_time = xTaskGetTickCount();
 
     CHASSIS.rc_type = GetRcType();
@@ -499,6 +553,8 @@ static void UpdateMotorStatus(void)
     for (uint8_t i = 0; i < 2; i++) {
         GetMotorMeasure(&CHASSIS.wheel_motor[i]);
     }
+
+    ChassisPowerUpdateSource(&CHASSIS.power);
 }
 
 static void UpdateBodyStatus(void)
@@ -567,13 +623,13 @@ static void UpdateLegStatus(void)
     uint8_t i = 0;
     // =====更新关节姿态=====
     CHASSIS.fdb.leg[0].joint.Phi1 =
-        theta_transform(CHASSIS.joint_motor[0].fdb.pos, J0_ANGLE_OFFSET, J0_DIRECTION, 1);
+        theta_transform(CHASSIS.joint_motor[0].fdb.pos, J0_ZERO, J0_DIRECTION, 1);
     CHASSIS.fdb.leg[0].joint.Phi4 =
-        theta_transform(CHASSIS.joint_motor[1].fdb.pos, J1_ANGLE_OFFSET, J1_DIRECTION, 1);
+        theta_transform(CHASSIS.joint_motor[1].fdb.pos, J1_ZERO, J1_DIRECTION, 1);
     CHASSIS.fdb.leg[1].joint.Phi1 =
-        theta_transform(CHASSIS.joint_motor[2].fdb.pos, J2_ANGLE_OFFSET, J2_DIRECTION, 1);
+        theta_transform(CHASSIS.joint_motor[2].fdb.pos, J2_ZERO, J2_DIRECTION, 1);
     CHASSIS.fdb.leg[1].joint.Phi4 =
-        theta_transform(CHASSIS.joint_motor[3].fdb.pos, J3_ANGLE_OFFSET, J3_DIRECTION, 1);
+        theta_transform(CHASSIS.joint_motor[3].fdb.pos, J3_ZERO, J3_DIRECTION, 1);
 
     CHASSIS.fdb.leg[0].joint.dPhi1 = CHASSIS.joint_motor[0].fdb.vel * (J0_DIRECTION);
     CHASSIS.fdb.leg[0].joint.dPhi4 = CHASSIS.joint_motor[1].fdb.vel * (J1_DIRECTION);
@@ -616,13 +672,13 @@ static void UpdateLegStatus(void)
         CHASSIS.fdb.leg[i].rod.dTheta = -CHASSIS.fdb.leg[i].rod.dPhi0 - CHASSIS.fdb.body.phi_dot;
 
         // 更新加速度信息
-        float accel = (CHASSIS.fdb.leg[i].rod.dL0 - last_dL0) / (CHASSIS.duration * MS_TO_S);
+        float accel = (CHASSIS.fdb.leg[i].rod.dL0 - last_dL0) / CHASSIS.dt;
         CHASSIS.fdb.leg[i].rod.ddL0 = accel;
 
-        accel = (CHASSIS.fdb.leg[i].rod.dPhi0 - last_dPhi0) / (CHASSIS.duration * MS_TO_S);
+        accel = (CHASSIS.fdb.leg[i].rod.dPhi0 - last_dPhi0) / CHASSIS.dt;
         CHASSIS.fdb.leg[i].rod.ddPhi0 = accel;
 
-        accel = (CHASSIS.fdb.leg[i].rod.dTheta - last_dTheta) / (CHASSIS.duration * MS_TO_S);
+        accel = (CHASSIS.fdb.leg[i].rod.dTheta - last_dTheta) / CHASSIS.dt;
         CHASSIS.fdb.leg[i].rod.ddTheta = accel;
 
         // 差分计算腿长变化率和腿角速度
@@ -739,7 +795,7 @@ static void BodyMotionObserve(void)
     // 使用kf同时估计加速度和速度,滤波更新
     OBSERVER.body.v_kf.MeasuredVector[0] = speed;                   // 输入轮速
     OBSERVER.body.v_kf.MeasuredVector[1] = CHASSIS.fdb.body.x_acc;  // 输入加速度
-    OBSERVER.body.v_kf.F_data[1] = CHASSIS.duration * MS_TO_S;      // 更新采样时间
+    OBSERVER.body.v_kf.F_data[1] = CHASSIS.dt;                      // 更新采样时间
 
     Kalman_Filter_Update(&OBSERVER.body.v_kf);
     CHASSIS.fdb.body.x_dot_obv = OBSERVER.body.v_kf.xhat_data[0];
@@ -749,7 +805,7 @@ static void BodyMotionObserve(void)
     if (fabs(CHASSIS.ref.speed_vector.vx) < WHEEL_DEADZONE &&
         fabs(CHASSIS.fdb.body.x_dot_obv) < 0.5f) {
         // 当目标速度为0，且速度小于阈值时，计算反馈距离
-        CHASSIS.fdb.body.x += CHASSIS.fdb.body.x_dot_obv * CHASSIS.duration * MS_TO_S;
+        CHASSIS.fdb.body.x += CHASSIS.fdb.body.x_dot_obv * CHASSIS.dt;
     } else {
         //CHASSIS.fdb.body.x = 0;
     }
@@ -1043,7 +1099,8 @@ static void Et08aRef()
 
 static void ESP32TrackerRef(void)
 {
-    float ref_yaw = uint_to_float(GetSbusCh(5), -M_PI, M_PI, 11);
+    const RcInput_s * rc = GetRcInput();
+    float ref_yaw = rc->ch[5] * M_PI;
     float delta_yaw = ref_yaw - CHASSIS.fdb.body.yaw;
     
     ModifyDebugDataPackage(8, ref_yaw, "yaw");
@@ -1054,7 +1111,7 @@ static void ESP32TrackerRef(void)
         delta_yaw += 2.0f * M_PI;
     }
 
-    float vx = uint_to_float(GetSbusCh(6), -1.0f, 1.0f, 11);
+    float vx = rc->ch[6];
     CHASSIS.ref.speed_vector.vx = vx;
     CHASSIS.ref.speed_vector.vy = 0;
     CHASSIS.ref.speed_vector.wz = PID_calc(&CHASSIS.pid.chassis_follow_gimbal, -delta_yaw, 0);
@@ -1110,6 +1167,7 @@ static void ConsoleNormal(void);
 static void ConsoleDebug(void);
 static void ConsolePosDebug(void);
 static void ConsoleStandUp(void);
+static void LimitWheelPower(void);
 
 /**
  * @brief          计算控制量
@@ -1356,6 +1414,22 @@ static void ConsoleNormal(void)
     //不知道为什么要反向，待后续研究
     CHASSIS.wheel_motor[0].set.tor = -(CHASSIS.cmd.leg[0].wheel.T * (W0_DIRECTION));
     CHASSIS.wheel_motor[1].set.tor = -(CHASSIS.cmd.leg[1].wheel.T * (W1_DIRECTION));
+
+    LimitWheelPower();
+}
+
+/**
+ * @brief 驱动轮功率限制，关节电机功耗由模型静态项近似
+ */
+static void LimitWheelPower(void)
+{
+    float tor[2] = {CHASSIS.wheel_motor[0].set.tor, CHASSIS.wheel_motor[1].set.tor};
+    float vel[2] = {CHASSIS.wheel_motor[0].fdb.vel, CHASSIS.wheel_motor[1].fdb.vel};
+
+    ChassisPowerLimit(&CHASSIS.power, tor, vel);
+
+    CHASSIS.wheel_motor[0].set.tor = tor[0];
+    CHASSIS.wheel_motor[1].set.tor = tor[1];
 }
 
 static void ConsoleDebug(void)
@@ -1397,13 +1471,13 @@ static void ConsolePosDebug(void)
     if (!(isnan(phi1_phi4_l[0]) || isnan(phi1_phi4_l[1]) || isnan(phi1_phi4_r[0]) ||
           isnan(phi1_phi4_r[1]))) {
         CHASSIS.joint_motor[0].set.pos =
-            theta_transform(phi1_phi4_l[0], -J0_ANGLE_OFFSET, J0_DIRECTION, 1);
+            theta_transform(phi1_phi4_l[0], -J0_ZERO, J0_DIRECTION, 1);
         CHASSIS.joint_motor[1].set.pos =
-            theta_transform(phi1_phi4_l[1], -J1_ANGLE_OFFSET, J1_DIRECTION, 1);
+            theta_transform(phi1_phi4_l[1], -J1_ZERO, J1_DIRECTION, 1);
         CHASSIS.joint_motor[2].set.pos =
-            theta_transform(phi1_phi4_r[0], -J2_ANGLE_OFFSET, J2_DIRECTION, 1);
+            theta_transform(phi1_phi4_r[0], -J2_ZERO, J2_DIRECTION, 1);
         CHASSIS.joint_motor[3].set.pos =
-            theta_transform(phi1_phi4_r[1], -J3_ANGLE_OFFSET, J3_DIRECTION, 1);
+            theta_transform(phi1_phi4_r[1], -J3_ZERO, J3_DIRECTION, 1);
     }
     // 检测设定角度是否超过电机角度限制
     CHASSIS.joint_motor[0].set.pos =
@@ -1435,13 +1509,13 @@ static void ConsoleStandUp(void)
     if (!(isnan(joint_pos_l[0]) || isnan(joint_pos_l[1]) || isnan(joint_pos_r[0]) ||
           isnan(joint_pos_r[1]))) {
         CHASSIS.joint_motor[0].set.pos =
-            theta_transform(joint_pos_l[1], -J0_ANGLE_OFFSET, J0_DIRECTION, 1);
+            theta_transform(joint_pos_l[1], -J0_ZERO, J0_DIRECTION, 1);
         CHASSIS.joint_motor[1].set.pos =
-            theta_transform(joint_pos_l[0], -J1_ANGLE_OFFSET, J1_DIRECTION, 1);
+            theta_transform(joint_pos_l[0], -J1_ZERO, J1_DIRECTION, 1);
         CHASSIS.joint_motor[2].set.pos =
-            theta_transform(joint_pos_r[1], -J2_ANGLE_OFFSET, J2_DIRECTION, 1);
+            theta_transform(joint_pos_r[1], -J2_ZERO, J2_DIRECTION, 1);
         CHASSIS.joint_motor[3].set.pos =
-            theta_transform(joint_pos_r[0], -J3_ANGLE_OFFSET, J3_DIRECTION, 1);
+            theta_transform(joint_pos_r[0], -J3_ZERO, J3_DIRECTION, 1);
     }
     // 检测设定角度是否超过电机角度限制
     CHASSIS.joint_motor[0].set.pos =
@@ -1475,6 +1549,7 @@ static void ConsoleStandUp(void)
 
 static void SendJointMotorCmd(void);
 static void SendWheelMotorCmd(void);
+static void RecordBlackbox(void);
 
 /**
  * @brief          发送控制量
@@ -1485,6 +1560,7 @@ void ChassisSendCmd(void)
 {
     SendJointMotorCmd();
     SendWheelMotorCmd();
+    RecordBlackbox();
 }
 
 /**
@@ -1631,6 +1707,63 @@ static void SendWheelMotorCmd(void)
     }
 }
 
+/**
+ * @brief 记录黑匣子数据，并在异常发生时触发保存
+ */
+static void RecordBlackbox(void)
+{
+    static ChassisMode_e last_mode = CHASSIS_OFF;
+    static bool last_take_off = false;
+    static bool last_offline = false;
+
+    BlackboxFrame_t frame;
+    frame.time = HAL_GetTick();
+    frame.mode = CHASSIS.mode;
+    frame.step = CHASSIS.step;
+    frame.online = 0;
+    for (uint8_t i = 0; i < 4; i++) {
+        frame.online |= (!CHASSIS.joint_motor[i].offline) << i;
+    }
+    for (uint8_t i = 0; i < 2; i++) {
+        frame.online |= (!CHASSIS.wheel_motor[i].offline) << (4 + i);
+    }
+
+    for (uint8_t i = 0; i < 2; i++) {
+        uint8_t offset = i * (BLACKBOX_THETA_R - BLACKBOX_THETA_L);
+        BlackboxSet(&frame, BLACKBOX_THETA_L + offset, CHASSIS.fdb.leg_state[i].theta);
+        BlackboxSet(&frame, BLACKBOX_THETA_DOT_L + offset, CHASSIS.fdb.leg_state[i].theta_dot);
+        BlackboxSet(&frame, BLACKBOX_X_L + offset, CHASSIS.fdb.leg_state[i].x);
+        BlackboxSet(&frame, BLACKBOX_X_DOT_L + offset, CHASSIS.fdb.leg_state[i].x_dot);
+        BlackboxSet(&frame, BLACKBOX_PHI_L + offset, CHASSIS.fdb.leg_state[i].phi);
+        BlackboxSet(&frame, BLACKBOX_PHI_DOT_L + offset, CHASSIS.fdb.leg_state[i].phi_dot);
+        BlackboxSet(&frame, BLACKBOX_L0_L + i, CHASSIS.fdb.leg[i].rod.L0);
+        BlackboxSet(&frame, BLACKBOX_JOINT_T0 + 2 * i, CHASSIS.cmd.leg[i].joint.T[0]);
+        BlackboxSet(&frame, BLACKBOX_JOINT_T1 + 2 * i, CHASSIS.cmd.leg[i].joint.T[1]);
+        BlackboxSet(&frame, BLACKBOX_WHEEL_T_L + i, CHASSIS.cmd.leg[i].wheel.T);
+    }
+    BlackboxSet(&frame, BLACKBOX_ROLL, CHASSIS.fdb.body.roll);
+    BlackboxSet(&frame, BLACKBOX_PITCH, CHASSIS.fdb.body.pitch);
+    BlackboxSet(&frame, BLACKBOX_YAW, CHASSIS.fdb.body.yaw);
+    BlackboxSet(&frame, BLACKBOX_PITCH_DOT, CHASSIS.fdb.body.pitch_dot);
+
+    BlackboxRecord(&frame);
+
+    bool take_off = CHASSIS.fdb.leg[0].is_take_off || CHASSIS.fdb.leg[1].is_take_off;
+    bool offline = ScanOfflineMotor();
+
+    if (CHASSIS.mode == CHASSIS_SAFE && last_mode != CHASSIS_SAFE && last_mode != CHASSIS_OFF) {
+        BlackboxTrigger(BLACKBOX_TRIGGER_SAFE);
+    } else if (take_off && !last_take_off) {
+        BlackboxTrigger(BLACKBOX_TRIGGER_TAKE_OFF);
+    } else if (offline && !last_offline) {
+        BlackboxTrigger(BLACKBOX_TRIGGER_MOTOR_OFFLINE);
+    }
+
+    last_mode = CHASSIS.mode;
+    last_take_off = take_off;
+    last_offline = offline;
+}
+
 /******************************************************************/
 /* Public                                                         */
 /*----------------------------------------------------------------*/
@@ -1674,5 +1807,27 @@ inline uint32_t ChassisGetDuration(void) { return CHASSIS.duration; }
 inline float ChassisGetSpeedVx(void) { return CHASSIS.fdb.speed_vector.vx; }
 inline float ChassisGetSpeedVy(void) { return CHASSIS.fdb.speed_vector.vy; }
 inline float ChassisGetSpeedWz(void) { return CHASSIS.fdb.speed_vector.wz; }
+
+/**
+ * @brief          安全模式(电机无力)且全部电机静止时允许param_store写flash
+ * @retval         允许1，不允许0
+ */
+bool_t ParamCommitAllowed(void)
+{
+    if (CHASSIS.mode != CHASSIS_SAFE) {
+        return 0;
+    }
+    for (uint8_t i = 0; i < 4; i++) {
+        if (fabsf(CHASSIS.joint_motor[i].fdb.vel) > CALIBRATE_STOP_VELOCITY) {
+            return 0;
+        }
+    }
+    for (uint8_t i = 0; i < 2; i++) {
+        if (fabsf(CHASSIS.wheel_motor[i].fdb.vel) > CALIBRATE_STOP_VELOCITY) {
+            return 0;
+        }
+    }
+    return 1;
+}
 #endif /* CHASSIS_BALANCE */
 /*------------------------------ End of File ------------------------------*/
@@ -41,6 +41,7 @@
 
 #if (CHASSIS_TYPE == CHASSIS_BALANCE)
 #include "IMU_task.h"
+#include "chassis_power_control.h"
 #include "custom_typedef.h"
 #include "kalman_filter.h"
 #include "math.h"
@@ -274,9 +275,11 @@ typedef struct
 
     PID_t pid;  // PID控制器
     LPF_t lpf;  // 低通滤波器
+    ChassisPower_s power;  // 驱动轮功率控制
 
     uint32_t last_time;  // (ms)上一次更新时间
     uint32_t duration;   // (ms)任务周期
+    float dt;            // (s)实际控制周期，由控制定时器测量，用于微分和积分
     float dyaw;          // (rad)(feedback)当前位置与云台中值角度差（用于坐标转换）
     uint16_t yaw_mid;    // (ecd)(preset)云台中值角度
 } Chassis_s;
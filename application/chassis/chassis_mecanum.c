@@ -7,6 +7,9 @@
   *  Version    Date            Author          Modification
   *  V1.0.0     Dec-9-2024      Tina_Lin         1. done
   *  V1.0.1     Dec-9-2024      Tina_Lin         1. 完成基本控制
+  *  V1.0.2     Oct-19-2026     Penguin         1. 添加功率限制
+  *  V1.0.3     Oct-19-2026     Penguin         1. 麦轮解算改为混合矩阵，驱动轮PID改为多通道PID
+  *  V1.0.4     Oct-19-2026     Penguin         1. 麦轮解算恢复为逐轮计算
   *
   @verbatim
   ==============================================================================
@@ -47,13 +50,8 @@ void ChassisInit(void)
     //yaw轴跟踪pid
     float chassis_yaw_pid[3] = {KP_CHASSIS_GIMBAL_FOLLOW_ANGLE, KI_CHASSIS_GIMBAL_FOLLOW_ANGLE, KD_CHASSIS_GIMBAL_FOLLOW_ANGLE};;
     
-    //获取底盘电机数据指针，初始化PID 
-    uint8_t i;
-    for (i = 0; i < 4; i++)
-    {
-        //底盘不跟随云台下的pid初始化
-        PID_init(&CHASSIS.motor_speed_pid[i], PID_POSITION, chassis_speed_pid, MAX_OUT_CHASSIS_WHEEL_SPEED,MAX_IOUT_CHASSIS_WHEEL_SPEED);
-    }
+    //底盘不跟随云台下的pid初始化，4个驱动轮共用同一组参数
+    PidBankInit(&CHASSIS.motor_speed_pid, PID_POSITION, 4, chassis_speed_pid, MAX_OUT_CHASSIS_WHEEL_SPEED,MAX_IOUT_CHASSIS_WHEEL_SPEED);
     //底盘跟随云台pid初始化
         PID_init(&CHASSIS.chassis_angle_pid, PID_POSITION, chassis_yaw_pid, 
         MAX_OUT_CHASSIS_GIMBAL_FOLLOW_ANGLE,MAX_IOUT_CHASSIS_GIMBAL_FOLLOW_ANGLE);
@@ -63,6 +61,10 @@ void ChassisInit(void)
     MotorInit(&CHASSIS.wheel_motor[1], 2, 1, DJI_M3508, 1, 1, 1);
     MotorInit(&CHASSIS.wheel_motor[2], 3, 1, DJI_M3508, 1, 1, 1);
     MotorInit(&CHASSIS.wheel_motor[3], 4, 1, DJI_M3508, 1, 1, 1);
+
+    ChassisPowerInit(
+        &CHASSIS.power, M3508_POWER_K_MECH, M3508_POWER_K_CU, M3508_POWER_K_W,
+        M3508_POWER_K_STATIC, 4);
 }
 
 /*-------------------- Set mode --------------------*/
@@ -95,6 +97,7 @@ void ChassisObserver(void) {
     for (uint8_t i = 0; i < 4; i++) {
         GetMotorMeasure(&CHASSIS.wheel_motor[i]);
     }
+    ChassisPowerUpdateSource(&CHASSIS.power);
 }
 
 /*-------------------- Reference --------------------*/
@@ -116,6 +119,9 @@ void ChassisReference(void) {
     vy_channel = rc_y * MAX_SPEED_VECTOR_VY;
 
     CHASSIS.dyaw = GetGimbalDeltaYawMid();
+    // 各模式共用同一组 sin/cos，每周期只计算一次
+    fp32 sin_yaw = sinf(CHASSIS.dyaw);
+    fp32 cos_yaw = cosf(CHASSIS.dyaw);
 
     //给定摇杆值(无死区)
     // CHASSIS.vx_rc_set = CHASSIS_VX_RC_SEN * CHASSIS.rc->rc.ch[3];
@@ -136,10 +142,7 @@ void ChassisReference(void) {
         case CHASSIS_FOLLOW_GIMBAL_YAW:{//云台跟随模式
 
             //GimbalSpeedVectorToChassisSpeedVector();
-            fp32 sin_yaw = 0.0f, cos_yaw = 0.0f;
 	        // 控制vx vy
-	        sin_yaw = sinf(CHASSIS.dyaw);
-	        cos_yaw = cosf(CHASSIS.dyaw);
             CHASSIS.vy_set = cos_yaw * CHASSIS.vy_rc_set - sin_yaw * CHASSIS.vx_rc_set;
 	        CHASSIS.vx_set = sin_yaw * CHASSIS.vy_rc_set + cos_yaw * CHASSIS.vx_rc_set;
 
@@ -156,10 +159,7 @@ void ChassisReference(void) {
         case CHASSIS_SPIN:{//小陀螺模式
 
             //GimbalSpeedVectorToChassisSpeedVector();
-            fp32 sin_yaw = 0.0f, cos_yaw = 0.0f;
 	        // 控制vx vy
-	        sin_yaw = sinf(CHASSIS.dyaw);
-	        cos_yaw = cosf(CHASSIS.dyaw);
             CHASSIS.vy_set = cos_yaw * CHASSIS.vy_rc_set - sin_yaw * CHASSIS.vx_rc_set;
 	        CHASSIS.vx_set = sin_yaw * CHASSIS.vy_rc_set + cos_yaw * CHASSIS.vx_rc_set;
             
@@ -182,10 +182,7 @@ void ChassisReference(void) {
 
     
     //GimbalSpeedVectorToChassisSpeedVector();
-    fp32 sin_yaw = 0.0f, cos_yaw = 0.0f;
 	// 控制vx vy
-	sin_yaw = sinf(CHASSIS.dyaw);
-	cos_yaw = cosf(CHASSIS.dyaw);
     CHASSIS.vy_set = cos_yaw * CHASSIS.vy_rc_set - sin_yaw * CHASSIS.vx_rc_set;
 	CHASSIS.vx_set = sin_yaw * CHASSIS.vy_rc_set + cos_yaw * CHASSIS.vx_rc_set;
 
@@ -243,16 +240,26 @@ void ChassisConsole(void)
     }
     
     //麦轮解算
-    CHASSIS.wheel_motor[0].set.vel = -CHASSIS.vx_set + CHASSIS.vy_set + (CHASSIS_WZ_SET_SCALE - 1.0f) * CHASSIS.wz_set;
-    CHASSIS.wheel_motor[1].set.vel =  CHASSIS.vx_set + CHASSIS.vy_set + (CHASSIS_WZ_SET_SCALE - 1.0f) * CHASSIS.wz_set;
-    CHASSIS.wheel_motor[2].set.vel =  CHASSIS.vx_set - CHASSIS.vy_set + (CHASSIS_WZ_SET_SCALE - 1.0f) * CHASSIS.wz_set;
-    CHASSIS.wheel_motor[3].set.vel = -CHASSIS.vx_set - CHASSIS.vy_set + (CHASSIS_WZ_SET_SCALE - 1.0f) * CHASSIS.wz_set; 
+    fp32 wheel_vel[4];
+    wheel_vel[0] = -CHASSIS.vx_set + CHASSIS.vy_set + (CHASSIS_WZ_SET_SCALE - 1.0f) * CHASSIS.wz_set;
+    wheel_vel[1] =  CHASSIS.vx_set + CHASSIS.vy_set + (CHASSIS_WZ_SET_SCALE - 1.0f) * CHASSIS.wz_set;
+    wheel_vel[2] =  CHASSIS.vx_set - CHASSIS.vy_set + (CHASSIS_WZ_SET_SCALE - 1.0f) * CHASSIS.wz_set;
+    wheel_vel[3] = -CHASSIS.vx_set - CHASSIS.vy_set + (CHASSIS_WZ_SET_SCALE - 1.0f) * CHASSIS.wz_set;
+
+    //pid速度计算
+    fp32 curr[4], vel[4];
+    for (i = 0; i < 4; i++)
+    {
+        CHASSIS.wheel_motor[i].set.vel = wheel_vel[i];
+        vel[i] = CHASSIS.wheel_motor[i].fdb.vel;
+    }
+    PidBankCalc(&CHASSIS.motor_speed_pid, vel, wheel_vel, curr);
 
-    //pid速度计算            
+    //功率限制
+    ChassisPowerLimit(&CHASSIS.power, curr, vel);
     for (i = 0; i < 4; i++)
     {
-        CHASSIS.wheel_motor[i].set.curr =
-        PID_calc(&CHASSIS.motor_speed_pid[i], CHASSIS.wheel_motor[i].fdb.vel, CHASSIS.wheel_motor[i].set.vel);
+        CHASSIS.wheel_motor[i].set.curr = curr[i];
     }
 
 }
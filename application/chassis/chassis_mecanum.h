@@ -25,10 +25,12 @@
 #include "math.h"
 #include "motor.h"
 #include "pid.h"
+#include "pid_bank.h"
 #include "remote_control.h"
 #include "struct_typedef.h"
 #include  "user_lib.h"
 #include "CAN_cmd_dji.h"
+#include "chassis_power_control.h"
 
 
 /*-------------------- Structural definition --------------------*/
@@ -85,9 +87,11 @@ typedef struct
 
     pid_type_def pid;  // PID控制器
     pid_type_def motor_chassis[4];               //chassis motor data.底盘电机数据
-    pid_type_def motor_speed_pid[4];             //motor speed PID.底盘电机速度pid
+    PidBank_s motor_speed_pid;                //motor speed PID.底盘电机速度pid
     pid_type_def chassis_angle_pid;           //follow angle PID.底盘跟随云台角度pid
 
+    ChassisPower_s power;                     //底盘功率控制
+
     float dyaw;  // (rad)(feedback)当前位置与云台中值角度差（用于坐标转换）
     uint16_t yaw_mid;  // (ecd)(preset)云台中值角度
     uint16_t current_set;
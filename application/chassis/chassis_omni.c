@@ -6,6 +6,9 @@
   * @history
   *  Version    Date            Author          Modification
   *  V1.0.0   2025.03.03       Harry_Wong        1.重新构建全向轮底盘，完成单底盘控制
+  *  V1.0.1   2026.10.19       Penguin           1.添加功率限制
+  *  V1.0.2   2026.10.19       Penguin           1.全向轮解算改为混合矩阵，驱动轮PID改为多通道PID
+  *  V1.0.3   2026.10.19       Penguin           1.全向轮解算恢复为逐轮计算
   @verbatim
   ==============================================================================
 
@@ -44,10 +47,7 @@ void ChassisInit(void)
 
     //step2 PID数据清零，设置PID参数
     const static fp32 wheel_vel[3]={KP_OMNI_VEL,KI_OMNI_VEL,KD_OMNI_VEL};
-    for (int i=0;i<4;++i)
-    {
-        PID_init(&chassis_pid.wheel_velocity[i],PID_POSITION,wheel_vel,MAX_OUT_OMNI_VEL,MAX_IOUT_OMNI_VEL);
-    }
+    PidBankInit(&chassis_pid.wheel_velocity,PID_POSITION,4,wheel_vel,MAX_OUT_OMNI_VEL,MAX_IOUT_OMNI_VEL);
     
     const static fp32 gimbal_follow[3]={KP_CHASSIS_FOLLOW_GIMBAL,KI_CHASSIS_FOLLOW_GIMBAL,KD_CHASSIS_FOLLOW_GIMBAL};
     PID_init(&chassis_pid.follow,PID_POSITION,gimbal_follow,MAX_OUT_CHASSIS_FOLLOW_GIMBAL,MAX_IOUT_CHASSIS_FOLLOW_GIMBAL);
@@ -58,6 +58,8 @@ void ChassisInit(void)
     MotorInit(&chassis.wheel[2],WHEEL_3_ID,WHEEL_3_CAN,WHEEL_3_MOTOR_TYPE,WHEEL_3_DIRECTION,WHEEL_3_RATIO,WHEEL_3_MODE);
     MotorInit(&chassis.wheel[3],WHEEL_4_ID,WHEEL_4_CAN,WHEEL_4_MOTOR_TYPE,WHEEL_4_DIRECTION,WHEEL_4_RATIO,WHEEL_4_MODE);
 
+    ChassisPowerInit(&chassis.power,M3508_POWER_K_MECH,M3508_POWER_K_CU,M3508_POWER_K_W,M3508_POWER_K_STATIC,4);
+
     //step4 初始模式设置
     chassis.mode = CHASSIS_LOCK;
 }
@@ -107,6 +109,8 @@ void ChassisObserver(void)
     }
 
     chassis.yaw_delta = GetGimbalDeltaYawMid();
+
+    ChassisPowerUpdateSource(&chassis.power);
 }
 
 /*-------------------- Reference --------------------*/
@@ -156,8 +160,10 @@ void ChassisReference(void)
         }
 
 
-        chassis.reference.vx =  chassis.reference_rc.vx * cosf(chassis.yaw_delta) - chassis.reference_rc.vy * sinf(chassis.yaw_delta);
-        chassis.reference.vy =  chassis.reference_rc.vx * sinf(chassis.yaw_delta) + chassis.reference_rc.vy * cos(chassis.yaw_delta);
+        fp32 sin_yaw = sinf(chassis.yaw_delta);
+        fp32 cos_yaw = cosf(chassis.yaw_delta);
+        chassis.reference.vx =  chassis.reference_rc.vx * cos_yaw - chassis.reference_rc.vy * sin_yaw;
+        chassis.reference.vy =  chassis.reference_rc.vx * sin_yaw + chassis.reference_rc.vy * cos_yaw;
 
         chassis.reference.wz=PID_calc(&chassis_pid.follow,0,chassis.yaw_delta);
     }
@@ -175,11 +181,15 @@ void ChassisConsole(void)
     chassis.set[0] = (sqrt(2)*(  chassis.reference.vx - chassis.reference.vy ) - WHEEL_CENTER_DISTANCE * chassis.reference.wz) / WHEEL_RADIUS * chassis.wheel[0].reduction_ratio;
     chassis.set[1] = (sqrt(2)*(  chassis.reference.vx + chassis.reference.vy ) - WHEEL_CENTER_DISTANCE * chassis.reference.wz) / WHEEL_RADIUS * chassis.wheel[1].reduction_ratio;
     chassis.set[2] = (sqrt(2)*( -chassis.reference.vx + chassis.reference.vy ) - WHEEL_CENTER_DISTANCE * chassis.reference.wz) / WHEEL_RADIUS * chassis.wheel[2].reduction_ratio;
-    chassis.set[3] = (sqrt(2)*( -chassis.reference.vx - chassis.reference.vy ) - WHEEL_CENTER_DISTANCE * chassis.reference.wz) / WHEEL_RADIUS * chassis.wheel[3].reduction_ratio; 
+    chassis.set[3] = (sqrt(2)*( -chassis.reference.vx - chassis.reference.vy ) - WHEEL_CENTER_DISTANCE * chassis.reference.wz) / WHEEL_RADIUS * chassis.wheel[3].reduction_ratio;
+
+    fp32 curr[4];
+    PidBankCalc(&chassis_pid.wheel_velocity,chassis.feedback,chassis.set,curr);
 
+    ChassisPowerLimit(&chassis.power,curr,chassis.feedback);
     for (int i=0;i<4;++i)
     {
-        chassis.wheel[i].set.curr = PID_calc(&chassis_pid.wheel_velocity[i], chassis.feedback[i], chassis.set[i]);
+        chassis.wheel[i].set.curr = curr[i];
     }
 }
 
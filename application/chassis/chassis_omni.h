@@ -24,10 +24,12 @@
 #include "math.h"
 #include "motor.h"
 #include "pid.h"
+#include "pid_bank.h"
 #include "remote_control.h"
 #include "struct_typedef.h"
 #include  "user_lib.h"
 #include "CAN_cmd_dji.h"
+#include "chassis_power_control.h"
 
 
 
@@ -43,7 +45,7 @@ typedef enum {
  */
  typedef struct
 {
-    pid_type_def wheel_velocity[4];//麦轮速度解算PID
+    PidBank_s wheel_velocity;//驱动轮速度PID
 
     pid_type_def follow; //云台跟随PID
 } PID_t;   
@@ -79,6 +81,8 @@ typedef struct
     fp32 set[4];
 
     fp32 yaw_delta;
+
+    ChassisPower_s power;  // 底盘功率控制
 } Chassis_s;
 
 
@@ -4,6 +4,7 @@
   * @brief      底盘功率控制
   * @history
   *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. 添加功率模型预测与驱动电机力矩分配
   *
   @verbatim
   ==============================================================================
@@ -13,15 +14,177 @@
   ****************************(C) COPYRIGHT 2024 Polarbear****************************
   */
 #include "chassis_power_control.h"
+
+#include "CAN_receive.h"
+#include "math.h"
 #include "referee.h"
-#include "arm_math.h"
-#include "detect_task.h"
 
-#define POWER_LIMIT         80.0f
-#define WARNING_POWER       40.0f   
-#define WARNING_POWER_BUFF  50.0f   
+// clang-format off
+#define NO_REFEREE_POWER_LIMIT  400.0f  // (W)裁判系统离线时的功率上限
+
+#define BUFFER_TARGET           30.0f   // (J)期望保留的缓冲能量
+#define BUFFER_KP               2.0f    // (W/J)缓冲能量高于期望值时允许多用的功率
+#define BUFFER_MIN_LIMIT_RATIO  0.5f    // 缓冲能量不足时功率上限不低于裁判系统上限的比例
+
+#define SUP_CAP_CAPACITANCE     6.0f    // (F)超级电容容量
+#define SUP_CAP_MIN_VOLTAGE     12.0f   // (V)超级电容最低放电电压
+#define SUP_CAP_DISCHARGE_TIME  5.0f    // (s)按该时间将剩余电容能量平均分配
+#define SUP_CAP_MAX_POWER       150.0f  // (W)超级电容最大放电功率
+// clang-format on
+
+static SupCap_s SUP_CAP;
+
+/**
+ * @brief          初始化功率控制
+ * @param[out]     pc 功率控制结构体
+ * @param[in]      k_mech 机械功率系数
+ * @param[in]      k_cu 铜损系数
+ * @param[in]      k_w 转速损耗系数
+ * @param[in]      k_static (W)静态功耗
+ * @param[in]      motor_num 驱动电机数量，不超过CHASSIS_POWER_MAX_MOTOR_NUM
+ * @retval         none
+ */
+void ChassisPowerInit(
+    ChassisPower_s * pc, fp32 k_mech, fp32 k_cu, fp32 k_w, fp32 k_static, uint8_t motor_num)
+{
+    pc->model.k_mech = k_mech;
+    pc->model.k_cu = k_cu;
+    pc->model.k_w = k_w;
+    pc->model.k_static = k_static;
+    pc->motor_num =
+        motor_num > CHASSIS_POWER_MAX_MOTOR_NUM ? CHASSIS_POWER_MAX_MOTOR_NUM : motor_num;
+
+    ChassisPowerSetSource(pc, false, 0.0f, 0.0f, false, 0.0f);
+    pc->predict = 0.0f;
+    pc->output = 0.0f;
+    pc->scale = 1.0f;
+}
+
+/**
+ * @brief          设置能量来源并计算本周期的功率上限
+ * @note           缓冲能量高于BUFFER_TARGET时多用，低于时少用，让缓冲能量稳定在BUFFER_TARGET附近；
+ *                 超级电容在线时额外加上电容可放电功率
+ * @param[out]     pc 功率控制结构体
+ * @param[in]      referee_online 裁判系统是否在线
+ * @param[in]      referee_limit (W)裁判系统功率上限
+ * @param[in]      buffer (J)缓冲能量
+ * @param[in]      cap_online 超级电容是否在线
+ * @param[in]      cap_voltage (V)超级电容电压
+ * @retval         none
+ */
+void ChassisPowerSetSource(
+    ChassisPower_s * pc, bool referee_online, fp32 referee_limit, fp32 buffer, bool cap_online,
+    fp32 cap_voltage)
+{
+    pc->source.referee_online = referee_online;
+    pc->source.referee_limit = referee_limit;
+    pc->source.buffer = buffer;
+    pc->source.cap_online = cap_online;
+    pc->source.cap_voltage = cap_voltage;
+
+    if (!referee_online) {
+        pc->limit = NO_REFEREE_POWER_LIMIT;
+        return;
+    }
+
+    fp32 limit = referee_limit + BUFFER_KP * (buffer - BUFFER_TARGET);
+    if (limit < referee_limit * BUFFER_MIN_LIMIT_RATIO) {
+        limit = referee_limit * BUFFER_MIN_LIMIT_RATIO;
+    }
+
+    if (cap_online && cap_voltage > SUP_CAP_MIN_VOLTAGE) {
+        fp32 cap_power = 0.5f * SUP_CAP_CAPACITANCE *
+                         (cap_voltage * cap_voltage - SUP_CAP_MIN_VOLTAGE * SUP_CAP_MIN_VOLTAGE) /
+                         SUP_CAP_DISCHARGE_TIME;
+        limit += cap_power > SUP_CAP_MAX_POWER ? SUP_CAP_MAX_POWER : cap_power;
+    }
+
+    pc->limit = limit;
+}
+
+/**
+ * @brief          从裁判系统和超级电容读取能量来源状态
+ * @param[out]     pc 功率控制结构体
+ * @retval         none
+ */
+void ChassisPowerUpdateSource(ChassisPower_s * pc)
+{
+    fp32 power, buffer;
+    get_chassis_power_and_buffer(&power, &buffer);
+    GetSupCapMeasure(&SUP_CAP);
+
+    ChassisPowerSetSource(
+        pc, !GetRefereeOffline(), robot_status.chassis_power_limit, buffer, !SUP_CAP.offline,
+        SUP_CAP.fdb.voltage_cap);
+}
+
+/**
+ * @brief          预测给定控制量下的底盘功率
+ * @param[in]      pc 功率控制结构体
+ * @param[in]      cmd 各电机控制量
+ * @param[in]      vel (rad/s)各电机转速
+ * @return         (W)预测功率
+ */
+fp32 ChassisPowerPredict(const ChassisPower_s * pc, const fp32 * cmd, const fp32 * vel)
+{
+    const PowerModel_s * m = &pc->model;
+    fp32 power = m->k_static;
+    for (uint8_t i = 0; i < pc->motor_num; i++) {
+        power += m->k_mech * cmd[i] * vel[i] + m->k_cu * cmd[i] * cmd[i] + m->k_w * vel[i] * vel[i];
+    }
+    return power;
+}
+
+/**
+ * @brief          对驱动电机控制量限幅，使预测功率不超过功率上限
+ * @note           回馈能量(机械功率+铜损<0)的电机保留原控制量，其余电机统一缩放为 s*u，
+ *                 总功率为 a*s^2 + b*s + c，其中 a = k_cu*sum(u^2)，b = k_mech*sum(u*w)，
+ *                 c 为与 s 无关的部分，令总功率等于上限解出 s
+ * @param[in,out]  pc 功率控制结构体
+ * @param[in,out]  cmd 各电机控制量
+ * @param[in]      vel (rad/s)各电机转速
+ * @retval         none
+ */
+void ChassisPowerLimit(ChassisPower_s * pc, fp32 * cmd, const fp32 * vel)
+{
+    const PowerModel_s * m = &pc->model;
+    fp32 a = 0.0f, b = 0.0f, c = m->k_static;
+
+    for (uint8_t i = 0; i < pc->motor_num; i++) {
+        fp32 mech = m->k_mech * cmd[i] * vel[i];
+        fp32 cu = m->k_cu * cmd[i] * cmd[i];
+        c += m->k_w * vel[i] * vel[i];
+        if (mech + cu < 0.0f) {
+            // 回馈能量的电机保留原控制量
+            c += mech + cu;
+        } else {
+            a += cu;
+            b += mech;
+        }
+    }
+
+    pc->predict = a + b + c;
+
+    fp32 s;
+    if (pc->predict <= pc->limit) {
+        s = 1.0f;
+    } else if (c >= pc->limit) {
+        s = 0.0f;
+    } else if (a < 1e-6f) {
+        s = (pc->limit - c) / b;
+    } else {
+        s = (-b + sqrtf(b * b + 4.0f * a * (pc->limit - c))) / (2.0f * a);
+    }
 
-#define NO_JUDGE_TOTAL_CURRENT_LIMIT    64000.0f    //16000 * 4, 
-#define BUFFER_TOTAL_CURRENT_LIMIT      16000.0f
-#define POWER_TOTAL_CURRENT_LIMIT       20000.0f
+    if (s < 1.0f) {
+        for (uint8_t i = 0; i < pc->motor_num; i++) {
+            if (m->k_mech * cmd[i] * vel[i] + m->k_cu * cmd[i] * cmd[i] >= 0.0f) {
+                cmd[i] *= s;
+            }
+        }
+    }
 
+    pc->scale = s;
+    pc->output = a * s * s + b * s + c;
+}
+/************************ END OF FILE ************************/
@@ -4,17 +4,89 @@
   * @brief      底盘功率控制
   * @history
   *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. 添加功率模型预测与驱动电机力矩分配
   *
   @verbatim
   ==============================================================================
+    单个电机功率模型:
+        P = k_mech * u * w + k_cu * u^2 + k_w * w^2
+        u为电机控制量(电流或力矩)，w为电机转速(rad/s)
+        k_mech * u * w 为机械功率，k_cu * u^2 为铜损，k_w * w^2 为摩擦等转速相关损耗
+    底盘总功率 = sum(P) + k_static
 
+    使用方法:
+        1. 初始化时调用 ChassisPowerInit 传入电机对应的模型参数
+        2. 每个控制周期调用 ChassisPowerUpdateSource 更新裁判系统和超级电容的状态
+        3. 计算出控制量后调用 ChassisPowerLimit 对控制量进行限幅，再发送给电机
+
+    限幅方法:
+        正在回馈能量(机械功率+铜损<0)的电机保持原控制量，
+        其余电机乘以同一个缩放系数s，s由一元二次方程直接解出，
+        计算量与电机数量成线性关系，无迭代，每周期耗时固定
   ==============================================================================
   @endverbatim
   ****************************(C) COPYRIGHT 2024 Polarbear****************************
   */
 #ifndef CHASSIS_POWER_CONTROL_H
 #define CHASSIS_POWER_CONTROL_H
-#include "chassis_task.h"
-#include "main.h"
+#include "stdbool.h"
+#include "struct_typedef.h"
+
+#define CHASSIS_POWER_MAX_MOTOR_NUM 4
+
+// clang-format off
+// M3508(C620)，u为C620电流控制值(-16384~16384 -> -20~20A)，w为转子转速
+#define M3508_POWER_K_MECH   1.907e-5f  // 20/16384(A) * 0.01562(N*m/A 转子端转矩常数)
+#define M3508_POWER_K_CU     4.5e-7f
+#define M3508_POWER_K_W      1.0e-5f
+#define M3508_POWER_K_STATIC 3.0f
+
+// MF9025，u为输出力矩(N*m)，w为输出轴转速
+#define MF9025_POWER_K_MECH   1.0f
+#define MF9025_POWER_K_CU     4.9f   // R / Kt^2
+#define MF9025_POWER_K_W      0.01f
+#define MF9025_POWER_K_STATIC 3.0f
+// clang-format on
+
+typedef struct
+{
+    fp32 k_mech;    // 机械功率系数
+    fp32 k_cu;      // 铜损系数
+    fp32 k_w;       // 转速损耗系数
+    fp32 k_static;  // (W)静态功耗
+} PowerModel_s;
+
+typedef struct
+{
+    PowerModel_s model;
+    uint8_t motor_num;
+
+    struct
+    {
+        bool referee_online;
+        fp32 referee_limit;  // (W)裁判系统功率上限
+        fp32 buffer;         // (J)缓冲能量
+        bool cap_online;
+        fp32 cap_voltage;    // (V)超级电容电压
+    } source;
+
+    fp32 limit;    // (W)本周期允许的底盘功率
+    fp32 predict;  // (W)限幅前的预测功率
+    fp32 output;   // (W)限幅后的预测功率
+    fp32 scale;    // 驱动电机控制量缩放系数
+} ChassisPower_s;
+
+extern void ChassisPowerInit(
+    ChassisPower_s * pc, fp32 k_mech, fp32 k_cu, fp32 k_w, fp32 k_static, uint8_t motor_num);
+
+extern void ChassisPowerSetSource(
+    ChassisPower_s * pc, bool referee_online, fp32 referee_limit, fp32 buffer, bool cap_online,
+    fp32 cap_voltage);
+
+extern void ChassisPowerUpdateSource(ChassisPower_s * pc);
+
+extern fp32 ChassisPowerPredict(const ChassisPower_s * pc, const fp32 * cmd, const fp32 * vel);
+
+extern void ChassisPowerLimit(ChassisPower_s * pc, fp32 * cmd, const fp32 * vel);
 
 #endif
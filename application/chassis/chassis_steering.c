@@ -0,0 +1,330 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       chassis_steering.c/h
+  * @brief      舵轮底盘控制器。
+  * @note       包括初始化，目标量更新、状态量更新、控制量计算与直接控制量的发送
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+*/
+#include "chassis_steering.h"
+
+#if (CHASSIS_TYPE == CHASSIS_STEERING_WHEEL)
+#include "CAN_cmd_dji.h"
+#include "CAN_receive.h"
+#include "chassis.h"
+#include "cmsis_os.h"
+#include "control_timer.h"
+#include "gimbal.h"
+#include "math.h"
+#include "remote_control.h"
+#include "string.h"
+#include "user_lib.h"
+
+#define RC_TO_ONE (1 / 670.0f)
+
+static const int8_t STEER_DIRECTION[4] = {S0_DIRECTION, S1_DIRECTION, S2_DIRECTION, S3_DIRECTION};
+static const int8_t WHEEL_DIRECTION[4] = {W0_DIRECTION, W1_DIRECTION, W2_DIRECTION, W3_DIRECTION};
+static const float STEER_ANGLE_OFFSET[4] = {
+    S0_ANGLE_OFFSET, S1_ANGLE_OFFSET, S2_ANGLE_OFFSET, S3_ANGLE_OFFSET};
+
+Chassis_s CHASSIS = {
+    .mode = CHASSIS_SAFE,
+    .error_code = 0,
+};
+
+/******************************************************************/
+/* Init                                                           */
+/******************************************************************/
+
+/**
+ * @brief          初始化
+ * @param[in]      none
+ * @retval         none
+ */
+void ChassisInit(void)
+{
+    /*-------------------- 初始化底盘电机 --------------------*/
+    for (uint8_t i = 0; i < 4; i++) {
+        MotorInit(
+            &CHASSIS.steer_motor[i], i + 1, STEER_CAN, DJI_M6020, STEER_DIRECTION[i], 1,
+            DJI_VOLTAGE_MODE);
+        MotorInit(
+            &CHASSIS.wheel_motor[i], i + 1, WHEEL_CAN, DJI_M3508, WHEEL_DIRECTION[i],
+            WHEEL_REDUCTION_RATIO, DJI_CURRENT_MODE);
+        CHASSIS.motor_array[i] = &CHASSIS.steer_motor[i];
+        CHASSIS.motor_array[i + 4] = &CHASSIS.wheel_motor[i];
+    }
+
+    /*-------------------- 初始化底盘PID --------------------*/
+    float steer_angle_pid[3] = {
+        KP_CHASSIS_STEER_ANGLE, KI_CHASSIS_STEER_ANGLE, KD_CHASSIS_STEER_ANGLE};
+    float steer_vel_pid[3] = {KP_CHASSIS_STEER_VEL, KI_CHASSIS_STEER_VEL, KD_CHASSIS_STEER_VEL};
+    float wheel_vel_pid[3] = {KP_CHASSIS_WHEEL_VEL, KI_CHASSIS_WHEEL_VEL, KD_CHASSIS_WHEEL_VEL};
+    for (uint8_t i = 0; i < 4; i++) {
+        PID_init(
+            &CHASSIS.pid.steer_angle[i], PID_POSITION, steer_angle_pid,
+            MAX_OUT_CHASSIS_STEER_ANGLE, MAX_IOUT_CHASSIS_STEER_ANGLE);
+        PID_init(
+            &CHASSIS.pid.steer_vel[i], PID_POSITION, steer_vel_pid, MAX_OUT_CHASSIS_STEER_VEL,
+            MAX_IOUT_CHASSIS_STEER_VEL);
+        PID_init(
+            &CHASSIS.pid.wheel_vel[i], PID_POSITION, wheel_vel_pid, MAX_OUT_CHASSIS_WHEEL_VEL,
+            MAX_IOUT_CHASSIS_WHEEL_VEL);
+    }
+    float follow_pid[3] = {
+        KP_CHASSIS_FOLLOW_GIMBAL, KI_CHASSIS_FOLLOW_GIMBAL, KD_CHASSIS_FOLLOW_GIMBAL};
+    PID_init(
+        &CHASSIS.pid.follow, PID_POSITION, follow_pid, MAX_OUT_CHASSIS_FOLLOW_GIMBAL,
+        MAX_IOUT_CHASSIS_FOLLOW_GIMBAL);
+
+    /*-------------------- 初始化运动学解算与功率控制 --------------------*/
+    const float module_x[4] = {MODULE_X, -MODULE_X, -MODULE_X, MODULE_X};
+    const float module_y[4] = {MODULE_Y, MODULE_Y, -MODULE_Y, -MODULE_Y};
+    SteeringSolverInit(&CHASSIS.solver, module_x, module_y, 4, MODULE_SPEED_DEADZONE);
+
+    ChassisPowerInit(
+        &CHASSIS.power, M3508_POWER_K_MECH, M3508_POWER_K_CU, M3508_POWER_K_W,
+        M3508_POWER_K_STATIC, 4);
+
+    /*-------------------- 值归零 --------------------*/
+    memset(&CHASSIS.fdb, 0, sizeof(CHASSIS.fdb));
+    memset(&CHASSIS.ref, 0, sizeof(CHASSIS.ref));
+}
+
+/******************************************************************/
+/* HandleException                                                */
+/******************************************************************/
+
+/**
+ * @brief          异常处理
+ * @param[in]      none
+ * @retval         none
+ */
+void ChassisHandleException(void)
+{
+    if (GetSbusOffline()) {
+        CHASSIS.error_code |= DBUS_ERROR_OFFSET;
+    } else {
+        CHASSIS.error_code &= ~DBUS_ERROR_OFFSET;
+    }
+
+    CHASSIS.error_code &= ~(STEER_ERROR_OFFSET | WHEEL_ERROR_OFFSET);
+    for (uint8_t i = 0; i < 4; i++) {
+        if (CHASSIS.steer_motor[i].offline) CHASSIS.error_code |= STEER_ERROR_OFFSET;
+        if (CHASSIS.wheel_motor[i].offline) CHASSIS.error_code |= WHEEL_ERROR_OFFSET;
+    }
+}
+
+/******************************************************************/
+/* SetMode                                                        */
+/******************************************************************/
+
+/**
+ * @brief          设置模式
+ * @param[in]      none
+ * @retval         none
+ */
+void ChassisSetMode(void)
+{
+    if (CHASSIS.error_code & (DBUS_ERROR_OFFSET | STEER_ERROR_OFFSET)) {
+        CHASSIS.mode = CHASSIS_SAFE;
+        return;
+    }
+
+    switch (GetRcType()) {
+        case RC_TYPE_ET08A: {
+            if (GetSbusCh(CHASSIS_MODE_CHANNEL) < ET08A_RC_CH_VALUE_OFFSET) {
+                CHASSIS.mode = CHASSIS_SAFE;
+            } else if (GetSbusCh(CHASSIS_MODE_CHANNEL) == ET08A_RC_CH_VALUE_OFFSET) {
+                CHASSIS.mode = CHASSIS_FOLLOW_GIMBAL_YAW;
+            } else {
+                CHASSIS.mode = CHASSIS_SPIN;
+            }
+        } break;
+
+        default: {
+            CHASSIS.mode = CHASSIS_SAFE;
+        } break;
+    }
+}
+
+/******************************************************************/
+/* Observer                                                       */
+/******************************************************************/
+
+/**
+ * @brief          更新状态量
+ * @param[in]      none
+ * @retval         none
+ */
+void ChassisObserver(void)
+{
+    CHASSIS.duration = (uint32_t)(GetControlDt(CONTROL_TIMER_CHASSIS) * 1000.0f + 0.5f);
+    CHASSIS.last_time = xTaskGetTickCount();
+
+    for (uint8_t i = 0; i < 4; i++) {
+        GetMotorMeasure(&CHASSIS.steer_motor[i]);
+        GetMotorMeasure(&CHASSIS.wheel_motor[i]);
+
+        CHASSIS.fdb.module.angle[i] = theta_format(
+            CHASSIS.steer_motor[i].fdb.pos * CHASSIS.steer_motor[i].direction -
+            STEER_ANGLE_OFFSET[i]);
+        CHASSIS.fdb.module.speed[i] = CHASSIS.wheel_motor[i].fdb.vel *
+                                      CHASSIS.wheel_motor[i].direction /
+                                      CHASSIS.wheel_motor[i].reduction_ratio * WHEEL_RADIUS;
+    }
+
+    SteeringForward(
+        &CHASSIS.solver, CHASSIS.fdb.module.angle, CHASSIS.fdb.module.speed,
+        &CHASSIS.fdb.speed_vector.vx, &CHASSIS.fdb.speed_vector.vy, &CHASSIS.fdb.speed_vector.wz);
+
+    ChassisPowerUpdateSource(&CHASSIS.power);
+}
+
+/******************************************************************/
+/* Reference                                                      */
+/******************************************************************/
+
+/**
+ * @brief          更新目标量
+ * @param[in]      none
+ * @retval         none
+ */
+void ChassisReference(void)
+{
+    int16_t rc_x = GetSbusCh(CHASSIS_X_CHANNEL) - ET08A_RC_CH_VALUE_OFFSET;
+    int16_t rc_y = GetSbusCh(CHASSIS_Y_CHANNEL) - ET08A_RC_CH_VALUE_OFFSET;
+    int16_t rc_wz = GetSbusCh(CHASSIS_WZ_CHANNEL) - ET08A_RC_CH_VALUE_OFFSET;
+
+    rc_deadband_limit(rc_x, rc_x, CHASSIS_RC_DEADLINE);
+    rc_deadband_limit(rc_y, rc_y, CHASSIS_RC_DEADLINE);
+    rc_deadband_limit(rc_wz, rc_wz, CHASSIS_RC_DEADLINE);
+
+    // 计算速度向量
+    ChassisSpeedVector_t v_set = {0.0f, 0.0f, 0.0f};
+    v_set.vx = rc_x * RC_TO_ONE * MAX_SPEED_VECTOR_VX;
+    v_set.vy = -rc_y * RC_TO_ONE * MAX_SPEED_VECTOR_VY;
+    v_set.wz = -rc_wz * RC_TO_ONE * MAX_SPEED_VECTOR_WZ;
+
+    switch (CHASSIS.mode) {
+        case CHASSIS_FREE: {  // 底盘坐标系下的速度
+            CHASSIS.ref.speed_vector = v_set;
+        } break;
+
+        case CHASSIS_FOLLOW_GIMBAL_YAW:
+        case CHASSIS_SPIN: {  // 云台坐标系下的速度，需要转换到底盘坐标系
+            float delta_yaw = GetGimbalDeltaYawMid();
+            float sin_yaw, cos_yaw;
+            SteeringSinCos(delta_yaw, &sin_yaw, &cos_yaw);
+            CHASSIS.ref.speed_vector.vx = cos_yaw * v_set.vx - sin_yaw * v_set.vy;
+            CHASSIS.ref.speed_vector.vy = sin_yaw * v_set.vx + cos_yaw * v_set.vy;
+
+            if (CHASSIS.mode == CHASSIS_SPIN) {
+                CHASSIS.ref.speed_vector.wz = SPIN_SPEED_WZ;
+            } else {
+                CHASSIS.ref.speed_vector.wz = PID_calc(&CHASSIS.pid.follow, -delta_yaw, 0);
+            }
+        } break;
+
+        case CHASSIS_OFF:
+        case CHASSIS_SAFE:
+        default: {
+            memset(&CHASSIS.ref.speed_vector, 0, sizeof(CHASSIS.ref.speed_vector));
+        } break;
+    }
+
+    SteeringInverse(
+        &CHASSIS.solver, CHASSIS.ref.speed_vector.vx, CHASSIS.ref.speed_vector.vy,
+        CHASSIS.ref.speed_vector.wz, CHASSIS.fdb.module.angle, CHASSIS.ref.module.angle,
+        CHASSIS.ref.module.speed);
+}
+
+/******************************************************************/
+/* Console                                                        */
+/******************************************************************/
+
+/**
+ * @brief          计算控制量
+ * @param[in]      none
+ * @retval         none
+ */
+void ChassisConsole(void)
+{
+    if (CHASSIS.mode == CHASSIS_SAFE || CHASSIS.mode == CHASSIS_OFF) {
+        for (uint8_t i = 0; i < 4; i++) {
+            CHASSIS.steer_motor[i].set.value = 0;
+            CHASSIS.wheel_motor[i].set.value = 0;
+            PID_clear(&CHASSIS.pid.steer_angle[i]);
+            PID_clear(&CHASSIS.pid.steer_vel[i]);
+            PID_clear(&CHASSIS.pid.wheel_vel[i]);
+        }
+        return;
+    }
+
+    float curr[4], vel[4];
+    for (uint8_t i = 0; i < 4; i++) {
+        // 舵向：角度环 + 速度环
+        float delta = theta_format(CHASSIS.ref.module.angle[i] - CHASSIS.fdb.module.angle[i]);
+        CHASSIS.steer_motor[i].set.vel = PID_calc(&CHASSIS.pid.steer_angle[i], 0, delta);
+        CHASSIS.steer_motor[i].set.value =
+            PID_calc(
+                &CHASSIS.pid.steer_vel[i],
+                CHASSIS.steer_motor[i].fdb.vel * CHASSIS.steer_motor[i].direction,
+                CHASSIS.steer_motor[i].set.vel) *
+            CHASSIS.steer_motor[i].direction;
+
+        // 驱动轮：速度环
+        CHASSIS.wheel_motor[i].set.vel = CHASSIS.ref.module.speed[i] / WHEEL_RADIUS *
+                                         CHASSIS.wheel_motor[i].reduction_ratio;
+        curr[i] = PID_calc(
+                      &CHASSIS.pid.wheel_vel[i],
+                      CHASSIS.wheel_motor[i].fdb.vel * CHASSIS.wheel_motor[i].direction,
+                      CHASSIS.wheel_motor[i].set.vel) *
+                  CHASSIS.wheel_motor[i].direction;
+        vel[i] = CHASSIS.wheel_motor[i].fdb.vel;
+    }
+
+    ChassisPowerLimit(&CHASSIS.power, curr, vel);
+    for (uint8_t i = 0; i < 4; i++) {
+        CHASSIS.wheel_motor[i].set.value = curr[i];
+    }
+}
+
+/******************************************************************/
+/* SendCmd                                                        */
+/******************************************************************/
+
+/**
+ * @brief          发送控制量
+ * @param[in]      none
+ * @retval         none
+ */
+void ChassisSendCmd(void)
+{
+#if (STEER_CAN == WHEEL_CAN)
+    DjiMultipleControl(WHEEL_CAN, 8, CHASSIS.motor_array);
+#else
+    DjiMultipleControl(STEER_CAN, 4, CHASSIS.motor_array);
+    DjiMultipleControl(WHEEL_CAN, 4, CHASSIS.motor_array + 4);
+#endif
+}
+
+/******************************************************************/
+/* Public                                                         */
+/******************************************************************/
+
+inline uint8_t ChassisGetStatus(void) { return CHASSIS.error_code; }
+inline uint32_t ChassisGetDuration(void) { return CHASSIS.duration; }
+inline float ChassisGetSpeedVx(void) { return CHASSIS.fdb.speed_vector.vx; }
+inline float ChassisGetSpeedVy(void) { return CHASSIS.fdb.speed_vector.vy; }
+inline float ChassisGetSpeedWz(void) { return CHASSIS.fdb.speed_vector.wz; }
+#endif  // CHASSIS_STEERING_WHEEL
+/*------------------------------ End of File ------------------------------*/
@@ -0,0 +1,111 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       chassis_steering.c/h
+  * @brief      舵轮底盘控制器。
+  * @note       包括初始化，目标量更新、状态量更新、控制量计算与直接控制量的发送
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+    4个舵轮模块，舵向电机为GM6020(电压控制)，驱动电机为M3508(电流控制)
+    模块顺序：0-左前，1-左后，2-右后，3-右前
+    遥控器(ET08A)模式通道：
+        下：安全模式
+        中：云台跟随
+        上：小陀螺
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+*/
+#ifndef CHASSIS_STEERING_H
+#define CHASSIS_STEERING_H
+
+#include "robot_param.h"
+
+#if (CHASSIS_TYPE == CHASSIS_STEERING_WHEEL)
+#include "chassis_power_control.h"
+#include "chassis_steering_solver.h"
+#include "custom_typedef.h"
+#include "motor.h"
+#include "pid.h"
+#include "struct_typedef.h"
+
+// clang-format off
+#define STEER_ERROR_OFFSET   ((uint8_t)1 << 0)  // 舵向电机错误偏移量
+#define WHEEL_ERROR_OFFSET   ((uint8_t)1 << 1)  // 驱动轮电机错误偏移量
+#define DBUS_ERROR_OFFSET    ((uint8_t)1 << 2)  // dbus错误偏移量
+// clang-format on
+
+/*-------------------- Structural definition --------------------*/
+
+typedef enum {
+    CHASSIS_OFF,                // 底盘关闭
+    CHASSIS_SAFE,               // 底盘无力，所有控制量置0
+    CHASSIS_FREE,               // 底盘不跟随云台，速度为底盘坐标系下的速度
+    CHASSIS_FOLLOW_GIMBAL_YAW,  // 底盘跟随云台，速度为云台坐标系下的速度
+    CHASSIS_SPIN,               // 小陀螺，速度为云台坐标系下的速度
+} ChassisMode_e;
+
+/**
+ * @brief 舵轮模块状态
+ */
+typedef struct
+{
+    float angle[4];  // (rad)舵向角度，0为底盘x正方向，逆时针为正
+    float speed[4];  // (m/s)轮速
+} ModuleState_t;
+
+/**
+ * @brief  底盘数据结构体
+ * @note   底盘坐标使用右手系，前进方向为x轴，左方向为y轴，上方向为z轴
+ */
+typedef struct
+{
+    ChassisMode_e mode;    // 底盘模式
+    uint8_t error_code;    // 底盘错误代码
+
+    /*-------------------- Motors --------------------*/
+    Motor_s steer_motor[4];  // 舵向电机
+    Motor_s wheel_motor[4];  // 驱动轮电机
+    Motor_s * motor_array[8];  // 发送用电机数组，前4个为舵向电机，后4个为驱动轮电机
+
+    /*-------------------- Values --------------------*/
+    struct
+    {
+        ChassisSpeedVector_t speed_vector;
+        ModuleState_t module;
+    } ref, fdb;
+
+    struct
+    {
+        pid_type_def steer_angle[4];
+        pid_type_def steer_vel[4];
+        pid_type_def wheel_vel[4];
+        pid_type_def follow;
+    } pid;
+
+    SteeringSolver_s solver;
+    ChassisPower_s power;  // 驱动轮功率控制
+
+    uint32_t last_time;  // (ms)上一次更新时间
+    uint32_t duration;   // (ms)任务周期
+} Chassis_s;
+
+extern void ChassisInit(void);
+
+extern void ChassisHandleException(void);
+
+extern void ChassisSetMode(void);
+
+extern void ChassisObserver(void);
+
+extern void ChassisReference(void);
+
+extern void ChassisConsole(void);
+
+extern void ChassisSendCmd(void);
+
+#endif  // CHASSIS_STEERING_WHEEL
+#endif  // CHASSIS_STEERING_H
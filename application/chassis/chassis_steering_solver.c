@@ -0,0 +1,169 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       chassis_steering_solver.c/h
+  * @brief      舵轮底盘运动学解算
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+#include "chassis_steering_solver.h"
+
+#include "math.h"
+
+#define STEERING_PI 3.14159265358979f
+#define STEERING_SIN_TABLE_SCALE (STEERING_SIN_TABLE_SIZE / (2.0f * STEERING_PI))
+
+static fp32 SIN_TABLE[STEERING_SIN_TABLE_SIZE + 1];
+static bool_t SIN_TABLE_READY = 0;
+
+/**
+ * @brief          将[-2pi, 2pi]内的角度限制到[-pi, pi]
+ */
+static fp32 WrapAngle(fp32 angle)
+{
+    if (angle > STEERING_PI) {
+        angle -= 2.0f * STEERING_PI;
+    } else if (angle < -STEERING_PI) {
+        angle += 2.0f * STEERING_PI;
+    }
+    return angle;
+}
+
+/**
+ * @brief          查表计算sin和cos
+ * @param[in]      angle (rad)角度，任意范围
+ * @param[out]     sin_out sin值
+ * @param[out]     cos_out cos值
+ * @retval         none
+ */
+void SteeringSinCos(fp32 angle, fp32 * sin_out, fp32 * cos_out)
+{
+    fp32 pos = angle * STEERING_SIN_TABLE_SCALE;
+    int32_t index = (int32_t)pos;
+    if (pos < index) index--;  // 向下取整
+    fp32 frac = pos - index;
+
+    uint32_t i_sin = (uint32_t)index & (STEERING_SIN_TABLE_SIZE - 1);
+    uint32_t i_cos = (i_sin + STEERING_SIN_TABLE_SIZE / 4) & (STEERING_SIN_TABLE_SIZE - 1);
+
+    *sin_out = SIN_TABLE[i_sin] + (SIN_TABLE[i_sin + 1] - SIN_TABLE[i_sin]) * frac;
+    *cos_out = SIN_TABLE[i_cos] + (SIN_TABLE[i_cos + 1] - SIN_TABLE[i_cos]) * frac;
+}
+
+/**
+ * @brief          初始化舵轮解算器
+ * @param[out]     solver 解算器
+ * @param[in]      x (m)各模块在底盘坐标系下的x坐标
+ * @param[in]      y (m)各模块在底盘坐标系下的y坐标
+ * @param[in]      module_num 模块数量
+ * @param[in]      speed_deadzone (m/s)低于该速度时舵向保持当前角度
+ * @note           正运动学默认各模块关于底盘中心对称分布
+ * @retval         none
+ */
+void SteeringSolverInit(
+    SteeringSolver_s * solver, const fp32 * x, const fp32 * y, uint8_t module_num,
+    fp32 speed_deadzone)
+{
+    if (!SIN_TABLE_READY) {
+        for (uint16_t i = 0; i <= STEERING_SIN_TABLE_SIZE; i++) {
+            SIN_TABLE[i] = sinf(i / STEERING_SIN_TABLE_SCALE);
+        }
+        SIN_TABLE_READY = 1;
+    }
+
+    if (module_num > STEERING_MODULE_MAX_NUM) module_num = STEERING_MODULE_MAX_NUM;
+    solver->module_num = module_num;
+    solver->speed_deadzone = speed_deadzone;
+
+    fp32 r2_sum = 0.0f;
+    for (uint8_t i = 0; i < module_num; i++) {
+        solver->x[i] = x[i];
+        solver->y[i] = y[i];
+        r2_sum += x[i] * x[i] + y[i] * y[i];
+    }
+    solver->r2_sum_inv = r2_sum > 0.0f ? 1.0f / r2_sum : 0.0f;
+}
+
+/**
+ * @brief          逆运动学，由底盘速度计算各模块的期望角度和轮速
+ * @param[in]      solver 解算器
+ * @param[in]      vx (m/s)底盘x方向速度
+ * @param[in]      vy (m/s)底盘y方向速度
+ * @param[in]      wz (rad/s)底盘旋转角速度
+ * @param[in]      fdb_angle (rad)各模块当前角度
+ * @param[out]     ref_angle (rad)各模块期望角度，范围[-pi, pi]
+ * @param[out]     ref_speed (m/s)各模块期望轮速，已经过反向和余弦缩放
+ * @retval         none
+ */
+void SteeringInverse(
+    const SteeringSolver_s * solver, fp32 vx, fp32 vy, fp32 wz, const fp32 * fdb_angle,
+    fp32 * ref_angle, fp32 * ref_speed)
+{
+    for (uint8_t i = 0; i < solver->module_num; i++) {
+        fp32 v_x = vx - wz * solver->y[i];
+        fp32 v_y = vy + wz * solver->x[i];
+        fp32 speed = sqrtf(v_x * v_x + v_y * v_y);
+
+        if (speed < solver->speed_deadzone) {
+            ref_angle[i] = fdb_angle[i];
+            ref_speed[i] = 0.0f;
+            continue;
+        }
+
+        fp32 delta = WrapAngle(atan2f(v_y, v_x) - fdb_angle[i]);
+        if (delta > STEERING_PI / 2) {
+            delta -= STEERING_PI;
+            speed = -speed;
+        } else if (delta < -STEERING_PI / 2) {
+            delta += STEERING_PI;
+            speed = -speed;
+        }
+
+        fp32 s, c;
+        SteeringSinCos(delta, &s, &c);
+        ref_angle[i] = WrapAngle(fdb_angle[i] + delta);
+        ref_speed[i] = speed * c;
+    }
+}
+
+/**
+ * @brief          正运动学，由各模块的角度和轮速估计底盘速度
+ * @param[in]      solver 解算器
+ * @param[in]      fdb_angle (rad)各模块角度
+ * @param[in]      fdb_speed (m/s)各模块轮速
+ * @param[out]     vx (m/s)底盘x方向速度
+ * @param[out]     vy (m/s)底盘y方向速度
+ * @param[out]     wz (rad/s)底盘旋转角速度
+ * @retval         none
+ */
+void SteeringForward(
+    const SteeringSolver_s * solver, const fp32 * fdb_angle, const fp32 * fdb_speed, fp32 * vx,
+    fp32 * vy, fp32 * wz)
+{
+    fp32 sum_x = 0.0f, sum_y = 0.0f, sum_w = 0.0f;
+    for (uint8_t i = 0; i < solver->module_num; i++) {
+        fp32 s, c;
+        SteeringSinCos(fdb_angle[i], &s, &c);
+        fp32 v_x = fdb_speed[i] * c;
+        fp32 v_y = fdb_speed[i] * s;
+        sum_x += v_x;
+        sum_y += v_y;
+        sum_w += solver->x[i] * v_y - solver->y[i] * v_x;
+    }
+
+    if (solver->module_num == 0) {
+        *vx = *vy = *wz = 0.0f;
+        return;
+    }
+    *vx = sum_x / solver->module_num;
+    *vy = sum_y / solver->module_num;
+    *wz = sum_w * solver->r2_sum_inv;
+}
+/************************ END OF FILE ************************/
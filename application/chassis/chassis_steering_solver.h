@@ -0,0 +1,59 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       chassis_steering_solver.c/h
+  * @brief      舵轮底盘运动学解算
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+    逆运动学:
+        模块i位于底盘坐标系(x_i, y_i)，底盘速度(vx, vy, wz)下模块速度为
+            v_ix = vx - wz * y_i
+            v_iy = vy + wz * x_i
+        模块期望角度 atan2(v_iy, v_ix)，期望速度 sqrt(v_ix^2 + v_iy^2)
+    最短转向:
+        期望角度与当前角度之差超过90度时，改为转向反方向并反转轮速，
+        舵向电机每次最多转动90度
+    余弦缩放:
+        轮速乘以 cos(角度误差)，舵向未转到位时减小轮速，避免侧滑
+    正运动学:
+        由各模块的角度和轮速最小二乘估计底盘速度
+    查表:
+        模块角度的sin/cos使用初始化时生成的表线性插值，不在控制周期中调用sinf/cosf
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+#ifndef CHASSIS_STEERING_SOLVER_H
+#define CHASSIS_STEERING_SOLVER_H
+#include "struct_typedef.h"
+
+#define STEERING_MODULE_MAX_NUM 4
+#define STEERING_SIN_TABLE_SIZE 256  // 一圈的表长度，线性插值误差约为 (2*pi/N)^2/8
+
+typedef struct
+{
+    uint8_t module_num;
+    fp32 x[STEERING_MODULE_MAX_NUM];  // (m)模块在底盘坐标系下的位置
+    fp32 y[STEERING_MODULE_MAX_NUM];  // (m)
+    fp32 r2_sum_inv;                  // 1/sum(x^2+y^2)，正运动学使用
+    fp32 speed_deadzone;              // (m/s)低于该速度时舵向保持当前角度
+} SteeringSolver_s;
+
+extern void SteeringSinCos(fp32 angle, fp32 * sin_out, fp32 * cos_out);
+
+extern void SteeringSolverInit(
+    SteeringSolver_s * solver, const fp32 * x, const fp32 * y, uint8_t module_num,
+    fp32 speed_deadzone);
+
+extern void SteeringInverse(
+    const SteeringSolver_s * solver, fp32 vx, fp32 vy, fp32 wz, const fp32 * fdb_angle,
+    fp32 * ref_angle, fp32 * ref_speed);
+
+extern void SteeringForward(
+    const SteeringSolver_s * solver, const fp32 * fdb_angle, const fp32 * fdb_speed, fp32 * vx,
+    fp32 * vy, fp32 * wz);
+
+#endif
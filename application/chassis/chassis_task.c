@@ -9,6 +9,7 @@
   *  V1.0.0     Apr-1-2024      Penguin         1. done
   *  V1.0.1     Apr-16-2024     Penguin         1. 完成基本框架
   *  V1.0.2     Jun-13-2024     Penguin         1. 添加默认的任务控制时间类宏定义
+  *  V1.0.3     Oct-19-2026     Penguin         1. 每个控制周期更新一次虚拟云台
   *
   @verbatim
   ==============================================================================
@@ -25,6 +26,10 @@
 #include "chassis_omni.h"
 #include "chassis_steering.h"
 #include "cmsis_os.h"
+#include "control_timer.h"
+#include "gimbal_virtual.h"
+#include "mem_pool.h"
+#include "task_monitor.h"
 #include "usb_debug.h"
 
 #ifndef CHASSIS_TASK_INIT_TIME
@@ -35,6 +40,10 @@
 #define CHASSIS_CONTROL_TIME_MS 2
 #endif  // CHASSIS_CONTROL_TIME_MS
 
+#ifndef CHASSIS_CONTROL_PHASE
+#define CHASSIS_CONTROL_PHASE 0  // (ms)控制周期内的释放相位偏移
+#endif  // CHASSIS_CONTROL_PHASE
+
 #if INCLUDE_uxTaskGetStackHighWaterMark
 uint32_t chassis_high_water;
 #endif
@@ -60,8 +69,16 @@ void chassis_task(void const * pvParameters)
     vTaskDelay(CHASSIS_TASK_INIT_TIME);
     // 初始化底盘
     ChassisInit();
+    mem_pool_init_release();
+    TaskMonitorRegister(CHASSIS_CONTROL_TIME_MS);
+    ControlTimerInit(CONTROL_TIMER_CHASSIS, CHASSIS_CONTROL_TIME_MS, CHASSIS_CONTROL_PHASE);
 
     while (1) {
+        TaskMonitorLoop();
+#if (GIMBAL_TYPE == GIMBAL_NONE)
+        // 更新虚拟云台，底盘中通过 GetGimbalDeltaYawMid 获取
+        GimbalVirtualUpdate();
+#endif
         // 更新状态量
         ChassisObserver();
         // 处理异常
@@ -75,7 +92,7 @@ void chassis_task(void const * pvParameters)
         // 发送控制量
         ChassisSendCmd();
         // 系统延时
-        vTaskDelay(CHASSIS_CONTROL_TIME_MS);
+        ControlTimerWait(CONTROL_TIMER_CHASSIS);
 
 #if INCLUDE_uxTaskGetStackHighWaterMark
         chassis_high_water = uxTaskGetStackHighWaterMark(NULL);
@@ -0,0 +1,205 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       power_sim.c
+  * @brief      在PC上运行的底盘功率控制仿真，验证缓冲能量不会被耗尽
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+    编译运行：
+      cc -Istub -I.. -I../../typedef -o power_sim power_sim.c ../chassis_power_control.c -lm
+      ./power_sim
+    仿真对象：
+      4个M3508(C620)，速度环P控制，目标转速在正反转之间反复阶跃，
+      电机真实功耗参数比控制器中的模型大20%，用来检验模型误差下的余量。
+      裁判系统每1ms按 (功率-上限)*dt 扣除缓冲能量，每20ms上报一次功率和缓冲能量；
+      超级电容以略低于上限的功率从电池取电，负载超出部分由电容提供。
+    检查项(任一不满足返回非0)：
+      1. 不限功率时缓冲能量会耗尽(说明工况足够激烈)
+      2. 限功率时缓冲能量始终大于0
+      3. 有超级电容时电容能量被使用，且平均转速高于无电容时
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include <math.h>
+#include <stdio.h>
+
+#include "CAN_receive.h"
+#include "chassis_power_control.h"
+#include "referee.h"
+
+#define SIM_TIME 20.0f       // (s)仿真时长
+#define SIM_DT 0.001f        // (s)仿真步长
+#define CONTROL_PERIOD 2     // (ms)控制周期
+#define REFEREE_PERIOD 20    // (ms)裁判系统功率数据上报周期
+#define REVERSE_PERIOD 1500  // (ms)目标转速换向周期
+
+#define REFEREE_POWER_LIMIT 60
+#define BUFFER_MAX 60.0f
+
+#define KT 0.01562f                  // (N*m/A)转子端转矩常数
+#define CURRENT_SCALE (20.0f / 16384.0f)
+#define ROTOR_INERTIA 9.3e-5f        // (kg*m^2)折算到转子的转动惯量
+#define FRICTION_TORQUE 0.01f        // (N*m)库伦摩擦
+#define MODEL_ERROR 1.2f             // 真实损耗 / 模型损耗
+#define REAL_STATIC_POWER 4.0f       // (W)
+
+#define WHEEL_VEL_MAX 900.0f  // (rad/s)转子目标转速
+#define WHEEL_KP 40.0f
+#define CURRENT_MAX 16384.0f
+
+#define CAP_VOLTAGE_MAX 24.0f
+#define CAP_VOLTAGE_MIN 12.0f
+#define CAP_CAPACITANCE 6.0f
+#define CAP_INPUT_RATIO 0.95f  // 电容模块取电功率 / 功率上限
+
+/*-------------------- 裁判系统与超级电容接口 --------------------*/
+
+robot_status_t robot_status;
+static fp32 REPORT_POWER, REPORT_BUFFER;
+static bool CAP_ONLINE;
+static fp32 CAP_VOLTAGE;
+
+void get_chassis_power_and_buffer(fp32 * power, fp32 * buffer)
+{
+    *power = REPORT_POWER;
+    *buffer = REPORT_BUFFER;
+}
+
+bool GetRefereeOffline(void) { return false; }
+
+void GetSupCapMeasure(SupCap_s * p_sup_cap)
+{
+    p_sup_cap->offline = !CAP_ONLINE;
+    p_sup_cap->fdb.voltage_cap = CAP_VOLTAGE;
+}
+
+/*-------------------- 仿真 --------------------*/
+
+typedef struct
+{
+    fp32 min_buffer;
+    fp32 mean_power;
+    fp32 mean_speed;
+    fp32 cap_voltage;
+} SimResult_t;
+
+static fp32 Sign(fp32 x) { return x > 0.0f ? 1.0f : (x < 0.0f ? -1.0f : 0.0f); }
+
+static SimResult_t Simulate(bool limit_enable, bool cap_enable)
+{
+    static const fp32 DIRECTION[4] = {1.0f, 1.0f, -1.0f, -1.0f};
+    ChassisPower_s power;
+    fp32 vel[4] = {0}, cmd[4] = {0};
+    fp32 buffer = BUFFER_MAX;
+    SimResult_t result = {BUFFER_MAX, 0.0f, 0.0f, 0.0f};
+    int steps = (int)(SIM_TIME / SIM_DT);
+
+    ChassisPowerInit(
+        &power, M3508_POWER_K_MECH, M3508_POWER_K_CU, M3508_POWER_K_W, M3508_POWER_K_STATIC, 4);
+    robot_status.chassis_power_limit = REFEREE_POWER_LIMIT;
+    REPORT_POWER = 0.0f;
+    REPORT_BUFFER = buffer;
+    CAP_ONLINE = cap_enable;
+    CAP_VOLTAGE = cap_enable ? CAP_VOLTAGE_MAX : 0.0f;
+
+    for (int t = 0; t < steps; t++) {
+        if (t % CONTROL_PERIOD == 0) {
+            fp32 target = ((t / REVERSE_PERIOD) % 2) ? -WHEEL_VEL_MAX : WHEEL_VEL_MAX;
+            for (int i = 0; i < 4; i++) {
+                cmd[i] = WHEEL_KP * (target * DIRECTION[i] - vel[i]);
+                if (cmd[i] > CURRENT_MAX) cmd[i] = CURRENT_MAX;
+                if (cmd[i] < -CURRENT_MAX) cmd[i] = -CURRENT_MAX;
+            }
+            ChassisPowerUpdateSource(&power);
+            if (limit_enable) {
+                ChassisPowerLimit(&power, cmd, vel);
+            }
+        }
+
+        // 电机动力学与真实功耗
+        fp32 load = REAL_STATIC_POWER;
+        for (int i = 0; i < 4; i++) {
+            fp32 torque = KT * cmd[i] * CURRENT_SCALE;
+            load += torque * vel[i] + MODEL_ERROR * (M3508_POWER_K_CU * cmd[i] * cmd[i] +
+                                                     M3508_POWER_K_W * vel[i] * vel[i]);
+            vel[i] += (torque - FRICTION_TORQUE * Sign(vel[i])) / ROTOR_INERTIA * SIM_DT;
+            result.mean_speed += fabsf(vel[i]) / 4.0f;
+        }
+        if (load < 0.0f) load = 0.0f;
+
+        // 超级电容
+        fp32 referee_power = load;
+        if (cap_enable) {
+            fp32 input = CAP_INPUT_RATIO * REFEREE_POWER_LIMIT;
+            fp32 energy = 0.5f * CAP_CAPACITANCE * CAP_VOLTAGE * CAP_VOLTAGE;
+            fp32 energy_min = 0.5f * CAP_CAPACITANCE * CAP_VOLTAGE_MIN * CAP_VOLTAGE_MIN;
+            fp32 energy_max = 0.5f * CAP_CAPACITANCE * CAP_VOLTAGE_MAX * CAP_VOLTAGE_MAX;
+            energy += (input - load) * SIM_DT;
+            if (energy < energy_min) {
+                referee_power += (energy_min - energy) / SIM_DT;
+                energy = energy_min;
+            } else if (energy > energy_max) {
+                referee_power = input - (energy - energy_max) / SIM_DT;
+                energy = energy_max;
+            } else {
+                referee_power = input;
+            }
+            CAP_VOLTAGE = sqrtf(2.0f * energy / CAP_CAPACITANCE);
+        }
+
+        // 裁判系统
+        buffer -= (referee_power - REFEREE_POWER_LIMIT) * SIM_DT;
+        if (buffer > BUFFER_MAX) buffer = BUFFER_MAX;
+        if (buffer < result.min_buffer) result.min_buffer = buffer;
+        if (t % REFEREE_PERIOD == 0) {
+            REPORT_POWER = referee_power;
+            REPORT_BUFFER = buffer > 0.0f ? buffer : 0.0f;
+        }
+        result.mean_power += referee_power;
+    }
+
+    result.mean_power /= steps;
+    result.mean_speed /= steps;
+    result.cap_voltage = CAP_VOLTAGE;
+    return result;
+}
+
+static void PrintResult(const char * name, SimResult_t r)
+{
+    printf(
+        "%-16s min_buffer=%7.2fJ mean_power=%6.2fW mean_speed=%6.1frad/s cap=%5.2fV\n", name,
+        r.min_buffer, r.mean_power, r.mean_speed, r.cap_voltage);
+}
+
+int main(void)
+{
+    int fail = 0;
+    SimResult_t unlimited = Simulate(false, false);
+    SimResult_t limited = Simulate(true, false);
+    SimResult_t cap = Simulate(true, true);
+
+    PrintResult("no limit", unlimited);
+    PrintResult("limit", limited);
+    PrintResult("limit + supcap", cap);
+
+    if (unlimited.min_buffer > 0.0f) {
+        printf("FAIL: test case does not exceed the power limit\n");
+        fail = 1;
+    }
+    if (limited.min_buffer <= 0.0f || cap.min_buffer <= 0.0f) {
+        printf("FAIL: buffer energy exhausted\n");
+        fail = 1;
+    }
+    if (cap.cap_voltage >= CAP_VOLTAGE_MAX || cap.mean_speed <= limited.mean_speed) {
+        printf("FAIL: supercap energy not used\n");
+        fail = 1;
+    }
+
+    if (!fail) printf("PASS\n");
+    return fail;
+}
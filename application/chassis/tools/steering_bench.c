@@ -0,0 +1,150 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       steering_bench.c
+  * @brief      在PC上运行的舵轮解算测试程序，检查解算结果并统计单周期解算耗时
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+    编译运行：
+      cc -O2 -I.. -I../../typedef -o steering_bench steering_bench.c ../chassis_steering_solver.c -lm
+      ./steering_bench
+    检查项(任一不满足返回非0)：
+      1. 查表sin/cos与sinf/cosf的最大误差小于1e-4
+      2. 舵向每次转动不超过90度
+      3. 舵向转到位后，由正运动学恢复的底盘速度与给定值一致
+    耗时：
+      单周期 = 4个模块的逆运动学 + 正运动学，与直接调用sinf/cosf的版本对比。
+      PC上的耗时只用于比较两种实现，实际耗时需在C板上用DWT计数测量
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "chassis_steering_solver.h"
+
+#define TEST_NUM 100000
+#define BENCH_NUM 2000000
+
+static const fp32 MODULE_X[4] = {0.2f, -0.2f, -0.2f, 0.2f};
+static const fp32 MODULE_Y[4] = {0.2f, 0.2f, -0.2f, -0.2f};
+
+static uint32_t SEED = 1;
+
+static fp32 Rand(fp32 min, fp32 max)
+{
+    SEED = SEED * 1664525u + 1013904223u;
+    return min + (max - min) * (SEED >> 8) / (fp32)(1u << 24);
+}
+
+static fp32 Wrap(fp32 a)
+{
+    while (a > (fp32)M_PI) a -= 2.0f * (fp32)M_PI;
+    while (a < -(fp32)M_PI) a += 2.0f * (fp32)M_PI;
+    return a;
+}
+
+static double Now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief 直接使用sinf/cosf的正运动学，作为耗时对比
+ */
+static void ForwardLibm(
+    const fp32 * angle, const fp32 * speed, fp32 * vx, fp32 * vy, fp32 * wz)
+{
+    fp32 sum_x = 0, sum_y = 0, sum_w = 0, r2 = 0;
+    for (int i = 0; i < 4; i++) {
+        fp32 v_x = speed[i] * cosf(angle[i]);
+        fp32 v_y = speed[i] * sinf(angle[i]);
+        sum_x += v_x;
+        sum_y += v_y;
+        sum_w += MODULE_X[i] * v_y - MODULE_Y[i] * v_x;
+        r2 += MODULE_X[i] * MODULE_X[i] + MODULE_Y[i] * MODULE_Y[i];
+    }
+    *vx = sum_x / 4;
+    *vy = sum_y / 4;
+    *wz = sum_w / r2;
+}
+
+int main(void)
+{
+    SteeringSolver_s solver, solver_no_deadzone;
+    int fail = 0;
+    SteeringSolverInit(&solver, MODULE_X, MODULE_Y, 4, 0.02f);
+    SteeringSolverInit(&solver_no_deadzone, MODULE_X, MODULE_Y, 4, 0.0f);  // 一致性检查不受死区影响
+
+    // 1. 查表精度
+    fp32 max_err = 0;
+    for (int i = 0; i < TEST_NUM; i++) {
+        fp32 a = Rand(-20.0f, 20.0f), s, c;
+        SteeringSinCos(a, &s, &c);
+        fp32 err = fmaxf(fabsf(s - sinf(a)), fabsf(c - cosf(a)));
+        if (err > max_err) max_err = err;
+    }
+    printf("sin/cos table max error: %.2e\n", max_err);
+    if (max_err > 1e-4f) fail = 1;
+
+    // 2/3. 最短转向与正逆运动学一致性
+    fp32 max_turn = 0, max_vel_err = 0;
+    for (int n = 0; n < TEST_NUM; n++) {
+        fp32 vx = Rand(-3, 3), vy = Rand(-3, 3), wz = Rand(-6, 6);
+        fp32 fdb[4], ref[4], speed[4];
+        for (int i = 0; i < 4; i++) fdb[i] = Rand(-(fp32)M_PI, (fp32)M_PI);
+
+        SteeringInverse(&solver_no_deadzone, vx, vy, wz, fdb, ref, speed);
+        for (int i = 0; i < 4; i++) {
+            fp32 turn = fabsf(Wrap(ref[i] - fdb[i]));
+            if (turn > max_turn) max_turn = turn;
+        }
+
+        SteeringInverse(&solver_no_deadzone, vx, vy, wz, ref, ref, speed);  // 舵向到位后
+        fp32 fx, fy, fw;
+        SteeringForward(&solver_no_deadzone, ref, speed, &fx, &fy, &fw);
+        fp32 err = fmaxf(fmaxf(fabsf(fx - vx), fabsf(fy - vy)), fabsf(fw - wz) * 0.2f);
+        if (err > max_vel_err) max_vel_err = err;
+    }
+    printf("max steer turn: %.4f rad, max velocity error: %.2e m/s\n", max_turn, max_vel_err);
+    if (max_turn > (fp32)M_PI_2 + 1e-4f) fail = 1;
+    if (max_vel_err > 1e-3f) fail = 1;
+
+    // 耗时
+    static fp32 input[1024][4];
+    for (int n = 0; n < 1024; n++) {
+        for (int i = 0; i < 4; i++) input[n][i] = Rand(-(fp32)M_PI, (fp32)M_PI);
+    }
+    volatile fp32 sink = 0;
+    fp32 ref[4], speed[4], vx, vy, wz;
+
+    double t0 = Now();
+    for (int n = 0; n < BENCH_NUM; n++) {
+        const fp32 * fdb = input[n & 1023];
+        SteeringInverse(&solver, 1.0f, 0.5f, 2.0f, fdb, ref, speed);
+        SteeringForward(&solver, fdb, speed, &vx, &vy, &wz);
+        sink += vx + vy + wz;
+    }
+    double t1 = Now();
+    for (int n = 0; n < BENCH_NUM; n++) {
+        const fp32 * fdb = input[n & 1023];
+        SteeringInverse(&solver, 1.0f, 0.5f, 2.0f, fdb, ref, speed);
+        ForwardLibm(fdb, speed, &vx, &vy, &wz);
+        sink += vx + vy + wz;
+    }
+    double t2 = Now();
+    printf(
+        "solve time per cycle: table %.1f ns, libm forward %.1f ns\n",
+        (t1 - t0) / BENCH_NUM * 1e9, (t2 - t1) / BENCH_NUM * 1e9);
+
+    printf(fail ? "FAIL\n" : "PASS\n");
+    return fail;
+}
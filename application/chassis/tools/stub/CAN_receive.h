@@ -0,0 +1,17 @@
+// 功率仿真在PC上编译 chassis_power_control.c 时使用的超级电容接口，由 power_sim.c 实现
+#ifndef CAN_RECEIVE_H_STUB
+#define CAN_RECEIVE_H_STUB
+#include "stdbool.h"
+#include "struct_typedef.h"
+
+typedef struct
+{
+    bool offline;
+    struct
+    {
+        float voltage_cap;
+    } fdb;
+} SupCap_s;
+
+extern void GetSupCapMeasure(SupCap_s * p_sup_cap);
+#endif
@@ -0,0 +1,5 @@
+// 在PC上编译 pid.c 时使用的空头文件，pid.c 只需要其中的 NULL
+#ifndef MAIN_H_STUB
+#define MAIN_H_STUB
+#include <stddef.h>
+#endif
@@ -0,0 +1,15 @@
+// 功率仿真在PC上编译 chassis_power_control.c 时使用的裁判系统接口，由 power_sim.c 实现
+#ifndef REFEREE_H_STUB
+#define REFEREE_H_STUB
+#include "stdbool.h"
+#include "struct_typedef.h"
+
+typedef struct
+{
+    uint16_t chassis_power_limit;
+} robot_status_t;
+
+extern robot_status_t robot_status;
+extern void get_chassis_power_and_buffer(fp32 * power, fp32 * buffer);
+extern bool GetRefereeOffline(void);
+#endif
@@ -0,0 +1,153 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       wheel_pid_bench.c
+  * @brief      在PC上运行的底盘驱动轮PID测试程序，对比多通道PID与原来逐轮调用PID_calc的结果和耗时
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *  V1.1.0     Oct-19-2026     Penguin         1. 麦轮解算恢复为逐轮计算，只对比驱动轮PID，误差按ULP统计
+  *
+  @verbatim
+  ==============================================================================
+    编译运行：
+      cc -O2 -Istub -I.. -I../../typedef -I../../../components/controller -o wheel_pid_bench \
+        wheel_pid_bench.c ../../../components/controller/pid.c \
+        ../../../components/controller/pid_bank.c -lm
+      ./wheel_pid_bench
+    检查项：两种实现在随机输入下的PID输出相差不超过 MAX_ULP 个ULP，否则返回非0
+    耗时：
+      只用于比较两种写法，C板上的耗时用 develop_task 中的 DEVELOP_PID_BANK_BENCH 测量
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "pid.h"
+#include "pid_bank.h"
+
+#define TEST_NUM 100000
+#define BENCH_NUM 5000000
+#define MAX_ULP 0
+
+#define WZ_SCALE 0.1f  // 对应麦轮底盘的 (CHASSIS_WZ_SET_SCALE - 1.0f)
+
+static const fp32 PID_PARAM[3] = {15000.0f, 10.0f, 0.0f};
+
+static uint32_t SEED = 1;
+
+static fp32 Rand(fp32 min, fp32 max)
+{
+    SEED = SEED * 1664525u + 1013904223u;
+    return min + (max - min) * (SEED >> 8) / (fp32)(1u << 24);
+}
+
+static double Now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief 两个浮点数之间相差的可表示数个数
+ */
+static uint32_t UlpDiff(fp32 a, fp32 b)
+{
+    int32_t ia, ib;
+    memcpy(&ia, &a, sizeof(ia));
+    memcpy(&ib, &b, sizeof(ib));
+    if (ia < 0) ia = (int32_t)0x80000000 - ia;
+    if (ib < 0) ib = (int32_t)0x80000000 - ib;
+    return ia > ib ? (uint32_t)(ia - ib) : (uint32_t)(ib - ia);
+}
+
+/**
+ * @brief chassis_mecanum.c 中的逐轮解算
+ */
+static void MecanumInverse(fp32 vx, fp32 vy, fp32 wz, fp32 * set)
+{
+    set[0] = -vx + vy + WZ_SCALE * wz;
+    set[1] = vx + vy + WZ_SCALE * wz;
+    set[2] = vx - vy + WZ_SCALE * wz;
+    set[3] = -vx - vy + WZ_SCALE * wz;
+}
+
+/**
+ * @brief 原来逐轮调用 PID_calc
+ */
+static void ScalarConsole(
+    pid_type_def pid[4], fp32 vx, fp32 vy, fp32 wz, const fp32 * fdb, fp32 * out)
+{
+    fp32 set[4];
+    MecanumInverse(vx, vy, wz, set);
+    for (int i = 0; i < 4; i++) {
+        out[i] = PID_calc(&pid[i], fdb[i], set[i]);
+    }
+}
+
+/**
+ * @brief 多通道PID
+ */
+static void BankConsole(
+    PidBank_s * bank, fp32 vx, fp32 vy, fp32 wz, const fp32 * fdb, fp32 * out)
+{
+    fp32 set[4];
+    MecanumInverse(vx, vy, wz, set);
+    PidBankCalc(bank, fdb, set, out);
+}
+
+int main(void)
+{
+    pid_type_def pid[4];
+    PidBank_s bank;
+    int fail = 0;
+
+    for (int i = 0; i < 4; i++) PID_init(&pid[i], PID_POSITION, PID_PARAM, 16000.0f, 2000.0f);
+    PidBankInit(&bank, PID_POSITION, 4, PID_PARAM, 16000.0f, 2000.0f);
+
+    uint32_t max_ulp = 0;
+    for (int n = 0; n < TEST_NUM; n++) {
+        fp32 vx = Rand(-3, 3), vy = Rand(-3, 3), wz = Rand(-6, 6);
+        fp32 fdb[4], out_a[4], out_b[4];
+        for (int i = 0; i < 4; i++) fdb[i] = Rand(-6, 6);
+        ScalarConsole(pid, vx, vy, wz, fdb, out_a);
+        BankConsole(&bank, vx, vy, wz, fdb, out_b);
+        for (int i = 0; i < 4; i++) {
+            uint32_t ulp = UlpDiff(out_a[i], out_b[i]);
+            if (ulp > max_ulp) max_ulp = ulp;
+        }
+    }
+    printf("max difference: %u ULP\n", max_ulp);
+    if (max_ulp > MAX_ULP) fail = 1;
+
+    static fp32 input[1024][4];
+    for (int n = 0; n < 1024; n++) {
+        for (int i = 0; i < 4; i++) input[n][i] = Rand(-6, 6);
+    }
+    volatile fp32 sink = 0;
+    fp32 out[4];
+
+    double t0 = Now();
+    for (int n = 0; n < BENCH_NUM; n++) {
+        const fp32 * fdb = input[n & 1023];
+        ScalarConsole(pid, fdb[0], fdb[1], fdb[2], fdb, out);
+        sink += out[0] + out[3];
+    }
+    double t1 = Now();
+    for (int n = 0; n < BENCH_NUM; n++) {
+        const fp32 * fdb = input[n & 1023];
+        BankConsole(&bank, fdb[0], fdb[1], fdb[2], fdb, out);
+        sink += out[0] + out[3];
+    }
+    double t2 = Now();
+    printf(
+        "console time per cycle: PID_calc %.1f ns, bank %.1f ns\n", (t1 - t0) / BENCH_NUM * 1e9,
+        (t2 - t1) / BENCH_NUM * 1e9);
+
+    printf(fail ? "FAIL\n" : "PASS\n");
+    return fail;
+}
@@ -7,6 +7,9 @@
   *  V1.0.0     Jun-14-2024     Penguin         1. done
   *  V1.1.0     2025-03-10      Harry_Wong      1. 初步完成自定义内容通信
   *  V1.2.0     Apr-01-2025     Penguin         1. 重构与优化
+  *  V2.0.0     Oct-19-2026     Penguin         1. DMA收发，收发缓冲池，多数据段打包，链路统计
+  *  V2.1.0     Oct-19-2026     Penguin         1. 板间时钟同步，云台yaw外推到本板控制时刻
+  *  V2.1.1     Oct-19-2026     Penguin         1. 云台yaw的外推移至虚拟云台预测器
   *
   @verbatim
   ==============================================================================
@@ -20,13 +23,16 @@
 #include "communication.h"
 
 #include "CRC8_CRC16.h"
+#include "bsp_dwt.h"
+#include "clock_sync.h"
 #include "bsp_uart.h"
 #include "bsp_usart.h"
 #include "detect_task.h"
-#include "fifo.h"
 #include "gimbal.h"
+#include "math.h"
 #include "robot_param.h"
 #include "signal_generator.h"
+#include "string.h"
 #include "uart2_typedef.h"
 #include "usb_debug.h"
 
@@ -36,128 +42,189 @@
 
 #define UART2_OFFLINE_TIME 200  // ms
 
-#define USART_RX_BUF_LENGHT 512
-#define USART1_FIFO_BUF_LENGTH 1024
+#ifndef UART2_BAUD_RATE
+#if __SELF_BOARD_ID == C_BOARD_DEFAULT
+#define UART2_BAUD_RATE 115200  // 单板时串口可能接自定义控制器等外设，保持CubeMX中的波特率
+#else
+#define UART2_BAUD_RATE 921600  // 双板通信，1kHz交换状态时占用率约20%
+#endif
+#endif  // UART2_BAUD_RATE
 
-/**
- * @brief 数据包初始化宏定义
- */
-#define UART2DataInit(data_name)                                                            \
-    {                                                                                       \
-        memset(&(Send_Data_##data_name##), 0, sizeof(Data_##data_name##_s));                \
-        Send_Data_##data_name##.frame_header.sof = UART2_COMMUNICATE_SOF;                   \
-        Send_Data_##data_name##.frame_header.len = sizeof(Send_Data_##data_name##.data);    \
-        Send_Data_##data_name##.frame_header.id = Uart2_Data_##data_name##_ID;              \
-        Send_Data_##data_name##.frame_header.type = 0;                                      \
-        append_CRC8_check_sum(                                                              \
-            (uint8_t *)(&(Send_Data_##data_name##.frame_header)), UART2_FRAME_HEADER_SIZE); \
-        LastSendTime.Data_##data_name## = 0;                                                \
-    }
+#define UART2_BYTE_US (10.0f * 1000000.0f / UART2_BAUD_RATE)  // (us)每字节的传输时间
 
-/**
- * @brief 对于数据发送进行宏定义
- */
-#define Uart2CheckDurationAndSend(data_name)                                                       \
-    {                                                                                              \
-        if (HAL_GetTick() - LastSendTime.Data_##data_name## >=                                     \
-            Uart2_Data_##data_name##_Duration) {                                                   \
-            LastSendTime.Data_##data_name## = HAL_GetTick();                                       \
-            Data##data_name##Renew();                                                              \
-            UartSendTxMessage(                                                                     \
-                &huart1, (uint8_t *)(&(Send_Data_##data_name##)), sizeof(Send_Data_##data_name##), \
-                UART2_COMMUNICATE_TIMEOUT);                                                        \
-        }                                                                                          \
-    }
+#define UART2_RX_BUF_LENGTH 256
+#define UART2_RX_POOL_NUM 4
+#define UART2_TX_POOL_NUM 2
+
+#define UART2_LOAD_PERIOD 1000      // (ms)占用率统计周期
+#define UART2_LATENCY_ALPHA 0.99f   // 延迟统计的EWMA系数
+#define UART2_OFFSET_LEAK 0.1f      // (us/帧)延迟最小值每帧上浮的量，跟随两块板的晶振漂移
+
+// 板间统一时基以主板的时钟为准，底盘板跟随云台板
+#define UART2_TIME_MASTER (__SELF_BOARD_ID != C_BOARD_BALANCE_CHASSIS)
 
 /**
- * @brief 对于接收数据进行存储
+ * @brief 数据段描述初始化宏定义，send为0时本板只接收该数据段
  */
-#define UART2DataSave(data_name)                                                          \
-    {                                                                                     \
-        uint16_t crc_ok = verify_CRC16_check_sum(received, sizeof(Data_##data_name##_s)); \
-        if (crc_ok) {                                                                     \
-            memcpy(&Receive_Data_##data_name##, received, sizeof(Data_##data_name##_s));  \
-        }                                                                                 \
+#define UART2Topic(data_name, send)                              \
+    {                                                            \
+        .id = Uart2_Data_##data_name##_ID,                       \
+        .size = sizeof(Data_##data_name##_s),                    \
+        .duration = Uart2_Data_##data_name##_Duration,           \
+        .Renew = (send) ? Data##data_name##Renew : NULL,         \
+        .receive = &Receive_Data_##data_name,                    \
     }
 
+// clang-format off
+#if __SELF_BOARD_ID == C_BOARD_BALANCE_CHASSIS
+#define UART2_SEND_TEST   0
+#define UART2_SEND_RC     1
+#define UART2_SEND_GIMBAL 0
+#define UART2_SEND_SYNC   1
+#elif __SELF_BOARD_ID == C_BOARD_BALANCE_GIMBAL
+#define UART2_SEND_TEST   0
+#define UART2_SEND_RC     0
+#define UART2_SEND_GIMBAL 1
+#define UART2_SEND_SYNC   1
+#else
+#define UART2_SEND_TEST   1
+#define UART2_SEND_RC     0
+#define UART2_SEND_GIMBAL 0
+#define UART2_SEND_SYNC   0
+#endif
+// clang-format on
+
+/*******************************************************************************/
+/* Type Definitions                                                            */
+/*******************************************************************************/
+
+typedef struct
+{
+    uint8_t id;
+    uint8_t size;
+    uint32_t duration;           // (ms)发送周期
+    void (*Renew)(void * data);  // 直接在发送帧中填写数据段，NULL表示本板不发送
+    void * receive;              // 接收数据的存储位置
+    uint32_t last_send;          // (ms)
+    uint32_t last_receive;       // (ms)
+    uint32_t time_stamp;         // (us)最近一次收到时帧头中的发送时间戳
+} Uart2Topic_t;
+
 /*******************************************************************************/
 /* Variable Definitions                                                        */
 /*******************************************************************************/
 uint32_t TASK_DURATION;
 uint32_t LAST_TASK_TIME;
 
-// clang-format off
-// data time record
-LastTime_t LastSendTime;
-LastTime_t LastReceiveTime;
-
-// send data
-Data_Test_s   Send_Data_Test;
-Data_Rc_s     Send_Data_Rc;
-Data_Gimbal_s Send_Data_Gimbal;
+static void DataTestRenew(void * data);
+static void DataRcRenew(void * data);
+static void DataGimbalRenew(void * data);
+static void DataSyncRenew(void * data);
 
+// clang-format off
 // receive data
 Data_Test_s   Receive_Data_Test;
 Data_Rc_s     Receive_Data_Rc;
 Data_Gimbal_s Receive_Data_Gimbal;
-
-// receive data buffer
-uint8_t usart1_buf[2][USART_RX_BUF_LENGHT];
-fifo_s_t usart1_fifo;
-uint8_t usart1_fifo_buf[USART1_FIFO_BUF_LENGTH];
-UnpackData_t usart1_unpack_obj;
+Data_Sync_s   Receive_Data_Sync;
+
+static Uart2Topic_t TOPIC[] = {
+    UART2Topic(Test,   UART2_SEND_TEST),
+    UART2Topic(Rc,     UART2_SEND_RC),
+    UART2Topic(Gimbal, UART2_SEND_GIMBAL),
+    UART2Topic(Sync,   UART2_SEND_SYNC),
+};
+#define UART2_TOPIC_NUM (sizeof(TOPIC) / sizeof(TOPIC[0]))
+
+// send frame pool
+static uint8_t  TX_POOL[UART2_TX_POOL_NUM][UART2_FRAME_MAX_SIZE];
+static uint8_t  TX_FILL = 0;         // 正在打包的缓冲区
+static uint16_t TX_PENDING_LEN = 0;  // 已打包等待DMA的帧长度，0表示没有
+static uint8_t  TX_SEQ = 0;
+static uint32_t TX_READY_CYCLE = 0;
+
+// receive buffer pool，ISR写RX_WRITE，任务写RX_READ
+static uint8_t           RX_POOL[UART2_RX_POOL_NUM][UART2_RX_BUF_LENGTH];
+static volatile uint16_t RX_LEN[UART2_RX_POOL_NUM];
+static volatile uint32_t RX_CYCLE[UART2_RX_POOL_NUM];  // 空闲中断时刻
+static volatile uint8_t  RX_WRITE = 0;  // DMA正在写的缓冲区
+static volatile uint8_t  RX_READ = 0;   // 任务下一个处理的缓冲区
+static volatile uint32_t LAST_INTERRUPT_TIME = 0;
+
+// link statistics
+static Uart2LinkStats_s LINK;
+static bool     RX_SEQ_VALID = false;
+static uint8_t  RX_LAST_SEQ = 0;
+static fp32     RX_OFFSET_MIN = 0;
+static uint32_t TX_BYTES = 0;
+static uint32_t RX_BYTES = 0;
+static uint32_t LAST_LOAD_TIME = 0;
+
+// clock sync，PEER_*为对方最近一帧的时间戳和本板收到它的时刻
+static ClockSync_s CLOCK_SYNC;
+static bool        PEER_VALID = false;
+static uint32_t    PEER_STAMP = 0;
+static uint32_t    PEER_ARRIVAL = 0;
 // clang-format on
 
 /*******************************************************************************/
 /* Main Functions                                                              */
-/*     Uart2SendDataInit                                                       */
 /*     Usart1Init                                                              */
 /*     USART1_IRQHandler                                                       */
 /*******************************************************************************/
 
-// uart数据包初始化
-void Uart2SendDataInit(void)
-{
-    UART2DataInit(Test);
-    UART2DataInit(Rc);
-    UART2DataInit(Gimbal);
-}
-
 // 4pin Uart串口初始化
 void Usart1Init(void)
 {
-    fifo_s_init(&usart1_fifo, usart1_fifo_buf, USART1_FIFO_BUF_LENGTH);
-    usart1_init(usart1_buf[0], usart1_buf[1], USART_RX_BUF_LENGHT);
+    if (huart1.Init.BaudRate != UART2_BAUD_RATE) {
+        huart1.Init.BaudRate = UART2_BAUD_RATE;
+        HAL_UART_Init(&huart1);
+    }
 
-    Uart2SendDataInit();
+    usart1_init(RX_POOL[0], RX_POOL[1], UART2_RX_BUF_LENGTH);
+
+    // 缓冲区由空闲中断从缓冲池中轮换，不使用DMA的双缓冲模式
+    __HAL_DMA_DISABLE(huart1.hdmarx);
+    while (huart1.hdmarx->Instance->CR & DMA_SxCR_EN) {
+        __HAL_DMA_DISABLE(huart1.hdmarx);
+    }
+    huart1.hdmarx->Instance->CR &= ~(DMA_SxCR_DBM | DMA_SxCR_CT);
+    __HAL_DMA_ENABLE(huart1.hdmarx);
+
+    ClockSyncInit(&CLOCK_SYNC);
+    LAST_LOAD_TIME = HAL_GetTick();
 }
 
 // 4pin Uart口中断处理函数
 void USART1_IRQHandler(void)
 {
-    static volatile uint8_t res;
     if (USART1->SR & UART_FLAG_IDLE) {
         __HAL_UART_CLEAR_PEFLAG(&huart1);
 
-        static uint16_t this_time_rx_len = 0;
-
-        if ((huart1.hdmarx->Instance->CR & DMA_SxCR_CT) == RESET) {
+        __HAL_DMA_DISABLE(huart1.hdmarx);
+        while (huart1.hdmarx->Instance->CR & DMA_SxCR_EN) {
             __HAL_DMA_DISABLE(huart1.hdmarx);
-            this_time_rx_len = USART_RX_BUF_LENGHT - __HAL_DMA_GET_COUNTER(huart1.hdmarx);
-            __HAL_DMA_SET_COUNTER(huart1.hdmarx, USART_RX_BUF_LENGHT);
-            huart1.hdmarx->Instance->CR |= DMA_SxCR_CT;
-            __HAL_DMA_ENABLE(huart1.hdmarx);
-            fifo_s_puts(&usart1_fifo, (char *)usart1_buf[0], this_time_rx_len);
-            LastReceiveTime.Interrupt = HAL_GetTick();
-        } else {
-            __HAL_DMA_DISABLE(huart1.hdmarx);
-            this_time_rx_len = USART_RX_BUF_LENGHT - __HAL_DMA_GET_COUNTER(huart1.hdmarx);
-            __HAL_DMA_SET_COUNTER(huart1.hdmarx, USART_RX_BUF_LENGHT);
-            huart1.hdmarx->Instance->CR &= ~(DMA_SxCR_CT);
-            __HAL_DMA_ENABLE(huart1.hdmarx);
-            fifo_s_puts(&usart1_fifo, (char *)usart1_buf[1], this_time_rx_len);
-            LastReceiveTime.Interrupt = HAL_GetTick();
         }
+
+        uint16_t this_time_rx_len = UART2_RX_BUF_LENGTH - __HAL_DMA_GET_COUNTER(huart1.hdmarx);
+        if (this_time_rx_len > 0) {
+            uint8_t next = (RX_WRITE + 1) % UART2_RX_POOL_NUM;
+            if (next != RX_READ) {
+                RX_LEN[RX_WRITE] = this_time_rx_len;
+                RX_CYCLE[RX_WRITE] = dwt_get_cycle();
+                RX_WRITE = next;
+            } else {
+                LINK.rx_overrun++;  // 缓冲池已满，覆盖当前缓冲区
+            }
+        }
+
+        __HAL_DMA_CLEAR_FLAG(huart1.hdmarx, __HAL_DMA_GET_TC_FLAG_INDEX(huart1.hdmarx));
+        __HAL_DMA_CLEAR_FLAG(huart1.hdmarx, __HAL_DMA_GET_HT_FLAG_INDEX(huart1.hdmarx));
+        huart1.hdmarx->Instance->M0AR = (uint32_t)RX_POOL[RX_WRITE];
+        __HAL_DMA_SET_COUNTER(huart1.hdmarx, UART2_RX_BUF_LENGTH);
+        __HAL_DMA_ENABLE(huart1.hdmarx);
+
+        LAST_INTERRUPT_TIME = HAL_GetTick();
     }
 }
 
@@ -166,159 +233,278 @@ void USART1_IRQHandler(void)
 /*     DataTestRenew                                                           */
 /*     DataRcRenew                                                             */
 /*     DataGimbalRenew                                                         */
+/*     DataSyncRenew                                                           */
 /*******************************************************************************/
 
-void DataTestRenew()
+static void DataTestRenew(void * data)
 {
-    Send_Data_Test.time_stamp = HAL_GetTick();
+    static uint32_t index = 0;
+    Data_Test_s * test = (Data_Test_s *)data;
+
+    test->index = index++;
+    test->test_float = GenerateSinWave(10, 0, 4);
+    memset(test->reserved, 0, sizeof(test->reserved));
+}
 
-    Send_Data_Test.data.index++;
-    Send_Data_Test.data.test_float = GenerateSinWave(10, 0, 4);
+static void DataRcRenew(void * data)
+{
+    Data_Rc_s * rc = (Data_Rc_s *)data;
 
-    append_CRC16_check_sum((uint8_t *)(&Send_Data_Test), sizeof(Data_Test_s));
+    memset(rc, 0, sizeof(Data_Rc_s));
+    rc->rc_offline = GetSbusOffline();
 }
 
-void DataRcRenew()
+static void DataGimbalRenew(void * data)
 {
-    Send_Data_Rc.time_stamp = HAL_GetTick();
+    Data_Gimbal_s * gimbal = (Data_Gimbal_s *)data;
 
-    // memcpy(&Send_Data_Rc.data.rc_ctrl, get_remote_control_point(), sizeof(RC_ctrl_t));
-    Send_Data_Rc.data.rc_offline = GetSbusOffline();
-    append_CRC16_check_sum((uint8_t *)(&Send_Data_Rc), sizeof(Data_Rc_s));
+    gimbal->sample_time = GetBoardTimeUs();
+    gimbal->yaw_motor_pos = 0.0f;
+    gimbal->yaw_vel_cmd = 0.0f;
+    gimbal->yaw_motor_offline = true;
+    gimbal->init_judge = false;
 }
 
-void DataGimbalRenew()
+static void DataSyncRenew(void * data)
 {
-    Send_Data_Gimbal.time_stamp = HAL_GetTick();
+    Data_Sync_s * sync = (Data_Sync_s *)data;
 
-    Send_Data_Gimbal.data.yaw_motor_pos = 0.0f;
-    Send_Data_Gimbal.data.yaw_motor_offline = true;
-    Send_Data_Gimbal.data.init_judge = false;
-    append_CRC16_check_sum((uint8_t *)(&Send_Data_Gimbal), sizeof(Data_Gimbal_s));
+    sync->origin = PEER_STAMP;
+    sync->receive = PEER_ARRIVAL;
+    sync->valid = PEER_VALID;
 }
 
 /*******************************************************************************/
-/* Uart2 Receive Data Solve Functions                                          */
-/*     Uart2DataSolve                                                          */
-/*     DataUnpack                                                              */
+/* Uart2 Send Functions                                                        */
+/*     Uart2Pack                                                               */
+/*     Uart2Transmit                                                           */
 /*******************************************************************************/
 
-void Uart2DataSolve(uint8_t * frame)
+/**
+  * @brief          把本周期到期的数据段打包成一帧，放不下的数据段留到下一帧
+  * @param[in]      now_ms: (ms)当前时间
+  * @param[in]      now_us: (us)帧头时间戳
+  * @retval         none
+  */
+static void Uart2Pack(uint32_t now_ms, uint32_t now_us)
 {
-    uint32_t time_stamp = 0;
+    if (TX_PENDING_LEN != 0) {
+        LINK.tx_stall++;  // 上一帧还在等待DMA，到期的数据段推迟到下一周期
+        return;
+    }
+
+    uint8_t * frame = TX_POOL[TX_FILL];
+    uint16_t index = UART2_HEADER_TIMESTAMP_LEN;
+    uint8_t num = 0;
 
-    uint8_t index = 0;
+    for (uint8_t i = 0; i < UART2_TOPIC_NUM; i++) {
+        Uart2Topic_t * topic = &TOPIC[i];
+        if (topic->Renew == NULL || now_ms - topic->last_send < topic->duration) {
+            continue;
+        }
+        if (index + UART2_TOPIC_HEADER_SIZE + topic->size + UART2_FRAME_CRC16_SIZE >
+            UART2_FRAME_MAX_SIZE) {
+            break;
+        }
+        TopicHeader_t * topic_header = (TopicHeader_t *)(frame + index);
+        topic_header->id = topic->id;
+        topic_header->len = topic->size;
+        index += UART2_TOPIC_HEADER_SIZE;
+        topic->Renew(frame + index);
+        index += topic->size;
+        topic->last_send = now_ms;
+        num++;
+    }
 
-    FrameHeader_t frame_header;
+    if (num == 0) {
+        return;
+    }
 
-    memcpy(&frame_header, frame, sizeof(FrameHeader_t));
-    index += sizeof(FrameHeader_t);
+    FrameHeader_t * frame_header = (FrameHeader_t *)frame;
+    frame_header->sof = UART2_COMMUNICATE_SOF;
+    frame_header->len = index - UART2_FRAME_HEADER_SIZE;
+    frame_header->seq = TX_SEQ++;
+    frame_header->num = num;
+    append_CRC8_check_sum(frame, UART2_FRAME_HEADER_SIZE);
+    memcpy(frame + UART2_FRAME_HEADER_SIZE, &now_us, UART2_FRAME_TIMESTAMP_SIZE);
+    append_CRC16_check_sum(frame, index + UART2_FRAME_CRC16_SIZE);
+
+    TX_PENDING_LEN = index + UART2_FRAME_CRC16_SIZE;
+    TX_READY_CYCLE = dwt_get_cycle();
+}
 
-    memcpy(&time_stamp, frame + index, sizeof(uint32_t));
-    index += sizeof(uint32_t);
+/**
+  * @brief          DMA空闲时发送已打包的帧，不等待发送完成
+  * @note           发送DMA可能与自定义控制器共用，只在DMA空闲时启动
+  * @retval         none
+  */
+static void Uart2Transmit(void)
+{
+    if (TX_PENDING_LEN == 0 || (huart1.hdmatx->Instance->CR & DMA_SxCR_EN)) {
+        return;
+    }
 
-    switch (frame_header.id) {
-        case Uart2_Data_Test_ID: {
-            memcpy(&Receive_Data_Test, frame, sizeof(Data_Test_s));
-            LastReceiveTime.Data_Test = HAL_GetTick();
-        } break;
-        case Uart2_Data_Rc_ID: {
-            memcpy(&Receive_Data_Rc, frame, sizeof(Data_Rc_s));
-            LastReceiveTime.Data_Rc = HAL_GetTick();
+    usart1_tx_dma_enable(TX_POOL[TX_FILL], TX_PENDING_LEN);
+    LINK.tx_queue_us = dwt_cycle_to_us(dwt_get_cycle() - TX_READY_CYCLE);
+    LINK.tx_frame++;
+    TX_BYTES += TX_PENDING_LEN;
+    TX_PENDING_LEN = 0;
+    TX_FILL = (TX_FILL + 1) % UART2_TX_POOL_NUM;
+}
 
-#if __CONTROL_LINK_RC == CL_RC_UART2
-            // const RC_ctrl_t * rc_ctrl = get_remote_control_point();
-            // memcpy((RC_ctrl_t *)rc_ctrl, &Receive_Data_Rc.data.rc_ctrl, sizeof(RC_ctrl_t));
-#endif
-        } break;
-        case Uart2_Data_Gimbal_ID: {
-            memcpy(&Receive_Data_Gimbal, frame, sizeof(Data_Gimbal_s));
-            LastReceiveTime.Data_Gimbal = HAL_GetTick();
-        } break;
-        default:
-            break;
+/*******************************************************************************/
+/* Uart2 Receive Data Solve Functions                                          */
+/*     Uart2DataSolve                                                          */
+/*     Uart2BufferSolve                                                        */
+/*     Uart2Receive                                                            */
+/*******************************************************************************/
+
+/**
+  * @brief          收到时钟同步数据段，与所在帧的时间戳和到达时刻构成一次双向测量
+  * @param[in]      time_stamp: (us,对方)所在帧的发送时刻 t3
+  * @param[in]      arrival_us: (us,本板)所在帧的到达时刻 t4
+  * @retval         none
+  */
+static void Uart2SyncSolve(uint32_t time_stamp, uint32_t arrival_us)
+{
+    if (!Receive_Data_Sync.valid) {
+        return;
     }
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    ClockSyncUpdate(
+        &CLOCK_SYNC, Receive_Data_Sync.origin, Receive_Data_Sync.receive, time_stamp, arrival_us);
+    __set_PRIMASK(primask);
 }
 
 /**
-  * @brief          单字节解包
-  * @param[in]      void
+  * @brief          处理一个校验通过的帧，按数据段id分发
+  * @param[in]      frame: 帧起始地址
+  * @param[in]      arrival_us: (us)本板收到帧的第一个字节的时刻
   * @retval         none
   */
-void DataUnpack(void)
+static void Uart2DataSolve(const uint8_t * frame, uint32_t arrival_us)
 {
-    uint8_t byte = 0;
-    UnpackData_t * p_obj = &usart1_unpack_obj;
-
-    while (fifo_s_used(&usart1_fifo)) {
-        byte = fifo_s_get(&usart1_fifo);
-        switch (p_obj->unpack_step) {
-            case STEP_HEADER_SOF: {
-                if (byte == UART2_COMMUNICATE_SOF) {
-                    p_obj->unpack_step = STEP_LENGTH;
-                    p_obj->protocol_packet[p_obj->index++] = byte;
-                } else {
-                    p_obj->index = 0;
-                }
-            } break;
-
-            case STEP_LENGTH: {
-                p_obj->data_len = byte;
-                p_obj->protocol_packet[p_obj->index++] = byte;
-                p_obj->unpack_step = STEP_ID;
-            } break;
-
-            case STEP_ID: {
-                p_obj->protocol_packet[p_obj->index++] = byte;
-
-                if (p_obj->data_len < (UART2_FRAME_MAX_SIZE - UART2_HEADER_CRC_TIMESTAMP_LEN)) {
-                    p_obj->unpack_step = STEP_TYPE;
-                } else {
-                    p_obj->unpack_step = STEP_HEADER_SOF;
-                    p_obj->index = 0;
-                }
-            } break;
-
-            case STEP_TYPE: {
-                p_obj->protocol_packet[p_obj->index++] = byte;
-                p_obj->unpack_step = STEP_HEADER_CRC8;
-            } break;
-
-            case STEP_HEADER_CRC8: {
-                p_obj->protocol_packet[p_obj->index++] = byte;
-
-                if (p_obj->index == UART2_FRAME_HEADER_SIZE) {
-                    if (verify_CRC8_check_sum(p_obj->protocol_packet, UART2_FRAME_HEADER_SIZE)) {
-                        p_obj->unpack_step = STEP_DATA_CRC16;
-                    } else {
-                        p_obj->unpack_step = STEP_HEADER_SOF;
-                        p_obj->index = 0;
-                    }
+    const FrameHeader_t * frame_header = (const FrameHeader_t *)frame;
+    uint32_t time_stamp = 0;
+    uint16_t index = UART2_HEADER_TIMESTAMP_LEN;
+    uint16_t end = UART2_FRAME_HEADER_SIZE + frame_header->len;
+
+    memcpy(&time_stamp, frame + UART2_FRAME_HEADER_SIZE, UART2_FRAME_TIMESTAMP_SIZE);
+
+    // 丢帧与延迟统计，两块板的时钟不同步，到达时刻与时间戳之差减去其最小值为排队造成的延迟
+    fp32 offset = (fp32)(int32_t)(arrival_us - time_stamp);
+    if (RX_SEQ_VALID) {
+        LINK.rx_lost += (uint8_t)(frame_header->seq - RX_LAST_SEQ - 1);
+        RX_OFFSET_MIN = fminf(RX_OFFSET_MIN + UART2_OFFSET_LEAK, offset);
+    } else {
+        RX_SEQ_VALID = true;
+        RX_OFFSET_MIN = offset;
+    }
+    RX_LAST_SEQ = frame_header->seq;
+    LINK.rx_latency_us = UART2_LATENCY_ALPHA * LINK.rx_latency_us +
+                         (1.0f - UART2_LATENCY_ALPHA) * (offset - RX_OFFSET_MIN);
+    LINK.rx_frame++;
+
+    PEER_STAMP = time_stamp;
+    PEER_ARRIVAL = arrival_us;
+    PEER_VALID = true;
+
+    for (uint8_t n = 0; n < frame_header->num; n++) {
+        const TopicHeader_t * topic_header = (const TopicHeader_t *)(frame + index);
+        index += UART2_TOPIC_HEADER_SIZE;
+        if (index + topic_header->len > end) {
+            break;
+        }
+        for (uint8_t i = 0; i < UART2_TOPIC_NUM; i++) {
+            Uart2Topic_t * topic = &TOPIC[i];
+            if (topic->id == topic_header->id && topic->size == topic_header->len) {
+                memcpy(topic->receive, frame + index, topic->size);
+                topic->last_receive = HAL_GetTick();
+                topic->time_stamp = time_stamp;
+                if (topic->id == Uart2_Data_Sync_ID) {
+                    Uart2SyncSolve(time_stamp, arrival_us);
                 }
-            } break;
+                break;
+            }
+        }
+        index += topic_header->len;
+    }
+}
 
-            case STEP_DATA_CRC16: {
-                if (p_obj->index < UART2_HEADER_CRC_TIMESTAMP_LEN + p_obj->data_len) {
-                    p_obj->protocol_packet[p_obj->index++] = byte;
-                }
-                if (p_obj->index >= UART2_HEADER_CRC_TIMESTAMP_LEN + p_obj->data_len) {
-                    p_obj->unpack_step = STEP_HEADER_SOF;
-                    p_obj->index = 0;
-
-                    if (verify_CRC16_check_sum(
-                            p_obj->protocol_packet,
-                            UART2_HEADER_CRC_TIMESTAMP_LEN + p_obj->data_len)) {
-                        Uart2DataSolve(p_obj->protocol_packet);
-                    }
-                }
-            } break;
+/**
+  * @brief          在接收缓冲区中原地查找并校验帧
+  * @param[in]      buf: 接收缓冲区
+  * @param[in]      len: 接收长度
+  * @param[in]      arrival_us: (us)空闲中断时刻
+  * @note           空闲中断在最后一个字节之后再过一个字节的时间触发，
+  *                 按字节数折算出每一帧第一个字节的到达时刻，两个方向的帧长不同时也不引入偏差
+  * @retval         none
+  */
+static void Uart2BufferSolve(uint8_t * buf, uint16_t len, uint32_t arrival_us)
+{
+    uint16_t i = 0;
+
+    while (i + UART2_HEADER_CRC_LEN <= len) {
+        if (buf[i] != UART2_COMMUNICATE_SOF ||
+            !verify_CRC8_check_sum(buf + i, UART2_FRAME_HEADER_SIZE)) {
+            i++;
+            continue;
+        }
 
-            default: {
-                p_obj->unpack_step = STEP_HEADER_SOF;
-                p_obj->index = 0;
-            } break;
+        uint16_t frame_len = UART2_HEADER_CRC_LEN + ((FrameHeader_t *)(buf + i))->len;
+        if (i + frame_len > len) {
+            LINK.rx_error++;  // 帧被空闲中断截断
+            break;
+        }
+        if (!verify_CRC16_check_sum(buf + i, frame_len)) {
+            LINK.rx_error++;
+            i++;
+            continue;
         }
+
+        Uart2DataSolve(buf + i, arrival_us - (uint32_t)((len - i + 1) * UART2_BYTE_US));
+        i += frame_len;
+    }
+}
+
+/**
+  * @brief          处理空闲中断交来的所有接收缓冲区
+  * @param[in]      now_us: (us)当前时间
+  * @retval         none
+  */
+static void Uart2Receive(uint32_t now_us)
+{
+    while (RX_READ != RX_WRITE) {
+        uint8_t index = RX_READ;
+        uint32_t queue_us = dwt_cycle_to_us(dwt_get_cycle() - RX_CYCLE[index]);
+
+        LINK.rx_queue_us = queue_us;
+        RX_BYTES += RX_LEN[index];
+        Uart2BufferSolve(RX_POOL[index], RX_LEN[index], now_us - queue_us);
+
+        RX_READ = (index + 1) % UART2_RX_POOL_NUM;
+    }
+}
+
+/**
+  * @brief          每 UART2_LOAD_PERIOD 统计一次链路占用率(每字节10位)
+  * @param[in]      now_ms: (ms)当前时间
+  * @retval         none
+  */
+static void Uart2LoadUpdate(uint32_t now_ms)
+{
+    uint32_t duration = now_ms - LAST_LOAD_TIME;
+    if (duration < UART2_LOAD_PERIOD) {
+        return;
     }
+
+    fp32 capacity = (fp32)UART2_BAUD_RATE / 10.0f * duration / 1000.0f;  // 统计周期内的字节数
+    LINK.tx_load = TX_BYTES / capacity;
+    LINK.rx_load = RX_BYTES / capacity;
+    TX_BYTES = 0;
+    RX_BYTES = 0;
+    LAST_LOAD_TIME = now_ms;
 }
 
 /*******************************************************************************/
@@ -331,15 +517,13 @@ void Uart2TaskLoop(void)
     TASK_DURATION = HAL_GetTick() - LAST_TASK_TIME;
     LAST_TASK_TIME = HAL_GetTick();
 
-#if __SELF_BOARD_ID == C_BOARD_BALANCE_CHASSIS
-    Uart2CheckDurationAndSend(Rc);
-#elif __SELF_BOARD_ID == C_BOARD_BALANCE_GIMBAL
-    Uart2CheckDurationAndSend(Gimbal);
-#elif __SELF_BOARD_ID == C_BOARD_DEFAULT
-    Uart2CheckDurationAndSend(Test);
-#endif
+    uint32_t now_ms = HAL_GetTick();
+    uint32_t now_us = dwt_get_us();
 
-    DataUnpack();
+    Uart2Receive(now_us);
+    Uart2Pack(now_ms, now_us);
+    Uart2Transmit();
+    Uart2LoadUpdate(now_ms);
 }
 
 /*******************************************************************************/
@@ -347,12 +531,16 @@ void Uart2TaskLoop(void)
 /*     GetUartOffline                                                          */
 /*     GetUartRcToeError                                                       */
 /*     GetUartGimbalYawMotorPos                                                */
+/*     GetUartGimbalYawVelCmd                                                  */
+/*     GetUartGimbalSampleTime                                                 */
 /*     GetUartGimbalInitJudge                                                  */
+/*     GetUart2LinkStats                                                       */
+/*     GetBoardTimeUs                                                          */
 /*******************************************************************************/
 
 bool GetUartOffline(void)
 {
-    if (HAL_GetTick() - LastReceiveTime.Interrupt > UART2_OFFLINE_TIME) {
+    if (HAL_GetTick() - LAST_INTERRUPT_TIME > UART2_OFFLINE_TIME) {
         return true;
     }
     return false;
@@ -363,7 +551,7 @@ bool GetUartRcOffline(void)
     if (GetUartOffline()) {
         return true;
     }
-    return Receive_Data_Rc.data.rc_offline;
+    return Receive_Data_Rc.rc_offline;
 }
 
 float GetUartGimbalYawMotorPos(void)
@@ -371,17 +559,53 @@ float GetUartGimbalYawMotorPos(void)
     if (GetUartOffline()) {
         return 0;
     }
-    return Receive_Data_Gimbal.data.yaw_motor_pos;
+    return Receive_Data_Gimbal.yaw_motor_pos;
+}
+
+float GetUartGimbalYawVelCmd(void)
+{
+    if (GetUartOffline()) {
+        return 0;
+    }
+    return Receive_Data_Gimbal.yaw_vel_cmd;
 }
 
+/**
+  * @brief          最近收到的云台数据的采样时刻
+  * @retval         (us)板间统一时基
+  */
+uint32_t GetUartGimbalSampleTime(void) { return Receive_Data_Gimbal.sample_time; }
+
 bool GetUartGimbalInitJudge(void)
 {
     if (GetUartOffline()) {
         return false;
     }
-    return Receive_Data_Gimbal.data.init_judge;
+    return Receive_Data_Gimbal.init_judge;
+}
+
+uint32_t GetUartTimeStampForTest(void) { return TOPIC[0].time_stamp; }
+
+const Uart2LinkStats_s * GetUart2LinkStats(void) { return &LINK; }
+
+/**
+  * @brief          板间统一时基，主板为本地时钟，其他板换算到主板的时钟，未同步时为本地时钟
+  * @retval         (us)
+  */
+uint32_t GetBoardTimeUs(void)
+{
+    uint32_t local_us = dwt_get_us();
+#if UART2_TIME_MASTER
+    return local_us;
+#else
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    uint32_t board_us = ClockSyncToPeer(&CLOCK_SYNC, local_us);
+    __set_PRIMASK(primask);
+    return board_us;
+#endif
 }
 
-uint32_t GetUartTimeStampForTest(void) { return Receive_Data_Test.time_stamp; }
+const ClockSync_s * GetBoardClockSync(void) { return &CLOCK_SYNC; }
 
 /*------------------------------ End of File ------------------------------*/
@@ -7,11 +7,29 @@
   *  V1.0.0     Jun-14-2024     Penguin         1. done
   *  V1.1.0     2025-03-10      Harry_Wong      1. 初步完成自定义内容通信
   *  V1.2.0     Apr-01-2025     Penguin         1. 重构与优化
+  *  V2.0.0     Oct-19-2026     Penguin         1. DMA收发，收发缓冲池，多数据段打包，链路统计
+  *  V2.1.0     Oct-19-2026     Penguin         1. 板间时钟同步，云台yaw外推到本板控制时刻
+  *  V2.1.1     Oct-19-2026     Penguin         1. 云台yaw的外推移至虚拟云台预测器
   *
   @verbatim
   ==============================================================================
   关于Usart1 和 Uart2 之间的关系：Usart1是内部配置，Uart2是C板上的外侧标注，两者为对应关系。
 
+  发送：
+    到期的数据段由各自的Renew函数直接写入发送缓冲区中的帧，整帧只计算一次CRC，
+    两个发送缓冲区交替使用，DMA空闲时启动发送，任务不等待发送完成。
+  接收：
+    DMA依次写入接收缓冲池中的缓冲区，空闲中断把写满一次的缓冲区交给任务并换上下一个，
+    任务在缓冲区中原地校验和解析，不再经过fifo逐字节拷贝。
+  统计：
+    包序号检查丢帧，帧头时间戳(发送方us)用于统计单向延迟中超出最小值的部分，
+    tx_load/rx_load为每秒统计一次的链路占用率。
+  时钟同步：
+    两块板每10ms互发一次同步数据段，回传对方最近一帧的时间戳和本板收到它的时刻，
+    与所在帧的时间戳和到达时刻构成一次NTP式的双向测量，由clock_sync估计偏移和漂移。
+    GetBoardTimeUs 为以云台板时钟为准的统一时基，带时间的数据段用它标记采样时刻，
+    底盘板的虚拟云台(gimbal_virtual)按采样时刻把云台yaw预测到控制时刻。
+
   ==============================================================================
   @endverbatim
   ****************************(C) COPYRIGHT 2024 Polarbear****************************
@@ -20,10 +38,26 @@
 #ifndef __COMMUNICATION_H
 #define __COMMUNICATION_H
 
+#include "clock_sync.h"
 #include "remote_control.h"
 #include "stdbool.h"
 #include "struct_typedef.h"
 
+typedef struct
+{
+    uint32_t tx_frame;      // 发送的帧数
+    uint32_t tx_stall;      // 因DMA未空闲推迟打包的次数
+    uint32_t tx_queue_us;   // (us)最近一帧从打包完成到启动DMA
+    fp32 tx_load;           // 发送方向的链路占用率
+    uint32_t rx_frame;      // 校验通过的帧数
+    uint32_t rx_error;      // 校验失败或不完整的帧数
+    uint32_t rx_lost;       // 按包序号统计的丢帧数
+    uint32_t rx_overrun;    // 任务来不及处理而覆盖的接收缓冲区数
+    uint32_t rx_queue_us;   // (us)最近一帧从空闲中断到任务解析
+    fp32 rx_latency_us;     // (us)单向延迟超出最小值的部分的EWMA
+    fp32 rx_load;           // 接收方向的链路占用率
+} Uart2LinkStats_s;
+
 extern void Usart1Init(void);
 
 extern void Uart2TaskLoop(void);
@@ -33,8 +67,13 @@ extern void Uart2TaskLoop(void);
 extern bool GetUartOffline(void);
 extern bool GetUartRcOffline(void);
 extern float GetUartGimbalYawMotorPos(void);
+extern float GetUartGimbalYawVelCmd(void);
+extern uint32_t GetUartGimbalSampleTime(void);
 extern bool GetUartGimbalInitJudge(void);
 extern uint32_t GetUartTimeStampForTest(void);
+extern const Uart2LinkStats_s * GetUart2LinkStats(void);
+extern uint32_t GetBoardTimeUs(void);
+extern const ClockSync_s * GetBoardClockSync(void);
 
 #endif  // __COMMUNICATION_H
 /*------------------------------ End of File ------------------------------*/
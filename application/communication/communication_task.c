@@ -1,8 +1,11 @@
 #include "communication_task.h"
 
+#include "CAN_communication.h"
 #include "bsp_uart.h"
 #include "cmsis_os.h"
 #include "communication.h"
+#include "remote_control.h"
+#include "task_monitor.h"
 
 #if INCLUDE_uxTaskGetStackHighWaterMark
 uint32_t communication_high_water;
@@ -10,15 +13,19 @@ uint32_t communication_high_water;
 
 // 任务相关时间
 #define COMMUNICATION_TASK_INIT_TIME 100
-#define COMMUNICATION_TASK_TIME_MS 2
+#define COMMUNICATION_TASK_TIME_MS 1
 
 void communication_task(void const * pvParameters)
 {
     Usart1Init();
     // 空闲一段时间
     vTaskDelay(COMMUNICATION_TASK_INIT_TIME);
+    TaskMonitorRegister(COMMUNICATION_TASK_TIME_MS);
     while (1) {
+        TaskMonitorLoop();
+        RcInputUpdate();
         Uart2TaskLoop();
+        CanBoardLinkUpdate();
 
         // 系统延时
         vTaskDelay(COMMUNICATION_TASK_TIME_MS);
@@ -32,6 +32,8 @@
 #include "supervisory_computer_cmd.h"
 #include "gimbal.h"
 #include "IMU.h"
+#include "task_monitor.h"
+#include "mem_pool.h"
 
 #if INCLUDE_uxTaskGetStackHighWaterMark
 uint32_t usb_high_water;
@@ -57,6 +59,8 @@ uint32_t usb_high_water;
 #define SEND_DURATION_RobotStatus  10// ms
 #define SEND_DURATION_JointState   10// ms
 #define SEND_DURATION_Buff         10// ms
+#define SEND_DURATION_TaskMonitor  100// ms
+#define SEND_DURATION_ShootStats   20// ms
 
 // clang-format on
 
@@ -77,6 +81,7 @@ static uint8_t USB_RX_BUF[USB_RX_DATA_SIZE];
 
 static const Imu_t * IMU;
 static const ChassisSpeedVector_t * FDB_SPEED_VECTOR;
+static const ShootFricStats_t * SHOOT_FRIC_STATS;
 
 // 判断USB连接状态用到的一些变量
 static bool USB_OFFLINE = true;
@@ -99,6 +104,8 @@ static SendDataRfidStatus_s  SEND_RFID_STATUS_DATA;
 static SendDataRobotStatus_s SEND_ROBOT_STATUS_DATA;
 static SendDataJointState_s  SEND_JOINT_STATE_DATA;
 static SendDataBuff_s        SEND_BUFF_DATA;
+static SendDataTaskMonitor_s SEND_TASK_MONITOR_DATA;
+static SendDataShootStats_s  SEND_SHOOT_STATS_DATA;
 
 // clang-format on
 
@@ -125,6 +132,8 @@ typedef struct
     uint32_t RobotStatus;
     uint32_t JointState;
     uint32_t Buff;
+    uint32_t TaskMonitor;
+    uint32_t ShootStats;
 } LastSendTime_t;
 static LastSendTime_t LAST_SEND_TIME;
 
@@ -153,6 +162,8 @@ static void UsbSendRfidStatusData(void);
 static void UsbSendRobotStatusData(void);
 static void UsbSendJointStateData(void);
 static void UsbSendBuffData(void);
+static void UsbSendTaskMonitorData(void);
+static void UsbSendShootStatsData(void);
 
 /*******************************************************************************/
 /* Receive Function                                                            */
@@ -178,6 +189,7 @@ void usb_task(void const * argument)
 
     vTaskDelay(10);  //等待USB设备初始化完成
     UsbInit();
+    mem_pool_init_release();
 
     while (1) {
         UsbSendData();
@@ -215,6 +227,7 @@ static void UsbInit(void)
     // 订阅数据
     IMU = Subscribe(IMU_NAME);                             // 获取IMU数据指针
     FDB_SPEED_VECTOR = Subscribe(CHASSIS_FDB_SPEED_NAME);  // 获取底盘速度矢量指针
+    SHOOT_FRIC_STATS = Subscribe(SHOOT_FRIC_STATS_NAME);   // 获取摩擦轮统计数据指针
 
     // 数据置零
     memset(&LAST_SEND_TIME, 0, sizeof(LastSendTime_t));
@@ -339,6 +352,22 @@ static void UsbInit(void)
     append_CRC8_check_sum(  // 添加帧头 CRC8 校验位
         (uint8_t *)(&SEND_BUFF_DATA.frame_header),
         sizeof(SEND_BUFF_DATA.frame_header));
+
+    // 14.初始化任务运行统计数据
+    SEND_TASK_MONITOR_DATA.frame_header.sof = SEND_SOF;
+    SEND_TASK_MONITOR_DATA.frame_header.len = (uint8_t)(sizeof(SendDataTaskMonitor_s) - 6);
+    SEND_TASK_MONITOR_DATA.frame_header.id = TASK_MONITOR_SEND_ID;
+    append_CRC8_check_sum(  // 添加帧头 CRC8 校验位
+        (uint8_t *)(&SEND_TASK_MONITOR_DATA.frame_header),
+        sizeof(SEND_TASK_MONITOR_DATA.frame_header));
+
+    // 15.初始化摩擦轮单发统计数据
+    SEND_SHOOT_STATS_DATA.frame_header.sof = SEND_SOF;
+    SEND_SHOOT_STATS_DATA.frame_header.len = (uint8_t)(sizeof(SendDataShootStats_s) - 6);
+    SEND_SHOOT_STATS_DATA.frame_header.id = SHOOT_STATS_SEND_ID;
+    append_CRC8_check_sum(  // 添加帧头 CRC8 校验位
+        (uint8_t *)(&SEND_SHOOT_STATS_DATA.frame_header),
+        sizeof(SEND_SHOOT_STATS_DATA.frame_header));
 }   
 
 /**
@@ -374,6 +403,10 @@ static void UsbSendData(void)
     CheckDurationAndSend(JointState);
     // 发送Buff数据
     CheckDurationAndSend(Buff);
+    // 发送TaskMonitor数据
+    CheckDurationAndSend(TaskMonitor);
+    // 发送ShootStats数据
+    CheckDurationAndSend(ShootStats);
 }
 
 /**
@@ -636,6 +669,62 @@ static void UsbSendBuffData(void)
     append_CRC16_check_sum((uint8_t *)&SEND_BUFF_DATA, sizeof(SendDataBuff_s));
     USB_Transmit((uint8_t *)&SEND_BUFF_DATA, sizeof(SendDataBuff_s));
 }
+
+/**
+ * @brief 发送任务运行统计数据，任务较多时分多包轮流发送
+ * @param duration 发送周期
+ */
+static void UsbSendTaskMonitorData(void)
+{
+    static uint8_t start = 0;
+    uint8_t task_num, i;
+    const TaskMonitorInfo_t * info = GetTaskMonitorInfo(&task_num);
+
+    if (start >= task_num) {
+        start = 0;
+    }
+
+    SEND_TASK_MONITOR_DATA.time_stamp = HAL_GetTick();
+    SEND_TASK_MONITOR_DATA.data.cpu_load = GetCpuLoad();
+    SEND_TASK_MONITOR_DATA.data.task_num = task_num;
+    SEND_TASK_MONITOR_DATA.data.start = start;
+
+    memset(SEND_TASK_MONITOR_DATA.data.tasks, 0, sizeof(SEND_TASK_MONITOR_DATA.data.tasks));
+    for (i = 0; i < TASK_MONITOR_PACKAGE_NUM && start + i < task_num; i++) {
+        memcpy(SEND_TASK_MONITOR_DATA.data.tasks[i].name, info[start + i].name, TASK_MONITOR_NAME_LEN);
+        SEND_TASK_MONITOR_DATA.data.tasks[i].cpu = info[start + i].cpu;
+        SEND_TASK_MONITOR_DATA.data.tasks[i].stack_free = info[start + i].stack_free;
+        SEND_TASK_MONITOR_DATA.data.tasks[i].jitter = info[start + i].jitter;
+        SEND_TASK_MONITOR_DATA.data.tasks[i].latency = info[start + i].latency;
+        SEND_TASK_MONITOR_DATA.data.tasks[i].miss = info[start + i].miss;
+    }
+    start += TASK_MONITOR_PACKAGE_NUM;
+
+    append_CRC16_check_sum((uint8_t *)&SEND_TASK_MONITOR_DATA, sizeof(SendDataTaskMonitor_s));
+    USB_Transmit((uint8_t *)&SEND_TASK_MONITOR_DATA, sizeof(SendDataTaskMonitor_s));
+}
+
+/**
+ * @brief 发送摩擦轮单发统计数据
+ * @param duration 发送周期
+ */
+static void UsbSendShootStatsData(void)
+{
+    if (SHOOT_FRIC_STATS == NULL) {
+        // 发射任务可能晚于USB任务发布数据
+        SHOOT_FRIC_STATS = Subscribe(SHOOT_FRIC_STATS_NAME);
+        if (SHOOT_FRIC_STATS == NULL) {
+            return;
+        }
+    }
+
+    SEND_SHOOT_STATS_DATA.time_stamp = HAL_GetTick();
+    // 数据段字段顺序与 ShootFricStats_t 相同，且均为4字节成员，没有填充
+    memcpy(&SEND_SHOOT_STATS_DATA.data, SHOOT_FRIC_STATS, sizeof(SEND_SHOOT_STATS_DATA.data));
+
+    append_CRC16_check_sum((uint8_t *)&SEND_SHOOT_STATS_DATA, sizeof(SendDataShootStats_s));
+    USB_Transmit((uint8_t *)&SEND_SHOOT_STATS_DATA, sizeof(SendDataShootStats_s));
+}
 /*******************************************************************************/
 /* Receive Function                                                            */
 /*******************************************************************************/
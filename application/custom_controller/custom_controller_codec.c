@@ -0,0 +1,137 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       custom_controller_codec.c/h
+  * @brief      自定义控制器数据段(0x0302, 30字节)的量化与差分编码，控制器端编码，机器人端解码
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include "custom_controller_codec.h"
+
+#include "math.h"
+
+#define CC_CODEC_HEAD_LENGTH 2
+#define CC_CODEC_INTERVAL_ALPHA 0.9f
+#define CC_CODEC_LATENCY_ALPHA 0.9f
+#define CC_CODEC_OFFSET_LEAK 0.01f  // (ms/帧)最小值每帧上浮的量，大于两块板晶振漂移造成的变化
+
+/**
+ * @brief          四舍五入并限幅到 [min, max]
+ */
+static int32_t Quantize(fp32 x, fp32 scale, int32_t min, int32_t max)
+{
+    int32_t q = (int32_t)floorf(x * scale + 0.5f);
+    if (q > max) return max;
+    if (q < min) return min;
+    return q;
+}
+
+/**
+ * @brief          编码一帧
+ * @param[out]     data 数据段
+ * @param[in]      frame 包序号、时间戳和 CC_CODEC_SAMPLE_NUM 个样本
+ * @retval         none
+ */
+void CustomControllerEncode(uint8_t data[CC_CODEC_DATA_LENGTH], const CcFrame_s * frame)
+{
+    fp32 last[CC_CODEC_JOINT_NUM];  // 解码端将得到的上一个样本
+    uint8_t * p = data + CC_CODEC_HEAD_LENGTH;
+
+    data[0] = frame->seq;
+    data[1] = frame->stamp;
+
+    for (uint8_t j = 0; j < CC_CODEC_JOINT_NUM; j++) {
+        int16_t q = (int16_t)Quantize(frame->pos[0][j], CC_CODEC_POS_SCALE, -32768, 32767);
+        p[0] = (uint8_t)q;
+        p[1] = (uint8_t)((uint16_t)q >> 8);
+        p += 2;
+        last[j] = q / CC_CODEC_POS_SCALE;
+    }
+
+    // 差分相对于解码后的值计算，量化误差不累积
+    for (uint8_t s = 1; s < CC_CODEC_SAMPLE_NUM; s++) {
+        for (uint8_t j = 0; j < CC_CODEC_JOINT_NUM; j++) {
+            int8_t d =
+                (int8_t)Quantize(frame->pos[s][j] - last[j], CC_CODEC_DELTA_SCALE, -128, 127);
+            *p++ = (uint8_t)d;
+            last[j] += d / CC_CODEC_DELTA_SCALE;
+        }
+    }
+}
+
+/**
+ * @brief          解码一帧
+ * @param[in]      data 数据段
+ * @param[out]     frame 包序号、时间戳和 CC_CODEC_SAMPLE_NUM 个样本
+ * @retval         none
+ */
+void CustomControllerDecode(const uint8_t data[CC_CODEC_DATA_LENGTH], CcFrame_s * frame)
+{
+    const uint8_t * p = data + CC_CODEC_HEAD_LENGTH;
+
+    frame->seq = data[0];
+    frame->stamp = data[1];
+
+    for (uint8_t j = 0; j < CC_CODEC_JOINT_NUM; j++) {
+        int16_t q = (int16_t)(p[0] | (p[1] << 8));
+        p += 2;
+        frame->pos[0][j] = q / CC_CODEC_POS_SCALE;
+    }
+
+    for (uint8_t s = 1; s < CC_CODEC_SAMPLE_NUM; s++) {
+        for (uint8_t j = 0; j < CC_CODEC_JOINT_NUM; j++) {
+            frame->pos[s][j] = frame->pos[s - 1][j] + (int8_t)(*p++) / CC_CODEC_DELTA_SCALE;
+        }
+    }
+}
+
+/**
+ * @brief          机器人端收到一帧时调用，解码并更新链路统计
+ * @param[in,out]  rx 接收状态
+ * @param[in]      data 数据段
+ * @param[in]      now_ms (ms)到达时刻
+ * @note           两块板的时钟不同步，到达时刻与时间戳之差 = 单向延迟 + 时钟偏差，
+ *                 减去其最小值后得到的是延迟中超出最小值的部分(排队、丢帧重发等)
+ * @retval         none
+ */
+void CustomControllerReceive(
+    CcReceiver_s * rx, const uint8_t data[CC_CODEC_DATA_LENGTH], uint32_t now_ms)
+{
+    uint8_t last_seq = rx->frame.seq;
+
+    CustomControllerDecode(data, &rx->frame);
+
+    uint8_t offset = (uint8_t)(now_ms - rx->frame.stamp);
+    if (!rx->valid) {
+        rx->valid = 1;
+        rx->count = 1;
+        rx->lost = 0;
+        rx->interval = 0.0f;
+        rx->offset = offset;
+        rx->offset_min = offset;
+        rx->latency = 0.0f;
+        rx->last_arrival = now_ms;
+        return;
+    }
+
+    rx->count++;
+    rx->lost += (uint8_t)(rx->frame.seq - last_seq - 1);
+    rx->interval = CC_CODEC_INTERVAL_ALPHA * rx->interval +
+                   (1.0f - CC_CODEC_INTERVAL_ALPHA) * (fp32)(now_ms - rx->last_arrival);
+    rx->last_arrival = now_ms;
+
+    // 时间戳只有8位，按相邻两帧的变化量展开；最小值缓慢上浮以跟随晶振漂移
+    rx->offset += (int8_t)(offset - (uint8_t)rx->offset);
+    rx->offset_min = fminf(rx->offset_min + CC_CODEC_OFFSET_LEAK, (fp32)rx->offset);
+    rx->latency = CC_CODEC_LATENCY_ALPHA * rx->latency +
+                  (1.0f - CC_CODEC_LATENCY_ALPHA) * ((fp32)rx->offset - rx->offset_min);
+}
+/*------------------------------ End of File ------------------------------*/
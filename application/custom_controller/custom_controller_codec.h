@@ -0,0 +1,71 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       custom_controller_codec.c/h
+  * @brief      自定义控制器数据段(0x0302, 30字节)的量化与差分编码，控制器端编码，机器人端解码
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *  V1.0.1     Oct-19-2026     Penguin         1. 修正说明中的样本频率
+  *
+  @verbatim
+  ==============================================================================
+    数据段格式(30字节，小端)：
+      [0]      包序号
+      [1]      控制器时间戳的低8位(ms)，机器人端用于估计链路延迟
+      [2..15]  最新样本，CC_CODEC_JOINT_NUM 个 int16，LSB = 1/CC_CODEC_POS_SCALE rad
+      [16..22] 前一个样本相对最新样本的差，int8，LSB = 1/CC_CODEC_DELTA_SCALE rad
+      [23..29] 再前一个样本相对前一个样本的差，int8
+    最新样本不经过差分，精度不受历史样本影响；差分按解码后的值逐个计算，
+    超出int8时饱和，只影响历史样本，误差不会累积到后续帧。
+    一帧携带 CC_CODEC_SAMPLE_NUM 个间隔为 发送周期/CC_CODEC_SAMPLE_NUM 的样本，
+    样本频率为帧率的 CC_CODEC_SAMPLE_NUM 倍。帧率受裁判系统限制不超过30Hz，样本频率最高90Hz；
+    默认采样间隔 CC_UPLINK_SAMPLE_TIME = 12ms 时，帧周期36ms(约28Hz)，样本频率约83Hz，
+    原来7个float只能放下一个样本，且第8个float只有一半。
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+#ifndef CUSTOM_CONTROLLER_CODEC_H
+#define CUSTOM_CONTROLLER_CODEC_H
+#include "struct_typedef.h"
+
+#define CC_CODEC_DATA_LENGTH 30
+#define CC_CODEC_JOINT_NUM 7
+#define CC_CODEC_SAMPLE_NUM 3
+#define CC_CODEC_POS_SCALE 4096.0f  // (LSB/rad)最新样本，范围 ±8 rad
+#define CC_CODEC_DELTA_SCALE 512.0f // (LSB/rad)样本差，范围 ±0.25 rad
+
+typedef struct
+{
+    uint8_t seq;    // 包序号
+    uint8_t stamp;  // (ms)控制器时间戳低8位
+    fp32 pos[CC_CODEC_SAMPLE_NUM][CC_CODEC_JOINT_NUM];  // (rad)pos[0]为最新样本，依次向前
+} CcFrame_s;
+
+/**
+ * @brief 机器人端的接收状态与链路统计
+ */
+typedef struct
+{
+    CcFrame_s frame;        // 最近一帧
+    bool_t valid;           // 已收到过数据
+    uint32_t count;         // 收到的帧数
+    uint32_t lost;          // 按包序号统计的丢帧数
+    uint32_t last_arrival;  // (ms)最近一帧的到达时刻
+    fp32 interval;          // (ms)到达间隔的EWMA
+    int32_t offset;         // (ms)到达时刻与控制器时间戳之差(展开后)
+    fp32 offset_min;        // (ms)offset的最小值，对应没有排队时的单向延迟
+    fp32 latency;           // (ms)单向延迟超出最小值的部分的EWMA，即排队和重传造成的延迟
+} CcReceiver_s;
+
+extern void CustomControllerEncode(
+    uint8_t data[CC_CODEC_DATA_LENGTH], const CcFrame_s * frame);
+
+extern void CustomControllerDecode(
+    const uint8_t data[CC_CODEC_DATA_LENGTH], CcFrame_s * frame);
+
+extern void CustomControllerReceive(
+    CcReceiver_s * rx, const uint8_t data[CC_CODEC_DATA_LENGTH], uint32_t now_ms);
+
+#endif  // CUSTOM_CONTROLLER_CODEC_H
+/*------------------------------ End of File ------------------------------*/
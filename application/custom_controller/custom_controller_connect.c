@@ -6,6 +6,8 @@
   * @history
   *  Version    Date            Author          Modification
   *  V1.0.0     Apr-30-2024     Penguin         1. done
+  *  V1.1.0     Oct-19-2026     Penguin         1. 改为DMA双缓冲非阻塞发送
+  *                                             2. 关节位置按custom_controller_codec量化、差分编码
   *
   @verbatim
   ==============================================================================
@@ -18,42 +20,121 @@
 #include "custom_controller_connect.h"
 
 #include "CRC8_CRC16.h"
+#include "bsp_dwt.h"
+#include "bsp_usart.h"
 #include "string.h"
-#include "usart.h"
+
+extern DMA_HandleTypeDef hdma_usart1_tx;
 
 /*-------------------- Send --------------------*/
 
-static Controller_t TX_DATA;  // 自定义控制器发送的数据
+static Controller_t TX_DATA[2];    // 双缓冲，DMA发送其中一个时填写另一个
+static uint8_t TX_FILL = 0;        // 正在填写的缓冲区
+static bool_t TX_PENDING = 0;      // TX_DATA[TX_FILL]已填好，等待DMA
+static bool_t TX_BUSY = 0;         // DMA正在发送另一个缓冲区
+static uint32_t TX_READY_CYCLE = 0;
+static uint32_t TX_START_CYCLE = 0;
+
+static CustomControllerUplink_s UPLINK;
+
+static CcFrame_s CC_FRAME;  // 采样历史，pos[0]为最新样本
+static uint8_t SAMPLE_COUNT = 0;
+static uint32_t LAST_SAMPLE_TIME = 0;
 
 /**
  * @brief 数据拼接函数，将帧头、命令码、数据段、帧尾头拼接成一个数组
+ * @param frame 填写的数据帧
  * @param data 数据段的数组指针
  * @param data_lenth 数据段长度
  */
-static void DataConcatenat(uint8_t * data, uint16_t data_lenth)
+static void DataConcatenat(Controller_t * frame, uint8_t * data, uint16_t data_lenth)
 {
     static uint8_t seq = 0;
     /// 帧头数据
-    TX_DATA.frame_header.sof = 0xA5;                // 数据帧起始字节，固定值为 0xA5
-    TX_DATA.frame_header.data_length = data_lenth;  // 数据帧中数据段的长度
-    TX_DATA.frame_header.seq = seq++;               // 包序号
-    append_CRC8_check_sum((uint8_t *)(&TX_DATA.frame_header), 5);  // 添加帧头 CRC8 校验位
+    frame->frame_header.sof = 0xA5;                // 数据帧起始字节，固定值为 0xA5
+    frame->frame_header.data_length = data_lenth;  // 数据帧中数据段的长度
+    frame->frame_header.seq = seq++;               // 包序号
+    append_CRC8_check_sum((uint8_t *)(&frame->frame_header), 5);  // 添加帧头 CRC8 校验位
     /// 命令码ID
-    TX_DATA.cmd_id = CONTROLLER_CMD_ID;
+    frame->cmd_id = CONTROLLER_CMD_ID;
     /// 数据段
-    memcpy(TX_DATA.data, data, data_lenth);
+    memcpy(frame->data, data, data_lenth);
     /// 帧尾CRC16，整包校验
-    append_CRC16_check_sum((uint8_t *)(&TX_DATA), DATA_FRAME_LENGTH);
+    append_CRC16_check_sum((uint8_t *)frame, DATA_FRAME_LENGTH);
+}
+
+/**
+ * @brief 查询上一帧是否发送完成，DMA空闲时启动等待中的帧
+ */
+static void UplinkPoll(void)
+{
+    uint32_t cycle = dwt_get_cycle();
+
+    if (TX_BUSY && (hdma_usart1_tx.Instance->CR & DMA_SxCR_EN) == 0) {
+        TX_BUSY = 0;
+        UPLINK.tx_us = dwt_cycle_to_us(cycle - TX_START_CYCLE);
+    }
+
+    if (TX_PENDING && !TX_BUSY) {
+        usart1_tx_dma_enable((uint8_t *)(&TX_DATA[TX_FILL]), sizeof(Controller_t));
+        TX_START_CYCLE = cycle;
+        TX_BUSY = 1;
+        TX_PENDING = 0;
+        TX_FILL ^= 1;
+
+        UPLINK.sent++;
+        UPLINK.queue_us = dwt_cycle_to_us(cycle - TX_READY_CYCLE);
+        if (UPLINK.queue_us > UPLINK.max_queue_us) {
+            UPLINK.max_queue_us = UPLINK.queue_us;
+        }
+    }
 }
 
 /**
- * @brief      发送数据到电脑
- * @param[in]  data 自定义数据段（最大30字节）
+ * @brief      发送数据到电脑，不等待发送完成
+ * @param[in]  data 自定义数据段（30字节）
  */
 void SendDataToPC(uint8_t * data)
 {
-    DataConcatenat(data, DATA_LENGTH);
-    HAL_UART_Transmit(&huart1, (uint8_t *)(&TX_DATA), sizeof(TX_DATA), 50);
+    if (TX_PENDING) {
+        UPLINK.dropped++;
+    }
+    DataConcatenat(&TX_DATA[TX_FILL], data, DATA_LENGTH);
+    TX_PENDING = 1;
+    TX_READY_CYCLE = dwt_get_cycle();
+    UplinkPoll();
 }
 
+/**
+ * @brief      采样关节位置，凑齐一帧时编码发送，在任务的每个周期调用
+ * @param[in]  pos (rad)关节位置
+ * @param[in]  now_ms (ms)当前时间
+ */
+void CustomControllerUplinkUpdate(const fp32 pos[CC_CODEC_JOINT_NUM], uint32_t now_ms)
+{
+    UplinkPoll();
+
+    if (now_ms - LAST_SAMPLE_TIME < CC_UPLINK_SAMPLE_TIME) {
+        return;
+    }
+    LAST_SAMPLE_TIME = now_ms;
+
+    memmove(CC_FRAME.pos[1], CC_FRAME.pos[0], sizeof(CC_FRAME.pos[0]) * (CC_CODEC_SAMPLE_NUM - 1));
+    memcpy(CC_FRAME.pos[0], pos, sizeof(CC_FRAME.pos[0]));
+
+    if (++SAMPLE_COUNT < CC_CODEC_SAMPLE_NUM) {
+        return;
+    }
+    SAMPLE_COUNT = 0;
+
+    uint8_t data[DATA_LENGTH];
+    CC_FRAME.stamp = (uint8_t)now_ms;
+    CustomControllerEncode(data, &CC_FRAME);
+    CC_FRAME.seq++;
+    UPLINK.frame++;
+    SendDataToPC(data);
+}
+
+const CustomControllerUplink_s * GetCustomControllerUplink(void) { return &UPLINK; }
+
 /************************ END OF FILE ************************/
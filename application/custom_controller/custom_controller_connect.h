@@ -6,9 +6,19 @@
   * @history
   *  Version    Date            Author          Modification
   *  V1.0.0     Apr-30-2024     Penguin         1. done
+  *  V1.1.0     Oct-19-2026     Penguin         1. 改为DMA双缓冲非阻塞发送
+  *                                             2. 关节位置按custom_controller_codec量化、差分编码
   *
   @verbatim
   ==============================================================================
+    发送：
+      CustomControllerUplinkUpdate 在任务的每个周期调用，每 CC_UPLINK_SAMPLE_TIME 采样一次，
+      每 CC_CODEC_SAMPLE_NUM 个样本编码成一帧。帧在两个缓冲区中交替填写，
+      DMA空闲时启动发送，不等待发送完成；DMA仍在发送上一帧时新帧保留到下一次调用，
+      再有新帧时覆盖等待中的帧并计入 dropped。
+    统计：
+      queue_us 编码完成到启动DMA，tx_us 启动DMA到查询到DMA完成(分辨率为任务周期)，
+      到机器人端的延迟由 referee.c 中的 CustomControllerReceive 统计。
 
   ==============================================================================
   @endverbatim
@@ -18,8 +28,9 @@
 #ifndef __CUSTOM_CONTROLLER_CONNECT_H__
 #define __CUSTOM_CONTROLLER_CONNECT_H__
 
-#include "stm32f4xx_hal.h"
+#include "custom_controller_codec.h"
 #include "referee.h"
+#include "stm32f4xx_hal.h"
 
 #define CONTROLLER_ENGINEERING ((uint8_t)0x01)  // 工程机器人的自定义控制器
 #define CONTROLLER_INFANTRY ((uint8_t)0x02)     // 步兵机器人的自定义控制器
@@ -34,6 +45,11 @@
 
 #define CONTROLLER_CMD_ID 0x0302  // 自定义控制器命令码
 
+#ifndef CC_UPLINK_SAMPLE_TIME
+// (ms)采样间隔，一帧的周期为 CC_CODEC_SAMPLE_NUM 倍，不超过裁判系统限制的30Hz
+#define CC_UPLINK_SAMPLE_TIME 12
+#endif  // CC_UPLINK_SAMPLE_TIME
+
 typedef __packed struct
 {
     __packed struct
@@ -48,7 +64,19 @@ typedef __packed struct
     __packed uint16_t frame_tail;  // 帧尾CRC16校验
 } Controller_t;                    // 自定义控制器数据包
 
+typedef struct
+{
+    uint32_t frame;         // 编码的帧数
+    uint32_t sent;          // 启动DMA发送的帧数
+    uint32_t dropped;       // 等待DMA时被新帧覆盖的帧数
+    uint32_t queue_us;      // (us)最近一帧从编码完成到启动DMA
+    uint32_t max_queue_us;  // (us)queue_us的最大值
+    uint32_t tx_us;         // (us)最近一帧从启动DMA到查询到完成
+} CustomControllerUplink_s;
+
 extern void SendDataToPC(uint8_t * data);
+extern void CustomControllerUplinkUpdate(const fp32 pos[CC_CODEC_JOINT_NUM], uint32_t now_ms);
+extern const CustomControllerUplink_s * GetCustomControllerUplink(void);
 
 #endif
 /************************ END OF FILE ************************/
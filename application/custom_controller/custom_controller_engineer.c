@@ -7,6 +7,7 @@
   *  Version    Date            Author          Modification
   *  V1.0.0     Aug-22-2024     Penguin         1. done
   *  V1.0.1     Jan-14-2025     Penguin         1. 能获取关节的位置
+  *  V1.0.2     Oct-19-2026     Penguin         1. 多圈计数与速度滤波改用 JointObserver
   *
   @verbatim
   ==============================================================================
@@ -52,8 +53,7 @@
             &CUSTOM_CONTROLLER.pid.joint[index], PID_POSITION, j##index##_pid_velocity, \
             MAX_OUT_JOINT_##index##_VELOCITY, MAX_IOUT_JOINT_##index##_VELOCITY);       \
     }
-#define JointLpfInit(index) \
-    LowPassFilterInit(&CUSTOM_CONTROLLER.lpf.joint[index], J##index##_LPF_ALPHA)
+#define JointLpfInit(index) CUSTOM_CONTROLLER.observer.alpha[index] = J##index##_LPF_ALPHA
 
 /*------------------------------ Variable Definition ------------------------------*/
 
@@ -93,7 +93,11 @@ void CustomControllerInit(void)
     JointPidInit(3);
     JointPidInit(4);
     JointPidInit(5);
-    // #LPF init ---------------------
+    // #observer init ---------------------
+    const float observer_gain[3] = {0.0f, 0.0f, 0.9f};
+    JointObserverInit(
+        &CUSTOM_CONTROLLER.observer, JOINT_OBSERVER_LPF, JOINT_NUM, 2 * M_PI, 1.0f, observer_gain,
+        CUSTOM_CONTROLLER_CONTROL_TIME * 0.001f);
     JointLpfInit(0);
     JointLpfInit(1);
     JointLpfInit(2);
@@ -159,8 +163,7 @@ void CustomControllerSetMode(void) { CUSTOM_CONTROLLER.mode = CUSTOM_CONTROLLER_
 
 void CustomControllerObserver(void)
 {
-    static float last_pos[6], pos_fdb[6] = {0, 0, 0, 0, 0, 0};
-    float dpos;
+    float raw_pos[JOINT_NUM], raw_vel[JOINT_NUM];
     uint8_t i;
     // 更新电机测量数据
     for (i = 0; i < JOINT_NUM; i++) {
@@ -168,21 +171,17 @@ void CustomControllerObserver(void)
     }
     // 获取观测值
     for (i = 0; i < JOINT_NUM; i++) {
-        CUSTOM_CONTROLLER.fdb.joint[i].vel = CUSTOM_CONTROLLER.joint_motor[i].fdb.vel;
-
-        // 处理多圈计数问题
-        pos_fdb[i] = theta_transform(
+        raw_pos[i] = theta_transform(
             CUSTOM_CONTROLLER.joint_motor[i].fdb.pos, CUSTOM_CONTROLLER.transform.pos[i],
             CUSTOM_CONTROLLER.joint_motor[i].direction, 1);
-
-        dpos = pos_fdb[i] - last_pos[i];
-        if (fabs(dpos) > M_PI) {
-            CUSTOM_CONTROLLER.fdb.joint[i].round += (dpos) < 0 ? 1 : -1;
-        }
-        last_pos[i] = pos_fdb[i];
-        CUSTOM_CONTROLLER.fdb.joint[i].pos =
-            (pos_fdb[i] + M_PI * 2 * CUSTOM_CONTROLLER.fdb.joint[i].round) /
-            CUSTOM_CONTROLLER.joint_motor[i].reduction_ratio;
+        raw_vel[i] =
+            CUSTOM_CONTROLLER.joint_motor[i].fdb.vel * CUSTOM_CONTROLLER.joint_motor[i].direction;
+    }
+    // 处理多圈计数问题
+    JointObserverUpdate(&CUSTOM_CONTROLLER.observer, raw_pos, raw_vel);
+    for (i = 0; i < JOINT_NUM; i++) {
+        CUSTOM_CONTROLLER.fdb.joint[i].pos = CUSTOM_CONTROLLER.observer.pos[i];
+        CUSTOM_CONTROLLER.fdb.joint[i].vel = CUSTOM_CONTROLLER.observer.vel[i];
     }
 
     // 更新机械臂控制数据
@@ -7,6 +7,7 @@
   *  Version    Date            Author          Modification
   *  V1.0.0     Aug-22-2024     Penguin         1. done
   *  V1.0.1     Jan-14-2025     Penguin         1. 能获取关节的位置
+  *  V1.0.2     Oct-19-2026     Penguin         1. 多圈计数与速度滤波改用 JointObserver
   *
   @verbatim
   ==============================================================================
@@ -22,6 +23,7 @@
 
 #if (CUSTOM_CONTROLLER_TYPE == CUSTOM_CONTROLLER_ENGINEER)
 
+#include "joint_observer.h"
 #include "motor.h"
 #include "pid.h"
 #include "struct_typedef.h"
@@ -63,7 +65,6 @@ typedef struct
             float pos;   // (rad)位置
             float dpos;  // (rad)位置差
             float vel;   // (rad/s)速度
-            int16_t round;   // 圈数(当前位于第几圈中，初始为0)
         } joint[JOINT_NUM];
     } fdb;
 
@@ -93,10 +94,7 @@ typedef struct
         pid_type_def joint[JOINT_NUM];
     } pid;
 
-    struct
-    {
-        LowPassFilter_t joint[JOINT_NUM];
-    } lpf;
+    JointObserver_s observer;  // 关节多圈展开与速度估计
 
 } CustomController_s;
 
@@ -9,6 +9,7 @@
   *  V1.0.1     Aug-23-2024     Penguin         1. 将接收和发送模式分开
   *  V1.0.2     Aug-23-2024     Penguin         1. 定义了自定义控制器的统一控制协议，
   *                                                无需再区分发送和接收模式了
+  *  V1.0.3     Oct-19-2026     Penguin         1. 改为非阻塞的编码发送，修复每个周期都发送的问题
   *
   @verbatim
   ==============================================================================
@@ -21,16 +22,21 @@
 
 #include "attribute_typedef.h"
 #include "cmsis_os.h"
+#include "control_timer.h"
 #include "custom_controller.h"
 #include "custom_controller_connect.h"
 #include "custom_controller_engineer.h"
+#include "mem_pool.h"
+#include "task_monitor.h"
+
+#ifndef CUSTOM_CONTROLLER_CONTROL_PHASE
+#define CUSTOM_CONTROLLER_CONTROL_PHASE 0  // (ms)控制周期内的释放相位偏移
+#endif  // CUSTOM_CONTROLLER_CONTROL_PHASE
 
 #if INCLUDE_uxTaskGetStackHighWaterMark
 uint32_t custom_controller_high_water;
 #endif
 
-static uint32_t lastTick = 0;
-
 __weak void CustomControllerPublish(void);
 __weak void CustomControllerInit(void);
 __weak void CustomControllerHandleException(void);
@@ -51,8 +57,14 @@ void custom_controller_task(void const * pvParameters)
     vTaskDelay(CUSTOM_CONTROLLER_TASK_INIT_TIME);
     // 初始化
     CustomControllerInit();
+    mem_pool_init_release();
+    TaskMonitorRegister(CUSTOM_CONTROLLER_CONTROL_TIME);
+    ControlTimerInit(
+        CONTROL_TIMER_CUSTOM_CONTROLLER, CUSTOM_CONTROLLER_CONTROL_TIME,
+        CUSTOM_CONTROLLER_CONTROL_PHASE);
 
     while (1) {
+        TaskMonitorLoop();
         // 更新状态量
         CustomControllerObserver();
         // 处理异常
@@ -66,13 +78,11 @@ void custom_controller_task(void const * pvParameters)
         // 发送控制量
         CustomControllerSendCmd();
 
-        // 发送数据至操作者电脑
-        if (xTaskGetTickCount() - lastTick > CUSTOM_CONTROLLER_SEND_TIME) {
-            SendDataToPC((uint8_t *)cc_control_data.pos);
-        }
+        // 发送数据至操作者电脑，不阻塞
+        CustomControllerUplinkUpdate(cc_control_data.pos, xTaskGetTickCount());
 
         // 系统延时
-        vTaskDelay(CUSTOM_CONTROLLER_CONTROL_TIME);
+        ControlTimerWait(CONTROL_TIMER_CUSTOM_CONTROLLER);
 
 #if INCLUDE_uxTaskGetStackHighWaterMark
         custom_controller_high_water = uxTaskGetStackHighWaterMark(NULL);
@@ -0,0 +1,136 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       codec_test.c
+  * @brief      在PC上运行的自定义控制器编解码测试程序，检查量化误差、差分饱和与链路统计
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+    编译运行：
+      cc -O2 -I.. -I../../typedef -o codec_test codec_test.c ../custom_controller_codec.c -lm
+      ./codec_test
+    检查项(任一不满足返回非0)：
+      1. 随机的关节运动(每个采样间隔最多变化0.2rad)，最新样本误差不超过半个LSB，
+         历史样本误差不超过半个差分LSB(差分按解码后的值计算，误差不累积)
+      2. 样本间变化超过差分范围时，历史样本饱和，最新样本和下一帧不受影响
+      3. 按固定周期发送、随机丢帧和随机附加延迟时，丢帧数与实际相同，
+         延迟统计收敛到附加延迟的均值附近，且不随时间戳回绕和时钟漂移增长
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include <math.h>
+#include <stdio.h>
+
+#include "custom_controller_codec.h"
+
+#define CASE_NUM 100000
+#define MAX_STEP 0.2   // (rad)每个采样间隔的最大变化
+#define RANGE 7.9      // (rad)关节位置范围
+#define PERIOD 36      // (ms)帧周期
+#define LINK_NUM 20000
+#define LOSS_RATE 0.05
+#define DRIFT 1e-4     // 两块板时钟的相对偏差
+
+static uint32_t SEED = 1;
+
+static double Rand(double min, double max)
+{
+    SEED = SEED * 1664525u + 1013904223u;
+    return min + (max - min) * (SEED >> 8) / (double)(1u << 24);
+}
+
+int main(void)
+{
+    int fail = 0;
+    uint8_t data[CC_CODEC_DATA_LENGTH];
+    CcFrame_s in, out;
+
+    // 1. 随机运动
+    {
+        double max_err[CC_CODEC_SAMPLE_NUM] = {0};
+        for (int c = 0; c < CASE_NUM; c++) {
+            for (int j = 0; j < CC_CODEC_JOINT_NUM; j++) {
+                double x = Rand(-RANGE, RANGE);
+                for (int s = 0; s < CC_CODEC_SAMPLE_NUM; s++) {
+                    in.pos[s][j] = (fp32)x;
+                    x += Rand(-MAX_STEP, MAX_STEP);
+                }
+            }
+            in.seq = (uint8_t)c;
+            in.stamp = (uint8_t)(c * 7);
+            CustomControllerEncode(data, &in);
+            CustomControllerDecode(data, &out);
+            if (out.seq != in.seq || out.stamp != in.stamp) fail = 1;
+            for (int s = 0; s < CC_CODEC_SAMPLE_NUM; s++) {
+                for (int j = 0; j < CC_CODEC_JOINT_NUM; j++) {
+                    double e = fabs(out.pos[s][j] - in.pos[s][j]);
+                    if (e > max_err[s]) max_err[s] = e;
+                }
+            }
+        }
+        for (int s = 0; s < CC_CODEC_SAMPLE_NUM; s++) {
+            double lsb = s == 0 ? 1.0 / CC_CODEC_POS_SCALE : 1.0 / CC_CODEC_DELTA_SCALE;
+            double bound = 0.5 * lsb + 1e-6;
+            printf("sample %d: max error %.2e rad (bound %.2e)\n", s, max_err[s], bound);
+            if (max_err[s] > bound) fail = 1;
+        }
+    }
+
+    // 2. 差分饱和
+    {
+        for (int j = 0; j < CC_CODEC_JOINT_NUM; j++) {
+            in.pos[0][j] = 1.0f;
+            in.pos[1][j] = 0.0f;  // 差1rad，超过差分范围
+            in.pos[2][j] = 0.0f;
+        }
+        CustomControllerEncode(data, &in);
+        CustomControllerDecode(data, &out);
+        double e0 = fabs(out.pos[0][0] - 1.0);
+        double e1 = fabs(out.pos[1][0] - (1.0 - 128.0 / CC_CODEC_DELTA_SCALE));
+        for (int j = 0; j < CC_CODEC_JOINT_NUM; j++) in.pos[0][j] = in.pos[1][j] = in.pos[2][j] = 0;
+        CustomControllerEncode(data, &in);
+        CustomControllerDecode(data, &out);
+        double e2 = fabs(out.pos[0][0]) + fabs(out.pos[1][0]) + fabs(out.pos[2][0]);
+        printf("saturation: newest %.2e, clamped %.2e, next frame %.2e\n", e0, e1, e2);
+        if (e0 > 0.5 / CC_CODEC_POS_SCALE || e1 > 1e-6 || e2 > 1e-6) fail = 1;
+    }
+
+    // 3. 链路统计
+    {
+        CcReceiver_s rx = {0};
+        uint32_t lost = 0, received = 0;
+        double extra_sum = 0;
+        fp32 latency_max = 0;
+        for (int n = 0; n < LINK_NUM; n++) {
+            uint32_t tx_ms = 12345u + (uint32_t)(n * PERIOD * (1.0 + DRIFT));
+            in.seq = (uint8_t)n;
+            in.stamp = (uint8_t)(n * PERIOD);  // 控制器的时钟
+            if (n > 10 && Rand(0, 1) < LOSS_RATE) {
+                lost++;
+                continue;
+            }
+            double extra = Rand(0, 1) < 0.2 ? Rand(0, 20) : 0;
+            CustomControllerEncode(data, &in);
+            CustomControllerReceive(&rx, data, tx_ms + 30 + (uint32_t)extra);
+            received++;
+            if (n > LINK_NUM / 2) {
+                extra_sum += (uint32_t)extra;
+                if (rx.latency > latency_max) latency_max = rx.latency;
+            }
+        }
+        double extra_mean = extra_sum / (received - (LINK_NUM / 2) * (1 - LOSS_RATE));
+        printf(
+            "link: lost %u (actual %u), interval %.1f ms, latency %.2f ms (max %.2f, extra mean "
+            "%.2f)\n",
+            rx.lost, lost, rx.interval, rx.latency, latency_max, extra_mean);
+        if (rx.lost != lost || rx.count != received) fail = 1;
+        if (latency_max > 4.0 * extra_mean + 2.0) fail = 1;
+    }
+
+    printf(fail ? "FAIL\n" : "PASS\n");
+    return fail;
+}
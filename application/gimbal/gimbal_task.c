@@ -21,7 +21,10 @@
 
 #include "attribute_typedef.h"
 #include "cmsis_os.h"
+#include "control_timer.h"
 #include "gimbal_yaw_pitch_direct.h"
+#include "mem_pool.h"
+#include "task_monitor.h"
 #include "usb_debug.h"
 
 #ifndef GIMBAL_TASK_INIT_TIME
@@ -32,6 +35,10 @@
 #define GIMBAL_CONTROL_TIME 1
 #endif  // GIMBAL_CONTROL_TIME
 
+#ifndef GIMBAL_CONTROL_PHASE
+#define GIMBAL_CONTROL_PHASE 0  // (ms)控制周期内的释放相位偏移
+#endif  // GIMBAL_CONTROL_PHASE
+
 #if INCLUDE_uxTaskGetStackHighWaterMark
 uint32_t gimbal_high_water;
 #endif
@@ -58,8 +65,12 @@ void gimbal_task(void const * pvParameters)
     vTaskDelay(GIMBAL_TASK_INIT_TIME);
     // 云台初始化
     GimbalInit();
+    mem_pool_init_release();
+    TaskMonitorRegister(GIMBAL_CONTROL_TIME);
+    ControlTimerInit(CONTROL_TIMER_GIMBAL, GIMBAL_CONTROL_TIME, GIMBAL_CONTROL_PHASE);
 
     while (1) {
+        TaskMonitorLoop();
         // 更新状态量
         GimbalObserver();
         // 处理异常
@@ -73,7 +84,7 @@ void gimbal_task(void const * pvParameters)
         // 发送控制量
         GimbalSendCmd();
         // 系统延时
-        vTaskDelay(GIMBAL_CONTROL_TIME);
+        ControlTimerWait(CONTROL_TIMER_GIMBAL);
 
 #if INCLUDE_uxTaskGetStackHighWaterMark
         gimbal_high_water = uxTaskGetStackHighWaterMark(NULL);
@@ -6,6 +6,9 @@
   * @history
   *  Version    Date            Author          Modification
   *  V1.0.0     2025-03-04      Harry_Wong      1. 初始化项目，填写对外函数
+  *  V1.1.0     Oct-19-2026     Penguin         1. yaw由预测器估计到底盘控制时刻
+  *  V1.1.1     Oct-19-2026     Penguin         1. 预测器在底盘任务中更新，CAN数据也经过预测器
+  *  V1.1.2     Oct-19-2026     Penguin         1. CAN数据的样本时刻与串口相同，使用统一时基(us)
   *
   @verbatim
   ==============================================================================
@@ -16,23 +19,86 @@
 */
 #include"gimbal_virtual.h"
 #if (GIMBAL_TYPE == GIMBAL_NONE)
+#include "CAN_communication.h"
+#include "IMU.h"
 #include "communication.h"
 
+#if __VIRTUAL_GIMBAL_FROM == VG_FROM_UART2 || __VIRTUAL_GIMBAL_FROM == VG_FROM_CAN
+static VgPredict_s VG_PREDICT;
+#endif
+static float DELTA_YAW_MID = 0.0f;
+
+/* ---------------- GimbalVirtualUpdate -------------------- */
+
+/**
+ * @brief          更新yaw轴和中值的差值，在底盘任务中每个控制周期调用一次
+ * @param[in]      none
+ * @note           由收到的yaw、云台目标角速度和本板IMU的yaw角速度预测到本周期。
+ *                 CAN数据段中没有云台目标角速度，按0预测，云台自身的转动由bias修正，
+ *                 样本时刻为本板的接收时刻，两者的样本时刻都是 GetBoardTimeUs 时基
+ * @retval         none
+ */
+void GimbalVirtualUpdate(void)
+{
+#if __VIRTUAL_GIMBAL_FROM == VG_FROM_UART2
+  if (GetUartOffline()) {
+    VgPredictInit(&VG_PREDICT);
+    DELTA_YAW_MID = 0.0f;
+    return;
+  }
+
+  uint32_t now = GetBoardTimeUs();
+  VgPredictStep(&VG_PREDICT, now, GetUartGimbalYawVelCmd(), GetImuVelocity(AX_YAW));
+
+  uint32_t sample_time = GetUartGimbalSampleTime();
+  if (sample_time != VG_PREDICT.sample_us) {
+    // 时钟未同步时两块板的时刻不可比，样本年龄按0处理
+    int32_t age = GetBoardClockSync()->synced ? (int32_t)(now - sample_time) : 0;
+    VgPredictCorrect(
+      &VG_PREDICT, GetUartGimbalYawMotorPos(), sample_time, age > 0 ? (uint32_t)age : 0);
+  }
+  DELTA_YAW_MID = VG_PREDICT.valid ? VG_PREDICT.yaw : GetUartGimbalYawMotorPos();
+#elif __VIRTUAL_GIMBAL_FROM == VG_FROM_CAN
+  if (GetCanGimbalOffline()) {
+    VgPredictInit(&VG_PREDICT);
+    DELTA_YAW_MID = 0.0f;
+    return;
+  }
+
+  uint32_t now = GetBoardTimeUs();
+  VgPredictStep(&VG_PREDICT, now, 0.0f, GetImuVelocity(AX_YAW));
+
+  uint32_t sample_time = GetCanGimbalSampleTime();
+  if (sample_time != VG_PREDICT.sample_us) {
+    int32_t age = (int32_t)(now - sample_time);
+    VgPredictCorrect(
+      &VG_PREDICT, GetCanGimbalYawMotorPos(), sample_time, age > 0 ? (uint32_t)age : 0);
+  }
+  DELTA_YAW_MID = VG_PREDICT.valid ? VG_PREDICT.yaw : GetCanGimbalYawMotorPos();
+#endif
+}
 
 /* ---------------- GetGimbalDeltaYawMid -------------------- */
 
 /**
  * @brief          (rad) 获取yaw轴和中值的差值
  * @param[in]      none
+ * @note           返回最近一次 GimbalVirtualUpdate 的结果，不改变预测器状态
  * @retval         float
  */
-inline float GetGimbalDeltaYawMid(void)
+inline float GetGimbalDeltaYawMid(void) { return DELTA_YAW_MID; }
+
+/**
+ * @brief          虚拟云台预测器的状态，用于调试
+ * @retval         预测器，未使用uart2或CAN数据时为NULL
+ */
+const VgPredict_s * GetGimbalVirtualPredict(void)
 {
-#if __VIRTUAL_GIMBAL_FROM == VG_FROM_UART2
-  return GetUartGimbalYawMotorPos();
+#if __VIRTUAL_GIMBAL_FROM == VG_FROM_UART2 || __VIRTUAL_GIMBAL_FROM == VG_FROM_CAN
+  return &VG_PREDICT;
 #else
-  return 0.0f ;
-#endif 
+  return NULL;
+#endif
 }
 
 /* ---------------- GetGimbalInitJudgeReturn -------------------- */
@@ -6,6 +6,8 @@
   * @history
   *  Version    Date            Author          Modification
   *  V1.0.0     2025-03-04      Harry_Wong      1. 初始化项目，填写对外函数
+  *  V1.1.0     Oct-19-2026     Penguin         1. yaw由预测器估计到底盘控制时刻
+  *  V1.1.1     Oct-19-2026     Penguin         1. 预测器在底盘任务中更新，CAN数据也经过预测器
   *
   @verbatim
   ==============================================================================
@@ -20,7 +22,11 @@
 #ifndef GIMBAL_VIRTUAL_H
 #define GIMBAL_VIRTUAL_H
 #include "gimbal.h"
+#include "gimbal_virtual_predict.h"
 #include  "user_lib.h"
 
+extern void GimbalVirtualUpdate(void);
+extern const VgPredict_s * GetGimbalVirtualPredict(void);
+
 #endif
 #endif
@@ -0,0 +1,137 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       gimbal_virtual_predict.c/h
+  * @brief      虚拟云台yaw预测器，在底盘控制频率下连续估计云台相对底盘的yaw角度
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include "gimbal_virtual_predict.h"
+
+#include "math.h"
+#include "string.h"
+
+#define VG_PREDICT_ALPHA 0.3f      // 位置修正增益
+#define VG_PREDICT_BETA 0.02f      // 角速度偏差修正增益
+#define VG_PREDICT_RESET 0.5f      // (rad)新息超过该值时直接采用测量值
+#define VG_PREDICT_MAX_BIAS 20.0f  // (rad/s)
+#define VG_PREDICT_MAX_STEP 10000  // (us)单次预测的最长时间，调用间隔过长时不外推
+#define VG_PREDICT_MAX_AGE 50000   // (us)样本年龄的上限
+#define VG_PREDICT_HOLD 50000      // (us)超过该时间没有新样本时云台角速度的权重开始减小
+#define VG_PREDICT_TIMEOUT 500000  // (us)超过该时间没有新样本时估计失效
+
+#ifndef PI
+#define PI 3.14159265358979f
+#endif
+
+static fp32 Wrap(fp32 x)
+{
+    while (x > PI) x -= 2.0f * PI;
+    while (x < -PI) x += 2.0f * PI;
+    return x;
+}
+
+/**
+ * @brief          初始化，收到第一个样本前估计无效
+ * @param[out]     vp 预测器
+ * @retval         none
+ */
+void VgPredictInit(VgPredict_s * vp) { memset(vp, 0, sizeof(VgPredict_s)); }
+
+/**
+ * @brief          预测到当前时刻，在底盘控制周期中调用
+ * @param[in,out]  vp 预测器
+ * @param[in]      now_us (us)当前时刻
+ * @param[in]      gimbal_rate (rad/s)云台yaw在世界坐标系下的目标角速度
+ * @param[in]      chassis_rate (rad/s)底盘yaw角速度
+ * @retval         (rad)估计的yaw电机位置
+ */
+fp32 VgPredictStep(VgPredict_s * vp, uint32_t now_us, fp32 gimbal_rate, fp32 chassis_rate)
+{
+    int32_t elapsed = (int32_t)(now_us - vp->last_us);
+    vp->last_us = now_us;
+    if (!vp->valid) {
+        return vp->yaw;
+    }
+    if (elapsed < 0) {
+        elapsed = 0;
+    }
+
+    uint32_t last_hold = vp->hold_us;
+    vp->hold_us += (uint32_t)elapsed;
+    if (vp->hold_us > VG_PREDICT_TIMEOUT) {
+        vp->valid = 0;
+        return vp->yaw;
+    }
+
+    // 断线时云台的角速度逐渐不可信，按剩余时间的比例减小，底盘角速度仍为本板测量值
+    fp32 gimbal_weight = 1.0f;
+    if (vp->hold_us > VG_PREDICT_HOLD) {
+        if (last_hold <= VG_PREDICT_HOLD) {
+            vp->dropout++;
+        }
+        gimbal_weight = (fp32)(VG_PREDICT_TIMEOUT - vp->hold_us) /
+                        (fp32)(VG_PREDICT_TIMEOUT - VG_PREDICT_HOLD);
+    }
+    vp->rate = gimbal_weight * (gimbal_rate + vp->bias) - chassis_rate;
+
+    if (elapsed > VG_PREDICT_MAX_STEP) {
+        elapsed = VG_PREDICT_MAX_STEP;
+    }
+    vp->yaw = Wrap(vp->yaw + vp->rate * elapsed * 1e-6f);
+    return vp->yaw;
+}
+
+/**
+ * @brief          收到新样本时修正估计，应在 VgPredictStep 之后调用
+ * @param[in,out]  vp 预测器
+ * @param[in]      yaw (rad)样本的yaw电机位置
+ * @param[in]      sample_us (us)样本的采样时刻，用于计算样本间隔
+ * @param[in]      age_us (us)样本的采样时刻到当前时刻的时间，未知时为0
+ * @retval         none
+ */
+void VgPredictCorrect(VgPredict_s * vp, fp32 yaw, uint32_t sample_us, uint32_t age_us)
+{
+    if (age_us > VG_PREDICT_MAX_AGE) {
+        age_us = VG_PREDICT_MAX_AGE;
+    }
+    fp32 interval = (fp32)(int32_t)(sample_us - vp->sample_us) * 1e-6f;
+    vp->sample_us = sample_us;
+    vp->hold_us = age_us;
+    vp->count++;
+
+    // 外推到当前时刻
+    fp32 measure = Wrap(yaw + vp->rate * age_us * 1e-6f);
+
+    if (!vp->valid) {
+        vp->valid = 1;
+        vp->yaw = measure;
+        vp->bias = 0.0f;
+        vp->innovation = 0.0f;
+        return;
+    }
+
+    vp->innovation = Wrap(measure - vp->yaw);
+    if (fabsf(vp->innovation) > VG_PREDICT_RESET) {
+        vp->yaw = measure;
+        vp->bias = 0.0f;
+        vp->reset++;
+        return;
+    }
+
+    vp->yaw = Wrap(vp->yaw + VG_PREDICT_ALPHA * vp->innovation);
+    if (interval > 0.0f) {
+        vp->bias += VG_PREDICT_BETA * vp->innovation / interval;
+        if (vp->bias > VG_PREDICT_MAX_BIAS) vp->bias = VG_PREDICT_MAX_BIAS;
+        if (vp->bias < -VG_PREDICT_MAX_BIAS) vp->bias = -VG_PREDICT_MAX_BIAS;
+    }
+}
+/*------------------------------ End of File ------------------------------*/
@@ -0,0 +1,56 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       gimbal_virtual_predict.c/h
+  * @brief      虚拟云台yaw预测器，在底盘控制频率下连续估计云台相对底盘的yaw角度
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+    模型：
+      yaw电机位置 = 云台yaw(世界) - 底盘yaw(世界)，云台按目标角速度稳定在世界坐标系下，
+      d(yaw)/dt = 云台目标角速度 + bias - 底盘角速度(本板IMU)
+      bias 为云台实际角速度与目标角速度之差，由测量修正。
+    预测(VgPredictStep)：
+      每次调用按距上次调用的时间积分上式。
+    修正(VgPredictCorrect)：
+      收到新样本时按样本的年龄(采样时刻到当前时刻)外推到当前时刻，与估计值之差为新息，
+      yaw 按 VG_PREDICT_ALPHA、bias 按 VG_PREDICT_BETA 修正(alpha-beta滤波)；
+      新息超过 VG_PREDICT_RESET 时(云台重新校准、长时间断线后)直接采用测量值。
+    断线：
+      超过 VG_PREDICT_HOLD 没有新样本时，云台角速度(目标角速度 + bias)的权重线性减小，
+      到 VG_PREDICT_TIMEOUT 时为0，底盘角速度仍按本板IMU积分(云台仍稳定在世界坐标系下)；
+      超过 VG_PREDICT_TIMEOUT 时估计失效，由调用方处理。
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#ifndef GIMBAL_VIRTUAL_PREDICT_H
+#define GIMBAL_VIRTUAL_PREDICT_H
+#include "struct_typedef.h"
+
+typedef struct
+{
+    bool_t valid;          // 已收到样本且未超时
+    fp32 yaw;              // (rad)估计的yaw电机位置，[-PI, PI]
+    fp32 rate;             // (rad/s)最近一次预测使用的相对角速度
+    fp32 bias;             // (rad/s)云台实际角速度与目标角速度之差
+
+    uint32_t last_us;      // (us)上次预测的时刻
+    uint32_t sample_us;    // (us)最近一个样本的采样时刻
+    uint32_t hold_us;      // (us)距最近一个样本的时间
+
+    fp32 innovation;       // (rad)最近一次修正的新息
+    uint32_t count;        // 使用的样本数
+    uint32_t reset;        // 新息过大直接采用测量值的次数
+    uint32_t dropout;      // 超过 VG_PREDICT_HOLD 没有新样本的次数
+} VgPredict_s;
+
+extern void VgPredictInit(VgPredict_s * vp);
+extern fp32 VgPredictStep(VgPredict_s * vp, uint32_t now_us, fp32 gimbal_rate, fp32 chassis_rate);
+extern void VgPredictCorrect(VgPredict_s * vp, fp32 yaw, uint32_t sample_us, uint32_t age_us);
+
+#endif  // GIMBAL_VIRTUAL_PREDICT_H
+/*------------------------------ End of File ------------------------------*/
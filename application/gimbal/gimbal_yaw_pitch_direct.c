@@ -6,6 +6,7 @@
   * @history
   *  Version    Date            Modification
   *   V1.0.0    2025-12-3       1. 完成云台所有基本控制
+  *   V1.0.1    2026-10-19      1. 目标轨迹按控制任务的实际周期更新
   @verbatim
   ==============================================================================
   ==============================================================================
@@ -15,6 +16,7 @@
 
 #include "gimbal_yaw_pitch_direct.h"
 
+#include "control_timer.h"
 #include "remote_control.h"
 #include "signal_generator.h"
 #include "string.h"
@@ -30,6 +32,26 @@
 
 #define PITCH_MAX (M_PI_2 * 0.9f)
 
+// 目标轨迹限幅
+#ifndef GIMBAL_TRAJ_PIT_MAX_VEL
+#define GIMBAL_TRAJ_PIT_MAX_VEL 8.0f  // (rad/s)
+#endif
+#ifndef GIMBAL_TRAJ_PIT_MAX_ACC
+#define GIMBAL_TRAJ_PIT_MAX_ACC 60.0f  // (rad/s^2)
+#endif
+#ifndef GIMBAL_TRAJ_PIT_MAX_JERK
+#define GIMBAL_TRAJ_PIT_MAX_JERK 1500.0f  // (rad/s^3)
+#endif
+#ifndef GIMBAL_TRAJ_YAW_MAX_VEL
+#define GIMBAL_TRAJ_YAW_MAX_VEL 10.0f  // (rad/s)
+#endif
+#ifndef GIMBAL_TRAJ_YAW_MAX_ACC
+#define GIMBAL_TRAJ_YAW_MAX_ACC 40.0f  // (rad/s^2)
+#endif
+#ifndef GIMBAL_TRAJ_YAW_MAX_JERK
+#define GIMBAL_TRAJ_YAW_MAX_JERK 800.0f  // (rad/s^3)
+#endif
+
 Gimbal_s GIMBAL;
 
 Motor_s * motor_array[2];
@@ -97,6 +119,14 @@ void GimbalInit(void)
     PID_init(
         &GIMBAL.pid.yaw.vel, PID_POSITION, yaw_vel_pid, GIMBAL_PID_YAW_VEL_MAX_OUT,
         GIMBAL_PID_YAW_VEL_MAX_IOUT);
+
+    // 轨迹生成初始化
+    TrajLimit_s pit_limit = {
+        GIMBAL_TRAJ_PIT_MAX_VEL, GIMBAL_TRAJ_PIT_MAX_ACC, GIMBAL_TRAJ_PIT_MAX_JERK};
+    TrajAxisInit(&GIMBAL.traj.pit, &pit_limit, 0.0f);
+    TrajLimit_s yaw_limit = {
+        GIMBAL_TRAJ_YAW_MAX_VEL, GIMBAL_TRAJ_YAW_MAX_ACC, GIMBAL_TRAJ_YAW_MAX_JERK};
+    TrajAxisInit(&GIMBAL.traj.yaw, &yaw_limit, 0.0f);
 }
 /*-------------------- Set mode --------------------*/
 
@@ -173,19 +203,38 @@ void GimbalReference(void)
     pit_pos = GenerateSinWave(0.3, 0, 1);
     yaw_pos = GenerateSinWave(0.5, M_PI, 5);
 #else
-    if (GetRcType() == RC_TYPE_ET08A) {
-        pit_pos = (GetSbusCh(1) - ET08A_RC_CH_VALUE_OFFSET) /
-                  (ET08A_RC_CH_VALUE_MAX - ET08A_RC_CH_VALUE_MIN) * 2;
-        yaw_pos = (GetSbusCh(0) - ET08A_RC_CH_VALUE_OFFSET) /
-                  (ET08A_RC_CH_VALUE_MAX - ET08A_RC_CH_VALUE_MIN) * 2;
-    } else if (GetRcType() == RC_TYPE_ESP32_TRACKER) {
-        pit_pos = uint_to_float(GetSbusCh(1), -M_PI_2, M_PI_2, 11);
-        yaw_pos = uint_to_float(GetSbusCh(2), -M_PI, M_PI, 11);
+    const RcInput_s * rc = GetRcInput();
+    if (rc->type == RC_TYPE_ET08A) {
+        pit_pos = rc->ch[1];
+        yaw_pos = rc->ch[0];
+    } else if (rc->type == RC_TYPE_ESP32_TRACKER) {
+        pit_pos = rc->ch[1] * M_PI_2;
+        yaw_pos = rc->ch[2] * M_PI;
     }
 #endif
-    GIMBAL.ref.pit.pos =
-        MID(theta_format(pit_pos), GIMBAL.limit.lower.imu.pit, GIMBAL.limit.upper.imu.pit);
-    GIMBAL.ref.yaw.pos = theta_format(yaw_pos);
+    pit_pos = MID(theta_format(pit_pos), GIMBAL.limit.lower.imu.pit, GIMBAL.limit.upper.imu.pit);
+    yaw_pos = theta_format(yaw_pos);
+
+    // 未控制时轨迹跟随反馈，进入控制后从当前姿态平滑过渡到遥控器目标
+    if (GIMBAL.mode != GIMBAL_IMU && GIMBAL.mode != GIMBAL_ECD) {
+        TrajAxisReset(&GIMBAL.traj.pit, GIMBAL.fdb.pit.pos, 0.0f);
+        TrajAxisReset(&GIMBAL.traj.yaw, GIMBAL.fdb.yaw.pos, 0.0f);
+    }
+
+    fp32 dt = GetControlDt(CONTROL_TIMER_GIMBAL);
+    TrajAxisSetTarget(&GIMBAL.traj.pit, pit_pos);
+    GIMBAL.ref.pit.pos = TrajAxisUpdate(&GIMBAL.traj.pit, dt);
+
+    // yaw目标取离当前轨迹位置最近的等效角，轨迹越过 ±pi 后整体平移回来
+    TrajAxisSetTarget(
+        &GIMBAL.traj.yaw, GIMBAL.traj.yaw.pos + theta_format(yaw_pos - GIMBAL.traj.yaw.pos));
+    TrajAxisUpdate(&GIMBAL.traj.yaw, dt);
+    if (GIMBAL.traj.yaw.pos > M_PI) {
+        TrajAxisShift(&GIMBAL.traj.yaw, -2.0f * M_PI);
+    } else if (GIMBAL.traj.yaw.pos < -M_PI) {
+        TrajAxisShift(&GIMBAL.traj.yaw, 2.0f * M_PI);
+    }
+    GIMBAL.ref.yaw.pos = GIMBAL.traj.yaw.pos;
 }
 
 /*-------------------- Console --------------------*/
@@ -35,6 +35,7 @@
 #include "robot_param.h"
 #include "struct_typedef.h"
 #include "supervisory_computer_cmd.h"
+#include "trajectory.h"
 #include "usb_debug.h"
 #include "user_lib.h"
 
@@ -108,6 +109,11 @@ typedef struct
             pid_type_def pos, vel;
         } rol, pit, yaw;
     } pid;
+
+    struct
+    {
+        TrajAxis_s pit, yaw;  // 遥控器目标经过轨迹生成后作为 ref.pos，yaw保持在 [-pi, pi]
+    } traj;
 } Gimbal_s;
 
 extern void GimbalInit(void);
@@ -0,0 +1,173 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       vg_predict_test.c
+  * @brief      在PC上运行的虚拟云台预测器测试程序，与直接保持最近一个样本的做法比较跟随误差
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+    编译运行：
+      cc -O2 -I.. -I../../typedef -o vg_predict_test vg_predict_test.c \
+         ../gimbal_virtual_predict.c -lm
+      ./vg_predict_test
+    模拟：
+      底盘yaw角速度为两个正弦之和，中间有一段小陀螺；云台按目标角速度转动，实际角速度
+      与目标有固定偏差；云台每 SAMPLE_PERIOD 发送一次yaw电机位置，带传输延迟、抖动和随机丢帧，
+      DROP_START 开始有一段 DROP_TIME 的断线；底盘IMU角速度带噪声和零偏。
+      底盘每 CTRL_PERIOD 读取一次，分别计算预测器和保持最近样本的误差，
+      均方根误差不含断线期间，断线期间单独统计最大误差。
+    检查项(任一不满足返回非0)：
+      1. 有云台目标角速度和没有(目标角速度为0，只靠测量修正)两种情况下，
+         预测器的均方根误差都小于保持样本的 MAX_RATIO 倍
+      2. 断线期间预测器的最大误差小于保持样本的最大误差
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include <math.h>
+#include <stdio.h>
+
+#include "gimbal_virtual_predict.h"
+
+#define SIM_TIME 20.0         // (s)
+#define CTRL_PERIOD 1000      // (us)底盘控制周期
+#define SIM_STEP 100          // (us)仿真步长
+#define SAMPLE_PERIOD 1000    // (us)云台发送周期
+#define LATENCY 1500          // (us)传输延迟
+#define JITTER 1000           // (us)传输延迟抖动
+#define LOSS_RATE 0.05
+#define DROP_START 13.5       // (s)
+#define DROP_TIME 0.2         // (s)
+#define IMU_NOISE 0.02        // (rad/s)
+#define IMU_BIAS 0.01         // (rad/s)
+#define GIMBAL_OFFSET 0.2     // (rad/s)云台实际角速度与目标的偏差
+#define MAX_RATIO 0.5
+
+#define QUEUE_SIZE 64
+
+static uint32_t SEED = 1;
+
+static double Rand(double min, double max)
+{
+    SEED = SEED * 1664525u + 1013904223u;
+    return min + (max - min) * (SEED >> 8) / (double)(1u << 24);
+}
+
+static double Wrap(double x)
+{
+    while (x > M_PI) x -= 2.0 * M_PI;
+    while (x < -M_PI) x += 2.0 * M_PI;
+    return x;
+}
+
+static double ChassisRate(double t)
+{
+    if (t > 6.0 && t < 9.0) return 6.0;  // 小陀螺
+    return 3.0 * sin(2.0 * M_PI * 0.5 * t) + 1.5 * sin(2.0 * M_PI * 1.3 * t + 1.0);
+}
+
+static double GimbalRateCmd(double t)
+{
+    return 1.5 * sin(2.0 * M_PI * 0.3 * t) + (fmod(t, 4.0) < 1.0 ? 2.0 : 0.0);
+}
+
+typedef struct
+{
+    uint32_t arrive;
+    uint32_t sample;
+    double yaw;
+    double rate_cmd;
+} Packet_s;
+
+/**
+ * @param[in]      use_cmd 是否把云台目标角速度交给预测器
+ * @param[out]     rms 预测器和保持样本的均方根误差
+ * @param[out]     drop_max 断线期间预测器和保持样本的最大误差
+ */
+static void Simulate(int use_cmd, double rms[2], double drop_max[2])
+{
+    VgPredict_s vp;
+    Packet_s queue[QUEUE_SIZE];
+    int head = 0, tail = 0;
+    double delta = 0.5;  // 真实yaw电机位置
+    double hold = 0.0;
+    double rate_cmd = 0.0;
+    int hold_valid = 0;
+    double sum[2] = {0, 0};
+    uint32_t n = 0;
+    uint32_t next_sample = 0;
+    uint32_t arrive_last = 0;
+
+    VgPredictInit(&vp);
+    drop_max[0] = drop_max[1] = 0;
+
+    for (uint32_t us = 0; us < (uint32_t)(SIM_TIME * 1e6); us += SIM_STEP) {
+        double t = us * 1e-6;
+        double gimbal_rate = GimbalRateCmd(t) + GIMBAL_OFFSET;
+        delta = Wrap(delta + (gimbal_rate - ChassisRate(t)) * SIM_STEP * 1e-6);
+
+        // 云台发送
+        if (us >= next_sample) {
+            next_sample += SAMPLE_PERIOD;
+            int drop = (t > DROP_START && t < DROP_START + DROP_TIME) || Rand(0, 1) < LOSS_RATE;
+            if (!drop) {
+                uint32_t arrive = us + LATENCY + (uint32_t)Rand(0, JITTER);
+                if (arrive < arrive_last) arrive = arrive_last;  // 串口不乱序
+                arrive_last = arrive;
+                queue[head] = (Packet_s){arrive, us, delta, GimbalRateCmd(t)};
+                head = (head + 1) % QUEUE_SIZE;
+            }
+        }
+
+        if (us % CTRL_PERIOD) continue;
+
+        // 底盘控制周期
+        double imu = ChassisRate(t) + IMU_BIAS + Rand(-IMU_NOISE, IMU_NOISE);
+        VgPredictStep(&vp, us, use_cmd ? rate_cmd : 0.0f, imu);
+        while (tail != head && queue[tail].arrive <= us) {
+            Packet_s * p = &queue[tail];
+            tail = (tail + 1) % QUEUE_SIZE;
+            hold = p->yaw;
+            rate_cmd = p->rate_cmd;
+            hold_valid = 1;
+            VgPredictCorrect(&vp, p->yaw, p->sample, us - p->sample);
+        }
+        if (!hold_valid || t < 0.5) continue;
+
+        double e_pred = fabs(Wrap(vp.yaw - delta));
+        double e_hold = fabs(Wrap(hold - delta));
+        if (t > DROP_START && t < DROP_START + DROP_TIME + 0.01) {
+            if (e_pred > drop_max[0]) drop_max[0] = e_pred;
+            if (e_hold > drop_max[1]) drop_max[1] = e_hold;
+            continue;
+        }
+        sum[0] += e_pred * e_pred;
+        sum[1] += e_hold * e_hold;
+        n++;
+    }
+    printf("resets %u, dropouts %u\n", vp.reset, vp.dropout);
+    rms[0] = sqrt(sum[0] / n);
+    rms[1] = sqrt(sum[1] / n);
+}
+
+int main(void)
+{
+    int fail = 0;
+
+    for (int use_cmd = 1; use_cmd >= 0; use_cmd--) {
+        double rms[2], drop_max[2];
+        Simulate(use_cmd, rms, drop_max);
+        printf(
+            "%s: rms %.4f rad (hold %.4f, ratio %.2f), dropout max %.3f rad (hold %.3f)\n",
+            use_cmd ? "with gimbal rate cmd" : "without gimbal rate cmd", rms[0], rms[1],
+            rms[0] / rms[1], drop_max[0], drop_max[1]);
+        if (rms[0] > MAX_RATIO * rms[1]) fail = 1;
+        if (drop_max[0] >= drop_max[1]) fail = 1;
+    }
+
+    printf(fail ? "FAIL\n" : "PASS\n");
+    return fail;
+}
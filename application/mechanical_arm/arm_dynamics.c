@@ -0,0 +1,112 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       arm_dynamics.c/h
+  * @brief      机械臂闭式逆动力学，计算重力矩、速度相关力矩和惯性力矩作为关节力矩前馈
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include "arm_dynamics.h"
+
+#include "stddef.h"
+
+/**
+ * @brief          初始化，计算与关节角无关的系数
+ * @param[out]     dyn 动力学模型
+ * @param[in]      param 连杆参数
+ * @retval         none
+ */
+void ArmDynamicsInit(ArmDynamics_s * dyn, const ArmDynamicsParam_s * param)
+{
+    const ArmLink_s * a = &param->link1;
+    const ArmLink_s * b = &param->link2;
+    fp32 l1 = param->l1, l2 = param->l2;
+    fp32 m3 = param->wrist_mass + param->tool_mass;
+
+    ArmKineSinTableInit();
+    dyn->param = *param;
+    dyn->m3 = m3;
+
+    fp32 first1 = a->mass * a->com + (b->mass + m3) * l1;  // J1之后对J1的一阶矩(沿大臂)
+    fp32 first2 = b->mass * b->com + m3 * l2;              // J2之后对J2的一阶矩(沿小臂)
+    dyn->g1 = GRAVITY * first1;
+    dyn->g2 = GRAVITY * first2;
+    dyn->gt = GRAVITY * param->tool_mass * param->tool_com;
+    dyn->k = l1 * first2;
+
+    dyn->m22 = b->inertia + b->mass * b->com * b->com + m3 * l2 * l2;
+    dyn->m11_0 = a->inertia + a->mass * a->com * a->com + (b->mass + m3) * l1 * l1 + dyn->m22;
+
+    for (uint8_t i = 0; i < ARM_DYN_JOINT_NUM; i++) {
+        dyn->gravity[i] = 0.0f;
+        dyn->torque[i] = 0.0f;
+    }
+}
+
+/**
+ * @brief          逆动力学
+ * @param[in,out]  dyn 动力学模型，结果写入 dyn->gravity 和 dyn->torque
+ * @param[in]      trig 当前关节角的sin/cos缓存
+ * @param[in]      dq (rad/s)关节速度
+ * @param[in]      ddq (rad/s^2)关节加速度，为NULL时不计惯性力矩
+ * @retval         none
+ */
+void ArmDynamicsUpdate(
+    ArmDynamics_s * dyn, const ArmKineTrig_s * trig, const fp32 dq[ARM_DYN_JOINT_NUM],
+    const fp32 ddq[ARM_DYN_JOINT_NUM])
+{
+    const ArmDynamicsParam_s * p = &dyn->param;
+    fp32 s1 = trig->s[1], c1 = trig->c[1];
+    fp32 s2 = trig->s[2], c2 = trig->c[2];
+    fp32 s3 = trig->s[3], c3 = trig->c[3];
+    fp32 s4 = trig->s[4], c4 = trig->c[4];
+    fp32 s12 = trig->s12, c12 = trig->c12;
+
+    // 重力矩，末端偏心部分的势能为 gt * (末端轴线的z分量 = c12*c4 - s12*c3*s4)
+    fp32 tool12 = -dyn->gt * (s12 * c4 + c12 * c3 * s4);
+    fp32 * G = dyn->gravity;
+    G[0] = 0.0f;
+    G[1] = -(dyn->g1 * s1 + dyn->g2 * s12) + tool12;
+    G[2] = -dyn->g2 * s12 + tool12;
+    G[3] = dyn->gt * s12 * s3 * s4;
+    G[4] = -dyn->gt * (c12 * s4 + s12 * c3 * c4);
+
+    // 绕J0的转动惯量及其对q1 q2的偏导，各质点到J0轴线的水平距离为r
+    fp32 m1 = p->link1.mass, m2 = p->link2.mass;
+    fp32 r1 = p->link1.com * s1;
+    fp32 r2 = p->l1 * s1 + p->link2.com * s12;
+    fp32 r3 = p->l1 * s1 + p->l2 * s12;
+    fp32 u = m2 * r2 + dyn->m3 * r3;
+    fp32 w = m2 * r2 * p->link2.com + dyn->m3 * r3 * p->l2;
+    fp32 iz = p->base_inertia + m1 * r1 * r1 + m2 * r2 * r2 + dyn->m3 * r3 * r3;
+    fp32 diz1 = 2.0f * (c1 * (m1 * r1 * p->link1.com + p->l1 * u) + c12 * w);
+    fp32 diz2 = 2.0f * c12 * w;
+
+    // 速度相关力矩
+    fp32 h = dyn->k * s2;
+    fp32 dq0_2 = dq[0] * dq[0];
+    fp32 * T = dyn->torque;
+    T[0] = (diz1 * dq[1] + diz2 * dq[2]) * dq[0];
+    T[1] = -h * (2.0f * dq[1] + dq[2]) * dq[2] - 0.5f * diz1 * dq0_2 + G[1];
+    T[2] = h * dq[1] * dq[1] - 0.5f * diz2 * dq0_2 + G[2];
+    T[3] = G[3];
+    T[4] = G[4];
+
+    // 惯性力矩
+    if (ddq != NULL) {
+        fp32 m12 = dyn->m22 + dyn->k * c2;
+        fp32 m11 = dyn->m11_0 + 2.0f * dyn->k * c2;
+        T[0] += iz * ddq[0];
+        T[1] += m11 * ddq[1] + m12 * ddq[2];
+        T[2] += m12 * ddq[1] + dyn->m22 * ddq[2];
+    }
+}
+/*------------------------------ End of File ------------------------------*/
@@ -0,0 +1,81 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       arm_dynamics.c/h
+  * @brief      机械臂闭式逆动力学，计算重力矩、速度相关力矩和惯性力矩作为关节力矩前馈
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+    模型：
+      坐标与关节定义同 arm_kinematics.h，J0(yaw)之上是在竖直平面内运动的两连杆：
+        大臂：J1到J2，质量m1，质心距J1为d1，绕质心转动惯量I1
+        小臂：J2到腕点，质量m2，质心距J2为d2，绕质心转动惯量I2
+        腕部：J3~J5电机、差速器和末端执行器视为腕点上的质点m3 = wrist_mass + tool_mass
+        末端：tool_mass 的质心沿末端轴线偏离腕点 tool_com，只计入重力矩(J1 J2 J3 J4)
+      J0以上绕竖直轴的转动惯量 = base_inertia + 各质点 m*r^2，r为到J0轴线的水平距离。
+    方程(拉格朗日法得到的闭式解，q2为小臂相对大臂的角度)：
+      tau = M(q) * ddq + C(q, dq) + G(q)
+        M11 = M11_0 + 2*k*cos(q2)，M12 = M22 + k*cos(q2)，k = l1*(m2*d2 + m3*l2)
+        C1 = -k*sin(q2)*(2*dq1*dq2 + dq2^2) - 0.5*dIz/dq1*dq0^2
+        C2 =  k*sin(q2)*dq1^2             - 0.5*dIz/dq2*dq0^2
+        tau0 = Iz*ddq0 + (dIz/dq1*dq1 + dIz/dq2*dq2)*dq0
+        G1 = -g*((m1*d1 + (m2+m3)*l1)*sin(q1) + (m2*d2 + m3*l2)*sin(q1+q2))，G2同理
+      与杆长、质量有关的系数在初始化时算好，sin/cos直接使用 ArmKineTrig_s 缓存，
+      每次计算只有几十次乘加，没有三角函数和除法。
+    使用：
+      ArmDynamicsUpdate 的 dq 使用关节速度反馈，ddq 可使用轨迹生成的期望加速度，不需要时传NULL；
+      结果 torque 为关节侧力矩，换算到电机侧后作为MIT模式的力矩前馈。
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+#ifndef ARM_DYNAMICS_H
+#define ARM_DYNAMICS_H
+#include "arm_kinematics.h"
+#include "struct_typedef.h"
+
+#define ARM_DYN_JOINT_NUM 5  // J0 J1 J2 J3 虚拟J4，虚拟J5(绕末端轴线)不受重力矩
+
+typedef struct
+{
+    fp32 mass;     // (kg)
+    fp32 com;      // (m)质心到近端关节轴线的距离
+    fp32 inertia;  // (kg*m^2)绕质心、垂直于臂平面的转动惯量
+} ArmLink_s;
+
+typedef struct
+{
+    fp32 l1;                 // (m)J1到J2
+    fp32 l2;                 // (m)J2到腕点
+    ArmLink_s link1, link2;  // 大臂、小臂
+    fp32 wrist_mass;         // (kg)集中在腕点的质量，不含末端执行器
+    fp32 tool_mass;          // (kg)末端执行器(含负载)
+    fp32 tool_com;           // (m)末端执行器质心沿末端轴线到腕点的距离
+    fp32 base_inertia;       // (kg*m^2)J0转动部分自身绕竖直轴的转动惯量
+} ArmDynamicsParam_s;
+
+typedef struct
+{
+    ArmDynamicsParam_s param;
+
+    // 预计算常量
+    fp32 g1, g2;  // (N*m)重力矩系数
+    fp32 gt;      // (N*m)末端偏心重力矩系数
+    fp32 k;       // (kg*m^2)惯性耦合系数
+    fp32 m11_0;   // (kg*m^2)M11的常数部分
+    fp32 m22;     // (kg*m^2)
+    fp32 m3;      // (kg)腕点质量
+
+    fp32 gravity[ARM_DYN_JOINT_NUM];  // (N*m)重力矩
+    fp32 torque[ARM_DYN_JOINT_NUM];   // (N*m)总力矩 = 惯性力矩 + 速度相关力矩 + 重力矩
+} ArmDynamics_s;
+
+extern void ArmDynamicsInit(ArmDynamics_s * dyn, const ArmDynamicsParam_s * param);
+extern void ArmDynamicsUpdate(
+    ArmDynamics_s * dyn, const ArmKineTrig_s * trig, const fp32 dq[ARM_DYN_JOINT_NUM],
+    const fp32 ddq[ARM_DYN_JOINT_NUM]);
+
+#endif  // ARM_DYNAMICS_H
+/*------------------------------ End of File ------------------------------*/
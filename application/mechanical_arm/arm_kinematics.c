@@ -0,0 +1,357 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       arm_kinematics.c/h
+  * @brief      工程机械臂J0-J5解析正逆运动学
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *  V1.0.1     Oct-19-2026     Penguin         1. sin表与三角函数缓存可单独计算，供动力学模块使用
+  *
+  @verbatim
+  ==============================================================================
+
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include "arm_kinematics.h"
+
+#include "math.h"
+
+#define ARM_KINE_PI 3.14159265358979f
+#define ARM_KINE_SIN_TABLE_SCALE (ARM_KINE_SIN_TABLE_SIZE / (2.0f * ARM_KINE_PI))
+#define ARM_KINE_WRIST_SINGULAR 0.01f  // sin(q4)小于该值时视为J3 J5共轴
+#define ARM_KINE_AXIS_SINGULAR 1e-4f   // (m)腕点到J0轴线的距离小于该值时J0保持当前值
+#define ARM_KINE_CANDIDATE_NUM 8
+
+static fp32 SIN_TABLE[ARM_KINE_SIN_TABLE_SIZE + 1];
+static bool_t SIN_TABLE_READY = 0;
+
+static fp32 WrapAngle(fp32 angle)
+{
+    while (angle > ARM_KINE_PI) angle -= 2.0f * ARM_KINE_PI;
+    while (angle < -ARM_KINE_PI) angle += 2.0f * ARM_KINE_PI;
+    return angle;
+}
+
+/**
+ * @brief          取与ref相差不超过pi的等价角
+ */
+static fp32 NearestAngle(fp32 angle, fp32 ref) { return ref + WrapAngle(angle - ref); }
+
+/**
+ * @brief          生成sin表，只在第一次调用时计算，ArmKineSinCos 之前必须调用一次
+ */
+void ArmKineSinTableInit(void)
+{
+    if (SIN_TABLE_READY) return;
+    for (uint16_t i = 0; i <= ARM_KINE_SIN_TABLE_SIZE; i++) {
+        SIN_TABLE[i] = sinf(i / ARM_KINE_SIN_TABLE_SCALE);
+    }
+    SIN_TABLE_READY = 1;
+}
+
+/**
+ * @brief          查表计算sin和cos
+ * @param[in]      angle (rad)任意角度
+ * @param[out]     sin_out
+ * @param[out]     cos_out
+ * @retval         none
+ */
+void ArmKineSinCos(fp32 angle, fp32 * sin_out, fp32 * cos_out)
+{
+    fp32 pos = angle * ARM_KINE_SIN_TABLE_SCALE;
+    fp32 index = floorf(pos);
+    fp32 frac = pos - index;
+
+    uint32_t i_sin = (uint32_t)(int32_t)index & (ARM_KINE_SIN_TABLE_SIZE - 1);
+    uint32_t i_cos = (i_sin + ARM_KINE_SIN_TABLE_SIZE / 4) & (ARM_KINE_SIN_TABLE_SIZE - 1);
+
+    *sin_out = SIN_TABLE[i_sin] + (SIN_TABLE[i_sin + 1] - SIN_TABLE[i_sin]) * frac;
+    *cos_out = SIN_TABLE[i_cos] + (SIN_TABLE[i_cos + 1] - SIN_TABLE[i_cos]) * frac;
+}
+
+/**
+ * @brief          M = Rz(a) * Ry(b) * Rz(g)
+ */
+static void ZyzMatrix(fp32 sa, fp32 ca, fp32 sb, fp32 cb, fp32 sg, fp32 cg, fp32 M[3][3])
+{
+    M[0][0] = ca * cb * cg - sa * sg;
+    M[0][1] = -ca * cb * sg - sa * cg;
+    M[0][2] = ca * sb;
+    M[1][0] = sa * cb * cg + ca * sg;
+    M[1][1] = -sa * cb * sg + ca * cg;
+    M[1][2] = sa * sb;
+    M[2][0] = -sb * cg;
+    M[2][1] = sb * sg;
+    M[2][2] = cb;
+}
+
+/**
+ * @brief          将 M 分解为 Rz(a) * Ry(b) * Rz(g)，给出 b>=0 与 b<0 两组解
+ * @param[in]      M 旋转矩阵
+ * @param[in]      hint_a 共轴(sin(b)接近0)时a保持该值
+ * @param[out]     a b g 两组解，共轴时两组相同
+ * @retval         none
+ */
+static void ZyzSolve(const fp32 M[3][3], fp32 hint_a, fp32 a[2], fp32 b[2], fp32 g[2])
+{
+    fp32 sb = sqrtf(M[0][2] * M[0][2] + M[1][2] * M[1][2]);
+
+    if (sb > ARM_KINE_WRIST_SINGULAR) {
+        a[0] = atan2f(M[1][2], M[0][2]);
+        b[0] = atan2f(sb, M[2][2]);
+        g[0] = atan2f(M[2][1], -M[2][0]);
+        a[1] = a[0] + ARM_KINE_PI;
+        b[1] = -b[0];
+        g[1] = g[0] + ARM_KINE_PI;
+        return;
+    }
+
+    // 共轴：固定a，由 Rz(-a)*M = Ry(b)*Rz(g) 求b和g，忽略数值上很小的剩余分量
+    fp32 s, c;
+    ArmKineSinCos(hint_a, &s, &c);
+    fp32 n02 = c * M[0][2] + s * M[1][2];
+    fp32 n10 = -s * M[0][0] + c * M[1][0];
+    fp32 n11 = -s * M[0][1] + c * M[1][1];
+
+    a[0] = a[1] = hint_a;
+    b[0] = b[1] = atan2f(n02, M[2][2]);
+    g[0] = g[1] = atan2f(n10, n11);
+}
+
+/**
+ * @brief          初始化运动学参数，生成sin表，关节默认不限位，手腕零点为0
+ * @param[out]     kine 运动学参数
+ * @param[in]      shoulder_height (m)J1轴线到原点的高度
+ * @param[in]      l1 (m)J1到J2
+ * @param[in]      l2 (m)J2到腕点
+ * @param[in]      l3 (m)腕点到末端
+ * @retval         none
+ */
+void ArmKinematicsInit(ArmKinematics_s * kine, fp32 shoulder_height, fp32 l1, fp32 l2, fp32 l3)
+{
+    ArmKineSinTableInit();
+
+    kine->shoulder_height = shoulder_height;
+    kine->l1 = l1;
+    kine->l2 = l2;
+    kine->l3 = l3;
+    kine->l1l1_l2l2 = l1 * l1 + l2 * l2;
+    kine->inv_2l1l2 = 1.0f / (2.0f * l1 * l2);
+
+    for (uint8_t i = 0; i < ARM_KINE_JOINT_NUM; i++) {
+        kine->min[i] = -ARM_KINE_NO_LIMIT;
+        kine->max[i] = ARM_KINE_NO_LIMIT;
+    }
+    kine->vj4_zero = 0.0f;
+    kine->vj5_zero = 0.0f;
+}
+
+/**
+ * @brief          设置关节限位，q4 q5为相对手腕零点的虚拟关节角
+ */
+void ArmKinematicsSetLimit(ArmKinematics_s * kine, uint8_t joint, fp32 min, fp32 max)
+{
+    if (joint >= ARM_KINE_JOINT_NUM) return;
+    kine->min[joint] = min;
+    kine->max[joint] = max;
+}
+
+/**
+ * @brief          设置手腕零点，即末端与小臂共线时的虚拟J4 J5位置
+ */
+void ArmKinematicsSetWristZero(ArmKinematics_s * kine, fp32 vj4_zero, fp32 vj5_zero)
+{
+    kine->vj4_zero = vj4_zero;
+    kine->vj5_zero = vj5_zero;
+}
+
+/**
+ * @brief          差速器电机角度 -> 运动学关节角q4 q5
+ */
+void ArmDifferentialToVirtual(
+    const ArmKinematics_s * kine, fp32 j4, fp32 j5, fp32 * q4, fp32 * q5)
+{
+    *q4 = (j4 - j5) * 0.5f - kine->vj4_zero;
+    *q5 = (j4 + j5) * 0.5f - kine->vj5_zero;
+}
+
+/**
+ * @brief          运动学关节角q4 q5 -> 差速器电机角度
+ */
+void ArmVirtualToDifferential(
+    const ArmKinematics_s * kine, fp32 q4, fp32 q5, fp32 * j4, fp32 * j5)
+{
+    fp32 vj4 = q4 + kine->vj4_zero;
+    fp32 vj5 = q5 + kine->vj5_zero;
+    *j4 = vj4 + vj5;
+    *j5 = vj5 - vj4;
+}
+
+/**
+ * @brief          计算关节角的sin/cos缓存，不需要正运动学的场合(如只做重力补偿)单独调用
+ */
+void ArmKineTrigUpdate(const fp32 q[ARM_KINE_JOINT_NUM], ArmKineTrig_s * trig)
+{
+    for (uint8_t i = 0; i < ARM_KINE_JOINT_NUM; i++) {
+        ArmKineSinCos(q[i], &trig->s[i], &trig->c[i]);
+    }
+    ArmKineSinCos(q[1] + q[2], &trig->s12, &trig->c12);
+}
+
+/**
+ * @brief          正运动学，同时更新 kine->trig
+ * @param[in,out]  kine 运动学参数
+ * @param[in]      q 关节角
+ * @param[out]     pose 末端位姿，yaw取离q0最近的一组
+ * @retval         none
+ */
+void ArmForward(ArmKinematics_s * kine, const fp32 q[ARM_KINE_JOINT_NUM], ArmPose_s * pose)
+{
+    ArmKineTrig_s * t = &kine->trig;
+    ArmKineTrigUpdate(q, t);
+
+    // R = Rz(q0)Ry(-q12) * Rz(q3)Ry(-q4)Rz(q5)
+    fp32 A[3][3], B[3][3], R[3][3];
+    ZyzMatrix(t->s[0], t->c[0], -t->s12, t->c12, 0.0f, 1.0f, A);
+    ZyzMatrix(t->s[3], t->c[3], -t->s[4], t->c[4], t->s[5], t->c[5], B);
+    for (uint8_t i = 0; i < 3; i++) {
+        for (uint8_t j = 0; j < 3; j++) {
+            R[i][j] = A[i][0] * B[0][j] + A[i][1] * B[1][j] + A[i][2] * B[2][j];
+        }
+    }
+
+    fp32 xp = -(kine->l1 * t->s[1] + kine->l2 * t->s12);
+    fp32 zp = kine->shoulder_height + kine->l1 * t->c[1] + kine->l2 * t->c12;
+    pose->x = t->c[0] * xp + kine->l3 * R[0][2];
+    pose->y = t->s[0] * xp + kine->l3 * R[1][2];
+    pose->z = zp + kine->l3 * R[2][2];
+
+    fp32 a[2], b[2], g[2];
+    ZyzSolve(R, q[0], a, b, g);
+    uint8_t k = fabsf(WrapAngle(a[1] - q[0])) < fabsf(WrapAngle(a[0] - q[0])) ? 1 : 0;
+    pose->yaw = WrapAngle(a[k]);
+    pose->pitch = -b[k];
+    pose->roll = WrapAngle(g[k]);
+}
+
+/**
+ * @brief          逆运动学
+ * @param[in]      kine 运动学参数
+ * @param[in]      pose 末端目标位姿
+ * @param[in]      q_now 当前关节角，用于选择分支和多圈关节的等价角
+ * @param[out]     q_out 关节角，可与q_now为同一数组
+ * @retval         求解结果
+ */
+ArmKineResult_e ArmInverse(
+    const ArmKinematics_s * kine, const ArmPose_s * pose, const fp32 q_now[ARM_KINE_JOINT_NUM],
+    fp32 q_out[ARM_KINE_JOINT_NUM])
+{
+    ArmKineResult_e result = ARM_KINE_OK;
+    fp32 cand[ARM_KINE_CANDIDATE_NUM][ARM_KINE_JOINT_NUM];
+
+    // 目标姿态与腕点
+    fp32 sy, cy, sp, cp, sr, cr;
+    ArmKineSinCos(pose->yaw, &sy, &cy);
+    ArmKineSinCos(pose->pitch, &sp, &cp);
+    ArmKineSinCos(pose->roll, &sr, &cr);
+    fp32 R[3][3];
+    ZyzMatrix(sy, cy, -sp, cp, sr, cr, R);
+
+    fp32 wx = pose->x - kine->l3 * R[0][2];
+    fp32 wy = pose->y - kine->l3 * R[1][2];
+    fp32 v = pose->z - kine->l3 * R[2][2] - kine->shoulder_height;
+    fp32 r = sqrtf(wx * wx + wy * wy);
+
+    // J1 J2 余弦定理，前后两支共用
+    fp32 c2 = (r * r + v * v - kine->l1l1_l2l2) * kine->inv_2l1l2;
+    if (c2 > 1.0f) {
+        c2 = 1.0f;
+        result = ARM_KINE_UNREACHABLE;
+    } else if (c2 < -1.0f) {
+        c2 = -1.0f;
+        result = ARM_KINE_UNREACHABLE;
+    }
+    fp32 s2 = sqrtf(1.0f - c2 * c2);
+    fp32 q2 = atan2f(s2, c2);
+    fp32 beta = atan2f(kine->l2 * s2, kine->l1 + kine->l2 * c2);
+
+    fp32 q0 = r > ARM_KINE_AXIS_SINGULAR ? atan2f(wy, wx) : q_now[0];
+    fp32 s0, c0;
+    ArmKineSinCos(q0, &s0, &c0);
+
+    uint8_t n = 0;
+    for (uint8_t shoulder = 0; shoulder < 2; shoulder++) {
+        // 前支腕点在J0前方(u=-r)，后支J0转半圈、腕点在后方(u=r)
+        fp32 u = shoulder ? r : -r;
+        fp32 q0_s = shoulder ? q0 + ARM_KINE_PI : q0;
+        fp32 s0_s = shoulder ? -s0 : s0;
+        fp32 c0_s = shoulder ? -c0 : c0;
+        fp32 gamma = atan2f(u, v);
+
+        for (uint8_t elbow = 0; elbow < 2; elbow++) {
+            fp32 q1 = elbow ? gamma + beta : gamma - beta;
+            fp32 q2_e = elbow ? -q2 : q2;
+
+            // M = (Rz(q0)Ry(-q12))^T * R = Ry(q12)Rz(-q0) * R
+            fp32 s12, c12;
+            ArmKineSinCos(q1 + q2_e, &s12, &c12);
+            fp32 T[3][3];
+            ZyzMatrix(s0_s, c0_s, -s12, c12, 0.0f, 1.0f, T);
+            fp32 M[3][3];
+            for (uint8_t i = 0; i < 3; i++) {
+                for (uint8_t j = 0; j < 3; j++) {
+                    M[i][j] = T[0][i] * R[0][j] + T[1][i] * R[1][j] + T[2][i] * R[2][j];
+                }
+            }
+
+            fp32 a[2], b[2], g[2];
+            ZyzSolve(M, q_now[3], a, b, g);
+            for (uint8_t wrist = 0; wrist < 2; wrist++) {
+                cand[n][0] = NearestAngle(q0_s, q_now[0]);
+                cand[n][1] = NearestAngle(q1, q_now[1]);
+                cand[n][2] = NearestAngle(q2_e, q_now[2]);
+                cand[n][3] = NearestAngle(a[wrist], q_now[3]);
+                cand[n][4] = NearestAngle(-b[wrist], q_now[4]);
+                cand[n][5] = NearestAngle(g[wrist], q_now[5]);
+                n++;
+            }
+        }
+    }
+
+    // 选解：先比较超限量，再比较与当前关节角的距离
+    uint8_t best = 0;
+    fp32 best_over = 0.0f, best_cost = 0.0f;
+    for (uint8_t k = 0; k < n; k++) {
+        fp32 over = 0.0f, cost = 0.0f;
+        for (uint8_t i = 0; i < ARM_KINE_JOINT_NUM; i++) {
+            if (cand[k][i] > kine->max[i]) {
+                over += cand[k][i] - kine->max[i];
+            } else if (cand[k][i] < kine->min[i]) {
+                over += kine->min[i] - cand[k][i];
+            }
+            fp32 d = cand[k][i] - q_now[i];
+            cost += d * d;
+        }
+        if (k == 0 || over < best_over || (over == best_over && cost < best_cost)) {
+            best = k;
+            best_over = over;
+            best_cost = cost;
+        }
+    }
+
+    for (uint8_t i = 0; i < ARM_KINE_JOINT_NUM; i++) {
+        fp32 q = cand[best][i];
+        if (q > kine->max[i]) q = kine->max[i];
+        if (q < kine->min[i]) q = kine->min[i];
+        q_out[i] = q;
+    }
+
+    if (result == ARM_KINE_OK && best_over > 0.0f) {
+        result = ARM_KINE_LIMITED;
+    }
+    return result;
+}
+/*------------------------------ End of File ------------------------------*/
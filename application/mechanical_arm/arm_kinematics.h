@@ -0,0 +1,111 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       arm_kinematics.c/h
+  * @brief      工程机械臂J0-J5解析正逆运动学
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *  V1.0.1     Oct-19-2026     Penguin         1. sin表与三角函数缓存可单独计算，供动力学模块使用
+  *
+  @verbatim
+  ==============================================================================
+    坐标系：
+      原点位于J0轴线上，x向前，y向左，z向上。关节方向定义与 mechanical_arm_engineer.h 一致，
+      其中J1 J2 J4(pitch)从右侧看逆时针为正，即绕 -y 转动，竖直向上为0。
+    关节向量 q[6]：
+      q0~q3 为J0~J3关节角，J2为小臂相对大臂的角度；
+      q4 为虚拟J4(pitch)，q5 为虚拟J5(roll)，均相对 ArmKinematicsSetWristZero 设置的零点。
+      差速器：vj4 = (j4 - j5)/2，vj5 = (j4 + j5)/2，反解 j4 = vj4 + vj5，j5 = vj5 - vj4。
+    正运动学：
+      R = Rz(q0) * Ry(-(q1+q2)) * Rz(q3) * Ry(-q4) * Rz(q5)
+      腕点 = (0, 0, shoulder_height) + Rz(q0) * (-(l1*s1 + l2*s12), 0, l1*c1 + l2*c12)
+      末端 = 腕点 + l3 * R * ez，J3 J4 J5三轴交于腕点(球形手腕)
+    末端位姿 ArmPose_s：
+      位置(x, y, z)，姿态 R = Rz(yaw) * Ry(-pitch) * Rz(roll)，
+      即末端轴线的方位角yaw、与竖直方向的夹角pitch(方向同J1)以及绕末端轴线的roll。
+    逆运动学(闭式解，无迭代)：
+      1. 腕点 = 末端 - l3 * 末端轴线
+      2. J0 = atan2(腕点y, 腕点x)，分前后两支(后支J0+pi，大臂向后翻)
+      3. J1 J2 由余弦定理求解，分肘部两支
+      4. M = (Rz(q0)Ry(-q12))^T * R = Rz(q3)Ry(-q4)Rz(q5)，按ZYZ分解，分手腕翻转两支
+      共8组解，选取满足限位且与当前关节角加权距离最小的一组；J3 J5等多圈关节取离当前值最近的等价角。
+      腕点在J0轴线上时J0保持当前值；q4接近0时J3与J5共轴，J3保持当前值，剩余转角全部给J5。
+      目标超出工作空间时按边界求解并返回 ARM_KINE_UNREACHABLE；
+      所有解都超出限位时返回离当前值最近的解并限幅，返回 ARM_KINE_LIMITED。
+    耗时：
+      关节角的sin/cos使用初始化时生成的表线性插值，杆长相关的常量在初始化时算好；
+      每次逆解固定计算全部8组解，不随目标位置和分支变化，耗时恒定，1kHz控制频率下占用很小。
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+#ifndef ARM_KINEMATICS_H
+#define ARM_KINEMATICS_H
+#include "struct_typedef.h"
+
+#define ARM_KINE_JOINT_NUM 6
+#define ARM_KINE_SIN_TABLE_SIZE 1024  // 一圈的表长度，线性插值误差约为 (2*pi/N)^2/8
+#define ARM_KINE_NO_LIMIT 1e6f        // (rad)不限位时的限位值
+
+typedef enum {
+    ARM_KINE_OK = 0,
+    ARM_KINE_LIMITED,      // 所有解都超出关节限位，输出已限幅
+    ARM_KINE_UNREACHABLE,  // 目标超出工作空间，输出为边界上的解
+} ArmKineResult_e;
+
+typedef struct
+{
+    fp32 x, y, z;           // (m)末端位置
+    fp32 yaw, pitch, roll;  // (rad)末端姿态
+} ArmPose_s;
+
+/**
+ * @brief  关节角的sin/cos缓存，正运动学计算一次后可供调用者复用(如重力补偿)
+ */
+typedef struct
+{
+    fp32 s[ARM_KINE_JOINT_NUM];
+    fp32 c[ARM_KINE_JOINT_NUM];
+    fp32 s12, c12;  // q1+q2
+} ArmKineTrig_s;
+
+typedef struct
+{
+    // 结构参数
+    fp32 shoulder_height;  // (m)J1轴线到原点的高度
+    fp32 l1;               // (m)J1到J2
+    fp32 l2;               // (m)J2到腕点
+    fp32 l3;               // (m)腕点到末端
+    fp32 min[ARM_KINE_JOINT_NUM];  // (rad)关节限位
+    fp32 max[ARM_KINE_JOINT_NUM];  // (rad)
+    fp32 vj4_zero;                 // (rad)q4=0时的虚拟J4位置
+    fp32 vj5_zero;                 // (rad)q5=0时的虚拟J5位置
+
+    // 预计算常量
+    fp32 l1l1_l2l2;  // l1^2 + l2^2
+    fp32 inv_2l1l2;  // 1/(2*l1*l2)
+
+    ArmKineTrig_s trig;  // 最近一次正运动学的三角函数缓存
+} ArmKinematics_s;
+
+extern void ArmKineSinTableInit(void);
+extern void ArmKineSinCos(fp32 angle, fp32 * sin_out, fp32 * cos_out);
+extern void ArmKineTrigUpdate(const fp32 q[ARM_KINE_JOINT_NUM], ArmKineTrig_s * trig);
+
+extern void ArmKinematicsInit(
+    ArmKinematics_s * kine, fp32 shoulder_height, fp32 l1, fp32 l2, fp32 l3);
+extern void ArmKinematicsSetLimit(ArmKinematics_s * kine, uint8_t joint, fp32 min, fp32 max);
+extern void ArmKinematicsSetWristZero(ArmKinematics_s * kine, fp32 vj4_zero, fp32 vj5_zero);
+
+extern void ArmDifferentialToVirtual(
+    const ArmKinematics_s * kine, fp32 j4, fp32 j5, fp32 * q4, fp32 * q5);
+extern void ArmVirtualToDifferential(
+    const ArmKinematics_s * kine, fp32 q4, fp32 q5, fp32 * j4, fp32 * j5);
+
+extern void ArmForward(ArmKinematics_s * kine, const fp32 q[ARM_KINE_JOINT_NUM], ArmPose_s * pose);
+extern ArmKineResult_e ArmInverse(
+    const ArmKinematics_s * kine, const ArmPose_s * pose, const fp32 q_now[ARM_KINE_JOINT_NUM],
+    fp32 q_out[ARM_KINE_JOINT_NUM]);
+
+#endif  // ARM_KINEMATICS_H
+/*------------------------------ End of File ------------------------------*/
@@ -7,6 +7,9 @@
   *  Version    Date            Author          Modification
   *  V1.0.0     Aug-20-2024     Penguin         1. done
   *  V1.0.1     Jan-14-2025     Penguin         1. 实现机械臂的基本控制
+  *  V1.1.0     Oct-19-2026     Penguin         1. 添加笛卡尔空间控制模式
+  *  V1.1.1     Oct-19-2026     Penguin         1. 笛卡尔空间控制默认关闭，结构参数移至robot_param
+  *                                             2. 动力学参数移至robot_param，力矩前馈默认关闭
   *
   @verbatim
   ==============================================================================
@@ -24,9 +27,13 @@
     - 定义J5正方向为：当J3归中时，从机械臂前方看，逆时针为正方向
     - vj4和j4 j5的关系：vj4 = (j4 - j5)/2
 
+笛卡尔空间控制模式(robot_param.h 中 ARM_CARTESIAN_ENABLE 为1时启用)
+    右摇杆控制末端前后左右，左摇杆上下控制末端高度、左右控制末端朝向，滚轮控制末端俯仰，
+    目标不可达或超出关节限位时保持上一个可达的目标
+
 机械臂控制
     左拨杆 
-          上：跟随模式
+          上：跟随模式(ARM_CARTESIAN_ENABLE为1且自定义控制器未连接时为笛卡尔空间控制模式)
           中：调试模式
           下：安全模式
     右拨杆
@@ -68,6 +75,8 @@
 
 #define MS_TO_S 0.001f  // ms转s
 
+#define JOINT_ACC_LPF_ALPHA 0.9f  // 关节加速度估计的低通系数
+
 #define ANGLE_PID 0
 #define VELOCITY_PID 1
 
@@ -92,6 +101,29 @@
 #define INIT_2006_SET_VALUE (-1000)  // 2006电机在进行初始化时的电流设置值
 #define INIT_2006_MIN_VEL 1          // 2006电机初始化完成的速度阈值
 
+#define ARM_CARTESIAN_LINEAR_SPEED 0.2f   // (m/s)笛卡尔空间控制时末端最大移动速度
+#define ARM_CARTESIAN_ANGULAR_SPEED 1.0f  // (rad/s)笛卡尔空间控制时末端最大转动速度
+
+// 关节目标轨迹限幅，J0~J2为大关节，J3~J5为末端小关节
+#ifndef ARM_TRAJ_BIG_JOINT_MAX_VEL
+#define ARM_TRAJ_BIG_JOINT_MAX_VEL 2.0f  // (rad/s)
+#endif
+#ifndef ARM_TRAJ_BIG_JOINT_MAX_ACC
+#define ARM_TRAJ_BIG_JOINT_MAX_ACC 8.0f  // (rad/s^2)
+#endif
+#ifndef ARM_TRAJ_BIG_JOINT_MAX_JERK
+#define ARM_TRAJ_BIG_JOINT_MAX_JERK 60.0f  // (rad/s^3)
+#endif
+#ifndef ARM_TRAJ_SMALL_JOINT_MAX_VEL
+#define ARM_TRAJ_SMALL_JOINT_MAX_VEL 10.0f  // (rad/s)
+#endif
+#ifndef ARM_TRAJ_SMALL_JOINT_MAX_ACC
+#define ARM_TRAJ_SMALL_JOINT_MAX_ACC 60.0f  // (rad/s^2)
+#endif
+#ifndef ARM_TRAJ_SMALL_JOINT_MAX_JERK
+#define ARM_TRAJ_SMALL_JOINT_MAX_JERK 1000.0f  // (rad/s^3)
+#endif
+
 // 气泵相关
 #define PUMP_ON_PWM 30000
 #define PUMP_OFF_PWM 0
@@ -118,8 +150,6 @@
             MAX_OUT_JOINT_##index##_VELOCITY, MAX_IOUT_JOINT_##index##_VELOCITY);          \
     }
 
-#define JointLowPassFilterInit(index) \
-    LowPassFilterInit(&MECHANICAL_ARM.lpf.j[index], J##index##_LPF_ALPHA)
 
 /*------------------------------ Variable Definition ------------------------------*/
 
@@ -143,6 +173,7 @@ void MechanicalArmPublish(void) {}
 
 void MechanicalArmInit(void)
 {
+    uint8_t i;
     MECHANICAL_ARM.rc = get_remote_control_point();
 
     MECHANICAL_ARM.init_completed = false;
@@ -161,13 +192,6 @@ void MechanicalArmInit(void)
     JointPidInit(3);
     JointPidInit(4);
     JointPidInit(5);
-    // #LPF init ---------------------
-    JointLowPassFilterInit(0);
-    JointLowPassFilterInit(1);
-    JointLowPassFilterInit(2);
-    JointLowPassFilterInit(3);
-    JointLowPassFilterInit(4);
-    JointLowPassFilterInit(5);
     // #limit init ---------------------
     MECHANICAL_ARM.limit.max.pos[J0] = MAX_JOINT_0_POSITION;
     MECHANICAL_ARM.limit.max.pos[J1] = MAX_JOINT_1_POSITION;
@@ -182,6 +206,27 @@ void MechanicalArmInit(void)
     MECHANICAL_ARM.limit.min.pos[J3] = MIN_JOINT_3_POSITION;
     MECHANICAL_ARM.limit.min.pos[J4] = MIN_JOINT_4_POSITION;
     MECHANICAL_ARM.limit.min.pos[J5] = MIN_JOINT_5_POSITION;
+    // #kinematics init ---------------------
+    ArmKinematicsInit(
+        &MA.cartesian.kine, ARM_SHOULDER_HEIGHT, ARM_LINK_1_LENGTH, ARM_LINK_2_LENGTH,
+        ARM_LINK_3_LENGTH);
+    for (i = 0; i < 4; i++) {
+        ArmKinematicsSetLimit(&MA.cartesian.kine, i, MA.limit.min.pos[i], MA.limit.max.pos[i]);
+    }
+    MA.cartesian.result = ARM_KINE_OK;
+    MA.cartesian.ready = false;
+    // #dynamics init ---------------------
+    ArmDynamicsParam_s dynamics_param = {
+        .l1 = ARM_LINK_1_LENGTH,
+        .l2 = ARM_LINK_2_LENGTH,
+        .link1 = {ARM_LINK_1_MASS, ARM_LINK_1_COM, ARM_LINK_1_INERTIA},
+        .link2 = {ARM_LINK_2_MASS, ARM_LINK_2_COM, ARM_LINK_2_INERTIA},
+        .wrist_mass = ARM_WRIST_MASS,
+        .tool_mass = ARM_TOOL_MASS,
+        .tool_com = ARM_TOOL_COM,
+        .base_inertia = ARM_BASE_INERTIA,
+    };
+    ArmDynamicsInit(&MA.dynamics, &dynamics_param);
     // #memset ---------------------
     memset(&MECHANICAL_ARM.fdb, 0, sizeof(MECHANICAL_ARM.fdb));
     memset(&MECHANICAL_ARM.ref, 0, sizeof(MECHANICAL_ARM.ref));
@@ -192,6 +237,16 @@ void MechanicalArmInit(void)
     MECHANICAL_ARM.ref.joint[J3].angle = 0.0f;
     MECHANICAL_ARM.ref.joint[J4].angle = 0.0f;
     MECHANICAL_ARM.ref.joint[J5].angle = 0.0f;
+    // #trajectory init ---------------------
+    TrajLimit_s big_joint_limit = {
+        ARM_TRAJ_BIG_JOINT_MAX_VEL, ARM_TRAJ_BIG_JOINT_MAX_ACC, ARM_TRAJ_BIG_JOINT_MAX_JERK};
+    TrajLimit_s small_joint_limit = {
+        ARM_TRAJ_SMALL_JOINT_MAX_VEL, ARM_TRAJ_SMALL_JOINT_MAX_ACC, ARM_TRAJ_SMALL_JOINT_MAX_JERK};
+    for (i = 0; i < JOINT_NUM; i++) {
+        TrajAxisInit(
+            &MA.traj.joint[i], i < J3 ? &big_joint_limit : &small_joint_limit,
+            MA.ref.joint[i].angle);
+    }
 
     // #Initial value setting ---------------------
     MECHANICAL_ARM.mode = MECHANICAL_ARM_SAFE;
@@ -212,6 +267,21 @@ void MechanicalArmInit(void)
     MECHANICAL_ARM.transform.duration[J3] = 2;
     MECHANICAL_ARM.transform.duration[J4] = 1;
     MECHANICAL_ARM.transform.duration[J5] = 1;
+    // #observer init ---------------------
+    // J0~J2不展开、速度不滤波；J3~J5可转多圈，速度反馈低通
+    const float observer_gain[3] = {0.0f, 0.0f, JOINT_ACC_LPF_ALPHA};
+    JointObserverInit(
+        &MA.observer, JOINT_OBSERVER_LPF, JOINT_NUM, 0.0f, 1.0f, observer_gain,
+        MECHANICAL_ARM_CONTROL_TIME * MS_TO_S);
+    for (uint8_t i = 0; i < JOINT_NUM; i++) {
+        MA.observer.ratio[i] = MA.joint_motor[i].reduction_ratio;
+    }
+    for (uint8_t i = J3; i <= J5; i++) {
+        MA.observer.range[i] = 2 * M_PI * MA.transform.duration[i];
+    }
+    MA.observer.alpha[J3] = J3_LPF_ALPHA;
+    MA.observer.alpha[J4] = J4_LPF_ALPHA;
+    MA.observer.alpha[J5] = J5_LPF_ALPHA;
 }
 
 /******************************************************************/
@@ -239,6 +309,14 @@ void MechanicalArmHandleException(void)
             // 设置虚拟关节J4关节的位置限制
             MECHANICAL_ARM.limit.max.vj4_pos = virtual_j4_pos - 0.15f + M_PI;
             MECHANICAL_ARM.limit.min.vj4_pos = virtual_j4_pos + 0.15f;
+
+            // 以虚拟J4 J5的限位中点作为手腕零点，运动学与动力学共用
+            float vj4_pos_mid = (MA.limit.max.vj4_pos + MA.limit.min.vj4_pos) / 2;
+            float vj5_pos_mid = (MA.limit.max.vj5_pos + MA.limit.min.vj5_pos) / 2;
+            ArmKinematicsSetWristZero(&MA.cartesian.kine, vj4_pos_mid, vj5_pos_mid);
+            ArmKinematicsSetLimit(
+                &MA.cartesian.kine, 4, MA.limit.min.vj4_pos - vj4_pos_mid,
+                MA.limit.max.vj4_pos - vj4_pos_mid);
         }
     }
 
@@ -273,6 +351,10 @@ void MechanicalArmSetMode(void)
 
     if (switch_is_up(MECHANICAL_ARM.rc->rc.s[MECHANICAL_ARM_MODE_CHANNEL])) {
         MECHANICAL_ARM.mode = MECHANICAL_ARM_FOLLOW;
+#if ARM_CARTESIAN_ENABLE
+        // 自定义控制器未连接时由遥控器控制末端位姿
+        if (!MA.custom_controller_ready) MECHANICAL_ARM.mode = MECHANICAL_ARM_CARTESIAN;
+#endif
     } else if (switch_is_mid(MECHANICAL_ARM.rc->rc.s[MECHANICAL_ARM_MODE_CHANNEL])) {
         MECHANICAL_ARM.mode = MECHANICAL_ARM_DEBUG;
     } else if (switch_is_down(MECHANICAL_ARM.rc->rc.s[MECHANICAL_ARM_MODE_CHANNEL])) {
@@ -291,10 +373,13 @@ void MechanicalArmSetMode(void)
 /* main function:       MechanicalArmObserver                     */
 /* auxiliary function:  UpdateMotorStatus                         */
 /*                      JointStateObserve                         */
+/*                      EndEffectorObserve                        */
 /******************************************************************/
 
 static void UpdateMotorStatus(void);
 static void JointStateObserve(void);
+static void EndEffectorObserve(void);
+static void JointDynamicsObserve(void);
 
 void MechanicalArmObserver(void)
 {
@@ -305,6 +390,8 @@ void MechanicalArmObserver(void)
 
     UpdateMotorStatus();
     JointStateObserve();
+    EndEffectorObserve();
+    JointDynamicsObserve();
 }
 
 /**
@@ -325,91 +412,75 @@ static void UpdateMotorStatus(void)
  */
 static void JointStateObserve(void)
 {
-    static float last_angle[6], angle_fdb[6] = {0, 0, 0, 0, 0, 0};
-    float vel, dpos;
-#define dangle MECHANICAL_ARM.transform.dpos
-
-    /*-----处理J0 J1 J2关节的反馈信息（J4 J5作为差速机构要特殊处理）*/
+    float raw_pos[JOINT_NUM], raw_vel[JOINT_NUM];
     uint8_t i;
+    for (i = 0; i < JOINT_NUM; i++) {
+        raw_pos[i] = theta_transform(
+            MA.joint_motor[i].fdb.pos, MA.transform.dpos[i], MA.joint_motor[i].direction,
+            MA.transform.duration[i]);
+        raw_vel[i] = MA.joint_motor[i].fdb.vel * MA.joint_motor[i].direction;
+    }
+    JointObserverUpdate(&MA.observer, raw_pos, raw_vel);
+
+    for (i = 0; i < JOINT_NUM; i++) {
+        MA.fdb.joint[i].angle = MA.observer.pos[i];
+        MA.fdb.joint[i].velocity = MA.observer.vel[i];
+    }
     for (i = 0; i < 3; i++) {
-        MA.fdb.joint[i].angle = theta_transform(
-                                    MA.joint_motor[i].fdb.pos, dangle[i],
-                                    MA.joint_motor[i].direction, MA.transform.duration[i]) /
-                                MA.joint_motor[i].reduction_ratio;
-        MA.fdb.joint[i].velocity = MA.joint_motor[i].fdb.vel / MA.joint_motor[i].reduction_ratio *
-                                   MA.joint_motor[i].direction;
         MA.fdb.joint[i].torque = MA.joint_motor[i].fdb.tor * MA.joint_motor[i].reduction_ratio *
                                  MA.joint_motor[i].direction;
     }
-    /*-----处理J3关节的反馈信息(涉及到多圈计数问题)*/
-    angle_fdb[J3] = theta_transform(
-                        MA.joint_motor[J3].fdb.pos, dangle[J3], MA.joint_motor[J3].direction,
-                        MA.transform.duration[J3]) /
-                    MA.joint_motor[J3].reduction_ratio;
-
-    dpos = angle_fdb[J3] - last_angle[J3];
-    if (fabs(dpos) > M_PI) {
-        MA.fdb.joint[J3].round += (dpos) < 0 ? 1 : -1;
-    }
-
-    last_angle[J3] = angle_fdb[J3];
-
-    MA.fdb.joint[J3].angle = angle_fdb[J3] + M_PI * 2 * MA.fdb.joint[J3].round;
-
-    vel = MA.joint_motor[J3].fdb.vel / MA.joint_motor[J3].reduction_ratio *
-          MA.joint_motor[J3].direction;
-
-    MA.fdb.joint[J3].velocity = LowPassFilterCalc(&MA.lpf.j[J3], vel);
-
-    /*-----处理J4 J5 关节的反馈信息*/
-    // 处理速度反馈
-    vel = MA.joint_motor[J4].fdb.vel / MA.joint_motor[J4].reduction_ratio *
-          MA.joint_motor[J4].direction;
-    MA.fdb.joint[J4].velocity = LowPassFilterCalc(&MA.lpf.j[J4], vel);
-
-    vel = MA.joint_motor[J5].fdb.vel / MA.joint_motor[J5].reduction_ratio *
-          MA.joint_motor[J5].direction;
-    MA.fdb.joint[J5].velocity = LowPassFilterCalc(&MA.lpf.j[J5], vel);
-
-    // 处理位置反馈
-    // J4
-    angle_fdb[J4] = theta_transform(
-        MA.joint_motor[J4].fdb.pos, dangle[J4], MA.joint_motor[J4].direction,
-        MA.transform.duration[J4]);
+}
 
-    dpos = angle_fdb[J4] - last_angle[J4];
-    if (fabs(dpos) > M_PI) {
-        MA.fdb.joint[J4].round += (dpos) < 0 ? 1 : -1;
-    }
-    last_angle[J4] = angle_fdb[J4];
-    MA.fdb.joint[J4].angle =
-        (angle_fdb[J4] + M_PI * 2 * MA.fdb.joint[J4].round) / MA.joint_motor[J4].reduction_ratio;
-
-    // J5
-    angle_fdb[J5] = theta_transform(
-        MA.joint_motor[J5].fdb.pos, dangle[J5], MA.joint_motor[J5].direction,
-        MA.transform.duration[J5]);
-
-    dpos = angle_fdb[J5] - last_angle[J5];
-    if (fabs(dpos) > M_PI) {
-        MA.fdb.joint[J5].round += (dpos) < 0 ? 1 : -1;
+/**
+ * @brief  末端位姿观测
+ * @param  none
+ */
+static void EndEffectorObserve(void)
+{
+    float q[ARM_KINE_JOINT_NUM];
+    uint8_t i;
+    for (i = 0; i < 4; i++) {
+        q[i] = MA.fdb.joint[i].angle;
     }
-    last_angle[J5] = angle_fdb[J5];
-    MA.fdb.joint[J5].angle =
-        (angle_fdb[J5] + M_PI * 2 * MA.fdb.joint[J5].round) / MA.joint_motor[J5].reduction_ratio;
+    ArmDifferentialToVirtual(
+        &MA.cartesian.kine, MA.fdb.joint[J4].angle, MA.fdb.joint[J5].angle, &q[4], &q[5]);
+    ArmForward(&MA.cartesian.kine, q, &MA.cartesian.fdb);
+}
 
-#undef dangle
+/**
+ * @brief  关节力矩前馈，复用正运动学的三角函数缓存
+ * @note   速度使用反馈值；加速度使用上一周期轨迹生成的期望加速度，轨迹的加速度连续，滞后一个周期影响很小
+ */
+static void JointDynamicsObserve(void)
+{
+    float dq[ARM_DYN_JOINT_NUM], ddq[ARM_DYN_JOINT_NUM];
+    uint8_t i;
+    for (i = 0; i < 4; i++) {
+        dq[i] = MA.fdb.joint[i].velocity;
+        ddq[i] = MA.traj.joint[i].acc;
+    }
+    dq[4] = (MA.fdb.joint[J4].velocity - MA.fdb.joint[J5].velocity) / 2;
+    ddq[4] = (MA.traj.joint[J4].acc - MA.traj.joint[J5].acc) / 2;
+    ArmDynamicsUpdate(&MA.dynamics, &MA.cartesian.kine.trig, dq, ddq);
 }
 
 /******************************************************************/
 /* Reference                                                      */
 /*----------------------------------------------------------------*/
 /* main function:       MechanicalArmReference                    */
+/* auxiliary function:  CartesianReference                        */
 /******************************************************************/
 
+static void CartesianReference(void);
+
 void MechanicalArmReference(void)
 {
     uint8_t i;
+    if (MECHANICAL_ARM.mode != MECHANICAL_ARM_CARTESIAN) {
+        MA.cartesian.ready = false;
+    }
+
     switch (MECHANICAL_ARM.mode) {
         case MECHANICAL_ARM_CUSTOM: {
             // MECHANICAL_ARM.ref.joint[J0].angle = MECHANICAL_ARM.rc->rc.ch[4] * RC_TO_ONE * M_PI;
@@ -511,6 +582,9 @@ void MechanicalArmReference(void)
                 MA.ref.joint[J5].angle = -(vj4_pos - vj5_pos);
             }
         } break;
+        case MECHANICAL_ARM_CARTESIAN: {
+            CartesianReference();
+        } break;
         case MECHANICAL_ARM_CALIBRATE:
         case MECHANICAL_ARM_SAFE:
         default: {
@@ -521,14 +595,65 @@ void MechanicalArmReference(void)
     }
 }
 
+/**
+ * @brief  笛卡尔空间控制，遥控器改变末端目标位姿，逆解得到关节目标
+ * @param  none
+ */
+static void CartesianReference(void)
+{
+    ArmKinematics_s * kine = &MA.cartesian.kine;
+    float q[ARM_KINE_JOINT_NUM];
+    uint8_t i;
+
+    // 手腕零点与虚拟J4限位已在初始化中标定，进入模式时末端目标从当前关节目标开始，避免跳变
+    for (i = 0; i < 4; i++) {
+        q[i] = MA.ref.joint[i].angle;
+    }
+    ArmDifferentialToVirtual(kine, MA.ref.joint[J4].angle, MA.ref.joint[J5].angle, &q[4], &q[5]);
+
+    if (!MA.cartesian.ready) {
+        ArmForward(kine, q, &MA.cartesian.ref);
+        MA.cartesian.ready = true;
+    }
+
+    float dt = MA.duration * MS_TO_S;
+    float linear = ARM_CARTESIAN_LINEAR_SPEED * dt;
+    float angular = ARM_CARTESIAN_ANGULAR_SPEED * dt;
+    ArmPose_s target = MA.cartesian.ref;
+    target.x += GetDt7RcCh(DT7_CH_RV) * linear;
+    target.y -= GetDt7RcCh(DT7_CH_RH) * linear;
+    target.z += GetDt7RcCh(DT7_CH_LV) * linear;
+    target.yaw -= GetDt7RcCh(DT7_CH_LH) * angular;
+    target.pitch += GetDt7RcCh(DT7_CH_ROLLER) * angular;
+
+    MA.cartesian.result = ArmInverse(kine, &target, q, q);
+    if (MA.cartesian.result != ARM_KINE_OK) {
+        return;  // 保持上一个可达的目标
+    }
+
+    MA.cartesian.ref = target;
+    for (i = 0; i < 4; i++) {
+        MA.ref.joint[i].angle = q[i];
+    }
+    ArmVirtualToDifferential(kine, q[4], q[5], &MA.ref.joint[J4].angle, &MA.ref.joint[J5].angle);
+}
+
 /******************************************************************/
 /* Console                                                        */
 /*----------------------------------------------------------------*/
 /* main function:       MechanicalArmConsole                      */
+/* auxiliary function:  JointTrajectory                           */
 /******************************************************************/
 
+static void JointTrajectory(bool active);
+static float JointTorqueFeedforward(uint8_t joint);
+
 void MechanicalArmConsole(void)
 {
+    JointTrajectory(
+        MA.mode == MECHANICAL_ARM_FOLLOW || MA.mode == MECHANICAL_ARM_CARTESIAN ||
+        MA.mode == MECHANICAL_ARM_DEBUG);
+
     switch (MECHANICAL_ARM.mode) {
         case MECHANICAL_ARM_CUSTOM: {
             // // 优先处理dm电机部分
@@ -568,38 +693,39 @@ void MechanicalArmConsole(void)
             //     MECHANICAL_ARM.pid.j5[ANGLE_PID].out);
         } break;
         case MECHANICAL_ARM_FOLLOW:
+        case MECHANICAL_ARM_CARTESIAN:
         case MECHANICAL_ARM_DEBUG: {
             /*机械臂J0 J1 J2基本不会出现过圈问题，不考虑过圈时的最优旋转方向问题。*/
 
             // J0
             MA.joint_motor[J0].set.vel =
-                PID_calc(&MA.pid.j0[0], MA.fdb.joint[J0].angle, MA.ref.joint[J0].angle) *
+                PID_calc(&MA.pid.j0[0], MA.fdb.joint[J0].angle, MA.traj.joint[J0].pos) *
                 MA.joint_motor[J0].direction * MA.joint_motor[J0].reduction_ratio;
-            MA.joint_motor[J0].set.tor = 0;
+            MA.joint_motor[J0].set.tor = JointTorqueFeedforward(J0);
 
             // J1
             MA.joint_motor[J1].set.vel =
-                PID_calc(&MA.pid.j1[0], MA.fdb.joint[J1].angle, MA.ref.joint[J1].angle) *
+                PID_calc(&MA.pid.j1[0], MA.fdb.joint[J1].angle, MA.traj.joint[J1].pos) *
                 MA.joint_motor[J1].direction * MA.joint_motor[J1].reduction_ratio;
-            MA.joint_motor[J1].set.tor = 0;
+            MA.joint_motor[J1].set.tor = JointTorqueFeedforward(J1);
 
             // J2
             MA.joint_motor[J2].set.vel =
-                PID_calc(&MA.pid.j2[0], MA.fdb.joint[J2].angle, MA.ref.joint[J2].angle) *
+                PID_calc(&MA.pid.j2[0], MA.fdb.joint[J2].angle, MA.traj.joint[J2].pos) *
                 MA.joint_motor[J2].direction * MA.joint_motor[J2].reduction_ratio;
-            MA.joint_motor[J2].set.tor = 0;
+            MA.joint_motor[J2].set.tor = JointTorqueFeedforward(J2);
 
             /*机械臂J3 J4 J5需要考虑过圈的处理（在Observer时已经记录圈数获得多圈反馈了）*/
             // J3
             MA.joint_motor[J3].set.vel =
-                PID_calc(&MA.pid.j3[0], MA.fdb.joint[J3].angle, MA.ref.joint[J3].angle) *
+                PID_calc(&MA.pid.j3[0], MA.fdb.joint[J3].angle, MA.traj.joint[J3].pos) *
                 MA.joint_motor[J3].direction * MA.joint_motor[J3].reduction_ratio;
             MA.joint_motor[J3].set.value =
                 PID_calc(&MA.pid.j3[1], MA.fdb.joint[J3].velocity, MA.joint_motor[J3].set.vel);
 
             // J4
             MA.joint_motor[J4].set.vel =
-                PID_calc(&MA.pid.j4[0], MA.fdb.joint[J4].angle, MA.ref.joint[J4].angle) *
+                PID_calc(&MA.pid.j4[0], MA.fdb.joint[J4].angle, MA.traj.joint[J4].pos) *
                 MA.joint_motor[J4].direction * MA.joint_motor[J4].reduction_ratio;
             MA.joint_motor[J4].set.value =
                 PID_calc(&MA.pid.j4[1], MA.fdb.joint[J4].velocity, MA.joint_motor[J4].set.vel);
@@ -607,7 +733,7 @@ void MechanicalArmConsole(void)
 
             // J5
             MA.joint_motor[J5].set.vel =
-                PID_calc(&MA.pid.j5[0], MA.fdb.joint[J5].angle, MA.ref.joint[J5].angle) *
+                PID_calc(&MA.pid.j5[0], MA.fdb.joint[J5].angle, MA.traj.joint[J5].pos) *
                 MA.joint_motor[J5].direction * MA.joint_motor[J5].reduction_ratio;
             MA.joint_motor[J5].set.value =
                 PID_calc(&MA.pid.j5[1], MA.fdb.joint[J5].velocity, MA.joint_motor[J5].set.vel);
@@ -637,6 +763,35 @@ void MechanicalArmConsole(void)
     }
 }
 
+/**
+ * @brief  关节轨迹生成，各关节同步到达 ref.joint 目标
+ * @param  active 机械臂处于关节位置控制中，否则轨迹跟随反馈，重新进入控制时从当前位置平滑出发
+ */
+static void JointTrajectory(bool active)
+{
+    uint8_t i;
+    for (i = 0; i < JOINT_NUM; i++) {
+        if (active) {
+            TrajAxisSetTarget(&MA.traj.joint[i], MA.ref.joint[i].angle);
+        } else {
+            TrajAxisReset(&MA.traj.joint[i], MA.fdb.joint[i].angle, 0.0f);
+        }
+    }
+    if (active) {
+        TrajectorySync(MA.traj.joint, JOINT_NUM, MA.duration * MS_TO_S);
+    }
+}
+
+/**
+ * @brief  关节力矩前馈换算到电机侧，作为达妙电机MIT模式的力矩
+ * @param  joint 关节序号
+ */
+static float JointTorqueFeedforward(uint8_t joint)
+{
+    return ARM_FEEDFORWARD_RATIO * MA.dynamics.torque[joint] * MA.joint_motor[joint].direction /
+           MA.joint_motor[joint].reduction_ratio;
+}
+
 /******************************************************************/
 /* SendCmd                                                        */
 /*----------------------------------------------------------------*/
@@ -666,6 +821,7 @@ void MechanicalArmSendCmd(void)
 
     switch (MECHANICAL_ARM.mode) {
         case MECHANICAL_ARM_FOLLOW:
+        case MECHANICAL_ARM_CARTESIAN:
         case MECHANICAL_ARM_DEBUG: {
             ArmSendCmdDebug();
         } break;
@@ -697,11 +853,11 @@ void ArmSendCmdSafe(void)
 
 void ArmSendCmdDebug(void)
 {
-    // 电机控制
-    DmMitCtrlVelocity(&MECHANICAL_ARM.joint_motor[J0], J0_KD_FOLLOW);
+    // 电机控制，速度环之外叠加力矩前馈
+    DmMitCtrl(&MECHANICAL_ARM.joint_motor[J0], J0_KP_FOLLOW, J0_KD_FOLLOW);
     delay_us(DM_DELAY);
-    DmMitCtrlVelocity(&MECHANICAL_ARM.joint_motor[J1], J1_KD_FOLLOW);
-    DmMitCtrlVelocity(&MECHANICAL_ARM.joint_motor[J2], J2_KD_FOLLOW);
+    DmMitCtrl(&MECHANICAL_ARM.joint_motor[J1], J1_KP_FOLLOW, J1_KD_FOLLOW);
+    DmMitCtrl(&MECHANICAL_ARM.joint_motor[J2], J2_KP_FOLLOW, J2_KD_FOLLOW);
     delay_us(DM_DELAY);
     // clang-format off
     CanCmdDjiMotor(
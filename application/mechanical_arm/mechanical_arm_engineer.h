@@ -7,6 +7,10 @@
   *  Version    Date            Author          Modification
   *  V1.0.0     Aug-20-2024     Penguin         1. done
   *  V1.0.1     Jan-14-2025     Penguin         1. 实现机械臂的基本控制
+  *  V1.1.0     Oct-19-2026     Penguin         1. 添加笛卡尔空间控制模式
+  *  V1.2.0     Oct-19-2026     Penguin         1. 关节目标经过多轴同步的轨迹生成后再进入PID
+  *  V1.3.0     Oct-19-2026     Penguin         1. J0~J2使用动力学模型计算的力矩前馈
+  *  V1.3.1     Oct-19-2026     Penguin         1. 关节多圈展开与速度滤波改用 JointObserver
   *
   @verbatim
   ==============================================================================
@@ -35,13 +39,17 @@
 #define MECHANICAL_ARM_ENGINEER_H
 
 #if (MECHANICAL_ARM_TYPE == MECHANICAL_ARM_ENGINEER_ARM)
+#include "arm_dynamics.h"
+#include "arm_kinematics.h"
 #include "custom_typedef.h"
 #include "data_exchange.h"
+#include "joint_observer.h"
 #include "mechanical_arm.h"
 #include "motor.h"
 #include "pid.h"
 #include "remote_control.h"
 #include "struct_typedef.h"
+#include "trajectory.h"
 #include "user_lib.h"
 
 #define JOINT_NUM 6  // 关节数量
@@ -55,6 +63,7 @@ typedef enum {
     MECHANICAL_ARM_DEBUG,
     MECHANICAL_ARM_CUSTOM,
     MECHANICAL_ARM_INIT,
+    MECHANICAL_ARM_CARTESIAN,  // 遥控器控制末端位姿，由逆运动学得到关节目标
 } MechanicalArmMode_e;
 
 /**
@@ -91,7 +100,6 @@ typedef struct
             float angle;     // (rad)位置
             float velocity;  // (rad/s)速度
             float torque;    // (N*m)力矩
-            int16_t round;   // 圈数(当前位于第几圈中，初始为0)
         } joint[JOINT_NUM];
     } fdb;
 
@@ -117,6 +125,22 @@ typedef struct
         } min;
     } limit;
 
+    struct
+    {
+        ArmKinematics_s kine;
+        ArmPose_s ref;           // 末端目标位姿
+        ArmPose_s fdb;           // 末端当前位姿
+        ArmKineResult_e result;  // 最近一次逆解结果
+        bool ready;              // 已由当前关节目标初始化末端目标位姿
+    } cartesian;
+
+    ArmDynamics_s dynamics;  // 关节力矩前馈
+
+    struct
+    {
+        TrajAxis_s joint[JOINT_NUM];  // 以 ref.joint 为目标，输出位置作为角度环的目标
+    } traj;
+
     struct
     {
         bool pump_on;
@@ -132,10 +156,7 @@ typedef struct
         pid_type_def j5[2];
     } pid;
 
-    struct
-    {
-        LowPassFilter_t j[6];
-    } lpf;
+    JointObserver_s observer;  // 关节多圈展开与速度估计
 
 } MechanicalArm_s;
 
@@ -6,6 +6,7 @@
   * @history
   *  Version    Date            Author          Modification
   *  V1.0.1     Apr-21-2024     Penguin         1. done
+  *  V1.0.2     Oct-19-2026     Penguin         1. 动力学参数移至robot_param，力矩前馈默认关闭
   *
   @verbatim
   ==============================================================================
@@ -29,6 +30,17 @@
 #include "signal_generator.h"
 #include "usb_debug.h"
 
+// 关节目标轨迹限幅
+#ifndef ARM_TRAJ_MAX_VEL
+#define ARM_TRAJ_MAX_VEL 4.0f  // (rad/s)
+#endif
+#ifndef ARM_TRAJ_MAX_ACC
+#define ARM_TRAJ_MAX_ACC 20.0f  // (rad/s^2)
+#endif
+#ifndef ARM_TRAJ_MAX_JERK
+#define ARM_TRAJ_MAX_JERK 200.0f  // (rad/s^3)
+#endif
+
 static MechanicalArm_s MECHANICAL_ARM = {
     .mode = MECHANICAL_ARM_ZERO_FORCE,
     .ctrl_link = LINK_NONE,
@@ -104,6 +116,25 @@ void MechanicalArmInit(void)
 
     // #Low pass filter init ---------------------
     LowPassFilterInit(&MECHANICAL_ARM.FirstOrderFilter.filter[3], 0.985f);
+
+    // #Trajectory init ---------------------
+    TrajLimit_s traj_limit = {ARM_TRAJ_MAX_VEL, ARM_TRAJ_MAX_ACC, ARM_TRAJ_MAX_JERK};
+    for (uint8_t i = 0; i < 4; i++) {
+        TrajAxisInit(&MECHANICAL_ARM.traj[i], &traj_limit, 0.0f);
+    }
+
+    // #Dynamics init ---------------------
+    ArmDynamicsParam_s dynamics_param = {
+        .l1 = ARM_LINK_1_LENGTH,
+        .l2 = ARM_LINK_2_LENGTH,
+        .link1 = {ARM_LINK_1_MASS, ARM_LINK_1_COM, ARM_LINK_1_INERTIA},
+        .link2 = {ARM_LINK_2_MASS, ARM_LINK_2_COM, ARM_LINK_2_INERTIA},
+        .wrist_mass = ARM_WRIST_MASS,
+        .tool_mass = 0.0f,
+        .tool_com = 0.0f,
+        .base_inertia = ARM_BASE_INERTIA,
+    };
+    ArmDynamicsInit(&MECHANICAL_ARM.dynamics, &dynamics_param);
 }
 
 /*-------------------- Handle exception --------------------*/
@@ -273,6 +304,8 @@ static void SetCtrlLink(void)
 }
 /*-------------------- Observe --------------------*/
 
+static void JointDynamicsObserve(void);
+
 /**
  * @brief          更新状态量
  * @param[in]      none
@@ -314,12 +347,47 @@ void MechanicalArmObserver(void)
         MECHANICAL_ARM.fdb.pos_delta[i] = MECHANICAL_ARM.fdb.pos[i] - last_pos[i];
     }
 
+    JointDynamicsObserve();
+
     // OutputPCData.packets[0].data = MECHANICAL_ARM.fdb.pos[3];
     // OutputPCData.packets[1].data = MECHANICAL_ARM.ref.pos[3];
     // OutputPCData.packets[2].data = MECHANICAL_ARM.fdb.vel[3];
     // OutputPCData.packets[3].data = MECHANICAL_ARM.ref.vel[3];
 }
 
+/**
+ * @brief          计算关节0-2的力矩前馈
+ * @note           小臂反馈为绝对角度，模型使用相对大臂的角度，算出的力矩再换回绝对角度，
+ *                 加速度使用上一周期轨迹生成的期望值
+ * @param[in]      none
+ * @retval         none
+ */
+static void JointDynamicsObserve(void)
+{
+    fp32 q[ARM_KINE_JOINT_NUM] = {0.0f};
+    fp32 dq[ARM_DYN_JOINT_NUM] = {0.0f}, ddq[ARM_DYN_JOINT_NUM] = {0.0f};
+    ArmKineTrig_s trig;
+
+    q[0] = MECHANICAL_ARM.fdb.pos[0];
+    q[1] = MECHANICAL_ARM.fdb.pos[1];
+    q[2] = MECHANICAL_ARM.fdb.pos[2] - MECHANICAL_ARM.fdb.pos[1];
+    dq[0] = MECHANICAL_ARM.fdb.vel[0];
+    dq[1] = MECHANICAL_ARM.fdb.vel[1];
+    dq[2] = MECHANICAL_ARM.fdb.vel[2] - MECHANICAL_ARM.fdb.vel[1];
+    ddq[0] = MECHANICAL_ARM.traj[0].acc;
+    ddq[1] = MECHANICAL_ARM.traj[1].acc;
+    ddq[2] = MECHANICAL_ARM.traj[2].acc - MECHANICAL_ARM.traj[1].acc;
+
+    ArmKineTrigUpdate(q, &trig);
+    ArmDynamicsUpdate(&MECHANICAL_ARM.dynamics, &trig, dq, ddq);
+
+    // 绝对角度下：tau_abs1 = tau1 - tau2，tau_abs2 = tau2
+    MECHANICAL_ARM.feedforward[0] = MECHANICAL_ARM.dynamics.torque[0];
+    MECHANICAL_ARM.feedforward[1] =
+        MECHANICAL_ARM.dynamics.torque[1] - MECHANICAL_ARM.dynamics.torque[2];
+    MECHANICAL_ARM.feedforward[2] = MECHANICAL_ARM.dynamics.torque[2];
+}
+
 /*-------------------- Reference --------------------*/
 
 /**
@@ -391,6 +459,18 @@ static void JointTorqueLimit(void);
  */
 void MechanicalArmConsole(void)
 {
+    // 跟随时关节0-3同步平滑地到达目标，其余模式轨迹跟随反馈，切入跟随时不会跳变
+    for (uint8_t i = 0; i < 4; i++) {
+        if (MECHANICAL_ARM.mode == MECHANICAL_ARM_FOLLOW) {
+            TrajAxisSetTarget(&MECHANICAL_ARM.traj[i], MECHANICAL_ARM.ref.pos[i]);
+        } else {
+            TrajAxisReset(&MECHANICAL_ARM.traj[i], MECHANICAL_ARM.fdb.pos[i], 0.0f);
+        }
+    }
+    if (MECHANICAL_ARM.mode == MECHANICAL_ARM_FOLLOW) {
+        TrajectorySync(MECHANICAL_ARM.traj, 4, MECHANICAL_ARM_CONTROL_TIME * 0.001f);
+    }
+
     switch (MECHANICAL_ARM.mode) {
         case MECHANICAL_ARM_INIT: {
             MechanicalArmInitConsole();
@@ -440,19 +520,27 @@ static void MechanicalArmInitConsole(void)
 static void MechanicalArmFollowConsole(void)
 {
     // 关节0-2跟随
-    MECHANICAL_ARM.joint_motor[0].set.pos = -MECHANICAL_ARM.ref.pos[0];
+    MECHANICAL_ARM.joint_motor[0].set.pos = -MECHANICAL_ARM.traj[0].pos;
 
     MECHANICAL_ARM.joint_motor[1].set.pos =
-        theta_transform(MECHANICAL_ARM.ref.pos[1], -J_1_ANGLE_TRANSFORM, 1, 1);
+        theta_transform(MECHANICAL_ARM.traj[1].pos, -J_1_ANGLE_TRANSFORM, 1, 1);
     MECHANICAL_ARM.joint_motor[1].mode = CYBERGEAR_MODE_POS;
 
     MECHANICAL_ARM.joint_motor[2].set.pos =
-        theta_transform(MECHANICAL_ARM.ref.pos[2], -J_2_ANGLE_TRANSFORM, -1, 1);
+        theta_transform(MECHANICAL_ARM.traj[2].pos, -J_2_ANGLE_TRANSFORM, -1, 1);
     MECHANICAL_ARM.joint_motor[2].mode = CYBERGEAR_MODE_POS;
 
+    // 轨迹速度与动力学力矩前馈，电机方向与上面的位置换算一致
+    static const float motor_sign[3] = {-1.0f, 1.0f, -1.0f};
+    for (uint8_t i = 0; i < 3; i++) {
+        MECHANICAL_ARM.joint_motor[i].set.vel = motor_sign[i] * MECHANICAL_ARM.traj[i].vel;
+        MECHANICAL_ARM.joint_motor[i].set.tor =
+            motor_sign[i] * ARM_FEEDFORWARD_RATIO * MECHANICAL_ARM.feedforward[i];
+    }
+
     // 关节3跟随
     MECHANICAL_ARM.ref.vel[3] = PID_calc(
-        &MECHANICAL_ARM.pid.joint_angle[3], MECHANICAL_ARM.fdb.pos[3], MECHANICAL_ARM.ref.pos[3]);
+        &MECHANICAL_ARM.pid.joint_angle[3], MECHANICAL_ARM.fdb.pos[3], MECHANICAL_ARM.traj[3].pos);
 
     MECHANICAL_ARM.joint_motor[3].set.value = PID_calc(
         &MECHANICAL_ARM.pid.joint_speed[3], MECHANICAL_ARM.fdb.vel[3], MECHANICAL_ARM.ref.vel[3]);
@@ -559,7 +647,7 @@ static void ArmSetZeroSendCmd(void)
 
 static void ArmFollowSendCmd(void)
 {
-    CybergearPositionControl(&MECHANICAL_ARM.joint_motor[0], 2, 0.5);
+    CybergearMitControl(&MECHANICAL_ARM.joint_motor[0], 2, 0.5);
     for (int i = 0; i < 1; i++) CybergearReadParam(&MECHANICAL_ARM.joint_motor[0], 0X302d);
 
     static float kp_vel[3] = {0, 3.0f, 4.0f};
@@ -568,7 +656,7 @@ static void ArmFollowSendCmd(void)
         if (MECHANICAL_ARM.joint_motor[i].mode == CYBERGEAR_MODE_SPEED) {
             CybergearVelocityControl(&MECHANICAL_ARM.joint_motor[i], kp_vel[i]);
         } else if (MECHANICAL_ARM.joint_motor[i].mode == CYBERGEAR_MODE_POS) {
-            CybergearPositionControl(&MECHANICAL_ARM.joint_motor[i], kp_pos[i], 0.5);
+            CybergearMitControl(&MECHANICAL_ARM.joint_motor[i], kp_pos[i], 0.5);
         } else {
             CybergearTorqueControl(&MECHANICAL_ARM.joint_motor[i]);
         }
@@ -6,6 +6,8 @@
   * @history
   *  Version    Date            Author          Modification
   *  V1.0.1     Apr-21-2024     Penguin         1. done
+  *  V1.1.0     Oct-19-2026     Penguin         1. 关节0-3目标经过多轴同步的轨迹生成后再跟随
+  *  V1.2.0     Oct-19-2026     Penguin         1. 关节0-2使用动力学模型计算的力矩前馈
   *
   @verbatim
   ==============================================================================
@@ -21,12 +23,14 @@
 #ifndef MECHANICAL_ARM_PENGUIN_MINI_H
 #define MECHANICAL_ARM_PENGUIN_MINI_H
 
+#include "arm_dynamics.h"
 #include "mechanical_arm.h"
 #include "motor.h"
 #include "pid.h"
 #include "remote_control.h"
 #include "stdbool.h"
 #include "struct_typedef.h"
+#include "trajectory.h"
 #include "user_lib.h"
 
 #define MECHANICAL_ARM_STATE_CHANNEL 1  // 机械臂状态切换通道
@@ -96,6 +100,11 @@ typedef struct
 
     PID_t pid;  // PID控制器
 
+    TrajAxis_s traj[4];  // 关节0-3轨迹，以 ref.pos 为目标
+
+    ArmDynamics_s dynamics;  // 动力学模型
+    float feedforward[3];    // (N*m)关节0-2力矩前馈，关节2为小臂绝对角度对应的力矩
+
     struct FirstOrderFilter{
         LowPassFilter_t filter[5];
     } FirstOrderFilter;
@@ -19,8 +19,11 @@
 
 #include "attribute_typedef.h"
 #include "cmsis_os.h"
+#include "control_timer.h"
 #include "mechanical_arm_penguin_mini.h"
 #include "mechanical_arm_engineer.h"
+#include "mem_pool.h"
+#include "task_monitor.h"
 
 #ifndef MECHANICAL_ARM_TASK_INIT_TIME
 #define MECHANICAL_ARM_TASK_INIT_TIME 201
@@ -30,6 +33,10 @@
 #define MECHANICAL_ARM_CONTROL_TIME 1
 #endif  // MECHANICAL_ARM_CONTROL_TIME
 
+#ifndef MECHANICAL_ARM_CONTROL_PHASE
+#define MECHANICAL_ARM_CONTROL_PHASE 0  // (ms)控制周期内的释放相位偏移
+#endif  // MECHANICAL_ARM_CONTROL_PHASE
+
 #if INCLUDE_uxTaskGetStackHighWaterMark
 uint32_t mechanical_arm_high_water;
 #endif
@@ -54,8 +61,12 @@ void mechanical_arm_task(void const * pvParameters)
     vTaskDelay(MECHANICAL_ARM_TASK_INIT_TIME);
     // 初始化
     MechanicalArmInit();
+    mem_pool_init_release();
+    TaskMonitorRegister(MECHANICAL_ARM_CONTROL_TIME);
+    ControlTimerInit(CONTROL_TIMER_MECHANICAL_ARM, MECHANICAL_ARM_CONTROL_TIME, MECHANICAL_ARM_CONTROL_PHASE);
 
     while (1) {
+        TaskMonitorLoop();
         // 更新状态量
         MechanicalArmObserver();
         // 处理异常
@@ -70,7 +81,7 @@ void mechanical_arm_task(void const * pvParameters)
         MechanicalArmSendCmd();
 
         // 系统延时
-        vTaskDelay(MECHANICAL_ARM_CONTROL_TIME);
+        ControlTimerWait(CONTROL_TIMER_MECHANICAL_ARM);
 
 #if INCLUDE_uxTaskGetStackHighWaterMark
         mechanical_arm_high_water = uxTaskGetStackHighWaterMark(NULL);
@@ -0,0 +1,237 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       dynamics_test.c
+  * @brief      在PC上运行的机械臂逆动力学测试程序，与数值拉格朗日方程对比并统计单次计算耗时
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+    编译运行：
+      cc -O2 -I.. -I../../typedef -o dynamics_test dynamics_test.c ../arm_dynamics.c \
+        ../arm_kinematics.c -lm
+      ./dynamics_test
+    检查项(任一不满足返回非0)：
+      1. 随机关节角、速度、加速度下，ArmDynamicsUpdate 的力矩与参考值的误差小于 TORQUE_TOL
+         参考值用double由拉格朗日方程 tau = d/dt(dL/d(dq)) - dL/dq 数值求导得到，
+         动能由各质点的三维速度直接计算，与 arm_dynamics.c 中的闭式推导相互独立
+      2. 速度、加速度为0时总力矩等于重力矩
+    耗时：
+      三角函数缓存 + 逆动力学的单次耗时，PC上的耗时只用于比较，
+      C板上的周期数用 develop_task 中的 DEVELOP_ARM_DYNAMICS_BENCH 测量
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "arm_dynamics.h"
+
+#define TEST_NUM 10000
+#define BENCH_NUM 5000000
+#define TORQUE_TOL 2e-3f  // (N*m)
+#define DIFF_DQ 1e-2      // 动能对速度求导的步长，动能是速度的二次函数，没有截断误差
+#define DIFF_Q 1e-6       // (rad)对关节角求导的步长
+#define DIFF_T 1e-5       // (s)对时间求导的步长
+
+static const ArmDynamicsParam_s PARAM = {
+    .l1 = 0.35f,
+    .l2 = 0.30f,
+    .link1 = {1.2f, 0.15f, 0.015f},
+    .link2 = {0.8f, 0.12f, 0.008f},
+    .wrist_mass = 1.0f,
+    .tool_mass = 0.5f,
+    .tool_com = 0.08f,
+    .base_inertia = 0.02f,
+};
+
+static uint32_t SEED = 1;
+
+static fp32 Rand(fp32 min, fp32 max)
+{
+    SEED = SEED * 1664525u + 1013904223u;
+    return min + (max - min) * (SEED >> 8) / (fp32)(1u << 24);
+}
+
+static double Now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/*-------------------- double 参考模型 --------------------*/
+
+/**
+ * @brief 臂平面内的点：到J0轴线的水平距离rho和高度z，对q1 q2的偏导
+ */
+typedef struct
+{
+    double rho, z, drho[2], dz[2];
+} PlanePoint_s;
+
+static PlanePoint_s PlanePoint(const double q[5], double a, double b)
+{
+    // 点位于大臂上距J1为a处，再沿小臂距J2为b处(b=0且a<l1时在大臂上)
+    PlanePoint_s p;
+    double s1 = sin(q[1]), c1 = cos(q[1]), s12 = sin(q[1] + q[2]), c12 = cos(q[1] + q[2]);
+    p.rho = a * s1 + b * s12;
+    p.z = a * c1 + b * c12;
+    p.drho[0] = a * c1 + b * c12;
+    p.drho[1] = b * c12;
+    p.dz[0] = -a * s1 - b * s12;
+    p.dz[1] = -b * s12;
+    return p;
+}
+
+/**
+ * @brief 质点动能，位置 (-rho*cos(q0), -rho*sin(q0), z)
+ */
+static double PointEnergy(double m, PlanePoint_s p, const double q[5], const double dq[5])
+{
+    double c0 = cos(q[0]), s0 = sin(q[0]);
+    double drho = p.drho[0] * dq[1] + p.drho[1] * dq[2];
+    double vx = -drho * c0 + p.rho * s0 * dq[0];
+    double vy = -drho * s0 - p.rho * c0 * dq[0];
+    double vz = p.dz[0] * dq[1] + p.dz[1] * dq[2];
+    return 0.5 * m * (vx * vx + vy * vy + vz * vz);
+}
+
+static double Lagrangian(const double q[5], const double dq[5])
+{
+    const ArmDynamicsParam_s * p = &PARAM;
+    double m3 = p->wrist_mass + p->tool_mass;
+    PlanePoint_s p1 = PlanePoint(q, p->link1.com, 0);
+    PlanePoint_s p2 = PlanePoint(q, p->l1, p->link2.com);
+    PlanePoint_s p3 = PlanePoint(q, p->l1, p->l2);
+
+    double T = 0.5 * p->base_inertia * dq[0] * dq[0] + 0.5 * p->link1.inertia * dq[1] * dq[1] +
+               0.5 * p->link2.inertia * (dq[1] + dq[2]) * (dq[1] + dq[2]);
+    T += PointEnergy(p->link1.mass, p1, q, dq);
+    T += PointEnergy(p->link2.mass, p2, q, dq);
+    T += PointEnergy(m3, p3, q, dq);
+
+    // 末端轴线 = Rz(q0) Ry(-q12) Rz(q3) Ry(-q4) * ez 的z分量
+    double q12 = q[1] + q[2];
+    double ex = -cos(q[3]) * sin(q[4]);
+    double ez = cos(q[4]);
+    double axis_z = sin(q12) * ex + cos(q12) * ez;
+
+    double V = GRAVITY * (p->link1.mass * p1.z + p->link2.mass * p2.z + m3 * p3.z +
+                          p->tool_mass * p->tool_com * axis_z);
+    return T - V;
+}
+
+/**
+ * @brief 广义动量 dL/d(dq_i)
+ */
+static double Momentum(const double q[5], const double dq[5], int i)
+{
+    double a[5], b[5];
+    for (int k = 0; k < 5; k++) a[k] = b[k] = dq[k];
+    a[i] += DIFF_DQ;
+    b[i] -= DIFF_DQ;
+    return (Lagrangian(q, a) - Lagrangian(q, b)) / (2 * DIFF_DQ);
+}
+
+/**
+ * @brief 沿 q(t) = q + dq*t + ddq*t^2/2 在t=0处求 tau_i = d/dt(dL/d(dq_i)) - dL/dq_i
+ */
+static double RefTorque(const double q[5], const double dq[5], const double ddq[5], int i)
+{
+    double qa[5], qb[5], va[5], vb[5];
+    for (int k = 0; k < 5; k++) {
+        qa[k] = q[k] + dq[k] * DIFF_T + 0.5 * ddq[k] * DIFF_T * DIFF_T;
+        qb[k] = q[k] - dq[k] * DIFF_T + 0.5 * ddq[k] * DIFF_T * DIFF_T;
+        va[k] = dq[k] + ddq[k] * DIFF_T;
+        vb[k] = dq[k] - ddq[k] * DIFF_T;
+    }
+    double dp = (Momentum(qa, va, i) - Momentum(qb, vb, i)) / (2 * DIFF_T);
+
+    for (int k = 0; k < 5; k++) qa[k] = qb[k] = q[k];
+    qa[i] += DIFF_Q;
+    qb[i] -= DIFF_Q;
+    double dl = (Lagrangian(qa, dq) - Lagrangian(qb, dq)) / (2 * DIFF_Q);
+    return dp - dl;
+}
+
+static void TrigOf(const fp32 q[5], ArmKineTrig_s * trig)
+{
+    fp32 q6[ARM_KINE_JOINT_NUM] = {q[0], q[1], q[2], q[3], q[4], 0.0f};
+    ArmKineTrigUpdate(q6, trig);
+}
+
+int main(void)
+{
+    int fail = 0;
+    ArmDynamics_s dyn;
+    ArmKineTrig_s trig;
+    ArmDynamicsInit(&dyn, &PARAM);
+
+    // 1. 与拉格朗日方程对比
+    fp32 max_err = 0, max_tor = 0;
+    for (int n = 0; n < TEST_NUM; n++) {
+        fp32 q[5], dq[5], ddq[5];
+        double qd[5], dqd[5], ddqd[5];
+        q[0] = Rand(-3.0f, 3.0f);
+        q[1] = Rand(-1.5f, 1.5f);
+        q[2] = Rand(-2.6f, 2.6f);
+        q[3] = Rand(-3.0f, 3.0f);
+        q[4] = Rand(-1.4f, 1.4f);
+        for (int k = 0; k < 5; k++) {
+            dq[k] = Rand(-3.0f, 3.0f);
+            ddq[k] = Rand(-10.0f, 10.0f);
+            qd[k] = q[k];
+            dqd[k] = dq[k];
+            ddqd[k] = ddq[k];
+        }
+        // 模型不计J3 J4的惯性，参考值中令其速度、加速度为0，只比较重力矩
+        dqd[3] = dqd[4] = ddqd[3] = ddqd[4] = 0;
+        dq[3] = dq[4] = ddq[3] = ddq[4] = 0;
+
+        TrigOf(q, &trig);
+        ArmDynamicsUpdate(&dyn, &trig, dq, ddq);
+        for (int i = 0; i < 5; i++) {
+            fp32 ref = (fp32)RefTorque(qd, dqd, ddqd, i);
+            fp32 err = fabsf(dyn.torque[i] - ref);
+            if (err > max_err) max_err = err;
+            if (fabsf(ref) > max_tor) max_tor = fabsf(ref);
+        }
+    }
+    printf("lagrange: max torque %.3f N*m, max error %.2e N*m\n", max_tor, max_err);
+    if (max_err > TORQUE_TOL) fail = 1;
+
+    // 2. 静止时总力矩等于重力矩
+    {
+        fp32 q[5] = {0.3f, -0.7f, 1.1f, 0.5f, 0.9f}, zero[5] = {0};
+        TrigOf(q, &trig);
+        ArmDynamicsUpdate(&dyn, &trig, zero, NULL);
+        fp32 err = 0;
+        for (int i = 0; i < 5; i++) err = fmaxf(err, fabsf(dyn.torque[i] - dyn.gravity[i]));
+        printf("static: gravity J1 %.3f J2 %.3f N*m, error %.2e\n", dyn.gravity[1], dyn.gravity[2], err);
+        if (err > 0) fail = 1;
+    }
+
+    // 耗时
+    {
+        fp32 q[ARM_KINE_JOINT_NUM] = {0.3f, -0.7f, 1.1f, 0.5f, 0.9f, 0.0f};
+        fp32 dq[5] = {0.5f, -0.2f, 0.3f, 0, 0}, ddq[5] = {1.0f, 2.0f, -1.0f, 0, 0};
+        volatile fp32 sink = 0;
+        double t0 = Now();
+        for (int n = 0; n < BENCH_NUM; n++) {
+            q[1] += 1e-7f;
+            ArmKineTrigUpdate(q, &trig);
+            ArmDynamicsUpdate(&dyn, &trig, dq, ddq);
+            sink += dyn.torque[1];
+        }
+        double t1 = Now();
+        printf("update time: %.1f ns (trig + dynamics)\n", (t1 - t0) / BENCH_NUM * 1e9);
+    }
+
+    printf(fail ? "FAIL\n" : "PASS\n");
+    return fail;
+}
@@ -0,0 +1,292 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       kinematics_test.c
+  * @brief      在PC上运行的机械臂正逆运动学测试程序，检查解算精度并统计单次解算耗时
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+    编译运行：
+      cc -O2 -I.. -I../../typedef -o kinematics_test kinematics_test.c ../arm_kinematics.c -lm
+      ./kinematics_test
+    检查项(任一不满足返回非0)：
+      1. 查表sin/cos与sinf/cosf的最大误差小于1e-5
+      2. 关节空间网格(每个关节8个点，共8^6组)：正解得到位姿，从附近的关节角出发逆解，
+         逆解结果的位姿与目标一致，非奇异位置关节角与原值一致
+      3. 工作空间网格：逆解成功的目标位姿误差小于阈值，返回不可达的目标腕点确实超出臂展
+      4. 任何情况下输出都在关节限位内
+      5. 沿直线连续运动(经过手腕共轴位置)时关节角每步变化量有界
+    正运动学的参考值使用double和libm计算，与查表结果相互独立。
+    耗时：
+      PC上的耗时只用于比较，实际耗时需在C板上用DWT计数测量
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "arm_kinematics.h"
+
+#define H 0.10f
+#define L1 0.35f
+#define L2 0.30f
+#define L3 0.12f
+
+#define POS_TOL 1e-4f  // (m)
+#define ROT_TOL 2e-3f  // 旋转矩阵元素
+#define JOINT_TOL 2e-3f  // (rad)
+#define BENCH_NUM 1000000
+
+static const fp32 MIN[6] = {-1.6f, -1.5f, -2.6f, -3.0f, -1.4f, -3.0f};
+static const fp32 MAX[6] = {1.6f, 0.5f, 2.6f, 3.0f, 1.4f, 3.0f};
+
+static uint32_t SEED = 1;
+
+static fp32 Rand(fp32 min, fp32 max)
+{
+    SEED = SEED * 1664525u + 1013904223u;
+    return min + (max - min) * (SEED >> 8) / (fp32)(1u << 24);
+}
+
+static double Now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/*-------------------- double 参考模型 --------------------*/
+
+static void Zyz(double a, double b, double g, double M[3][3])
+{
+    double sa = sin(a), ca = cos(a), sb = sin(b), cb = cos(b), sg = sin(g), cg = cos(g);
+    M[0][0] = ca * cb * cg - sa * sg;
+    M[0][1] = -ca * cb * sg - sa * cg;
+    M[0][2] = ca * sb;
+    M[1][0] = sa * cb * cg + ca * sg;
+    M[1][1] = -sa * cb * sg + ca * cg;
+    M[1][2] = sa * sb;
+    M[2][0] = -sb * cg;
+    M[2][1] = sb * sg;
+    M[2][2] = cb;
+}
+
+static void RefForward(const fp32 q[6], double p[3], double R[3][3])
+{
+    double A[3][3], B[3][3];
+    Zyz(q[0], -(q[1] + q[2]), 0, A);
+    Zyz(q[3], -q[4], q[5], B);
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            R[i][j] = A[i][0] * B[0][j] + A[i][1] * B[1][j] + A[i][2] * B[2][j];
+        }
+    }
+    double xp = -(L1 * sin(q[1]) + L2 * sin(q[1] + q[2]));
+    p[0] = cos(q[0]) * xp + L3 * R[0][2];
+    p[1] = sin(q[0]) * xp + L3 * R[1][2];
+    p[2] = H + L1 * cos(q[1]) + L2 * cos(q[1] + q[2]) + L3 * R[2][2];
+}
+
+static void PoseToRef(const ArmPose_s * pose, double p[3], double R[3][3])
+{
+    p[0] = pose->x;
+    p[1] = pose->y;
+    p[2] = pose->z;
+    Zyz(pose->yaw, -pose->pitch, pose->roll, R);
+}
+
+/**
+ * @brief 关节角q对应的位姿与目标位姿的误差
+ */
+static void PoseError(const fp32 q[6], const ArmPose_s * pose, fp32 * pos_err, fp32 * rot_err)
+{
+    double p0[3], R0[3][3], p1[3], R1[3][3];
+    RefForward(q, p0, R0);
+    PoseToRef(pose, p1, R1);
+    double pe = 0, re = 0;
+    for (int i = 0; i < 3; i++) {
+        pe = fmax(pe, fabs(p0[i] - p1[i]));
+        for (int j = 0; j < 3; j++) re = fmax(re, fabs(R0[i][j] - R1[i][j]));
+    }
+    *pos_err = (fp32)pe;
+    *rot_err = (fp32)re;
+}
+
+static int InLimit(const fp32 q[6])
+{
+    for (int i = 0; i < 6; i++) {
+        if (q[i] < MIN[i] - 1e-6f || q[i] > MAX[i] + 1e-6f) return 0;
+    }
+    return 1;
+}
+
+int main(void)
+{
+    ArmKinematics_s kine;
+    int fail = 0;
+    ArmKinematicsInit(&kine, H, L1, L2, L3);
+    for (uint8_t i = 0; i < 6; i++) ArmKinematicsSetLimit(&kine, i, MIN[i], MAX[i]);
+
+    // 1. 查表精度
+    fp32 max_err = 0;
+    for (int i = 0; i < 100000; i++) {
+        fp32 a = Rand(-20.0f, 20.0f), s, c;
+        ArmKineSinCos(a, &s, &c);
+        fp32 err = fmaxf(fabsf(s - sinf(a)), fabsf(c - cosf(a)));
+        if (err > max_err) max_err = err;
+    }
+    printf("sin/cos table max error: %.2e\n", max_err);
+    if (max_err > 1e-5f) fail = 1;
+
+    // 2. 关节空间网格
+    {
+        const int N = 8;
+        uint32_t count = 0, not_ok = 0, joint_checked = 0;
+        fp32 max_pos = 0, max_rot = 0, max_joint = 0;
+        int idx[6] = {0};
+        while (idx[5] < N) {
+            fp32 q[6], q_now[6], q_out[6];
+            for (int i = 0; i < 6; i++) {
+                q[i] = MIN[i] + (MAX[i] - MIN[i]) * (idx[i] + 0.5f) / N;
+                q_now[i] = q[i] + Rand(-0.05f, 0.05f);
+            }
+            ArmPose_s pose;
+            ArmForward(&kine, q, &pose);
+            ArmKineResult_e result = ArmInverse(&kine, &pose, q_now, q_out);
+            count++;
+            if (result != ARM_KINE_OK) not_ok++;
+            if (!InLimit(q_out)) fail = 1;
+
+            fp32 pe, re;
+            PoseError(q_out, &pose, &pe, &re);
+            if (pe > max_pos) max_pos = pe;
+            if (re > max_rot) max_rot = re;
+
+            fp32 r = fabsf(L1 * sinf(q[1]) + L2 * sinf(q[1] + q[2]));
+            if (fabsf(sinf(q[4])) > 0.05f && fabsf(sinf(q[2])) > 0.05f && r > 0.02f) {
+                joint_checked++;
+                for (int i = 0; i < 6; i++) {
+                    fp32 d = fabsf(q_out[i] - q[i]);
+                    if (d > max_joint) max_joint = d;
+                }
+            }
+
+            for (int i = 0; i < 6; i++) {
+                if (++idx[i] < N || i == 5) break;
+                idx[i] = 0;
+            }
+        }
+        printf(
+            "joint grid: %u poses, %u not ok, max pos error %.2e m, max rot error %.2e\n", count,
+            not_ok, max_pos, max_rot);
+        printf("joint grid: %u non-singular poses, max joint error %.2e rad\n", joint_checked, max_joint);
+        if (not_ok > 0 || max_pos > POS_TOL || max_rot > ROT_TOL || max_joint > JOINT_TOL) fail = 1;
+    }
+
+    // 3. 工作空间网格
+    {
+        static const fp32 PITCH[4] = {-1.5708f, -0.7854f, -2.3562f, 0.0f};
+        uint32_t ok = 0, limited = 0, unreachable = 0, wrong_unreachable = 0;
+        fp32 max_pos = 0, max_rot = 0;
+        const fp32 q_home[6] = {0.0f, -0.6f, -1.2f, 0.0f, 0.3f, 0.0f};
+        for (fp32 x = -0.4f; x <= 0.9f; x += 0.02f) {
+            for (fp32 y = -0.6f; y <= 0.6f; y += 0.02f) {
+                for (fp32 z = -0.4f; z <= 0.9f; z += 0.02f) {
+                    for (int k = 0; k < 4; k++) {
+                        ArmPose_s pose = {x, y, z, atan2f(y, x), PITCH[k], 0.3f};
+                        fp32 q_out[6];
+                        ArmKineResult_e result = ArmInverse(&kine, &pose, q_home, q_out);
+                        if (!InLimit(q_out)) fail = 1;
+
+                        if (result == ARM_KINE_OK) {
+                            ok++;
+                            fp32 pe, re;
+                            PoseError(q_out, &pose, &pe, &re);
+                            if (pe > max_pos) max_pos = pe;
+                            if (re > max_rot) max_rot = re;
+                        } else if (result == ARM_KINE_LIMITED) {
+                            limited++;
+                        } else {
+                            unreachable++;
+                            double p[3], R[3][3];
+                            PoseToRef(&pose, p, R);
+                            double wx = p[0] - L3 * R[0][2], wy = p[1] - L3 * R[1][2];
+                            double wz = p[2] - L3 * R[2][2] - H;
+                            double d = sqrt(wx * wx + wy * wy + wz * wz);
+                            if (d < L1 + L2 - 1e-4 && d > fabs(L1 - L2) + 1e-4) wrong_unreachable++;
+                        }
+                    }
+                }
+            }
+        }
+        printf(
+            "workspace grid: %u ok, %u limited, %u unreachable (%u wrong), max pos error %.2e m, "
+            "max rot error %.2e\n",
+            ok, limited, unreachable, wrong_unreachable, max_pos, max_rot);
+        if (wrong_unreachable > 0 || max_pos > POS_TOL || max_rot > ROT_TOL) fail = 1;
+    }
+
+    // 5. 连续运动，末端从斜下方移到正前方，q4经过0
+    {
+        const fp32 q_a[6] = {-0.8f, -0.9f, -1.0f, 0.4f, 0.6f, 0.2f};
+        const fp32 q_b[6] = {0.7f, -0.5f, -0.8f, 0.4f, -0.5f, -0.4f};
+        ArmPose_s pa, pb;
+        ArmForward(&kine, q_a, &pa);
+        ArmForward(&kine, q_b, &pb);
+        fp32 q[6], max_step = 0;
+        for (int i = 0; i < 6; i++) q[i] = q_a[i];
+        const int STEP = 2000;
+        for (int n = 1; n <= STEP; n++) {
+            fp32 k = (fp32)n / STEP;
+            ArmPose_s pose = {
+                pa.x + (pb.x - pa.x) * k,         pa.y + (pb.y - pa.y) * k,
+                pa.z + (pb.z - pa.z) * k,         pa.yaw + (pb.yaw - pa.yaw) * k,
+                pa.pitch + (pb.pitch - pa.pitch) * k, pa.roll + (pb.roll - pa.roll) * k};
+            fp32 q_out[6];
+            ArmInverse(&kine, &pose, q, q_out);
+            for (int i = 0; i < 6; i++) {
+                fp32 d = fabsf(q_out[i] - q[i]);
+                if (d > max_step) max_step = d;
+                q[i] = q_out[i];
+            }
+        }
+        printf("continuous path: max joint step %.4f rad\n", max_step);
+        if (max_step > 0.05f) fail = 1;
+    }
+
+    // 耗时
+    {
+        static ArmPose_s poses[1024];
+        static fp32 qs[1024][6];
+        for (int n = 0; n < 1024; n++) {
+            for (int i = 0; i < 6; i++) qs[n][i] = Rand(MIN[i], MAX[i]);
+            ArmForward(&kine, qs[n], &poses[n]);
+        }
+        volatile fp32 sink = 0;
+        ArmPose_s pose;
+        fp32 q_out[6];
+
+        double t0 = Now();
+        for (int n = 0; n < BENCH_NUM; n++) {
+            ArmForward(&kine, qs[n & 1023], &pose);
+            sink += pose.x;
+        }
+        double t1 = Now();
+        for (int n = 0; n < BENCH_NUM; n++) {
+            ArmInverse(&kine, &poses[n & 1023], qs[(n + 1) & 1023], q_out);
+            sink += q_out[0];
+        }
+        double t2 = Now();
+        printf(
+            "solve time: forward %.1f ns, inverse %.1f ns\n", (t1 - t0) / BENCH_NUM * 1e9,
+            (t2 - t1) / BENCH_NUM * 1e9);
+    }
+
+    printf(fail ? "FAIL\n" : "PASS\n");
+    return fail;
+}
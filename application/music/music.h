@@ -3,6 +3,6 @@
 
 #include "struct_typedef.h"
 #define MUSIC_TASK_INIT_TIME 10
-#define MUSIC_TASK_TIME_MS 1
+#define MUSIC_TASK_TIME_MS 10  // 音符切换在定时器中断中完成，任务只需低频检查报警状态
 
 #endif  // MUSIC_H
@@ -0,0 +1,415 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       music_data.c/h
+  * @brief      压缩格式的音乐数据，由 tools/music_convert.py 生成，请勿手动修改
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include "music_data.h"
+
+// clang-format off
+/*-------------------- START --------------------*/
+// 8 notes, 36 bytes of flash, replaces a 108-byte RAM note table
+static const uint16_t START_PITCH[] = {
+    0, 262, 659, 1568, 1047,
+};  // Hz
+static const uint16_t START_DURATION[] = {
+    2, 200, 3, 15, 500,
+};  // ms
+static const uint8_t START_STREAM[] = {
+    0, 0, 1, 1, 0, 2, 2, 1, 0, 2, 3, 1, 0, 3, 4, 4,
+};
+const MusicData_s MUSIC_DATA_START = {START_PITCH, START_DURATION, START_STREAM, 8};
+
+/*-------------------- MOTOR_OFFLINE --------------------*/
+// 8 notes, 28 bytes of flash, replaces a 108-byte RAM note table
+static const uint16_t MOTOR_OFFLINE_PITCH[] = {
+    1000, 0, 350,
+};  // Hz
+static const uint16_t MOTOR_OFFLINE_DURATION[] = {
+    30, 100, 70,
+};  // ms
+static const uint8_t MOTOR_OFFLINE_STREAM[] = {
+    0, 0, 1, 1, 2, 2, 1, 2, 2, 2, 1, 1, 0, 0, 1, 1,
+};
+const MusicData_s MUSIC_DATA_MOTOR_OFFLINE = {MOTOR_OFFLINE_PITCH, MOTOR_OFFLINE_DURATION, MOTOR_OFFLINE_STREAM, 8};
+
+/*-------------------- RC_OFFLINE --------------------*/
+// 4 notes, 18 bytes of flash, replaces a 60-byte RAM note table
+static const uint16_t RC_OFFLINE_PITCH[] = {
+    1200, 400, 0,
+};  // Hz
+static const uint16_t RC_OFFLINE_DURATION[] = {
+    100, 400,
+};  // ms
+static const uint8_t RC_OFFLINE_STREAM[] = {
+    0, 0, 1, 1, 0, 0, 2, 0,
+};
+const MusicData_s MUSIC_DATA_RC_OFFLINE = {RC_OFFLINE_PITCH, RC_OFFLINE_DURATION, RC_OFFLINE_STREAM, 4};
+
+/*-------------------- YOU --------------------*/
+// 482 notes, 1012 bytes of flash, replaces a 5796-byte RAM note table
+static const uint16_t YOU_PITCH[] = {
+    494, 392, 587, 523, 294, 330, 0, 262, 247, 220, 196, 349,
+    440,
+};  // Hz
+static const uint16_t YOU_DURATION[] = {
+    200, 400, 1200, 800, 1600, 2000, 40, 600, 1000, 0, 2400,
+};  // ms
+static const uint8_t YOU_STREAM[] = {
+    0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 1, 0, 2, 1, 1, 0,
+    3, 0, 255, 1, 1, 0, 0, 0, 3, 0, 0, 0, 1, 0, 0, 1,
+    1, 0, 0, 1, 1, 0, 2, 1, 1, 0, 3, 0, 255, 1, 1, 0,
+    0, 0, 3, 0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 1, 0,
+    2, 1, 1, 0, 3, 0, 255, 1, 1, 0, 0, 0, 3, 0, 0, 0,
+    1, 0, 0, 1, 1, 0, 0, 1, 1, 0, 2, 1, 1, 0, 3, 0,
+    255, 1, 1, 0, 4, 1, 5, 2, 4, 1, 5, 1, 4, 1, 5, 1,
+    1, 3, 3, 3, 0, 3, 5, 3, 4, 1, 5, 2, 4, 1, 5, 1,
+    4, 1, 5, 1, 3, 4, 0, 1, 2, 3, 5, 5, 4, 1, 5, 1,
+    4, 1, 5, 1, 0, 3, 3, 3, 0, 3, 5, 3, 4, 1, 5, 2,
+    4, 1, 5, 1, 4, 1, 5, 1, 0, 3, 3, 3, 2, 5, 6, 3,
+    5, 1, 6, 6, 5, 1, 4, 0, 5, 7, 4, 1, 5, 1, 1, 1,
+    6, 1, 5, 1, 6, 6, 5, 1, 4, 0, 5, 7, 4, 1, 5, 1,
+    1, 3, 7, 2, 6, 1, 5, 1, 6, 6, 5, 1, 4, 0, 5, 7,
+    4, 1, 7, 1, 4, 1, 6, 1, 5, 1, 6, 6, 5, 1, 4, 0,
+    5, 7, 4, 1, 5, 1, 1, 1, 6, 1, 5, 1, 6, 6, 5, 1,
+    4, 0, 5, 7, 4, 1, 5, 1, 3, 3, 7, 2, 6, 1, 5, 1,
+    6, 6, 5, 1, 4, 0, 5, 7, 4, 1, 8, 1, 9, 0, 10, 8,
+    6, 0, 10, 0, 6, 6, 10, 0, 6, 6, 10, 0, 1, 3, 5, 7,
+    4, 0, 7, 1, 6, 6, 7, 3, 6, 0, 7, 1, 6, 9, 7, 1,
+    4, 1, 5, 1, 9, 2, 6, 1, 9, 1, 5, 1, 4, 1, 7, 1,
+    4, 2, 6, 1, 5, 3, 11, 3, 1, 2, 5, 1, 1, 1, 5, 0,
+    1, 7, 0, 3, 3, 2, 7, 1, 4, 1, 5, 1, 1, 3, 12, 3,
+    1, 0, 12, 7, 1, 0, 6, 9, 1, 7, 6, 9, 1, 3, 4, 4,
+    5, 3, 11, 3, 1, 2, 5, 1, 1, 1, 5, 0, 1, 7, 0, 3,
+    3, 2, 7, 1, 4, 1, 5, 1, 0, 3, 12, 2, 6, 6, 12, 1,
+    1, 0, 12, 7, 3, 3, 2, 2, 6, 1, 1, 1, 3, 1, 0, 0,
+    3, 10, 6, 3, 6, 1, 5, 1, 6, 6, 5, 1, 4, 0, 5, 7,
+    4, 1, 5, 1, 1, 1, 6, 1, 5, 1, 6, 6, 5, 1, 4, 0,
+    5, 7, 4, 1, 5, 1, 1, 3, 7, 2, 6, 1, 5, 1, 6, 6,
+    5, 1, 4, 0, 5, 7, 4, 1, 7, 1, 4, 1, 6, 1, 5, 1,
+    255, 1, 4, 0, 5, 7, 4, 1, 5, 1, 1, 1, 6, 1, 5, 1,
+    6, 6, 5, 1, 4, 0, 5, 7, 4, 1, 5, 1, 3, 3, 7, 2,
+    6, 1, 5, 1, 255, 1, 4, 0, 5, 7, 4, 1, 8, 1, 9, 0,
+    10, 8, 6, 0, 10, 0, 6, 6, 10, 0, 6, 6, 10, 0, 1, 3,
+    5, 7, 4, 0, 7, 1, 6, 6, 7, 3, 6, 0, 7, 1, 6, 6,
+    7, 1, 4, 1, 5, 1, 9, 2, 6, 1, 9, 1, 5, 1, 4, 1,
+    7, 1, 4, 5, 6, 3, 5, 3, 11, 3, 1, 2, 5, 1, 1, 1,
+    5, 0, 1, 7, 0, 3, 3, 2, 7, 1, 4, 1, 5, 1, 1, 3,
+    12, 8, 1, 0, 12, 1, 1, 0, 6, 6, 1, 7, 6, 9, 4, 1,
+    6, 9, 4, 4, 5, 3, 11, 3, 1, 3, 6, 9, 1, 1, 5, 0,
+    1, 7, 2, 3, 3, 2, 7, 1, 4, 1, 5, 1, 3, 3, 12, 8,
+    1, 0, 12, 1, 1, 0, 12, 7, 3, 3, 2, 2, 6, 1, 4, 1,
+    5, 1, 4, 0, 7, 10, 6, 3, 5, 3, 11, 3, 1, 2, 5, 1,
+    1, 1, 5, 0, 1, 7, 0, 3, 3, 2, 7, 1, 4, 1, 5, 1,
+    1, 3, 12, 8, 1, 0, 12, 1, 1, 0, 6, 9, 1, 7, 6, 9,
+    1, 3, 4, 4, 5, 3, 11, 3, 1, 2, 5, 1, 1, 1, 5, 0,
+    1, 7, 0, 3, 3, 2, 7, 1, 4, 1, 5, 1, 3, 3, 12, 2,
+    6, 6, 12, 1, 1, 0, 12, 7, 3, 3, 2, 2, 5, 3, 11, 3,
+    1, 2, 5, 1, 1, 1, 5, 0, 1, 7, 0, 3, 3, 2, 7, 1,
+    4, 1, 5, 1, 1, 3, 12, 8, 1, 0, 12, 1, 1, 0, 6, 9,
+    1, 7, 6, 9, 1, 3, 4, 4, 5, 3, 11, 3, 1, 3, 6, 0,
+    1, 1, 5, 0, 1, 7, 2, 3, 3, 2, 7, 1, 4, 1, 5, 1,
+    3, 3, 12, 8, 1, 0, 12, 1, 1, 0, 12, 7, 3, 3, 2, 2,
+    6, 1, 1, 1, 3, 1, 0, 0, 3, 10, 6, 3, 5, 3, 4, 3,
+    7, 3, 1, 3, 7, 3, 4, 3, 5, 3, 11, 3, 1, 3, 11, 3,
+    5, 3, 4, 3, 7, 3, 4, 3, 5, 3, 11, 3, 5, 3, 4, 3,
+    7, 3, 1, 3, 5, 3, 4, 3, 5, 3, 11, 3, 1, 3, 11, 3,
+    5, 3, 4, 3, 5, 3, 4, 3, 5, 3, 11, 3, 5, 3, 4, 3,
+    7, 3, 1, 3, 7, 3, 4, 3, 5, 3, 11, 3, 1, 3, 11, 3,
+    5, 3, 4, 3,
+};
+const MusicData_s MUSIC_DATA_YOU = {YOU_PITCH, YOU_DURATION, YOU_STREAM, 482};
+
+/*-------------------- UNITY --------------------*/
+// 171 notes, 362 bytes of flash, replaces a 2064-byte RAM note table
+static const uint16_t UNITY_PITCH[] = {
+    1319, 1175, 1047, 880, 784, 0, 440, 523, 587, 659, 1760, 1568,
+};  // Hz
+static const uint16_t UNITY_DURATION[] = {
+    50, 300, 800, 500, 400, 350, 100,
+};  // ms
+static const uint8_t UNITY_STREAM[] = {
+    0, 0, 1, 1, 2, 0, 3, 1, 4, 0, 3, 2, 0, 0, 1, 1,
+    2, 0, 3, 1, 4, 0, 3, 2, 0, 0, 1, 1, 2, 0, 3, 1,
+    4, 0, 3, 3, 2, 4, 1, 4, 0, 4, 1, 4, 5, 1, 0, 0,
+    1, 1, 2, 0, 3, 1, 4, 0, 3, 2, 0, 0, 1, 1, 2, 0,
+    3, 1, 4, 0, 3, 2, 6, 0, 7, 1, 8, 0, 9, 1, 4, 0,
+    3, 3, 4, 4, 3, 4, 2, 4, 1, 4, 5, 1, 0, 0, 1, 1,
+    2, 0, 3, 1, 4, 0, 3, 2, 0, 0, 1, 1, 2, 0, 3, 1,
+    4, 0, 3, 2, 0, 0, 1, 1, 2, 0, 3, 1, 4, 0, 3, 3,
+    2, 4, 1, 4, 0, 4, 1, 4, 5, 1, 0, 0, 1, 1, 2, 0,
+    3, 1, 4, 0, 3, 2, 0, 0, 1, 1, 2, 0, 3, 1, 4, 0,
+    3, 2, 6, 0, 7, 1, 8, 0, 9, 1, 4, 0, 3, 3, 4, 4,
+    3, 4, 2, 4, 1, 4, 5, 5, 9, 4, 5, 5, 3, 4, 255, 2,
+    3, 1, 4, 6, 3, 1, 2, 6, 3, 4, 4, 4, 9, 4, 3, 4,
+    255, 2, 3, 1, 4, 6, 3, 1, 10, 6, 11, 4, 0, 4, 1, 4,
+    0, 4, 255, 2, 0, 1, 1, 6, 0, 1, 11, 6, 0, 4, 1, 4,
+    2, 4, 0, 4, 255, 2, 0, 1, 1, 6, 0, 1, 11, 6, 0, 4,
+    1, 4, 2, 4, 3, 4, 255, 2, 3, 1, 4, 6, 3, 1, 2, 6,
+    3, 4, 4, 4, 9, 4, 3, 4, 255, 2, 3, 1, 4, 6, 3, 1,
+    10, 6, 11, 4, 0, 4, 1, 4, 0, 4, 255, 1, 0, 1, 1, 6,
+    2, 1, 1, 6, 0, 4, 255, 1, 0, 1, 1, 6, 2, 1, 1, 6,
+    0, 4, 255, 4,
+};
+const MusicData_s MUSIC_DATA_UNITY = {UNITY_PITCH, UNITY_DURATION, UNITY_STREAM, 171};
+
+/*-------------------- CANON --------------------*/
+// 212 notes, 464 bytes of flash, replaces a 2556-byte RAM note table
+static const uint16_t CANON_PITCH[] = {
+    987, 587, 783, 1174, 1318, 1109, 1760, 1479, 1568, 739, 880, 648,
+    294, 440, 493, 370, 391,
+};  // Hz
+static const uint16_t CANON_DURATION[] = {
+    200, 400, 600,
+};  // ms
+static const uint8_t CANON_STREAM[] = {
+    0, 0, 1, 1, 1, 0, 2, 0, 0, 0, 3, 0, 4, 0, 5, 2,
+    3, 2, 4, 0, 3, 0, 6, 1, 7, 0, 8, 0, 6, 1, 7, 0,
+    8, 0, 6, 0, 5, 0, 0, 0, 5, 0, 3, 0, 4, 0, 7, 0,
+    8, 0, 7, 1, 3, 0, 4, 0, 7, 1, 9, 0, 2, 0, 10, 0,
+    0, 0, 10, 0, 2, 0, 10, 0, 3, 0, 5, 0, 3, 0, 0, 1,
+    3, 0, 5, 0, 0, 1, 10, 0, 2, 0, 10, 0, 2, 0, 9, 0,
+    2, 0, 10, 0, 0, 0, 5, 0, 3, 0, 0, 1, 3, 0, 5, 0,
+    3, 1, 5, 0, 3, 0, 5, 0, 0, 0, 5, 0, 3, 0, 4, 0,
+    7, 0, 8, 0, 6, 0, 6, 1, 7, 0, 8, 0, 6, 1, 7, 0,
+    8, 0, 6, 0, 5, 0, 0, 0, 5, 0, 3, 0, 4, 0, 7, 0,
+    8, 0, 7, 1, 3, 0, 4, 0, 7, 1, 9, 0, 2, 0, 10, 0,
+    0, 0, 10, 0, 2, 0, 10, 0, 3, 0, 5, 0, 3, 0, 0, 1,
+    3, 0, 5, 0, 0, 1, 10, 0, 2, 0, 10, 0, 2, 0, 9, 0,
+    2, 0, 10, 0, 0, 0, 5, 0, 3, 0, 0, 1, 3, 0, 5, 0,
+    3, 1, 5, 0, 3, 0, 10, 0, 0, 0, 5, 0, 3, 0, 4, 0,
+    7, 0, 8, 0, 6, 0, 6, 1, 3, 0, 4, 0, 7, 1, 4, 0,
+    3, 0, 4, 0, 5, 0, 3, 0, 4, 0, 7, 0, 4, 0, 3, 0,
+    5, 0, 3, 1, 0, 0, 5, 0, 3, 1, 1, 0, 11, 0, 9, 0,
+    2, 0, 9, 0, 11, 0, 9, 0, 3, 0, 5, 0, 3, 0, 0, 1,
+    3, 0, 5, 0, 0, 1, 10, 0, 2, 0, 10, 0, 2, 0, 9, 0,
+    2, 0, 10, 0, 0, 0, 5, 0, 3, 0, 0, 1, 3, 0, 5, 0,
+    3, 1, 5, 0, 0, 0, 5, 0, 3, 0, 4, 0, 3, 0, 5, 0,
+    3, 0, 0, 0, 5, 0, 3, 0, 12, 0, 13, 1, 1, 1, 9, 1,
+    13, 1, 11, 1, 10, 1, 5, 1, 14, 1, 9, 1, 0, 1, 3, 1,
+    15, 1, 10, 1, 5, 1, 7, 1, 16, 1, 1, 1, 2, 1, 0, 1,
+    12, 1, 9, 1, 10, 1, 3, 1, 16, 1, 2, 1, 0, 1, 3, 1,
+    13, 1, 11, 1, 10, 1, 5, 1,
+};
+const MusicData_s MUSIC_DATA_CANON = {CANON_PITCH, CANON_DURATION, CANON_STREAM, 212};
+
+/*-------------------- CASTLE_IN_THE_SKY --------------------*/
+// 311 notes, 676 bytes of flash, replaces a 3744-byte RAM note table
+static const uint16_t CASTLE_IN_THE_SKY_PITCH[] = {
+    0, 880, 988, 1046, 1318, 659, 784, 698, 740, 1175, 831, 1480,
+    1760, 1568,
+};  // Hz
+static const uint16_t CASTLE_IN_THE_SKY_DURATION[] = {
+    1000, 200, 128, 600, 400, 1200, 800, 64, 20, 328, 528, 928,
+    1600,
+};  // ms
+static const uint8_t CASTLE_IN_THE_SKY_STREAM[] = {
+    0, 0, 1, 1, 2, 1, 0, 2, 3, 3, 2, 1, 0, 2, 3, 4,
+    0, 2, 4, 4, 0, 2, 2, 5, 0, 2, 5, 1, 255, 1, 1, 3,
+    6, 1, 0, 2, 1, 4, 0, 2, 3, 4, 0, 2, 6, 6, 0, 2,
+    0, 4, 5, 1, 0, 7, 5, 1, 0, 7, 7, 3, 5, 1, 0, 2,
+    7, 1, 3, 3, 0, 2, 5, 6, 0, 2, 0, 1, 3, 1, 0, 7,
+    3, 1, 0, 7, 3, 1, 0, 7, 2, 3, 8, 1, 0, 2, 8, 4,
+    2, 4, 0, 2, 2, 6, 0, 2, 0, 4, 1, 1, 2, 1, 0, 2,
+    3, 3, 2, 1, 0, 2, 3, 4, 0, 2, 4, 4, 0, 2, 2, 6,
+    0, 2, 0, 4, 5, 1, 0, 8, 5, 1, 0, 2, 1, 3, 6, 1,
+    0, 2, 1, 4, 0, 2, 3, 4, 0, 2, 6, 5, 0, 9, 5, 1,
+    0, 7, 7, 4, 0, 2, 3, 1, 2, 1, 0, 8, 2, 4, 0, 2,
+    3, 4, 0, 2, 9, 1, 0, 8, 9, 1, 0, 8, 4, 1, 0, 7,
+    3, 4, 0, 10, 3, 4, 2, 1, 0, 2, 1, 1, 0, 8, 1, 1,
+    0, 2, 2, 4, 0, 2, 10, 4, 0, 2, 10, 6, 0, 10, 3, 1,
+    9, 1, 0, 2, 4, 3, 9, 1, 0, 2, 4, 4, 0, 2, 11, 4,
+    0, 2, 9, 6, 0, 10, 6, 1, 0, 8, 6, 1, 0, 2, 3, 1,
+    2, 1, 0, 2, 3, 4, 0, 2, 4, 4, 0, 2, 4, 6, 0, 11,
+    1, 1, 2, 1, 0, 2, 3, 4, 0, 2, 2, 4, 0, 2, 9, 1,
+    0, 8, 9, 1, 0, 2, 3, 3, 6, 1, 0, 8, 6, 4, 0, 10,
+    11, 4, 0, 2, 4, 4, 0, 2, 9, 4, 0, 2, 3, 4, 0, 2,
+    4, 12, 4, 6, 0, 10, 4, 4, 0, 2, 12, 6, 0, 2, 13, 4,
+    0, 2, 13, 4, 0, 2, 4, 1, 0, 7, 9, 1, 0, 2, 3, 4,
+    0, 9, 3, 1, 0, 2, 9, 4, 0, 2, 3, 1, 9, 1, 0, 8,
+    9, 1, 0, 2, 13, 4, 0, 2, 4, 6, 0, 10, 5, 4, 0, 2,
+    12, 6, 0, 2, 13, 6, 0, 2, 4, 1, 9, 1, 0, 2, 3, 6,
+    0, 9, 3, 1, 0, 2, 9, 4, 0, 2, 3, 1, 9, 1, 0, 8,
+    9, 1, 0, 2, 2, 4, 0, 2, 1, 6, 0, 2, 1, 1, 2, 1,
+    3, 3, 2, 1, 0, 2, 3, 4, 0, 2, 4, 4, 0, 2, 2, 5,
+    0, 2, 5, 1, 255, 1, 1, 3, 6, 1, 0, 2, 1, 4, 0, 2,
+    3, 4, 0, 2, 6, 6, 0, 2, 0, 4, 5, 1, 0, 7, 5, 1,
+    0, 7, 7, 3, 5, 1, 0, 2, 7, 1, 3, 3, 0, 2, 5, 6,
+    0, 2, 0, 1, 3, 1, 0, 7, 3, 1, 0, 7, 3, 1, 0, 7,
+    2, 3, 8, 1, 0, 2, 8, 4, 2, 4, 0, 2, 2, 6, 0, 2,
+    0, 4, 1, 1, 2, 1, 0, 2, 3, 3, 2, 1, 0, 2, 3, 4,
+    0, 2, 4, 4, 0, 2, 2, 6, 0, 2, 0, 4, 5, 1, 0, 8,
+    5, 1, 0, 2, 1, 3, 6, 1, 0, 2, 1, 4, 0, 2, 3, 4,
+    0, 2, 6, 5, 0, 9, 5, 1, 0, 7, 7, 4, 0, 2, 3, 1,
+    2, 1, 0, 8, 2, 4, 0, 2, 3, 4, 0, 2, 9, 1, 0, 8,
+    9, 1, 0, 8, 4, 1, 0, 7, 3, 4, 0, 10, 1, 12,
+};
+const MusicData_s MUSIC_DATA_CASTLE_IN_THE_SKY = {CASTLE_IN_THE_SKY_PITCH, CASTLE_IN_THE_SKY_DURATION, CASTLE_IN_THE_SKY_STREAM, 311};
+
+/*-------------------- SEE_YOU_AGAIN --------------------*/
+// 205 notes, 432 bytes of flash, replaces a 2472-byte RAM note table
+static const uint16_t SEE_YOU_AGAIN_PITCH[] = {
+    0, 587, 880, 784, 988, 392, 494, 659, 440, 698,
+};  // Hz
+static const uint16_t SEE_YOU_AGAIN_DURATION[] = {
+    500, 125, 63, 375, 250, 188, 200, 693, 630, 441,
+};  // ms
+static const uint8_t SEE_YOU_AGAIN_STREAM[] = {
+    0, 0, 1, 1, 2, 1, 3, 1, 1, 1, 255, 1, 3, 2, 2, 2,
+    4, 2, 2, 2, 3, 2, 2, 2, 1, 1, 2, 1, 3, 1, 1, 1,
+    255, 1, 3, 2, 2, 2, 4, 2, 2, 2, 3, 2, 2, 2, 1, 1,
+    2, 1, 3, 1, 1, 1, 255, 1, 3, 2, 2, 2, 4, 2, 2, 2,
+    3, 2, 2, 2, 1, 1, 2, 1, 3, 1, 1, 1, 255, 1, 5, 1,
+    6, 1, 1, 1, 7, 3, 1, 1, 1, 4, 0, 5, 1, 2, 8, 1,
+    255, 1, 5, 1, 8, 1, 6, 4, 0, 1, 6, 2, 1, 2, 7, 1,
+    9, 1, 7, 1, 1, 1, 6, 1, 8, 1, 255, 3, 5, 1, 0, 4,
+    0, 2, 5, 2, 6, 2, 1, 2, 7, 3, 1, 1, 1, 4, 0, 5,
+    1, 2, 8, 1, 255, 1, 5, 1, 6, 1, 0, 4, 8, 2, 6, 2,
+    1, 1, 7, 1, 3, 1, 2, 1, 4, 1, 2, 1, 3, 1, 1, 2,
+    7, 2, 3, 2, 4, 1, 255, 2, 2, 1, 0, 4, 1, 2, 7, 2,
+    3, 2, 4, 1, 255, 2, 2, 1, 0, 4, 255, 1, 0, 6, 0, 4,
+    255, 2, 3, 2, 255, 2, 4, 2, 255, 1, 3, 7, 7, 3, 4, 2,
+    3, 1, 3, 8, 7, 3, 7, 1, 4, 2, 3, 9, 3, 1, 5, 1,
+    6, 1, 1, 1, 7, 3, 1, 1, 1, 4, 0, 5, 5, 1, 8, 1,
+    255, 1, 5, 1, 8, 1, 6, 4, 0, 1, 6, 2, 1, 2, 7, 1,
+    9, 1, 7, 1, 1, 1, 6, 1, 8, 1, 255, 1, 5, 1, 8, 1,
+    255, 2, 5, 1, 0, 4, 0, 2, 5, 2, 6, 2, 1, 2, 7, 3,
+    1, 1, 1, 4, 0, 5, 1, 2, 8, 1, 255, 1, 5, 1, 6, 1,
+    0, 4, 8, 2, 6, 2, 1, 1, 7, 1, 3, 1, 2, 1, 4, 1,
+    2, 1, 3, 1, 1, 2, 7, 2, 3, 2, 4, 1, 255, 2, 2, 1,
+    0, 4, 1, 2, 7, 2, 3, 2, 4, 1, 255, 2, 2, 1, 0, 4,
+    3, 1, 9, 1, 7, 3, 1, 3, 3, 1, 9, 1, 7, 5, 9, 2,
+    7, 1, 1, 1, 6, 4, 0, 4,
+};
+const MusicData_s MUSIC_DATA_SEE_YOU_AGAIN = {SEE_YOU_AGAIN_PITCH, SEE_YOU_AGAIN_DURATION, SEE_YOU_AGAIN_STREAM, 205};
+
+/*-------------------- HAO_YUN_LAI --------------------*/
+// 137 notes, 314 bytes of flash, replaces a 1656-byte RAM note table
+static const uint16_t HAO_YUN_LAI_PITCH[] = {
+    494, 740, 660, 588, 440, 330, 370, 294, 0,
+};  // Hz
+static const uint16_t HAO_YUN_LAI_DURATION[] = {
+    250, 125, 375, 500, 376, 625, 1000, 63, 313, 251, 688,
+};  // ms
+static const uint8_t HAO_YUN_LAI_STREAM[] = {
+    0, 0, 1, 1, 2, 2, 3, 1, 0, 1, 4, 0, 3, 1, 2, 1,
+    0, 3, 0, 0, 2, 0, 3, 0, 0, 1, 4, 1, 5, 0, 4, 1,
+    0, 1, 6, 3, 6, 0, 0, 1, 4, 1, 0, 2, 4, 1, 0, 0,
+    2, 1, 3, 1, 2, 3, 3, 4, 2, 1, 1, 0, 2, 1, 3, 1,
+    4, 0, 3, 1, 0, 5, 0, 6, 0, 7, 4, 7, 6, 1, 5, 8,
+    7, 7, 5, 7, 6, 7, 4, 0, 4, 7, 5, 7, 6, 1, 4, 1,
+    0, 8, 6, 1, 4, 1, 0, 1, 3, 0, 3, 7, 0, 7, 3, 7,
+    2, 7, 1, 0, 8, 1, 1, 0, 8, 7, 0, 9, 3, 0, 0, 3,
+    4, 1, 6, 1, 4, 1, 3, 1, 0, 3, 0, 1, 3, 10, 0, 1,
+    4, 0, 0, 1, 4, 1, 5, 1, 4, 1, 6, 3, 6, 1, 5, 1,
+    7, 1, 6, 1, 5, 2, 6, 1, 0, 1, 4, 1, 6, 1, 0, 1,
+    4, 3, 0, 1, 3, 8, 0, 7, 2, 2, 3, 1, 0, 3, 4, 0,
+    3, 0, 0, 6, 8, 7, 0, 9, 3, 0, 0, 3, 4, 1, 6, 1,
+    4, 1, 3, 1, 0, 3, 0, 1, 3, 10, 0, 1, 4, 0, 0, 1,
+    4, 1, 5, 1, 4, 1, 6, 3, 6, 1, 5, 1, 7, 1, 6, 1,
+    5, 2, 6, 1, 0, 1, 4, 1, 6, 1, 0, 1, 4, 3, 0, 1,
+    3, 8, 0, 7, 2, 2, 3, 1, 0, 3, 4, 0, 3, 0, 0, 6,
+    8, 6,
+};
+const MusicData_s MUSIC_DATA_HAO_YUN_LAI = {HAO_YUN_LAI_PITCH, HAO_YUN_LAI_DURATION, HAO_YUN_LAI_STREAM, 137};
+
+/*-------------------- GONG_XI_FA_CAI --------------------*/
+// 112 notes, 252 bytes of flash, replaces a 1356-byte RAM note table
+static const uint16_t GONG_XI_FA_CAI_PITCH[] = {
+    494, 554, 659, 440, 370, 0, 740,
+};  // Hz
+static const uint16_t GONG_XI_FA_CAI_DURATION[] = {
+    188, 63, 125, 250, 1000, 750, 1500,
+};  // ms
+static const uint8_t GONG_XI_FA_CAI_STREAM[] = {
+    0, 0, 1, 1, 0, 2, 2, 2, 0, 2, 1, 2, 0, 3, 0, 0,
+    1, 1, 0, 2, 3, 2, 4, 2, 3, 2, 4, 3, 0, 0, 1, 1,
+    0, 2, 2, 2, 0, 2, 1, 2, 0, 2, 3, 2, 4, 0, 3, 1,
+    4, 2, 2, 2, 3, 2, 5, 2, 3, 2, 5, 2, 0, 3, 1, 3,
+    2, 3, 1, 3, 0, 0, 1, 1, 0, 2, 3, 2, 4, 3, 0, 3,
+    1, 3, 2, 3, 1, 3, 0, 0, 1, 1, 0, 2, 4, 2, 3, 3,
+    4, 0, 3, 1, 1, 2, 2, 2, 4, 0, 3, 1, 1, 2, 2, 2,
+    4, 0, 3, 1, 1, 2, 2, 2, 4, 2, 2, 2, 4, 3, 4, 0,
+    3, 1, 1, 2, 2, 2, 4, 0, 3, 1, 1, 2, 2, 2, 4, 0,
+    3, 1, 1, 2, 2, 2, 4, 2, 2, 2, 4, 3, 6, 3, 2, 3,
+    6, 3, 2, 2, 0, 2, 1, 4, 6, 3, 2, 3, 6, 3, 2, 2,
+    255, 1, 6, 5, 5, 2, 1, 2, 0, 0, 1, 1, 0, 2, 3, 2,
+    4, 2, 5, 2, 1, 2, 0, 0, 1, 1, 0, 2, 3, 2, 0, 3,
+    5, 2, 0, 2, 3, 3, 0, 3, 1, 3, 2, 3, 6, 4, 5, 6,
+};
+const MusicData_s MUSIC_DATA_GONG_XI_FA_CAI = {GONG_XI_FA_CAI_PITCH, GONG_XI_FA_CAI_DURATION, GONG_XI_FA_CAI_STREAM, 112};
+
+/*-------------------- DEJA_VU --------------------*/
+// 50 notes, 124 bytes of flash, replaces a 612-byte RAM note table
+static const uint16_t DEJA_VU_PITCH[] = {
+    0, 494, 587, 659, 880, 831, 740, 988,
+};  // Hz
+static const uint16_t DEJA_VU_DURATION[] = {
+    1500, 250, 125, 63,
+};  // ms
+static const uint8_t DEJA_VU_STREAM[] = {
+    0, 0, 1, 1, 0, 2, 2, 2, 0, 2, 2, 2, 0, 2, 3, 2,
+    3, 1, 0, 2, 4, 2, 255, 1, 5, 2, 5, 1, 1, 1, 6, 3,
+    4, 3, 6, 2, 0, 2, 6, 2, 0, 2, 6, 2, 0, 2, 3, 1,
+    4, 3, 7, 3, 4, 2, 255, 1, 7, 1, 1, 1, 0, 2, 2, 2,
+    0, 2, 2, 2, 0, 2, 3, 2, 3, 1, 0, 2, 4, 2, 255, 1,
+    5, 2, 5, 1, 2, 2, 0, 2, 6, 3, 4, 3, 6, 2, 0, 2,
+    6, 2, 4, 1,
+};
+const MusicData_s MUSIC_DATA_DEJA_VU = {DEJA_VU_PITCH, DEJA_VU_DURATION, DEJA_VU_STREAM, 50};
+
+/*-------------------- MEOW --------------------*/
+// 4 notes, 24 bytes of flash, replaces a 60-byte RAM note table
+static const uint16_t MEOW_PITCH[] = {
+    0, 1200, 1000, 800,
+};  // Hz
+static const uint16_t MEOW_DURATION[] = {
+    500, 80, 100, 120,
+};  // ms
+static const uint8_t MEOW_STREAM[] = {
+    0, 0, 1, 1, 2, 2, 3, 3,
+};
+const MusicData_s MUSIC_DATA_MEOW = {MEOW_PITCH, MEOW_DURATION, MEOW_STREAM, 4};
+
+/*-------------------- ERROR --------------------*/
+// 5 notes, 24 bytes of flash, replaces a 72-byte RAM note table
+static const uint16_t ERROR_PITCH[] = {
+    0, 296, 698,
+};  // Hz
+static const uint16_t ERROR_DURATION[] = {
+    2, 400, 3, 1000,
+};  // ms
+static const uint8_t ERROR_STREAM[] = {
+    0, 0, 1, 1, 0, 2, 2, 1, 0, 3,
+};
+const MusicData_s MUSIC_DATA_ERROR = {ERROR_PITCH, ERROR_DURATION, ERROR_STREAM, 5};
+
+/*-------------------- REFEREE_CONNECT --------------------*/
+// 7 notes, 34 bytes of flash, replaces a 96-byte RAM note table
+static const uint16_t REFEREE_CONNECT_PITCH[] = {
+    0, 659, 330, 392,
+};  // Hz
+static const uint16_t REFEREE_CONNECT_DURATION[] = {
+    2, 200, 3, 300, 400, 500,
+};  // ms
+static const uint8_t REFEREE_CONNECT_STREAM[] = {
+    0, 0, 1, 1, 0, 2, 2, 3, 0, 2, 3, 4, 0, 5,
+};
+const MusicData_s MUSIC_DATA_REFEREE_CONNECT = {REFEREE_CONNECT_PITCH, REFEREE_CONNECT_DURATION, REFEREE_CONNECT_STREAM, 7};
+
+/*-------------------- REFEREE_DISCONNECT --------------------*/
+// 5 notes, 26 bytes of flash, replaces a 72-byte RAM note table
+static const uint16_t REFEREE_DISCONNECT_PITCH[] = {
+    0, 1568, 330,
+};  // Hz
+static const uint16_t REFEREE_DISCONNECT_DURATION[] = {
+    2, 200, 3, 400, 500,
+};  // ms
+static const uint8_t REFEREE_DISCONNECT_STREAM[] = {
+    0, 0, 1, 1, 0, 2, 2, 3, 0, 4,
+};
+const MusicData_s MUSIC_DATA_REFEREE_DISCONNECT = {REFEREE_DISCONNECT_PITCH, REFEREE_DISCONNECT_DURATION, REFEREE_DISCONNECT_STREAM, 5};
+
+// clang-format on
+/*------------------------------ End of File ------------------------------*/
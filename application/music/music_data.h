@@ -0,0 +1,30 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       music_data.c/h
+  * @brief      压缩格式的音乐数据，由 tools/music_convert.py 生成，请勿手动修改
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#ifndef MUSIC_DATA_H
+#define MUSIC_DATA_H
+
+#include "music_typedef.h"
+
+extern const MusicData_s MUSIC_DATA_START;
+extern const MusicData_s MUSIC_DATA_MOTOR_OFFLINE;
+extern const MusicData_s MUSIC_DATA_RC_OFFLINE;
+extern const MusicData_s MUSIC_DATA_YOU;
+extern const MusicData_s MUSIC_DATA_UNITY;
+extern const MusicData_s MUSIC_DATA_CANON;
+extern const MusicData_s MUSIC_DATA_CASTLE_IN_THE_SKY;
+extern const MusicData_s MUSIC_DATA_SEE_YOU_AGAIN;
+extern const MusicData_s MUSIC_DATA_HAO_YUN_LAI;
+extern const MusicData_s MUSIC_DATA_GONG_XI_FA_CAI;
+extern const MusicData_s MUSIC_DATA_DEJA_VU;
+extern const MusicData_s MUSIC_DATA_MEOW;
+extern const MusicData_s MUSIC_DATA_ERROR;
+extern const MusicData_s MUSIC_DATA_REFEREE_CONNECT;
+extern const MusicData_s MUSIC_DATA_REFEREE_DISCONNECT;
+
+#endif  // MUSIC_DATA_H
+/*------------------------------ End of File ------------------------------*/
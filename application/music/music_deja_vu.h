@@ -1,9 +1,9 @@
 #ifndef __MUSIC_DEJA_VU_H_
 #define __MUSIC_DEJA_VU_H_
 
-extern void MusicDejaVuInit(void);
+#include "music_typedef.h"
 
-extern void MusicDejaVuPlay(void);
+extern MusicInfo_s MusicDejaVuInit(void);
 
 #endif  // __MUSIC_DEJA_VU_H_
 /*------------------------------ End of File ------------------------------*/
@@ -2,8 +2,8 @@
 #define MUSIC_ERROR_H
 #include <stdbool.h>
 
-extern void MusicErrorInit(void);
+#include "music_typedef.h"
 
-extern bool MusicErrorPlay(void);
+extern MusicInfo_s MusicErrorInit(void);
 
 #endif  // MUSIC_ERROR_H
@@ -1,9 +1,9 @@
 #ifndef __MUSIC_MEOW_H_
 #define __MUSIC_MEOW_H_
 
-extern void MusicMeowInit(void);
+#include "music_typedef.h"
 
-extern void MusicMeowPlay(void);
+extern MusicInfo_s MusicMeowInit(void);
 
 #endif  // __MUSIC_MEOW_H_
 /*------------------------------ End of File ------------------------------*/
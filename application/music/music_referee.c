@@ -52,89 +52,34 @@
 static Note CONNECT_NOTES[10];
 static Note DISCONNECT_NOTES[10];
 
-static uint32_t last_note_id = 0;        // Index of the last note
-static uint32_t write_id = 1;            // Index of the note to be written
-static uint32_t play_id_connect = 1;     // Index of the note to be played
-static uint32_t play_id_disconnect = 1;  // Index of the note to be played
-
-static uint32_t start_time = 0;  // Start time of the music
-static uint32_t now = 0;
-
-/*-------------------- Private functions --------------------*/
-static void WriteConnectNote(int note, float Long)
-{
-    CONNECT_NOTES[write_id].note = note;
-    CONNECT_NOTES[write_id].Long = Long;
-    CONNECT_NOTES[write_id].end = CONNECT_NOTES[write_id - 1].end + Long;
-    write_id++;
-}
-
-static void WriteDisconnectNote(int note, float Long)
-{
-    DISCONNECT_NOTES[write_id].note = note;
-    DISCONNECT_NOTES[write_id].Long = Long;
-    DISCONNECT_NOTES[write_id].end = DISCONNECT_NOTES[write_id - 1].end + Long;
-    write_id++;
-}
-
 /*-------------------- User functions --------------------*/
 
-bool MusicRefereeConncetPlay()
+MusicInfo_s MusicRefereeConnectInit(void)
 {
-    now = HAL_GetTick();
-
-    bool end = false;
-    if (now - start_time >= CONNECT_NOTES[play_id_connect].end) {
-        play_id_connect++;
-        if (play_id_connect > last_note_id) {
-            end = true;
-            play_id_connect = 1;
-            start_time = now;
-        }
-
-        buzzer_note(CONNECT_NOTES[play_id_connect].note, 0.05);
-    }
-    return end;
-}
-
-bool MusicRefereeDisconnectPlay()
-{
-    now = HAL_GetTick();
-
-    bool end = false;
-    if (now - start_time >= DISCONNECT_NOTES[play_id_disconnect].end) {
-        play_id_disconnect++;
-        if (play_id_disconnect > last_note_id) {
-            end = true;
-            play_id_disconnect = 1;
-            start_time = now;
-        }
-
-        buzzer_note(DISCONNECT_NOTES[play_id_disconnect].note, 0.05);
-    }
-    return end;
+    static MusicInfo_s MUSIC_INFO;
+    MUSIC_INFO.notes = CONNECT_NOTES;
+
+    WRITE_NOTE(0, 2);
+    WRITE_NOTE(C3, HalfBeat * 2);
+    WRITE_NOTE(0, 3);
+    WRITE_NOTE(B3, HalfBeat * 3);
+    WRITE_NOTE(0, 3);
+    WRITE_NOTE(B5, HalfBeat * 4);
+    WRITE_NOTE(0, 500);
+
+    return MUSIC_INFO;
 }
 
-void MusicRefereeInit(void)
+MusicInfo_s MusicRefereeDisconnectInit(void)
 {
-    // connect
-    WriteConnectNote(0, 2);
-    WriteConnectNote(C3, HalfBeat * 2);
-    WriteConnectNote(0, 3);
-    WriteConnectNote(B3, HalfBeat * 3);
-    WriteConnectNote(0, 3);
-    WriteConnectNote(B5, HalfBeat * 4);
-    WriteConnectNote(0, 500);
+    static MusicInfo_s MUSIC_INFO;
+    MUSIC_INFO.notes = DISCONNECT_NOTES;
 
-    last_note_id = write_id - 1;
-    write_id = 1;
+    WRITE_NOTE(0, 2);
+    WRITE_NOTE(D5, HalfBeat * 2);
+    WRITE_NOTE(0, 3);
+    WRITE_NOTE(B3, HalfBeat * 4);
+    WRITE_NOTE(0, 500);
 
-    // disconnect
-    WriteDisconnectNote(0, 2);
-    WriteDisconnectNote(D5, HalfBeat * 2);
-    WriteDisconnectNote(0, 3);
-    WriteDisconnectNote(B3, HalfBeat * 4);
-    WriteDisconnectNote(0, 500);
-    last_note_id = write_id - 1;
-    write_id = 1;
+    return MUSIC_INFO;
 }
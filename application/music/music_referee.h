@@ -2,10 +2,10 @@
 #define MUSIC_REFEREE_H
 #include <stdbool.h>
 
-extern void MusicRefereeInit(void);
+#include "music_typedef.h"
 
-extern bool MusicRefereeConncetPlay(void);
+extern MusicInfo_s MusicRefereeConnectInit(void);
 
-extern bool MusicRefereeDisconnectPlay(void);
+extern MusicInfo_s MusicRefereeDisconnectInit(void);
 
 #endif  // MUSIC_REFEREE_H
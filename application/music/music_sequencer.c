@@ -0,0 +1,240 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       music_sequencer.c/h
+  * @brief      定时器中断驱动的音符序列器，支持按优先级打断背景音乐的提示音
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+    使用方法：
+    1. MusicSequencerInit() 初始化定时器
+    2. MusicSequencerAlert(&MUSIC_DATA_XXX, volume, priority) 播放提示音，
+       priority越大优先级越高，相同优先级按先后顺序播放
+    3. MusicSequencerBackground(&MUSIC_DATA_XXX, volume) 设置背景音乐，NULL为不播放
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include "music_sequencer.h"
+
+#include <stddef.h>
+
+#include "bsp_buzzer.h"
+#include "cmsis_os.h"
+#include "music_stream.h"
+
+typedef struct
+{
+    const MusicData_s * music;
+    uint8_t volume;  // [0,255]
+    uint8_t priority;
+} MusicRequest_s;
+
+static MusicStream_s ALERT_STREAM;
+static MusicRequest_s ALERT;
+static bool_t ALERT_PLAYING = 0;
+
+// 按优先级从高到低排列
+static MusicRequest_s ALERT_QUEUE[MUSIC_ALERT_QUEUE_LEN];
+static uint8_t ALERT_QUEUE_NUM = 0;
+
+static MusicStream_s BACKGROUND_STREAM;
+static MusicRequest_s BACKGROUND = {.music = NULL};
+
+/*-------------------- Private functions --------------------*/
+
+static uint8_t VolumeToU8(float volume)
+{
+    if (volume > 1.0f) {
+        volume = 1.0f;
+    } else if (volume < 0.0f) {
+        volume = 0.0f;
+    }
+    return (uint8_t)(volume * 255.0f);
+}
+
+/**
+ * @brief          按优先级插入等待队列，队列满时丢弃优先级最低的一项
+ */
+static void AlertQueuePush(const MusicRequest_s * request)
+{
+    uint8_t i = ALERT_QUEUE_NUM;
+
+    if (ALERT_QUEUE_NUM == MUSIC_ALERT_QUEUE_LEN) {
+        if (ALERT_QUEUE[MUSIC_ALERT_QUEUE_LEN - 1].priority >= request->priority) {
+            return;
+        }
+        i--;
+    } else {
+        ALERT_QUEUE_NUM++;
+    }
+
+    for (; i > 0 && ALERT_QUEUE[i - 1].priority < request->priority; i--) {
+        ALERT_QUEUE[i] = ALERT_QUEUE[i - 1];
+    }
+    ALERT_QUEUE[i] = *request;
+}
+
+static bool_t AlertQueueContains(const MusicData_s * music)
+{
+    for (uint8_t i = 0; i < ALERT_QUEUE_NUM; i++) {
+        if (ALERT_QUEUE[i].music == music) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static MusicRequest_s AlertQueuePop(void)
+{
+    MusicRequest_s request = ALERT_QUEUE[0];
+    ALERT_QUEUE_NUM--;
+    for (uint8_t i = 0; i < ALERT_QUEUE_NUM; i++) {
+        ALERT_QUEUE[i] = ALERT_QUEUE[i + 1];
+    }
+    return request;
+}
+
+/**
+ * @brief          取出下一个要播放的音符
+ * @param[out]     note 频率(Hz)
+ * @param[out]     duration 时长(ms)
+ * @param[out]     volume 音量
+ * @retval         0表示没有需要播放的音符
+ */
+static bool_t SequencerNextNote(uint16_t * note, uint16_t * duration, uint8_t * volume)
+{
+    MusicStream_s * stream;
+
+    if (ALERT_PLAYING && !MusicStreamNext(&ALERT_STREAM)) {
+        ALERT_PLAYING = 0;
+    }
+    while (!ALERT_PLAYING && ALERT_QUEUE_NUM > 0) {
+        ALERT = AlertQueuePop();
+        MusicStreamStart(&ALERT_STREAM, ALERT.music);
+        ALERT_PLAYING = MusicStreamNext(&ALERT_STREAM);
+    }
+
+    if (ALERT_PLAYING) {
+        stream = &ALERT_STREAM;
+        *volume = ALERT.volume;
+    } else if (BACKGROUND.music != NULL) {
+        // 背景音乐循环播放
+        if (!MusicStreamNext(&BACKGROUND_STREAM)) {
+            MusicStreamStart(&BACKGROUND_STREAM, BACKGROUND.music);
+            if (!MusicStreamNext(&BACKGROUND_STREAM)) {
+                return 0;
+            }
+        }
+        stream = &BACKGROUND_STREAM;
+        *volume = BACKGROUND.volume;
+    } else {
+        return 0;
+    }
+
+    *note = stream->note;
+    *duration = stream->duration;
+    return 1;
+}
+
+/**
+ * @brief          打断当前音符，从下一个待播放的音符重新开始序列，需在临界区内调用
+ */
+static void SequencerRestart(void)
+{
+    uint16_t note, duration;
+    uint8_t volume;
+
+    if (SequencerNextNote(&note, &duration, &volume)) {
+        buzzer_seq_start(note, duration, volume);
+    } else {
+        buzzer_seq_stop();
+    }
+}
+
+/*-------------------- Public functions --------------------*/
+
+/**
+ * @brief          初始化序列器
+ * @retval         none
+ */
+void MusicSequencerInit(void)
+{
+    ALERT_PLAYING = 0;
+    ALERT_QUEUE_NUM = 0;
+    BACKGROUND.music = NULL;
+    buzzer_seq_init();
+}
+
+/**
+ * @brief          播放提示音，优先级高于当前提示音时立即打断，否则排队等待
+ * @param[in]      music 压缩的音乐数据
+ * @param[in]      volume 音量[0,1]
+ * @param[in]      priority 优先级，越大越优先
+ * @retval         none
+ */
+void MusicSequencerAlert(const MusicData_s * music, float volume, uint8_t priority)
+{
+    MusicRequest_s request = {.music = music, .volume = VolumeToU8(volume), .priority = priority};
+
+    taskENTER_CRITICAL();
+    if ((ALERT_PLAYING && ALERT.music == music) || AlertQueueContains(music)) {
+        // 同一个提示音正在播放或等待中，不重复添加
+    } else if (ALERT_PLAYING && ALERT.priority >= priority) {
+        AlertQueuePush(&request);
+    } else {
+        if (ALERT_PLAYING) {
+            // 被打断的提示音之后从头重新播放
+            AlertQueuePush(&ALERT);
+            ALERT_PLAYING = 0;
+        }
+        AlertQueuePush(&request);
+        SequencerRestart();
+    }
+    taskEXIT_CRITICAL();
+}
+
+/**
+ * @brief          设置背景音乐，与当前背景音乐相同时只更新音量
+ * @param[in]      music 压缩的音乐数据，NULL为停止背景音乐
+ * @param[in]      volume 音量[0,1]
+ * @retval         none
+ */
+void MusicSequencerBackground(const MusicData_s * music, float volume)
+{
+    taskENTER_CRITICAL();
+    BACKGROUND.volume = VolumeToU8(volume);
+    if (BACKGROUND.music != music) {
+        BACKGROUND.music = music;
+        if (music != NULL) {
+            MusicStreamStart(&BACKGROUND_STREAM, music);
+        }
+        if (!ALERT_PLAYING) {
+            SequencerRestart();
+        }
+    }
+    taskEXIT_CRITICAL();
+}
+
+/**
+ * @brief          是否有提示音正在播放或等待播放
+ * @retval         1: 有, 0: 没有
+ */
+bool_t MusicSequencerAlertBusy(void) { return ALERT_PLAYING || ALERT_QUEUE_NUM > 0; }
+
+/**
+ * @brief          TIM2中断中预装载下一个音符
+ */
+void buzzer_seq_next_callback(void)
+{
+    uint16_t note, duration;
+    uint8_t volume;
+
+    if (SequencerNextNote(&note, &duration, &volume)) {
+        buzzer_seq_load(note, duration, volume);
+    }
+}
+/*------------------------------ End of File ------------------------------*/
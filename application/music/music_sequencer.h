@@ -0,0 +1,34 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       music_sequencer.c/h
+  * @brief      定时器中断驱动的音符序列器，支持按优先级打断背景音乐的提示音
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+    音符切换在TIM2中断(bsp_buzzer)中完成，与music_task的运行周期无关。
+    提示音按优先级排队，高优先级的提示音立即打断当前播放；
+    所有提示音播放完后背景音乐从打断处继续，并循环播放。
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#ifndef MUSIC_SEQUENCER_H
+#define MUSIC_SEQUENCER_H
+
+#include "music_typedef.h"
+#include "struct_typedef.h"
+
+// 等待播放的提示音数量上限
+#define MUSIC_ALERT_QUEUE_LEN 4
+
+extern void MusicSequencerInit(void);
+extern void MusicSequencerAlert(const MusicData_s * music, float volume, uint8_t priority);
+extern void MusicSequencerBackground(const MusicData_s * music, float volume);
+extern bool_t MusicSequencerAlertBusy(void);
+
+#endif  // MUSIC_SEQUENCER_H
+/*------------------------------ End of File ------------------------------*/
@@ -0,0 +1,73 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       music_stream.c/h
+  * @brief      压缩音乐格式的流式解码器
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+    使用方法：
+    1. MusicStreamStart(&stream, &MUSIC_DATA_XXX) 从头开始解码
+    2. 每次 MusicStreamNext(&stream) 解码下一个音符到 stream.note / stream.end，
+       返回0表示音乐已结束
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include "music_stream.h"
+
+#include <stddef.h>
+
+/**
+ * @brief          从头开始解码音乐
+ * @param[out]     stream 解码器
+ * @param[in]      music 压缩的音乐数据
+ * @retval         none
+ */
+void MusicStreamStart(MusicStream_s * stream, const MusicData_s * music)
+{
+    stream->music = music;
+    stream->pos = 0;
+    stream->note_id = 0;
+    stream->repeat = 0;
+    stream->note = 0;
+    stream->duration = 0;
+    stream->end = 0;
+}
+
+/**
+ * @brief          解码下一个音符
+ * @param[in,out]  stream 解码器
+ * @retval         1: 解码成功 0: 音乐已结束
+ */
+bool_t MusicStreamNext(MusicStream_s * stream)
+{
+    const MusicData_s * music = stream->music;
+    const uint8_t * p;
+
+    if (music == NULL || stream->note_id >= music->note_num) {
+        return 0;
+    }
+
+    if (stream->repeat > 0) {
+        stream->repeat--;
+    } else {
+        p = &music->stream[stream->pos];
+        stream->pos += 2;
+        if (p[0] == MUSIC_STREAM_REPEAT) {
+            // 重复记号后一定跟着上一个音符，本次消耗一次重复
+            stream->repeat = p[1] - 1;
+        } else {
+            stream->note = music->pitch[p[0]];
+            stream->duration = music->duration[p[1]];
+        }
+    }
+
+    stream->end += stream->duration;
+    stream->note_id++;
+    return 1;
+}
+/*------------------------------ End of File ------------------------------*/
@@ -0,0 +1,38 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       music_stream.c/h
+  * @brief      压缩音乐格式的流式解码器
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+    不依赖HAL库，转换工具在PC上用同一份代码校验解码结果。
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#ifndef MUSIC_STREAM_H
+#define MUSIC_STREAM_H
+
+#include "music_typedef.h"
+#include "struct_typedef.h"
+
+typedef struct
+{
+    const MusicData_s * music;
+    uint32_t pos;       // stream读取位置
+    uint16_t note_id;   // 已解码的音符数量
+    uint8_t repeat;     // 上一个音符剩余的重复次数
+    uint16_t note;      // (Hz)当前音符频率
+    uint16_t duration;  // (ms)当前音符时长
+    uint32_t end;       // (ms)当前音符相对音乐开始的结束时间
+} MusicStream_s;
+
+extern void MusicStreamStart(MusicStream_s * stream, const MusicData_s * music);
+extern bool_t MusicStreamNext(MusicStream_s * stream);
+
+#endif  // MUSIC_STREAM_H
+/*------------------------------ End of File ------------------------------*/
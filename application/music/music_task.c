@@ -7,6 +7,10 @@
   *  Version    Date            Author          Modification
   *  V1.0.0     May-20-2024     Penguin         1. done
   *  V1.0.1     May-09-2025     Penguin         1. 添加展览模式，可以用ps2控制音乐的播放
+  *  V1.1.0     Oct-19-2026     Penguin         1. 音乐改为flash中的压缩格式，流式解码播放
+  *  V1.2.0     Oct-19-2026     Penguin         1. 音符切换改由music_sequencer在定时器中断中完成，
+  *                                                本任务只负责选择提示音和背景音乐
+  *  V1.2.1     Oct-19-2026     Penguin         1. 添加裁判系统连接/断开提示音
   *
   @verbatim
   ==============================================================================
@@ -24,25 +28,12 @@
 #include "bsp_buzzer.h"
 #include "cmsis_os.h"
 #include "data_exchange.h"
-#include "fifo.h"
 #include "motor.h"
 #include "music.h"
 #include "music_calibrate.h"
-#include "music_canon.h"
-#include "music_castle_in_the_sky.h"
-#include "music_deja_vu.h"
-#include "music_error.h"
-#include "music_gong_xi_fa_cai.h"
-#include "music_hao_yun_lai.h"
-#include "music_meow.h"
-#include "music_motor_offline.h"
-#include "music_rc_offline.h"
-#include "music_referee.h"
-#include "music_see_you_again.h"
-#include "music_start.h"
+#include "music_data.h"
+#include "music_sequencer.h"
 #include "music_typedef.h"
-#include "music_unity.h"
-#include "music_you.h"
 #include "ps2.h"
 #include "referee.h"
 #include "remote_control.h"
@@ -67,19 +58,7 @@ uint32_t music_high_water;
 #define STEP_INIT 1
 #define STEP_NORMAL 2
 
-#define PLAY_LIST_FIFO_BUF_LENGTH 10
-
-#define is_play_cali()                                                                 \
-    (is_play == CALI_BEGIN || is_play == CALI_MIDDLE_TIME || is_play == CALI_GIMBAL || \
-     is_play == CALI_IMU || is_play == CALI_CHASSIS)
-
-#define SET_MUSIC_TO_PLAY(MUSIC_INDEX) \
-    if (is_play < MUSIC_INDEX) {       \
-        is_play = MUSIC_INDEX;         \
-        play_id = 0;                   \
-    }
-
-// Enum Declarations，根据优先级排列，越后面优先级越高
+// Enum Declarations，作为提示音的优先级，越后面优先级越高
 typedef enum {
     PLAY_NONE = 0,
     POWER_UP,
@@ -88,6 +67,8 @@ typedef enum {
     CALI_GIMBAL,
     CALI_IMU,
     CALI_CHASSIS,
+    PLAY_REFEREE_CONNECT,
+    PLAY_REFEREE_DISCONNECT,
     PLAY_MOTOR_OFFLINE,
     PLAY_RC_OFFLINE,
 } Playing_e;
@@ -103,7 +84,8 @@ typedef enum {
     gong_xi_fa_cai,
     hao_yun_lai,
     meow,
-    referee,
+    referee_connect,
+    referee_disconnect,
     see_you_again,
     unity,
     you,
@@ -112,17 +94,11 @@ typedef enum {
 // Variable Declarations
 static uint8_t music_step = STEP_INIT;
 
-Playing_e is_play = POWER_UP;
-fifo_s_t play_list_fifo;
-uint8_t play_list_fifo_buf[PLAY_LIST_FIFO_BUF_LENGTH];
-
-static MusicInfo_s MUSICS[20];
-static uint32_t now = 0;
-static uint32_t start_time = 0;
-static uint32_t play_id = 0;  // 0为保留音符，不使用
+static const MusicData_s * MUSICS[20];
 
 static uint32_t task_count = 0;
 static uint32_t last_abnormal_warning_time = 0;
+static bool last_referee_offline = true;  // 上电时裁判系统尚未连接
 // static uint32_t last_task_time = 0;
 // static uint32_t task_duration = 0;
 
@@ -132,35 +108,6 @@ Ps2Button_t ps2_btn_l1 = {.last = false, .now = false};
 bool play_default_music = false;
 #endif
 
-/**
- * @brief 播放音乐
- * @param  none
- * @return 结束1 未结束0
- */
-bool PlayMusic(MusicInfo_s * music_info, float volume)
-{
-    now = HAL_GetTick();
-    bool end = false;
-
-    if (play_id == 0) {
-        start_time = now;
-        play_id++;
-        buzzer_note(music_info->notes[play_id].note, volume);
-    }
-    if (now - start_time >= music_info->notes[play_id].end) {
-        play_id++;
-        if (play_id > music_info->last_note_id) {
-            end = true;
-            play_id = 0;
-            buzzer_note(0, 0.1);
-        } else {
-            buzzer_note(music_info->notes[play_id].note, volume);
-        }
-    }
-
-    return end;
-}
-
 /*******************************************************************************/
 /* Main Functions                                                              */
 /*     music_task                                                              */
@@ -200,81 +147,70 @@ void music_task(void const * pvParameters)
 
 static void MusicInit(void)
 {
-    fifo_s_init(&play_list_fifo, play_list_fifo_buf, PLAY_LIST_FIFO_BUF_LENGTH);
+    MusicSequencerInit();
 
     music_step = STEP_INIT;
 
     // clang-format off
-    MUSICS[start]             = MusicStartInit();
-    MUSICS[motor_offline]     = MusicMotorOfflineInit();
-    MUSICS[rc_offline]        = MusicRcOfflineInit();
-    MUSICS[you]               = MusicYouInit();
-    // MUSICS[unity]             = MusicUnityInit();
-    // MUSICS[canon]             = MusicCanonInit();
-    // MUSICS[castle_in_the_sky] = MusicCastleInTheSkyInit();
-    // MUSICS[see_you_again]     = MusicSeeYouAgainInit();
-    // MUSICS[hao_yun_lai]       = MusicHaoYunLaiInit();
-    // MUSICS[gong_xi_fa_cai]    = MusicGongXiFaCaiInit();
-    // MUSICS[deja_vu]           = MusicDejaVuInit();
+    MUSICS[start]              = &MUSIC_DATA_START;
+    MUSICS[motor_offline]      = &MUSIC_DATA_MOTOR_OFFLINE;
+    MUSICS[rc_offline]         = &MUSIC_DATA_RC_OFFLINE;
+    MUSICS[you]                = &MUSIC_DATA_YOU;
+    MUSICS[unity]              = &MUSIC_DATA_UNITY;
+    MUSICS[canon]              = &MUSIC_DATA_CANON;
+    MUSICS[castle_in_the_sky]  = &MUSIC_DATA_CASTLE_IN_THE_SKY;
+    MUSICS[see_you_again]      = &MUSIC_DATA_SEE_YOU_AGAIN;
+    MUSICS[hao_yun_lai]        = &MUSIC_DATA_HAO_YUN_LAI;
+    MUSICS[gong_xi_fa_cai]     = &MUSIC_DATA_GONG_XI_FA_CAI;
+    MUSICS[deja_vu]            = &MUSIC_DATA_DEJA_VU;
+    MUSICS[meow]               = &MUSIC_DATA_MEOW;
+    MUSICS[error]              = &MUSIC_DATA_ERROR;
+    MUSICS[referee_connect]    = &MUSIC_DATA_REFEREE_CONNECT;
+    MUSICS[referee_disconnect] = &MUSIC_DATA_REFEREE_DISCONNECT;
     // clang-format on
+
+    MusicSequencerAlert(MUSICS[start], 0.5f, POWER_UP);
 }
 
 static void MusicPlay(void)
 {
     if (music_step == STEP_INIT) {  // 开机
-        if (PlayMusic(&MUSICS[start], 0.5f)) {
+        if (!MusicSequencerAlertBusy()) {
             music_step = STEP_NORMAL;
-            is_play = PLAY_NONE;
         }
-    } else {  // 正常状态
-        if (HAL_GetTick() - last_abnormal_warning_time > ABNORMAL_WARNING_INTERVAL) {
-            last_abnormal_warning_time = HAL_GetTick();
+        return;
+    }
 
-            if (ENABLE_ALARM_RC_OFFLINE && GetSbusOffline()) {  // 检测遥控器是否离线
-                fifo_s_put(&play_list_fifo, PLAY_RC_OFFLINE);
-            }
-            if (ENABLE_ALARM_MOTOR_OFFLINE && ScanOfflineMotor()) {  // 检测是否存在离线电机
-                fifo_s_put(&play_list_fifo, PLAY_MOTOR_OFFLINE);
-            }
-        }
+    // 正常状态
+    if (HAL_GetTick() - last_abnormal_warning_time > ABNORMAL_WARNING_INTERVAL) {
+        last_abnormal_warning_time = HAL_GetTick();
 
-        // 播放列表内容
-        if (play_list_fifo.used_num > 0 && is_play == PLAY_NONE) {
-            is_play = (Playing_e)fifo_s_get(&play_list_fifo);
-            play_id = 0;
+        if (ENABLE_ALARM_RC_OFFLINE && GetSbusOffline()) {  // 检测遥控器是否离线
+            MusicSequencerAlert(MUSICS[rc_offline], 0.5f, PLAY_RC_OFFLINE);
         }
+        if (ENABLE_ALARM_MOTOR_OFFLINE && ScanOfflineMotor()) {  // 检测是否存在离线电机
+            MusicSequencerAlert(MUSICS[motor_offline], 0.5f, PLAY_MOTOR_OFFLINE);
+        }
+    }
 
-        // 根据is_play播放对应音乐
-        switch (is_play) {
-            case POWER_UP: {
-                if (PlayMusic(&MUSICS[start], 0.5f)) is_play = PLAY_NONE;
-            } break;
-
-            case PLAY_MOTOR_OFFLINE: {
-                if (PlayMusic(&MUSICS[motor_offline], 0.5f)) is_play = PLAY_NONE;
-            } break;
-
-            case PLAY_RC_OFFLINE: {
-                if (PlayMusic(&MUSICS[rc_offline], 0.5f)) is_play = PLAY_NONE;
-            } break;
+    // 裁判系统连接状态变化时提示
+    if (ENABLE_CHECK_REFEREE_OFFLINE && GetRefereeOffline() != last_referee_offline) {
+        last_referee_offline = GetRefereeOffline();
+        if (last_referee_offline) {
+            MusicSequencerAlert(MUSICS[referee_disconnect], 0.5f, PLAY_REFEREE_DISCONNECT);
+        } else {
+            MusicSequencerAlert(MUSICS[referee_connect], 0.5f, PLAY_REFEREE_CONNECT);
+        }
+    }
 
+    // 背景音乐，提示音播放期间由序列器暂停
 #if ENABLE_EXHIBITION_MODE
-            default: {
-                if (play_default_music) {
-                    PlayMusic(&MUSICS[you], 0.1f);
-                } else {
-                    buzzer_off();
-                }
-            }
+    if (play_default_music) {
 #else
-            default: {
-                if ((!ENABLE_CHECK_REFEREE_OFFLINE) || (!GetRefereeOffline())) {
-                    PlayMusic(&MUSICS[you], 0.1f);
-                } else {
-                    buzzer_off();
-                }
-            }
+    if ((!ENABLE_CHECK_REFEREE_OFFLINE) || (!GetRefereeOffline())) {
 #endif
-        }
+        MusicSequencerBackground(MUSICS[you], 0.1f);
+    } else {
+        MusicSequencerBackground(NULL, 0.1f);
     }
 }
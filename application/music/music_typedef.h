@@ -5,10 +5,18 @@
   * @history
   *  Version    Date            Author          Modification
   *  V1.0.0     2025-04-03      Penguin         1.初始化
+  *  V1.1.0     Oct-19-2026     Penguin         1.添加flash中的压缩音乐格式
   *
   @verbatim
   ==============================================================================
+    WRITE_NOTE 编写的乐谱(music_xxx.c)只作为转换工具的输入，不再编译进固件。
+    tools/music_convert.py 将乐谱转换为 music_data.c 中的 MusicData_s 常量，
+    由 music_stream.c 在播放时逐个解码，不占用RAM。
 
+    压缩格式：
+    每首音乐有自己的音高表 pitch[] 和时长表 duration[]，音符流 stream[] 由以下记号组成
+      [p][d]      : 一个音符，音高为 pitch[p]，时长为 duration[d]，p < 0xFF
+      [0xFF][n]   : 将上一个音符再重复 n 次
   ==============================================================================
   @endverbatim
   ****************************(C) COPYRIGHT 2024 Polarbear****************************
@@ -44,5 +52,15 @@ typedef struct
     uint32_t last_note_id;  // 结尾音符的index
 } MusicInfo_s;
 
+#define MUSIC_STREAM_REPEAT 0xFF  // 重复记号
+
+typedef struct
+{
+    const uint16_t * pitch;     // (Hz)音高表
+    const uint16_t * duration;  // (ms)时长表
+    const uint8_t * stream;     // 音符流
+    uint16_t note_num;          // 音符数量
+} MusicData_s;
+
 #endif  // MUSIC_TYPEDEF_H
 /*------------------------------ End of File ------------------------------*/
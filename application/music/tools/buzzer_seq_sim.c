@@ -0,0 +1,253 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       buzzer_seq_sim.c
+  * @brief      在PC上运行的音符序列器仿真，检查提示音能完整播放并正常结束
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+    编译运行：
+      cc -O2 -Istub -I.. -I../../typedef -I../../../bsp/boards -o buzzer_seq_sim \
+         buzzer_seq_sim.c ../music_sequencer.c ../music_stream.c ../music_data.c \
+         ../../../bsp/boards/bsp_buzzer.c
+      ./buzzer_seq_sim
+    定时器模型(RM0090)：
+      TIM4每个音调周期产生一次更新事件，ARR/CCR3预装载，在更新事件时生效；
+      TIM2对TIM4的更新事件计数，计到ARR后的下一次计数溢出并产生中断，ARR为0时计数器不计数。
+    检查项(任一不满足返回非0)：
+      1. 开机、错误、裁判系统连接/断开提示音的每个音符的音高、音量、音调周期数与乐谱一致，
+         播放完后TIM2停止，提示音不再处于播放状态
+      2. 播放背景音乐时插入提示音，提示音结束后背景音乐继续播放
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include <stdio.h>
+
+#include "bsp_buzzer.h"
+#include "main.h"
+#include "music_data.h"
+#include "music_sequencer.h"
+#include "music_stream.h"
+
+#define PCLK1 42000000
+#define TIM4_PSC 499      // 计数频率168kHz，与 8*21000/note 的ARR计算一致
+#define TICK_PER_MS 168
+#define MIN_PERIODS 3
+#define LOG_LEN 1024
+#define SIM_LIMIT_MS 60000
+
+typedef struct
+{
+    uint32_t arr;
+    uint32_t ccr;
+    uint32_t periods;
+} Segment_s;
+
+TIM_TypeDef SIM_TIM2;
+static TIM_TypeDef SIM_TIM4;
+TIM_HandleTypeDef htim4 = {&SIM_TIM4};
+
+static int NVIC_ENABLE = 0;
+static uint32_t ARR_SHADOW, CCR_SHADOW;
+static uint64_t TICK;  // TIM4计数时钟
+
+static Segment_s LOG[LOG_LEN];
+static int LOG_NUM;
+static Segment_s CUR;
+static int CUR_VALID;
+static int BOUNDARY;  // 上一次更新事件时产生了TIM2中断，当前周期是音符的最后一个周期
+
+extern void TIM2_IRQHandler(void);
+
+uint32_t HAL_RCC_GetPCLK1Freq(void) { return PCLK1; }
+void HAL_TIM_PWM_Start(TIM_HandleTypeDef * htim, uint32_t channel) {}
+void HAL_NVIC_SetPriority(IRQn_Type irq, uint32_t pre, uint32_t sub) {}
+void HAL_NVIC_EnableIRQ(IRQn_Type irq) { NVIC_ENABLE = 1; }
+void HAL_NVIC_DisableIRQ(IRQn_Type irq) { NVIC_ENABLE = 0; }
+void HAL_NVIC_ClearPendingIRQ(IRQn_Type irq) {}
+
+static void SegmentClose(void)
+{
+    if (CUR_VALID && LOG_NUM < LOG_LEN) LOG[LOG_NUM++] = CUR;
+    CUR_VALID = 0;
+}
+
+static void SegmentOpen(void)
+{
+    CUR.arr = ARR_SHADOW;
+    CUR.ccr = CCR_SHADOW;
+    CUR.periods = 0;
+    CUR_VALID = 1;
+}
+
+/**
+ * @brief          处理任务中写入的UG，TIM4的UG表示打断当前音符开始新的音符
+ */
+static void SimSoftwareUpdate(void)
+{
+    if (SIM_TIM4.EGR & TIM_EGR_UG) {
+        SIM_TIM4.EGR = 0;
+        SIM_TIM4.CNT = 0;
+        ARR_SHADOW = SIM_TIM4.ARR;
+        CCR_SHADOW = SIM_TIM4.CCR3;
+        SegmentClose();
+        SegmentOpen();
+        BOUNDARY = 0;
+    }
+    if (SIM_TIM2.EGR & TIM_EGR_UG) {
+        SIM_TIM2.EGR = 0;
+        SIM_TIM2.CNT = 0;
+    }
+    if (!(SIM_TIM2.CR1 & TIM_CR1_CEN)) {
+        SegmentClose();
+    }
+}
+
+/**
+ * @brief          TIM4运行一个音调周期
+ */
+static void SimPeriod(void)
+{
+    TICK += ARR_SHADOW + 1;
+    if (CUR_VALID) CUR.periods++;
+
+    ARR_SHADOW = SIM_TIM4.ARR;
+    CCR_SHADOW = SIM_TIM4.CCR3;
+    if (BOUNDARY) {
+        SegmentClose();
+        SegmentOpen();
+        BOUNDARY = 0;
+    }
+
+    // TRGO -> TIM2
+    if ((SIM_TIM2.CR1 & TIM_CR1_CEN) && SIM_TIM2.ARR != 0) {
+        if (SIM_TIM2.CNT >= SIM_TIM2.ARR) {
+            SIM_TIM2.CNT = 0;
+            SIM_TIM2.SR |= TIM_SR_UIF;
+        } else {
+            SIM_TIM2.CNT++;
+        }
+    }
+    if ((SIM_TIM2.SR & TIM_SR_UIF) && (SIM_TIM2.DIER & TIM_DIER_UIE) && NVIC_ENABLE) {
+        TIM2_IRQHandler();
+        if (SIM_TIM2.CR1 & TIM_CR1_CEN) {
+            BOUNDARY = 1;
+        } else {
+            CUR_VALID = 0;  // 结束后的静音周期不是音符
+        }
+    }
+}
+
+static int SeqRunning(void) { return (SIM_TIM2.CR1 & TIM_CR1_CEN) != 0; }
+
+static double NowMs(void) { return (double)TICK / TICK_PER_MS; }
+
+static void SimReset(void)
+{
+    SIM_TIM2 = (TIM_TypeDef){0};
+    SIM_TIM4 = (TIM_TypeDef){0};
+    SIM_TIM4.PSC = TIM4_PSC;
+    SIM_TIM4.ARR = 0xFFFF;
+    ARR_SHADOW = SIM_TIM4.ARR;
+    CCR_SHADOW = 0;
+    NVIC_ENABLE = 0;
+    TICK = 0;
+    LOG_NUM = 0;
+    CUR_VALID = 0;
+    BOUNDARY = 0;
+    MusicSequencerInit();
+    SimSoftwareUpdate();
+}
+
+static Segment_s Expect(uint16_t note, uint16_t duration, uint8_t volume)
+{
+    Segment_s s;
+    if (note == 0) {
+        s.arr = TICK_PER_MS - 1;
+        s.ccr = 0;
+        s.periods = duration;
+    } else {
+        s.arr = 8 * 21000 / note - 1;
+        s.ccr = ((8 * 10500 / note - 1) * volume) >> 8;
+        s.periods = TICK_PER_MS * duration / (s.arr + 1);
+    }
+    if (s.periods < MIN_PERIODS) s.periods = MIN_PERIODS;
+    return s;
+}
+
+/**
+ * @brief          播放一个提示音到结束，与乐谱逐个音符比较
+ * @retval         错误数
+ */
+static int CheckAlert(const char * name, const MusicData_s * music)
+{
+    int err = 0;
+    SimReset();
+    MusicSequencerAlert(music, 1.0f, 1);
+    SimSoftwareUpdate();
+    while (SeqRunning() && NowMs() < SIM_LIMIT_MS) SimPeriod();
+
+    MusicStream_s stream;
+    MusicStreamStart(&stream, music);
+    int n = 0;
+    while (MusicStreamNext(&stream)) {
+        Segment_s e = Expect(stream.note, stream.duration, 255);
+        if (n >= LOG_NUM || LOG[n].arr != e.arr || LOG[n].ccr != e.ccr ||
+            LOG[n].periods != e.periods) {
+            err++;
+        }
+        n++;
+    }
+    if (LOG_NUM != n || SeqRunning() || MusicSequencerAlertBusy()) err++;
+    printf(
+        "%-18s %2d/%2d notes, %s after %.1f ms, %d errors\n", name, LOG_NUM, n,
+        SeqRunning() ? "still running" : "stopped", NowMs(), err);
+    return err;
+}
+
+int main(void)
+{
+    int fail = 0;
+
+    // 1. 提示音完整播放
+    if (CheckAlert("start", &MUSIC_DATA_START)) fail = 1;
+    if (CheckAlert("error", &MUSIC_DATA_ERROR)) fail = 1;
+    if (CheckAlert("referee connect", &MUSIC_DATA_REFEREE_CONNECT)) fail = 1;
+    if (CheckAlert("referee disconnect", &MUSIC_DATA_REFEREE_DISCONNECT)) fail = 1;
+
+    // 2. 提示音结束后背景音乐继续
+    {
+        int err = 0;
+        uint8_t bg_volume = (uint8_t)(0.5f * 255.0f);
+        SimReset();
+        MusicSequencerBackground(&MUSIC_DATA_DEJA_VU, 0.5f);
+        SimSoftwareUpdate();
+        while (NowMs() < 1000) SimPeriod();
+        MusicSequencerAlert(&MUSIC_DATA_START, 1.0f, 1);
+        SimSoftwareUpdate();
+        int alert_start = LOG_NUM;
+        while (MusicSequencerAlertBusy() && NowMs() < SIM_LIMIT_MS) SimPeriod();
+        double alert_end = NowMs();
+        int alert_end_log = LOG_NUM;
+        while (NowMs() < alert_end + 2000) SimPeriod();
+
+        // 提示音之后的音符使用背景音乐的音量
+        int bg_notes = 0;
+        for (int i = alert_end_log + 1; i < LOG_NUM; i++) {
+            Segment_s e = Expect((uint16_t)(8 * 21000 / (LOG[i].arr + 1)), 1, bg_volume);
+            if (LOG[i].ccr != 0 && LOG[i].ccr == e.ccr) bg_notes++;
+        }
+        if (!SeqRunning() || bg_notes == 0 || alert_end >= SIM_LIMIT_MS) err++;
+        printf(
+            "background: alert from note %d to %d, %d background notes in 2 s after, %d errors\n",
+            alert_start, alert_end_log, bg_notes, err);
+        if (err) fail = 1;
+    }
+
+    printf(fail ? "FAIL\n" : "PASS\n");
+    return fail;
+}
@@ -0,0 +1,144 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       music_convert.c
+  * @brief      在PC上运行的乐谱转换程序，将 WRITE_NOTE 乐谱转换为压缩音乐格式
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+    由 music_convert.py 为每一首乐谱单独编译运行：
+      cc -DSCORE_FILE=\"music_xxx.c\" -DSCORE_INIT=MusicXxxInit -DSCORE_NAME=XXX ...
+    1. 调用乐谱的初始化函数得到原始音符表
+    2. 生成音高表、时长表和音符流，输出C代码到stdout
+    3. 使用 music_stream.c 解码生成的数据，与原始音符表逐个比较音高和结束时间，
+       不一致时返回非0
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include SCORE_FILE
+
+#include <stdio.h>
+
+#include "music_stream.h"
+
+#define STR_(x) #x
+#define STR(x) STR_(x)
+
+#define MAX_TABLE_LEN 0xFF
+#define MAX_STREAM_LEN 8192
+
+static uint16_t PITCH[MAX_TABLE_LEN];
+static uint16_t DURATION[MAX_TABLE_LEN + 1];
+static uint8_t STREAM[MAX_STREAM_LEN];
+static uint16_t PITCH_NUM = 0;
+static uint16_t DURATION_NUM = 0;
+static uint32_t STREAM_LEN = 0;
+
+static int FindOrAdd(uint16_t * table, uint16_t * num, uint16_t max, uint16_t value)
+{
+    uint16_t i;
+    for (i = 0; i < *num; i++) {
+        if (table[i] == value) {
+            return i;
+        }
+    }
+    if (*num >= max) {
+        return -1;
+    }
+    table[*num] = value;
+    return (*num)++;
+}
+
+static void PrintTable16(const char * type, const char * suffix, const uint16_t * table, uint16_t num)
+{
+    uint16_t i;
+    printf("static const uint16_t %s_%s[] = {", STR(SCORE_NAME), suffix);
+    for (i = 0; i < num; i++) {
+        printf("%s%u,", (i % 12 == 0) ? "\n    " : " ", table[i]);
+    }
+    printf("\n};  // %s\n", type);
+}
+
+int main(void)
+{
+    MusicInfo_s info = SCORE_INIT();
+    const Note * notes = info.notes;
+    uint32_t n = info.last_note_id;
+    uint32_t i, run = 0;
+    int p, d, last_p = -1, last_d = -1;
+    MusicStream_s stream;
+    MusicData_s data;
+
+    // 编码，时长取相邻两个结束时间之差，保证解码后的结束时间与原表完全一致
+    for (i = 1; i <= n + 1; i++) {
+        if (i <= n) {
+            p = FindOrAdd(PITCH, &PITCH_NUM, MAX_TABLE_LEN, (uint16_t)notes[i].note);
+            d = FindOrAdd(
+                DURATION, &DURATION_NUM, MAX_TABLE_LEN + 1,
+                (uint16_t)(notes[i].end - notes[i - 1].end));
+            if (p < 0 || d < 0) {
+                fprintf(stderr, "%s: too many different pitches or durations\n", STR(SCORE_NAME));
+                return 1;
+            }
+            if (p == last_p && d == last_d && run < 0xFF) {
+                run++;
+                continue;
+            }
+        }
+        if (run > 0) {
+            STREAM[STREAM_LEN++] = MUSIC_STREAM_REPEAT;
+            STREAM[STREAM_LEN++] = (uint8_t)run;
+            run = 0;
+        }
+        if (i <= n) {
+            STREAM[STREAM_LEN++] = (uint8_t)p;
+            STREAM[STREAM_LEN++] = (uint8_t)d;
+            last_p = p;
+            last_d = d;
+        }
+        if (STREAM_LEN + 4 > MAX_STREAM_LEN) {
+            fprintf(stderr, "%s: stream too long\n", STR(SCORE_NAME));
+            return 1;
+        }
+    }
+
+    // 校验
+    data.pitch = PITCH;
+    data.duration = DURATION;
+    data.stream = STREAM;
+    data.note_num = (uint16_t)n;
+    MusicStreamStart(&stream, &data);
+    for (i = 1; i <= n; i++) {
+        if (!MusicStreamNext(&stream) || stream.note != (uint16_t)notes[i].note ||
+            stream.end != notes[i].end) {
+            fprintf(stderr, "%s: mismatch at note %u\n", STR(SCORE_NAME), i);
+            return 1;
+        }
+    }
+    if (MusicStreamNext(&stream)) {
+        fprintf(stderr, "%s: extra notes after end\n", STR(SCORE_NAME));
+        return 1;
+    }
+
+    // 输出
+    printf("/*-------------------- %s --------------------*/\n", STR(SCORE_NAME));
+    printf("// %u notes, %u bytes of flash, replaces a %u-byte RAM note table\n", n,
+           (unsigned)(PITCH_NUM * 2 + DURATION_NUM * 2 + STREAM_LEN),
+           (unsigned)((n + 1) * sizeof(Note)));
+    PrintTable16("Hz", "PITCH", PITCH, PITCH_NUM);
+    PrintTable16("ms", "DURATION", DURATION, DURATION_NUM);
+    printf("static const uint8_t %s_STREAM[] = {", STR(SCORE_NAME));
+    for (i = 0; i < STREAM_LEN; i += 2) {
+        printf("%s%u, %u,", (i % 16 == 0) ? "\n    " : " ", STREAM[i], STREAM[i + 1]);
+    }
+    printf("\n};\n");
+    printf(
+        "const MusicData_s MUSIC_DATA_%s = {%s_PITCH, %s_DURATION, %s_STREAM, %u};\n\n",
+        STR(SCORE_NAME), STR(SCORE_NAME), STR(SCORE_NAME), STR(SCORE_NAME), n);
+    return 0;
+}
+/*------------------------------ End of File ------------------------------*/
@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+将 application/music 下用 WRITE_NOTE 编写的乐谱转换为压缩音乐格式，生成 music_data.c/h
+
+用法（需要PC上的C编译器，默认cc，可用环境变量CC指定）：
+    python music_convert.py
+
+添加新乐谱：在 SCORES 中添加 (乐谱文件, 初始化函数, 名称)，然后重新运行本脚本。
+每首乐谱转换后都会用 music_stream.c 解码并与原始音符表比较，不一致时报错退出。
+"""
+
+import os
+import subprocess
+import sys
+import tempfile
+
+# (乐谱文件, 初始化函数, 名称)
+SCORES = [
+    ("music_start.c", "MusicStartInit", "START"),
+    ("music_motor_offline.c", "MusicMotorOfflineInit", "MOTOR_OFFLINE"),
+    ("music_rc_offline.c", "MusicRcOfflineInit", "RC_OFFLINE"),
+    ("music_you.c", "MusicYouInit", "YOU"),
+    ("music_unity.c", "MusicUnityInit", "UNITY"),
+    ("music_canon.c", "MusicCanonInit", "CANON"),
+    ("music_castle_in_the_sky.c", "MusicCastleInTheSkyInit", "CASTLE_IN_THE_SKY"),
+    ("music_see_you_again.c", "MusicSeeYouAgainInit", "SEE_YOU_AGAIN"),
+    ("music_hao_yun_lai.c", "MusicHaoYunLaiInit", "HAO_YUN_LAI"),
+    ("music_gong_xi_fa_cai.c", "MusicGongXiFaCaiInit", "GONG_XI_FA_CAI"),
+    ("music_deja_vu.c", "MusicDejaVuInit", "DEJA_VU"),
+    ("music_meow.c", "MusicMeowInit", "MEOW"),
+    ("music_error.c", "MusicErrorInit", "ERROR"),
+    ("music_referee.c", "MusicRefereeConnectInit", "REFEREE_CONNECT"),
+    ("music_referee.c", "MusicRefereeDisconnectInit", "REFEREE_DISCONNECT"),
+]
+
+TOOLS_DIR = os.path.dirname(os.path.abspath(__file__))
+MUSIC_DIR = os.path.dirname(TOOLS_DIR)
+TYPEDEF_DIR = os.path.join(MUSIC_DIR, "..", "typedef")
+BSP_DIR = os.path.join(MUSIC_DIR, "..", "..", "bsp", "boards")
+
+FILE_HEADER = """/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       music_data.c/h
+  * @brief      压缩格式的音乐数据，由 tools/music_convert.py 生成，请勿手动修改
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+"""
+
+
+def convert(score, init, name, workdir):
+    exe = os.path.join(workdir, name.lower())
+    cmd = [
+        os.environ.get("CC", "cc"),
+        "-std=c99",
+        "-O0",
+        "-I" + os.path.join(TOOLS_DIR, "stub"),
+        "-I" + MUSIC_DIR,
+        "-I" + TYPEDEF_DIR,
+        "-I" + BSP_DIR,
+        '-DSCORE_FILE="%s"' % score,
+        "-DSCORE_INIT=" + init,
+        "-DSCORE_NAME=" + name,
+        os.path.join(TOOLS_DIR, "music_convert.c"),
+        os.path.join(MUSIC_DIR, "music_stream.c"),
+        "-o",
+        exe,
+    ]
+    subprocess.check_call(cmd)
+    return subprocess.check_output([exe]).decode("utf-8")
+
+
+def main():
+    body = []
+    with tempfile.TemporaryDirectory() as workdir:
+        for score, init, name in SCORES:
+            try:
+                body.append(convert(score, init, name, workdir))
+            except subprocess.CalledProcessError:
+                sys.exit("convert %s failed" % score)
+            print("converted " + score)
+
+    with open(os.path.join(MUSIC_DIR, "music_data.c"), "w", encoding="utf-8", newline="\n") as f:
+        f.write(FILE_HEADER)
+        f.write('\n#include "music_data.h"\n\n')
+        f.write("// clang-format off\n")
+        f.write("".join(body))
+        f.write("// clang-format on\n")
+        f.write("/*------------------------------ End of File ------------------------------*/\n")
+
+    with open(os.path.join(MUSIC_DIR, "music_data.h"), "w", encoding="utf-8", newline="\n") as f:
+        f.write(FILE_HEADER)
+        f.write("\n#ifndef MUSIC_DATA_H\n#define MUSIC_DATA_H\n\n")
+        f.write('#include "music_typedef.h"\n\n')
+        for _, _, name in SCORES:
+            f.write("extern const MusicData_s MUSIC_DATA_%s;\n" % name)
+        f.write("\n#endif  // MUSIC_DATA_H\n")
+        f.write("/*------------------------------ End of File ------------------------------*/\n")
+
+
+if __name__ == "__main__":
+    main()
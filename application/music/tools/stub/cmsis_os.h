@@ -0,0 +1,6 @@
+// 序列器仿真(buzzer_seq_sim.c)在PC上编译 music_sequencer.c 时使用的头文件，仿真为单线程
+#ifndef CMSIS_OS_H_STUB
+#define CMSIS_OS_H_STUB
+#define taskENTER_CRITICAL()
+#define taskEXIT_CRITICAL()
+#endif
@@ -0,0 +1,51 @@
+// 序列器仿真(buzzer_seq_sim.c)在PC上编译 bsp_buzzer.c 时使用的头文件，
+// 定时器寄存器为普通变量，由仿真程序按参考手册的行为推进
+#ifndef MAIN_H_STUB
+#define MAIN_H_STUB
+#include "struct_typedef.h"
+
+typedef struct
+{
+    volatile uint32_t CR1, CR2, SMCR, DIER, SR, EGR, CCMR1, CCMR2, CCER, CNT, PSC, ARR;
+    volatile uint32_t CCR1, CCR2, CCR3, CCR4;
+} TIM_TypeDef;
+
+typedef struct
+{
+    TIM_TypeDef * Instance;
+} TIM_HandleTypeDef;
+
+extern TIM_TypeDef SIM_TIM2;
+#define TIM2 (&SIM_TIM2)
+
+#define TIM_CR1_CEN (1u << 0)
+#define TIM_CR1_URS (1u << 2)
+#define TIM_CR1_ARPE (1u << 7)
+#define TIM_CR2_MMS (7u << 4)
+#define TIM_CR2_MMS_1 (2u << 4)
+#define TIM_SMCR_SMS (7u << 0)
+#define TIM_SMCR_TS_0 (1u << 4)
+#define TIM_SMCR_TS_1 (2u << 4)
+#define TIM_DIER_UIE (1u << 0)
+#define TIM_SR_UIF (1u << 0)
+#define TIM_EGR_UG (1u << 0)
+#define TIM_CCMR2_OC3PE (1u << 3)
+#define TIM_CHANNEL_3 0x08u
+
+typedef enum { TIM2_IRQn = 28 } IRQn_Type;
+
+#define __weak __attribute__((weak))
+#define __HAL_RCC_TIM2_CLK_ENABLE()
+#define __HAL_TIM_ENABLE(h) ((h)->Instance->CR1 |= TIM_CR1_CEN)
+#define __HAL_TIM_DISABLE(h) ((h)->Instance->CR1 &= ~TIM_CR1_CEN)
+#define __HAL_TIM_PRESCALER(h, psc) ((h)->Instance->PSC = (psc))
+#define __HAL_TIM_SetCompare(h, ch, v) ((h)->Instance->CCR3 = (v))
+
+extern uint32_t HAL_RCC_GetPCLK1Freq(void);
+extern void HAL_TIM_PWM_Start(TIM_HandleTypeDef * htim, uint32_t channel);
+extern void HAL_NVIC_SetPriority(IRQn_Type irq, uint32_t pre, uint32_t sub);
+extern void HAL_NVIC_EnableIRQ(IRQn_Type irq);
+extern void HAL_NVIC_DisableIRQ(IRQn_Type irq);
+extern void HAL_NVIC_ClearPendingIRQ(IRQn_Type irq);
+
+#endif
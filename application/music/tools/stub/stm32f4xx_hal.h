@@ -0,0 +1,4 @@
+// 转换工具在PC上编译乐谱时使用的空头文件，乐谱中不调用任何HAL函数
+#ifndef STM32F4XX_HAL_H_STUB
+#define STM32F4XX_HAL_H_STUB
+#endif
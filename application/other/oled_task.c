@@ -6,6 +6,7 @@
   * @history
   *  Version    Date            Author          Modification
   *  V1.0.0     Nov-11-2019     RM              1. done
+  *  V1.0.1     Oct-19-2026     Penguin         1. 只发送变化的页窗口，不再每次清屏全刷
   *
   @verbatim
   ==============================================================================
@@ -21,6 +22,7 @@
 #include "cmsis_os.h"
 #include "detect_task.h"
 #include "voltage_task.h"
+#include "task_monitor.h"
 
 #define OLED_CONTROL_TIME 10
 #define REFRESH_RATE    10
@@ -61,6 +63,8 @@ void oled_task(void const * argument)
         }
         osDelay(10);
     }
+    //retained mode: every element below overwrites its own area, only the changed windows are sent
+    OLED_operate_gram(PEN_CLEAR);
     while(1)
     {
         //use i2c ack to check the oled
@@ -74,6 +78,7 @@ void oled_task(void const * argument)
         if(last_oled_error == 1 && now_oled_errror == 0)
         {
             OLED_init();
+            OLED_invalidate();
         }
 
         if(now_oled_errror == 0)
@@ -83,21 +88,8 @@ void oled_task(void const * argument)
             if(refresh_tick > configTICK_RATE_HZ / (OLED_CONTROL_TIME * REFRESH_RATE))
             {
                 refresh_tick = 0;
-                OLED_operate_gram(PEN_CLEAR);
                 OLED_show_graphic(0, 1, &battery_box);
-
-                if(get_battery_percentage() < 10)
-                {
-                    OLED_printf(9, 2, "%d", get_battery_percentage());
-                }
-                else if(get_battery_percentage() < 100)
-                {
-                    OLED_printf(6, 2, "%d", get_battery_percentage());
-                }
-                else
-                {
-                    OLED_printf(3, 2, "%d", get_battery_percentage());
-                }
+                OLED_printf(3, 2, "%3d", get_battery_percentage());
 
                 OLED_show_string(90, 27, "DBUS");
                 OLED_show_graphic(115, 27, &check_box[error_list_local[DBUS_TOE].error_exist]);
@@ -119,8 +111,12 @@ void oled_task(void const * argument)
 
                 }
 
-                OLED_refresh_gram();
+                //cpu load and the smallest stack headroom of all tasks
+                OLED_printf(0, 51, "CPU%3d%% STK%4d", GetCpuLoad() / 10, GetMinStackFree());
             }
+
+            //send one changed page window per cycle
+            OLED_refresh_dirty();
         }
 
 
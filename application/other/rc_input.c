@@ -0,0 +1,87 @@
+/**
+  ****************************(C) COPYRIGHT 2025 Polarbear****************************
+  * @file       rc_input.c/h
+  * @brief      遥控器输入处理：SBUS帧解包，通道值归一化，死区和变化率限制
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2025 Polarbear****************************
+  */
+
+#include "rc_input.h"
+
+#include "string.h"
+
+#define SBUS_CH_MASK ((1u << SBUS_CH_BITS) - 1)
+
+/**
+ * @brief          解包SBUS帧中的16个通道
+ * @param[in]      frame SBUS帧(至少25字节)，不检查帧头帧尾
+ * @param[out]     ch 通道值 [0,2047]
+ * @retval         none
+ */
+void SbusUnpack(const uint8_t * frame, uint16_t ch[SBUS_CH_NUM])
+{
+    const uint8_t * payload = frame + 1;
+
+    for (uint8_t i = 0; i < SBUS_CH_NUM; i++) {
+        uint16_t bit = i * SBUS_CH_BITS;
+        uint32_t word;
+        memcpy(&word, payload + (bit >> 3), sizeof(word));  // 小端，最后一个通道读到帧尾
+        ch[i] = (uint16_t)((word >> (bit & 0x07)) & SBUS_CH_MASK);
+    }
+}
+
+/**
+ * @brief          通道值归一化
+ * @param[in]      raw 通道值
+ * @param[in]      mid 中值
+ * @param[in]      half_range 中值到最大值的距离
+ * @retval         [-1,1]
+ */
+fp32 RcNormalize(uint16_t raw, fp32 mid, fp32 half_range)
+{
+    fp32 x = ((fp32)raw - mid) / half_range;
+    if (x > 1.0f) return 1.0f;
+    if (x < -1.0f) return -1.0f;
+    return x;
+}
+
+/**
+ * @brief          死区和变化率限制
+ * @param[in]      filter 滤波参数
+ * @param[in]      last 上一帧的输出
+ * @param[in]      in 归一化后的通道值
+ * @param[in]      dt (s)距上一帧的时间，为0时不限制变化率
+ * @retval         [-1,1]
+ */
+fp32 RcFilterStep(const RcFilter_s * filter, fp32 last, fp32 in, fp32 dt)
+{
+    fp32 db = filter->deadband;
+    if (db > 0.0f) {
+        if (in > db) {
+            in = (in - db) / (1.0f - db);
+        } else if (in < -db) {
+            in = (in + db) / (1.0f - db);
+        } else {
+            in = 0.0f;
+        }
+    }
+
+    if (filter->slew > 0.0f && dt > 0.0f) {
+        fp32 step = filter->slew * dt;
+        if (in > last + step) {
+            in = last + step;
+        } else if (in < last - step) {
+            in = last - step;
+        }
+    }
+    return in;
+}
+/*------------------------------ End of File ------------------------------*/
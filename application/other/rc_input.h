@@ -0,0 +1,49 @@
+/**
+  ****************************(C) COPYRIGHT 2025 Polarbear****************************
+  * @file       rc_input.c/h
+  * @brief      遥控器输入处理：SBUS帧解包，通道值归一化，死区和变化率限制
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+    SBUS帧(25字节)：
+      byte 0:     帧头 0x0F
+      byte 1-22:  16个11位通道，按位小端依次排列
+      byte 23:    标志位，bit2 为接收机丢帧，bit3 为接收机失控保护
+      byte 24:    帧尾
+    解包(SbusUnpack)：
+      第 i 个通道从第 11*i 位开始，每个通道从所在字节读一个32位小端字，移位后取低11位，
+      不需要逐通道手写移位表。
+    滤波(RcFilterStep)：
+      输入为归一化到 [-1,1] 的通道值。死区内输出0，死区外线性拉伸，输出在死区边界处连续；
+      变化率限制按两帧的时间间隔计算单帧最大变化量，参数为0时不处理。
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2025 Polarbear****************************
+  */
+
+#ifndef RC_INPUT_H
+#define RC_INPUT_H
+#include "struct_typedef.h"
+
+#define SBUS_CH_NUM 16
+#define SBUS_CH_BITS 11
+#define SBUS_FLAG_BYTE 23
+
+#define SBUS_FLAG_FRAME_LOST ((uint8_t)0x04)
+#define SBUS_FLAG_FAILSAFE ((uint8_t)0x08)
+
+typedef struct
+{
+    fp32 deadband;  // 死区，[0,1)
+    fp32 slew;      // (1/s)最大变化率，0为不限制
+} RcFilter_s;
+
+extern void SbusUnpack(const uint8_t * frame, uint16_t ch[SBUS_CH_NUM]);
+extern fp32 RcNormalize(uint16_t raw, fp32 mid, fp32 half_range);
+extern fp32 RcFilterStep(const RcFilter_s * filter, fp32 last, fp32 in, fp32 dt);
+
+#endif  // RC_INPUT_H
+/*------------------------------ End of File ------------------------------*/
@@ -4,7 +4,7 @@
   * @brief      遥控器处理，遥控器是通过类似SBUS的协议传输，利用DMA传输方式节约CPU
   *             资源，利用串口空闲中断来拉起处理函数，同时提供一些掉线重启DMA，串口
   *             的方式保证热插拔的稳定性。
-  * @note       该任务是通过串口中断启动，不是freeRTOS任务
+  * @note       串口中断只保存原始帧，由 RcInputUpdate 在通信任务中处理
   * @history
   *  Version    Date            Author          Modification
   *  V1.0.0     Dec-26-2018     RM              1. done
@@ -13,6 +13,9 @@
   *                                             2. support RC HT8A
   *                                             3. support normal sbus RC in struct SBUS_t
   *  V2.0.1     Feb-25-2025     Penguin         1. support RC ET08A
+  *  V2.0.2     Oct-19-2026     Penguin         1. support RC data from CAN board link
+  *  V2.1.0     Oct-19-2026     Penguin         1. 中断中只保存原始帧，在任务中解包、归一化和滤波
+  *  V2.1.1     Oct-19-2026     Penguin         1. 通过CAN接收时使用发送端的遥控器类型
   *
   @verbatim
   ==============================================================================
@@ -33,10 +36,13 @@
 
 #include "remote_control.h"
 
+#include "CAN_communication.h"
+#include "bsp_dwt.h"
 #include "bsp_usart.h"
 #include "communication.h"
 #include "detect_task.h"
 #include "main.h"
+#include "rc_input.h"
 #include "robot_param.h"
 #include "string.h"
 
@@ -48,24 +54,63 @@
 //遥控器出错数据上限
 #define RC_CHANNAL_ERROR_VALUE 700
 
+// 摇杆通道(0-3)的死区和变化率限制
+#ifndef RC_STICK_DEADBAND
+#define RC_STICK_DEADBAND 0.01f
+#endif
+#ifndef RC_STICK_SLEW
+#define RC_STICK_SLEW 0.0f  // (1/s)0为不限制
+#endif
+
 extern UART_HandleTypeDef huart3;
 extern DMA_HandleTypeDef hdma_usart3_rx;
 
-static void SolveSbusData(volatile const uint8_t * sbus_buf, SBUS_t * sbus);
+typedef struct
+{
+    uint8_t data[SBUS_RC_FRAME_LENGTH];
+    uint32_t time;  // (us)
+} SbusFrame_s;
 
-static void CheckRcType(void);
+// 各型号遥控器的通道中值和中值到最大值的距离，表中没有的型号归一化后的通道值为0
+typedef struct
+{
+    fp32 mid;
+    fp32 half_range;
+} RcChRange_s;
+
+static void SbusFrameReceive(const uint8_t * buf);
+static RC_Type_e CheckRcType(uint8_t connect_flag);
 
-// SBUS数据
+// SBUS数据，由 RcInputUpdate 更新
 static SBUS_t SBUS = {.connect_flag = 0xFF};
 
 //接收原始数据，为25个字节，给了50个字节长度，防止DMA传输越界
 static uint8_t sbus_rx_buf[2][SBUS_RX_BUF_NUM];
 
+// 中断保存的原始帧，sbus_frame_seq 为已保存的帧数，最新一帧在 SBUS_FRAME[(seq - 1) & 1]
+static SbusFrame_s SBUS_FRAME[2];
+static volatile uint32_t sbus_frame_seq = 0;
+
 // 上一次接收数据的时间
 static uint32_t last_receive_time = 0;
 
-// 遥控器类型
-static RC_Type_e rc_type;
+// 处理后的遥控器数据，双缓冲，rc_input_idx 为已发布的一份
+static RcInput_s RC_INPUT[2];
+static volatile uint8_t rc_input_idx = 0;
+static RcInputStats_s RC_INPUT_STATS;
+
+// clang-format off
+static const RcChRange_s RC_CH_RANGE[] = {
+    [RC_TYPE_AT9S_PRO]      = {AT9S_PRO_RC_CH_VALUE_OFFSET,
+                               (AT9S_PRO_RC_CH_VALUE_MAX - AT9S_PRO_RC_CH_VALUE_MIN) / 2.0f},
+    [RC_TYPE_ET08A]         = {ET08A_RC_CH_VALUE_OFFSET,
+                               (ET08A_RC_CH_VALUE_MAX - ET08A_RC_CH_VALUE_MIN) / 2.0f},
+    [RC_TYPE_ESP32_TRACKER] = {1023.5f, 1023.5f},  // 通道值为 [0,2047] 上的绝对量
+};
+// clang-format on
+
+static const RcFilter_s RC_STICK_FILTER = {RC_STICK_DEADBAND, RC_STICK_SLEW};
+static const RcFilter_s RC_NO_FILTER = {0.0f, 0.0f};
 
 /**
   * @brief          遥控器初始化
@@ -121,7 +166,7 @@ void USART3_IRQHandler(void)
             __HAL_DMA_ENABLE(&hdma_usart3_rx);
 
             if (this_time_rx_len == SBUS_RC_FRAME_LENGTH) {
-                SolveSbusData(sbus_rx_buf[1], &SBUS);
+                SbusFrameReceive(sbus_rx_buf[0]);
             }
         } else {
             /* Current memory buffer used is Memory 1 */
@@ -146,62 +191,139 @@ void USART3_IRQHandler(void)
             __HAL_DMA_ENABLE(&hdma_usart3_rx);
 
             if (this_time_rx_len == SBUS_RC_FRAME_LENGTH) {
-                SolveSbusData(sbus_rx_buf[1], &SBUS);
+                SbusFrameReceive(sbus_rx_buf[1]);
             }
         }
     }
 }
 
-static void SolveSbusData(volatile const uint8_t * sbus_buf, SBUS_t * sbus)
+/**
+  * @brief          保存原始帧，在串口中断中调用
+  * @param[in]      buf 刚接收完的DMA缓冲区
+  * @retval         none
+  */
+static void SbusFrameReceive(const uint8_t * buf)
 {
-    // clang-format off
-    sbus->ch[0] =((sbus_buf[2]<<8)   + (sbus_buf[1]))     & 0x07ff;                    \
-    sbus->ch[1] =((sbus_buf[3]<<5)   + (sbus_buf[2]>>3))  & 0x07ff;                    \
-    sbus->ch[2] =((sbus_buf[5]<<10)  + (sbus_buf[4]<<2) + (sbus_buf[3]>>6)) & 0x07ff;  \
-    sbus->ch[3] =((sbus_buf[6]<<7)   + (sbus_buf[5]>>1))  & 0x07ff;                    \
-    sbus->ch[4] =((sbus_buf[7]<<4)   + (sbus_buf[6]>>4))  & 0x07ff;                    \
-    sbus->ch[5] =((sbus_buf[9]<<9)   + (sbus_buf[8]<<1) + (sbus_buf[7]>>7)) & 0x07ff;  \
-    sbus->ch[6] =((sbus_buf[10]<<6)  + (sbus_buf[9]>>2))  & 0x07ff;                    \
-    sbus->ch[7] =((sbus_buf[11]<<3)  + (sbus_buf[10]>>5)) & 0x07ff;                    \
-    sbus->ch[8] =((sbus_buf[13]<<8)  + (sbus_buf[12]))    & 0x07ff;                    \
-    sbus->ch[9] =((sbus_buf[14]<<5)  + (sbus_buf[13]>>3)) & 0x07ff;                    \
-    sbus->ch[10]=((sbus_buf[16]<<10) + (sbus_buf[15]<<2) + (sbus_buf[14]>>6)) & 0x07ff;\
-    sbus->ch[11]=((sbus_buf[17]<<7)  + (sbus_buf[16]>>1)) & 0x07ff;                    \
-    sbus->ch[12]=((sbus_buf[18]<<4)  + (sbus_buf[17]>>4)) & 0x07ff;                    \
-    sbus->ch[13]=((sbus_buf[20]<<9)  + (sbus_buf[19]<<1) + (sbus_buf[18]>>7)) & 0x07ff;\
-    sbus->ch[14]=((sbus_buf[21]<<6)  + (sbus_buf[20]>>2)) & 0x07ff;                    \
-    sbus->ch[15]=((sbus_buf[22]<<3)  + (sbus_buf[21]>>5)) & 0x07ff;                    \
-    sbus->connect_flag = sbus_buf[23];
-    // clang-format on
-
-    // 检查遥控器类型
-    CheckRcType();
+    SbusFrame_s * frame = &SBUS_FRAME[sbus_frame_seq & 1];
+    memcpy(frame->data, buf, SBUS_RC_FRAME_LENGTH);
+    frame->time = dwt_get_us();
+    __DMB();
+    sbus_frame_seq++;
 
     // 记录数据接收时间
     last_receive_time = HAL_GetTick();
 }
 
-static void CheckRcType()
+/**
+  * @brief          取出中断保存的最新一帧
+  * @param[out]     raw 通道值
+  * @param[out]     flag 标志位
+  * @param[out]     time (us)接收时刻
+  * @retval         是否有新的一帧
+  */
+static bool SbusFrameTake(uint16_t raw[SBUS_CH_NUM], uint8_t * flag, uint32_t * time)
+{
+    static uint32_t last_seq = 0;
+    uint32_t seq = sbus_frame_seq;
+    if (seq == last_seq) {
+        return false;
+    }
+
+    SbusFrame_s frame = SBUS_FRAME[(seq - 1) & 1];
+    __DMB();
+    if (sbus_frame_seq - seq > 1) {
+        // 复制期间该缓冲区被新的一帧覆盖，下次再取
+        return false;
+    }
+
+    RC_INPUT_STATS.overrun += seq - last_seq - 1;
+    last_seq = seq;
+    SbusUnpack(frame.data, raw);
+    *flag = frame.data[SBUS_FLAG_BYTE];
+    *time = frame.time;
+    return true;
+}
+
+static RC_Type_e CheckRcType(uint8_t connect_flag)
+{
+    switch (connect_flag) {
+        case ET08A_RC_CONNECTED_FLAG:
+            return RC_TYPE_ET08A;
+        case ESP32_TRACKER_CONNECTED_FLAG:
+            return RC_TYPE_ESP32_TRACKER;
+        default:
+            return RC_TYPE_UNKNOW;
+    }
+}
+
+/**
+  * @brief          处理遥控器数据，每个任务周期调用一次
+  * @note           直连接收机时每收到一帧处理一次；通过CAN接收时每次调用都更新
+  * @retval         none
+  */
+void RcInputUpdate(void)
 {
-    switch (SBUS.connect_flag) {
-        case ET08A_RC_CONNECTED_FLAG: {
-            rc_type = RC_TYPE_ET08A;
-        } break;
-
-        case ESP32_TRACKER_CONNECTED_FLAG: {
-            rc_type = RC_TYPE_ESP32_TRACKER;
-        } break;
-
-        default: {
-            rc_type = RC_TYPE_UNKNOW;
-        } break;
+    const RcInput_s * last = &RC_INPUT[rc_input_idx];
+    RcInput_s * next = &RC_INPUT[rc_input_idx ^ 1];
+
+#if __CONTROL_LINK_RC == CL_RC_CAN
+    for (uint8_t i = 0; i < SBUS_CH_NUM; i++) {
+        next->raw[i] = GetCanRcCh(i);
+    }
+    next->flag = 0;
+    next->time = dwt_get_us();
+    next->type = GetCanRcType();
+#else
+    if (!SbusFrameTake(next->raw, &next->flag, &next->time)) {
+        return;
+    }
+    next->type = CheckRcType(next->flag);
+#endif
+
+    if (next->flag & SBUS_FLAG_FRAME_LOST) RC_INPUT_STATS.lost++;
+    if (next->flag & SBUS_FLAG_FAILSAFE) RC_INPUT_STATS.failsafe++;
+    RC_INPUT_STATS.frame++;
+
+    // 第一帧和遥控器型号变化时不限制变化率
+    fp32 dt = 0.0f;
+    if (last->seq > 0 && last->type == next->type) {
+        dt = (next->time - last->time) * 1e-6f;
+    }
+
+    const RcChRange_s * range = NULL;
+    if (next->type < sizeof(RC_CH_RANGE) / sizeof(RC_CH_RANGE[0])) {
+        range = &RC_CH_RANGE[next->type];
     }
+    for (uint8_t i = 0; i < SBUS_CH_NUM; i++) {
+        if (range == NULL || range->half_range <= 0.0f) {
+            next->ch[i] = 0.0f;
+            continue;
+        }
+        fp32 x = RcNormalize(next->raw[i], range->mid, range->half_range);
+        // 自定义控制器的通道为绝对量，不做处理
+        const RcFilter_s * filter = (i < 4 && next->type != RC_TYPE_ESP32_TRACKER)
+                                        ? &RC_STICK_FILTER
+                                        : &RC_NO_FILTER;
+        next->ch[i] = RcFilterStep(filter, last->ch[i], x, dt);
+    }
+    next->seq = last->seq + 1;
+
+    memcpy(SBUS.ch, next->raw, sizeof(SBUS.ch));
+    SBUS.connect_flag = next->flag;
+
+    __DMB();
+    rc_input_idx ^= 1;
 }
 
 /******************************************************************/
 /* API                                                            */
 /*----------------------------------------------------------------*/
-/* function:      GetRcOffline                                    */
+/* function:      GetSbusOffline                                  */
+/*                GetSbusCh                                       */
+/*                GetRcCh                                         */
+/*                GetRcType                                       */
+/*                GetRcInput                                      */
+/*                GetRcInputStats                                 */
 /*                GetDt7RcCh                                      */
 /*                GetDt7RcSw                                      */
 /*                GetDt7MouseSpeed                                */
@@ -219,9 +341,11 @@ inline bool GetSbusOffline(void)
 
 #if __CONTROL_LINK_RC == CL_RC_DIRECT
     return ((now - last_receive_time > RC_LOST_TIME) && (now < RC_LOST_TIME)) ||
-           (!rc_type);
+           (GetRcType() == RC_TYPE_UNKNOW);
 #elif __CONTROL_LINK_RC == CL_RC_UART2
     return GetUartRcOffline();
+#elif __CONTROL_LINK_RC == CL_RC_CAN
+    return GetCanRcOffline();
 #else
     return true;
 #endif
@@ -232,12 +356,28 @@ inline bool GetSbusOffline(void)
   * @param[in]      ch 通道id [0,15]
   * @retval         SBUS通道值，范围为 [0, 2048]
   */
-inline uint16_t GetSbusCh(uint8_t ch) { return SBUS.ch[ch]; }
+inline uint16_t GetSbusCh(uint8_t ch) { return RC_INPUT[rc_input_idx].raw[ch]; }
+
+/**
+  * @brief          获取归一化并经过死区和变化率限制的通道值。
+  * @param[in]      ch 通道id [0,15]
+  * @retval         [-1,1]，自定义控制器的通道按 [0,2047] 线性映射到 [-1,1]
+  */
+inline fp32 GetRcCh(uint8_t ch) { return RC_INPUT[rc_input_idx].ch[ch]; }
 
 /**
   * @brief          获取遥控器型号。
   * @retval         遥控器型号
   */
-inline RC_Type_e GetRcType(void) { return rc_type; }
+inline RC_Type_e GetRcType(void) { return RC_INPUT[rc_input_idx].type; }
+
+/**
+  * @brief          获取最近一帧遥控器数据，同一帧的各通道值一致。
+  * @note           指向的数据在处理完之后的第二帧时被覆盖，不要长期保存
+  * @retval         遥控器数据
+  */
+const RcInput_s * GetRcInput(void) { return &RC_INPUT[rc_input_idx]; }
+
+const RcInputStats_s * GetRcInputStats(void) { return &RC_INPUT_STATS; }
 
 /*------------------------------ End of File ------------------------------*/
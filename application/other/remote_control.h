@@ -4,7 +4,7 @@
   * @brief      遥控器处理，遥控器是通过类似SBUS的协议传输，利用DMA传输方式节约CPU
   *             资源，利用串口空闲中断来拉起处理函数，同时提供一些掉线重启DMA，串口
   *             的方式保证热插拔的稳定性。
-  * @note       该任务是通过串口中断启动，不是freeRTOS任务
+  * @note       串口中断只保存原始帧，由 RcInputUpdate 在通信任务中处理
   * @history
   *  Version    Date            Author          Modification
   *  V1.0.0     Dec-26-2018     RM              1. done
@@ -13,6 +13,9 @@
   *                                             2. support RC HT8A
   *                                             3. support normal sbus RC in struct Sbus_t
   *  V2.0.1     Feb-25-2025     Penguin         1. support RC ET08A
+  *  V2.0.2     Oct-19-2026     Penguin         1. support RC data from CAN board link
+  *  V2.1.0     Oct-19-2026     Penguin         1. 中断中只保存原始帧，在任务中解包、归一化和滤波
+  *  V2.1.1     Oct-19-2026     Penguin         1. 通过CAN接收时使用发送端的遥控器类型
   *
   @verbatim
   ==============================================================================
@@ -26,6 +29,14 @@
   ET08A 遥控器设置指南：
     1. 设置 主菜单->系统设置->摇杆模式 为模式2
     2. 设置 主菜单->通用功能->通道设置 5通道为 [辅助1 SB --] 6通道为 [辅助2 SC --]
+
+  数据处理流程：
+    1. USART3 空闲中断：DMA收满一帧时复制到原始帧缓冲区并记录时刻，不做解包
+    2. RcInputUpdate(通信任务，1ms)：取出最新一帧，解包，按标志位判断遥控器型号，
+       按型号归一化到 [-1,1]，摇杆通道(0-3)按 RC_STICK_DEADBAND 和 RC_STICK_SLEW 做死区和
+       变化率限制，最后整帧发布。标志位中的丢帧和失控保护计入 RcInputStats_s
+    3. 使用方通过 GetSbusCh(原始值)、GetRcCh(处理后的值)或 GetRcInput(整帧)读取，
+       同一帧内各通道值一致
   ==============================================================================
   @endverbatim
   ****************************(C) COPYRIGHT 2025 Polarbear****************************
@@ -78,12 +89,31 @@ typedef enum {
     RC_TYPE_ESP32_TRACKER,
 } RC_Type_e;
 
+typedef struct
+{
+    uint32_t seq;      // 已处理的帧数
+    uint32_t time;     // (us)帧接收时刻
+    RC_Type_e type;    // 遥控器型号
+    uint8_t flag;      // SBUS标志位
+    uint16_t raw[16];  // 原始通道值
+    fp32 ch[16];       // 归一化并经过死区和变化率限制的通道值 [-1,1]
+} RcInput_s;
+
+typedef struct
+{
+    uint32_t frame;     // 处理的帧数
+    uint32_t lost;      // 标志位中接收机丢帧的帧数
+    uint32_t failsafe;  // 标志位中接收机失控保护的帧数
+    uint32_t overrun;   // 未来得及处理就被新一帧覆盖的帧数
+} RcInputStats_s;
+
 /* ----------------------- Internal Data ----------------------------------- */
 
 extern void remote_control_init(void);
 extern const SBUS_t * get_sbus_point(void);
 extern void slove_RC_lost(void);
 extern void slove_data_error(void);
+extern void RcInputUpdate(void);
 
 /******************************************************************/
 /* API                                                            */
@@ -91,7 +121,10 @@ extern void slove_data_error(void);
 
 extern inline bool GetSbusOffline(void);
 extern inline uint16_t GetSbusCh(uint8_t ch);
+extern inline fp32 GetRcCh(uint8_t ch);
 extern inline RC_Type_e GetRcType(void);
+extern const RcInput_s * GetRcInput(void);
+extern const RcInputStats_s * GetRcInputStats(void);
 
 #endif
 /*------------------------------ End of File ------------------------------*/
@@ -0,0 +1,162 @@
+/**
+  ****************************(C) COPYRIGHT 2025 Polarbear****************************
+  * @file       rc_input_test.c
+  * @brief      在PC上运行的遥控器输入处理测试程序，检查SBUS解包、归一化、死区和变化率限制
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+    编译运行：
+      cc -O2 -I.. -I../../typedef -o rc_input_test rc_input_test.c ../rc_input.c -lm
+      ./rc_input_test
+    检查项(任一不满足返回非0)：
+      1. 随机帧的解包结果与原来逐通道移位的写法相同，并打印两者的耗时
+      2. ET08A 通道最小值、中值、最大值归一化为 -1、0、1，超出范围时限幅
+      3. 死区内输出0，死区边界两侧输出连续，满量程输出仍为 ±1
+      4. 阶跃输入时每帧的变化量不超过 slew * dt，且最终到达目标；slew 为0时不限制
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2025 Polarbear****************************
+  */
+
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "rc_input.h"
+
+#define UNPACK_CASE 1000000
+#define EPS 1e-5f
+
+static uint32_t SEED = 1;
+
+static uint32_t RandU32(void)
+{
+    SEED = SEED * 1664525u + 1013904223u;
+    return SEED;
+}
+
+// 原来在串口中断中的解包写法
+static void SbusUnpackRef(const uint8_t * sbus_buf, uint16_t * ch)
+{
+    // clang-format off
+    ch[0] =((sbus_buf[2]<<8)   + (sbus_buf[1]))     & 0x07ff;
+    ch[1] =((sbus_buf[3]<<5)   + (sbus_buf[2]>>3))  & 0x07ff;
+    ch[2] =((sbus_buf[5]<<10)  + (sbus_buf[4]<<2) + (sbus_buf[3]>>6)) & 0x07ff;
+    ch[3] =((sbus_buf[6]<<7)   + (sbus_buf[5]>>1))  & 0x07ff;
+    ch[4] =((sbus_buf[7]<<4)   + (sbus_buf[6]>>4))  & 0x07ff;
+    ch[5] =((sbus_buf[9]<<9)   + (sbus_buf[8]<<1) + (sbus_buf[7]>>7)) & 0x07ff;
+    ch[6] =((sbus_buf[10]<<6)  + (sbus_buf[9]>>2))  & 0x07ff;
+    ch[7] =((sbus_buf[11]<<3)  + (sbus_buf[10]>>5)) & 0x07ff;
+    ch[8] =((sbus_buf[13]<<8)  + (sbus_buf[12]))    & 0x07ff;
+    ch[9] =((sbus_buf[14]<<5)  + (sbus_buf[13]>>3)) & 0x07ff;
+    ch[10]=((sbus_buf[16]<<10) + (sbus_buf[15]<<2) + (sbus_buf[14]>>6)) & 0x07ff;
+    ch[11]=((sbus_buf[17]<<7)  + (sbus_buf[16]>>1)) & 0x07ff;
+    ch[12]=((sbus_buf[18]<<4)  + (sbus_buf[17]>>4)) & 0x07ff;
+    ch[13]=((sbus_buf[20]<<9)  + (sbus_buf[19]<<1) + (sbus_buf[18]>>7)) & 0x07ff;
+    ch[14]=((sbus_buf[21]<<6)  + (sbus_buf[20]>>2)) & 0x07ff;
+    ch[15]=((sbus_buf[22]<<3)  + (sbus_buf[21]>>5)) & 0x07ff;
+    // clang-format on
+}
+
+static double Seconds(void) { return (double)clock() / CLOCKS_PER_SEC; }
+
+int main(void)
+{
+    int fail = 0;
+
+    // 1. 解包
+    {
+        static uint8_t frames[256][25];
+        uint16_t ch[SBUS_CH_NUM], ref[SBUS_CH_NUM];
+        volatile uint32_t sink = 0;
+        int err = 0;
+
+        for (int i = 0; i < 256; i++) {
+            for (int j = 0; j < 25; j++) frames[i][j] = (uint8_t)RandU32();
+            SbusUnpack(frames[i], ch);
+            SbusUnpackRef(frames[i], ref);
+            for (int c = 0; c < SBUS_CH_NUM; c++) {
+                if (ch[c] != ref[c]) err++;
+            }
+        }
+
+        double t0 = Seconds();
+        for (int i = 0; i < UNPACK_CASE; i++) {
+            SbusUnpack(frames[i & 0xFF], ch);
+            sink += ch[i & 0x0F];
+        }
+        double t1 = Seconds();
+        for (int i = 0; i < UNPACK_CASE; i++) {
+            SbusUnpackRef(frames[i & 0xFF], ref);
+            sink += ref[i & 0x0F];
+        }
+        double t2 = Seconds();
+
+        printf(
+            "unpack: %d errors, %.1f ns/frame (shift table %.1f ns/frame)\n", err,
+            (t1 - t0) * 1e9 / UNPACK_CASE, (t2 - t1) * 1e9 / UNPACK_CASE);
+        if (err) fail = 1;
+    }
+
+    // 2. 归一化(ET08A 353/1024/1694)
+    {
+        fp32 half = (1694 - 353) / 2.0f;
+        fp32 min = RcNormalize(353, 1024, half);
+        fp32 mid = RcNormalize(1024, 1024, half);
+        fp32 max = RcNormalize(1694, 1024, half);
+        fp32 over = RcNormalize(2047, 1024, half);
+        printf("normalize: %.4f %.4f %.4f %.4f\n", min, mid, max, over);
+        if (fabsf(min + 1.0f) > 2e-3f || mid != 0.0f || fabsf(max - 1.0f) > 2e-3f ||
+            over != 1.0f) {
+            fail = 1;
+        }
+    }
+
+    // 3. 死区
+    {
+        RcFilter_s f = {0.05f, 0.0f};
+        int err = 0;
+        if (RcFilterStep(&f, 0, 0.05f, 0) != 0.0f) err++;
+        if (RcFilterStep(&f, 0, -0.03f, 0) != 0.0f) err++;
+        if (fabsf(RcFilterStep(&f, 0, 0.05f + EPS, 0)) > 2 * EPS) err++;
+        if (fabsf(RcFilterStep(&f, 0, 1.0f, 0) - 1.0f) > EPS) err++;
+        if (fabsf(RcFilterStep(&f, 0, -1.0f, 0) + 1.0f) > EPS) err++;
+        fp32 last = -1.0f;
+        for (fp32 x = -1.0f; x <= 1.0f; x += 0.001f) {
+            fp32 y = RcFilterStep(&f, 0, x, 0);
+            if (y < last) err++;  // 单调
+            last = y;
+        }
+        printf("deadband: %d errors\n", err);
+        if (err) fail = 1;
+    }
+
+    // 4. 变化率限制，ET08A 约7ms一帧
+    {
+        RcFilter_s f = {0.0f, 10.0f};
+        fp32 dt = 0.007f;
+        fp32 y = -1.0f;
+        int frame = 0;
+        int err = 0;
+        while (y < 1.0f && frame < 1000) {
+            fp32 next = RcFilterStep(&f, y, 1.0f, dt);
+            if (next - y > f.slew * dt + EPS) err++;
+            y = next;
+            frame++;
+        }
+        int expect = (int)ceilf(2.0f / (f.slew * dt));
+        if (y != 1.0f || frame > expect + 1) err++;
+
+        RcFilter_s none = {0.0f, 0.0f};
+        if (RcFilterStep(&none, -1.0f, 1.0f, dt) != 1.0f) err++;
+        if (RcFilterStep(&f, -1.0f, 1.0f, 0.0f) != 1.0f) err++;
+        printf("slew: %d frames to full scale (expect %d), %d errors\n", frame, expect, err);
+        if (err) fail = 1;
+    }
+
+    printf(fail ? "FAIL\n" : "PASS\n");
+    return fail;
+}
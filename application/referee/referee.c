@@ -6,6 +6,7 @@
   * @history
   *  Version    Date            Author          Modification
   *  V1.0.0     2024/3/6         YZX             1.更新裁判系统通信协议至1.6.1（不包含半自动步兵和UI）
+  *  V1.0.1     Oct-19-2026     Penguin         1.自定义控制器数据按custom_controller_codec解码，统计延迟和丢帧
   @verbatim
   =================================================================================
 
@@ -46,9 +47,11 @@ buff_t buff_musk_t;
 air_support_data_t robot_energy_t;
 hurt_data_t robot_hurt_t;
 shoot_data_t shoot_data;
+static uint32_t shoot_data_count = 0;  // 收到的射速包数量
 ext_bullet_remaining_t bullet_remaining_t;
 robot_interaction_data_t student_interactive_data_t;
 CustomControllerData_t CUSTOM_CONTROLLER_DATA;  //自定义控制器数据
+static CcReceiver_s CUSTOM_CONTROLLER_RX;       //自定义控制器解码结果和链路统计
 
 ext_robot_command_t robot_command_t;
 
@@ -77,6 +80,7 @@ void init_referee_struct_data(void)
 
     memset(&student_interactive_data_t, 0, sizeof(robot_interaction_data_t));
     memset(&CUSTOM_CONTROLLER_DATA, 0, sizeof(CustomControllerData_t));
+    memset(&CUSTOM_CONTROLLER_RX, 0, sizeof(CcReceiver_s));
 
     memset(&robot_command_t, 0, sizeof(ext_robot_command_t));
 }
@@ -159,6 +163,7 @@ void referee_data_solve(uint8_t * frame)
         } break;
         case SHOOT_DATA_CMD_ID: {
             memcpy(&shoot_data, frame + index, sizeof(shoot_data_t));
+            shoot_data_count++;
             referee_online_time = HAL_GetTick();
         } break;
         case BULLET_REMAINING_CMD_ID: {
@@ -172,6 +177,8 @@ void referee_data_solve(uint8_t * frame)
         case CUSTOM_CONTROLLER_CMD_ID: {
             memcpy(&CUSTOM_CONTROLLER_DATA, frame + index, sizeof(CustomControllerData_t));
             referee_online_time = HAL_GetTick();
+            CustomControllerReceive(
+                &CUSTOM_CONTROLLER_RX, CUSTOM_CONTROLLER_DATA.data, referee_online_time);
         } break;
         case ROBOT_COMMAND_CMD_ID: {
             memcpy(&robot_command_t, frame + index, sizeof(ext_robot_command_t));
@@ -210,6 +217,14 @@ void get_shoot_heat42_limit_and_heat42(uint16_t * heat_limit, uint16_t * heat)
     *heat = power_heat_data.shooter_42mm_barrel_heat;
 }
 
+uint16_t get_shoot_cooling_value(void) { return robot_status.shooter_barrel_cooling_value; }
+
+void get_shoot_speed_and_count(fp32 * speed, uint32_t * count)
+{
+    *speed = shoot_data.initial_speed;
+    *count = shoot_data_count;
+}
+
 /**
  * @brief 反馈机器人颜色
  * @param  none
@@ -258,6 +273,8 @@ uint16_t get_shoot_heat(void)  // 双枪管哨兵
 
 CustomControllerData_t * GetCustomControllerDataPoint(void) { return &CUSTOM_CONTROLLER_DATA; }
 
+const CcReceiver_s * GetCustomControllerReceiver(void) { return &CUSTOM_CONTROLLER_RX; }
+
 /*========== API ==========*/
 
 inline bool GetRefereeOffline(void)
@@ -267,16 +284,16 @@ inline bool GetRefereeOffline(void)
 }
 
 /**
- * @brief 获取自定义控制器数据
- * @param  index 数据索引
- * @return float 数据
+ * @brief 获取自定义控制器数据，最近一帧中最新的样本
+ * @param  index 关节索引
+ * @return float (rad)关节位置
  */
 inline float GetCustomControllerPos(uint8_t index)
 {
-    float data = 0;
-    memcpy(&data, &CUSTOM_CONTROLLER_DATA.data[index * 4], 4);
-    return data;
-    // return *((float *)(&CUSTOM_CONTROLLER_DATA.data[index * 4]));
+    if (index >= CC_CODEC_JOINT_NUM) {
+        return 0;
+    }
+    return CUSTOM_CONTROLLER_RX.frame.pos[0][index];
 }
 
 /*------------------------------ End of File ------------------------------*/
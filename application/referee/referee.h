@@ -15,6 +15,7 @@
 */
 #ifndef REFEREE_H
 #define REFEREE_H
+#include "custom_controller_codec.h"
 #include "main.h"
 #include "protocol.h"
 #include "stdbool.h"
@@ -283,8 +284,11 @@ extern uint8_t get_team_color(void);
 extern void get_shoot_heat0_limit_and_heat0(uint16_t * heat0_limit, uint16_t * heat0);
 extern void get_shoot_heat1_limit_and_heat1(uint16_t * heat1_limit, uint16_t * heat1);
 extern void get_shoot_heat42_limit_and_heat42(uint16_t *heat_limit, uint16_t *heat);
+extern uint16_t get_shoot_cooling_value(void);
+extern void get_shoot_speed_and_count(fp32 * speed, uint32_t * count);
 
 extern CustomControllerData_t * GetCustomControllerDataPoint(void);
+extern const CcReceiver_s * GetCustomControllerReceiver(void);
 
 /*========== API ==========*/
 
@@ -0,0 +1,234 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       CAN_board_codec.c/h
+  * @brief      板间CAN通信的按位打包，多个数据段共享一帧，按优先级和过期程度选择发送的数据段
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *  V1.0.1     Oct-19-2026     Penguin         1. CanBoardUnpack返回帧中的数据段掩码
+  *
+  @verbatim
+  ==============================================================================
+
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include "CAN_board_codec.h"
+
+#include "string.h"
+
+#define CAN_BOARD_STALE_PERIOD 3  // 超过该数量的发送周期未收到，认为数据过期
+
+/**
+ * @brief          从 pos 位开始写入 bits 位
+ */
+static void BitWrite(uint8_t data[8], uint8_t * pos, uint32_t value, uint8_t bits)
+{
+    for (uint8_t i = 0; i < bits; i++, (*pos)++) {
+        if (value & (1u << i)) {
+            data[*pos >> 3] |= (uint8_t)(1u << (*pos & 0x07));
+        }
+    }
+}
+
+/**
+ * @brief          从 pos 位开始读取 bits 位
+ */
+static uint32_t BitRead(const uint8_t data[8], uint8_t * pos, uint8_t bits)
+{
+    uint32_t value = 0;
+    for (uint8_t i = 0; i < bits; i++, (*pos)++) {
+        if (data[*pos >> 3] & (1u << (*pos & 0x07))) {
+            value |= 1u << i;
+        }
+    }
+    return value;
+}
+
+static uint8_t TopicBits(const CanBoardSchema_s * schema)
+{
+    uint8_t bits = 0;
+    for (uint8_t i = 0; i < schema->field_num; i++) {
+        bits += schema->field_bits[i];
+    }
+    return bits;
+}
+
+/**
+ * @brief          选出下一个放入帧的数据段
+ * @param[in]      link 链路状态
+ * @param[in]      now_ms (ms)当前时刻
+ * @param[in]      mask 已放入的数据段
+ * @param[in]      free_bits 帧中剩余的位数
+ * @param[in]      min_ratio 过期程度(距上次发送的时间/周期)的下限
+ * @retval         数据段编号，没有可放入的数据段时为 CAN_BOARD_TOPIC_MAX
+ */
+static uint8_t TopicSelect(
+    const CanBoardLink_s * link, uint32_t now_ms, uint8_t mask, uint8_t free_bits, fp32 min_ratio)
+{
+    uint8_t best = CAN_BOARD_TOPIC_MAX;
+    fp32 best_ratio = 0.0f;
+
+    for (uint8_t id = 0; id < link->topic_num; id++) {
+        const CanBoardSchema_s * schema = &link->schema[id];
+        if (!link->topic[id].enable || (mask & (1u << id)) || TopicBits(schema) > free_bits) {
+            continue;
+        }
+        fp32 ratio = (fp32)(now_ms - link->topic[id].last_time) / (fp32)schema->period;
+        if (ratio < min_ratio) {
+            continue;
+        }
+        if (best == CAN_BOARD_TOPIC_MAX || schema->priority < link->schema[best].priority ||
+            (schema->priority == link->schema[best].priority && ratio > best_ratio)) {
+            best = id;
+            best_ratio = ratio;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief          初始化，所有数据段默认不发送
+ * @param[out]     link 链路状态
+ * @param[in]      schema 数据段描述表
+ * @param[in]      num 数据段数量，不超过 CAN_BOARD_TOPIC_MAX
+ * @retval         none
+ */
+void CanBoardLinkInit(CanBoardLink_s * link, const CanBoardSchema_s * schema, uint8_t num)
+{
+    memset(link, 0, sizeof(CanBoardLink_s));
+    link->schema = schema;
+    link->topic_num = num > CAN_BOARD_TOPIC_MAX ? CAN_BOARD_TOPIC_MAX : num;
+}
+
+/**
+ * @brief          选择到期的数据段打包成一帧
+ * @param[in,out]  link 链路状态，发送端的数据段值需要在调用前更新
+ * @param[in]      now_ms (ms)当前时刻
+ * @param[out]     data 帧数据
+ * @retval         是否打包了一帧，没有到期的数据段时不打包
+ */
+bool_t CanBoardPack(CanBoardLink_s * link, uint32_t now_ms, uint8_t data[8])
+{
+    uint8_t mask = 0;
+    uint8_t free_bits = CAN_BOARD_FRAME_BITS - CAN_BOARD_HEAD_BITS;
+    uint8_t id;
+
+    // 到期的数据段
+    while ((id = TopicSelect(link, now_ms, mask, free_bits, 1.0f)) != CAN_BOARD_TOPIC_MAX) {
+        mask |= (uint8_t)(1u << id);
+        free_bits -= TopicBits(&link->schema[id]);
+    }
+    if (mask == 0) {
+        return 0;
+    }
+    // 捎带过半周期的数据段
+    while ((id = TopicSelect(link, now_ms, mask, free_bits, 0.5f)) != CAN_BOARD_TOPIC_MAX) {
+        mask |= (uint8_t)(1u << id);
+        free_bits -= TopicBits(&link->schema[id]);
+    }
+
+    uint8_t pos = 0;
+    memset(data, 0, 8);
+    BitWrite(data, &pos, link->seq & CAN_BOARD_SEQ_MASK, 4);
+    BitWrite(data, &pos, mask, 4);
+    for (id = 0; id < link->topic_num; id++) {
+        if (!(mask & (1u << id))) {
+            continue;
+        }
+        const CanBoardSchema_s * schema = &link->schema[id];
+        for (uint8_t i = 0; i < schema->field_num; i++) {
+            BitWrite(data, &pos, link->topic[id].value[i], schema->field_bits[i]);
+        }
+        link->topic[id].last_time = now_ms;
+        link->topic_count++;
+    }
+
+    link->seq++;
+    link->frame++;
+    link->payload_bits += pos - CAN_BOARD_HEAD_BITS;
+    return 1;
+}
+
+/**
+ * @brief          解包收到的一帧并更新丢帧统计
+ * @param[in,out]  link 链路状态
+ * @param[in]      data 帧数据
+ * @param[in]      now_ms (ms)到达时刻
+ * @retval         帧中的数据段掩码，丢弃的帧为0
+ */
+uint8_t CanBoardUnpack(CanBoardLink_s * link, const uint8_t data[8], uint32_t now_ms)
+{
+    uint8_t pos = 0;
+    uint8_t seq = (uint8_t)BitRead(data, &pos, 4);
+    uint8_t mask = (uint8_t)BitRead(data, &pos, 4);
+
+    // 整帧检查后再写入，避免两块板的数据段表不一致时写入错位的数据
+    uint8_t bits = CAN_BOARD_HEAD_BITS;
+    for (uint8_t id = 0; id < CAN_BOARD_TOPIC_MAX; id++) {
+        if (!(mask & (1u << id))) {
+            continue;
+        }
+        if (id >= link->topic_num) {
+            link->rx_error++;
+            return 0;
+        }
+        bits += TopicBits(&link->schema[id]);
+    }
+    if (bits > CAN_BOARD_FRAME_BITS) {
+        link->rx_error++;
+        return 0;
+    }
+
+    if (link->rx_valid) {
+        link->rx_lost += (uint8_t)(seq - link->seq - 1) & CAN_BOARD_SEQ_MASK;
+    }
+    link->rx_valid = 1;
+    link->seq = seq;
+    link->frame++;
+    link->payload_bits += bits - CAN_BOARD_HEAD_BITS;
+
+    for (uint8_t id = 0; id < link->topic_num; id++) {
+        if (!(mask & (1u << id))) {
+            continue;
+        }
+        const CanBoardSchema_s * schema = &link->schema[id];
+        for (uint8_t i = 0; i < schema->field_num; i++) {
+            link->topic[id].value[i] = BitRead(data, &pos, schema->field_bits[i]);
+        }
+        link->topic[id].last_time = now_ms;
+        link->topic[id].enable = 1;
+        link->topic_count++;
+    }
+    return mask;
+}
+
+/**
+ * @brief          接收端的数据段是否在有效期内
+ * @param[in]      link 链路状态
+ * @param[in]      id 数据段编号
+ * @param[in]      now_ms (ms)当前时刻
+ * @retval         收到过且未超过 CAN_BOARD_STALE_PERIOD 个发送周期
+ */
+bool_t CanBoardFresh(const CanBoardLink_s * link, uint8_t id, uint32_t now_ms)
+{
+    if (id >= link->topic_num || !link->topic[id].enable) {
+        return 0;
+    }
+    return now_ms - link->topic[id].last_time <=
+           (uint32_t)link->schema[id].period * CAN_BOARD_STALE_PERIOD;
+}
+
+/**
+ * @brief          把 bits 位的补码还原为有符号数
+ */
+int32_t CanBoardSignExtend(uint32_t value, uint8_t bits)
+{
+    if (bits < 32 && (value & (1u << (bits - 1)))) {
+        value |= ~((1u << bits) - 1);
+    }
+    return (int32_t)value;
+}
+/*------------------------------ End of File ------------------------------*/
@@ -0,0 +1,77 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       CAN_board_codec.c/h
+  * @brief      板间CAN通信的按位打包，多个数据段共享一帧，按优先级和过期程度选择发送的数据段
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *  V1.0.1     Oct-19-2026     Penguin         1. CanBoardUnpack返回帧中的数据段掩码
+  *
+  @verbatim
+  ==============================================================================
+    帧格式(8字节，按位小端，与SBUS相同)：
+      bit 0-3:  包序号，每帧加1，接收端按其差值统计丢帧
+      bit 4-7:  数据段掩码，bit n 为1表示帧中带有数据段 n
+      bit 8-63: 按数据段编号从小到大依次排列的各数据段
+    数据段：
+      由 CanBoardSchema_s 描述，包括各字段的位宽、优先级和发送周期，两块板使用同一张表。
+      字段值按无符号整数保存，有符号的字段用 CanBoardSignExtend 还原。
+    发送选择(CanBoardPack)：
+      1. 到达发送周期的数据段按优先级、再按过期程度(距上次发送的时间/周期)依次放入，放不下的跳过
+      2. 帧中的剩余空间捎带已过半个周期的数据段，减少之后单独发送的帧
+      没有到期的数据段时不发送，板间通信只占用必要的总线时间。
+    接收(CanBoardUnpack)：
+      数据段的 last_time 为最近一次收到的时刻，使用前用 CanBoardFresh 检查是否过期。
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#ifndef CAN_BOARD_CODEC_H
+#define CAN_BOARD_CODEC_H
+#include "struct_typedef.h"
+
+#define CAN_BOARD_TOPIC_MAX 4    // 受帧头中数据段掩码的位数限制
+#define CAN_BOARD_FIELD_MAX 6
+#define CAN_BOARD_HEAD_BITS 8
+#define CAN_BOARD_FRAME_BITS 64
+#define CAN_BOARD_SEQ_MASK 0x0F
+
+typedef struct
+{
+    uint8_t field_num;
+    uint8_t field_bits[CAN_BOARD_FIELD_MAX];  // 各字段的位宽，最大32
+    uint8_t priority;                         // 数值越小优先级越高
+    uint16_t period;                          // (ms)发送周期
+} CanBoardSchema_s;
+
+typedef struct
+{
+    uint32_t value[CAN_BOARD_FIELD_MAX];  // 发送端为待发送的值，接收端为最近收到的值
+    uint32_t last_time;                   // (ms)上次发送或接收的时刻
+    bool_t enable;                        // 发送端为本板发送该数据段，接收端为已收到过
+} CanBoardTopic_s;
+
+typedef struct
+{
+    const CanBoardSchema_s * schema;
+    CanBoardTopic_s topic[CAN_BOARD_TOPIC_MAX];
+    uint8_t topic_num;
+
+    uint8_t seq;           // 发送端为下一帧的包序号，接收端为最近一帧的包序号
+    bool_t rx_valid;       // 已收到过帧
+    uint32_t frame;        // 发送或接收的帧数
+    uint32_t topic_count;  // 发送或接收的数据段数
+    uint32_t payload_bits; // 发送或接收的数据段总位数
+    uint32_t rx_lost;      // 按包序号统计的丢帧数
+    uint32_t rx_error;     // 掩码中含有未知数据段或超出帧长的帧数
+} CanBoardLink_s;
+
+extern void CanBoardLinkInit(CanBoardLink_s * link, const CanBoardSchema_s * schema, uint8_t num);
+extern bool_t CanBoardPack(CanBoardLink_s * link, uint32_t now_ms, uint8_t data[8]);
+extern uint8_t CanBoardUnpack(CanBoardLink_s * link, const uint8_t data[8], uint32_t now_ms);
+extern bool_t CanBoardFresh(const CanBoardLink_s * link, uint8_t id, uint32_t now_ms);
+extern int32_t CanBoardSignExtend(uint32_t value, uint8_t bits);
+
+#endif  // CAN_BOARD_CODEC_H
+/*------------------------------ End of File ------------------------------*/
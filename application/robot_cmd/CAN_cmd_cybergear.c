@@ -5,6 +5,7 @@
   * @history
   *  Version    Date            Author          Modification
   *  V2.0.0     Apr-19-2024     Penguin         1. 完成。
+  *  V2.1.0     Oct-19-2026     Penguin         1. 增加带力矩前馈的运控模式指令
   *
   @verbatim
   ==============================================================================
@@ -325,6 +326,20 @@ void CybergearPositionControl(Motor_s * p_motor, float kp, float kd)
     CybergearControl(p_motor, 0, p_motor->set.pos, 0, kp, kd);
 }
 
+/**
+  * @brief          小米电机运控模式完整指令，位置、速度、力矩前馈均取自 set
+  * @param[in]      p_motor 电机结构体
+  * @param[in]      kp 位置刚度
+  * @param[in]      kd 速度阻尼
+  * @retval         none
+  */
+void CybergearMitControl(Motor_s * p_motor, float kp, float kd)
+{
+    if (p_motor->type != CYBERGEAR_MOTOR) return;
+
+    CybergearControl(p_motor, p_motor->set.tor, p_motor->set.pos, p_motor->set.vel, kp, kd);
+}
+
 /**
   * @brief          小米电机速度模式控制指令
   * @param[in]      p_motor 电机结构体
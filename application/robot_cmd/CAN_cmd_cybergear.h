@@ -5,6 +5,7 @@
   * @history
   *  Version    Date            Author          Modification
   *  V2.0.0     Apr-19-2024     Penguin         1. 完成。
+  *  V2.1.0     Oct-19-2026     Penguin         1. 增加带力矩前馈的运控模式指令
   *
   @verbatim
   ==============================================================================
@@ -40,4 +41,6 @@ extern void CybergearPositionControl(Motor_s * p_motor, float kp, float kd);
 
 extern void CybergearVelocityControl(Motor_s * p_motor, float kd);
 
+extern void CybergearMitControl(Motor_s * p_motor, float kp, float kd);
+
 #endif  //CAN_CMD_CYBERGEAR_H
@@ -5,6 +5,11 @@
   * @history
   *  Version    Date            Author          Modification
   *  V1.0.0     May-27-2024     Penguin         1. done
+  *  V2.0.0     Oct-19-2026     Penguin         1. 板间数据按位打包，多个数据段共享一帧
+  *  V2.0.1     Oct-19-2026     Penguin         1. 添加云台数据段的断线和接收时刻接口
+  *                                             2. 遥控器数据段中传输遥控器类型
+  *  V2.0.2     Oct-19-2026     Penguin         1. 遥控器类型单独为一个数据段，捎带在通道帧中
+  *                                             2. 云台数据段的样本时刻改为统一时基(us)
   *
   @verbatim
   ==============================================================================
@@ -23,17 +28,66 @@ bit 8-11: data_type
 
 #include "bsp_can.h"
 #include "can_typedef.h"
+#include "communication.h"
 #include "gimbal.h"
 #include "string.h"
 #include "user_lib.h"
 
+#define CAN_BOARD_BUS_BITS 111        // 8字节标准帧的位数(不计填充位)
+#define CAN_BOARD_BITRATE 1000000     // (bit/s)
+#define CAN_BOARD_LOAD_PERIOD 1000    // (ms)总线占用率统计周期
+#define CAN_BOARD_RC_CH_MID ET08A_RC_CH_VALUE_OFFSET  // 遥控器数据过期时的通道值
+
+// 各板发送的数据段和发送目标
+#if __SELF_BOARD_ID == C_BOARD_BALANCE_CHASSIS
+#define CAN_BOARD_SEND_RC     1
+#define CAN_BOARD_SEND_GIMBAL 0
+#define CAN_BOARD_TARGET_ID   C_BOARD_BALANCE_GIMBAL
+#elif __SELF_BOARD_ID == C_BOARD_BALANCE_GIMBAL
+#define CAN_BOARD_SEND_RC     0
+#define CAN_BOARD_SEND_GIMBAL 1
+#define CAN_BOARD_TARGET_ID   C_BOARD_BALANCE_CHASSIS
+#else
+#define CAN_BOARD_SEND_RC     0
+#define CAN_BOARD_SEND_GIMBAL 0
+#define CAN_BOARD_TARGET_ID   C_BOARD_DEFAULT
+#endif
+
 static CanCtrlData_s CAN_CTRL_DATA = {
     .tx_header.IDE = CAN_ID_STD,
     .tx_header.RTR = CAN_RTR_DATA,
     .tx_header.DLC = 8,
 };
 
-static CanBoardCommunicate_t SEND_CBC;
+// clang-format off
+// 两块板使用同一张表：字段数，各字段位宽，优先级，发送周期(ms)
+// 遥控器类型过半周期(32ms)后捎带在下一个通道帧(44位)中，不会到期单独发送
+static const CanBoardSchema_s CAN_BOARD_SCHEMA[CAN_TOPIC_NUM] = {
+    [CAN_TOPIC_Rc_Low]  = {4, {CAN_RC_CH_BITS, CAN_RC_CH_BITS, CAN_RC_CH_BITS, CAN_RC_CH_BITS},
+                           0, 16},
+    [CAN_TOPIC_Rc_High] = {4, {CAN_RC_CH_BITS, CAN_RC_CH_BITS, CAN_RC_CH_BITS, CAN_RC_CH_BITS},
+                           1, 32},
+    [CAN_TOPIC_Rc_Type] = {1, {CAN_RC_TYPE_BITS}, 1, 64},
+    [CAN_TOPIC_Gimbal]  = {3, {CAN_GIMBAL_YAW_BITS, 1, 1}, 0, 10},
+};
+// clang-format on
+
+static CanBoardLink_s CAN_BOARD_TX = {
+    .schema = CAN_BOARD_SCHEMA,
+    .topic_num = CAN_TOPIC_NUM,
+    .topic[CAN_TOPIC_Rc_Low].enable = CAN_BOARD_SEND_RC,
+    .topic[CAN_TOPIC_Rc_High].enable = CAN_BOARD_SEND_RC,
+    .topic[CAN_TOPIC_Rc_Type].enable = CAN_BOARD_SEND_RC,
+    .topic[CAN_TOPIC_Gimbal].enable = CAN_BOARD_SEND_GIMBAL,
+};
+
+static CanBoardLink_s CAN_BOARD_RX = {
+    .schema = CAN_BOARD_SCHEMA,
+    .topic_num = CAN_TOPIC_NUM,
+};
+
+static CanBoardLinkStats_s CAN_BOARD_STATS;
+static uint32_t CAN_GIMBAL_RX_US = 0;  // (us)最近一次收到云台数据段的统一时基时刻
 
 /*-------------------- Private functions --------------------*/
 // 板间通信
@@ -61,30 +115,166 @@ static void SendData(uint8_t can, uint16_t std_id, uint8_t * data)
     CAN_SendTxMessage(&CAN_CTRL_DATA);
 }
 
+/**
+ * @brief          更新本板发送的数据段的值
+ * @retval         none
+ */
+static void CanBoardRenew(void)
+{
+#if CAN_BOARD_SEND_RC
+    const SBUS_t * sbus = get_sbus_point();
+    uint32_t * low = CAN_BOARD_TX.topic[CAN_TOPIC_Rc_Low].value;
+    uint32_t * high = CAN_BOARD_TX.topic[CAN_TOPIC_Rc_High].value;
+    for (uint8_t i = 0; i < 4; i++) {
+        low[i] = sbus->ch[i];
+        high[i] = sbus->ch[i + 4];
+    }
+    CAN_BOARD_TX.topic[CAN_TOPIC_Rc_Type].value[0] =
+        GetSbusOffline() ? RC_TYPE_UNKNOW : GetRcType();
+#endif
+
+#if CAN_BOARD_SEND_GIMBAL
+    float delta_yaw_mid = 0.0f;
+    bool yaw_motor_offline = true;
+    bool init_judge = false;
+
+    uint32_t * gimbal = CAN_BOARD_TX.topic[CAN_TOPIC_Gimbal].value;
+    gimbal[0] = float_to_uint(delta_yaw_mid, -M_PI, M_PI, CAN_GIMBAL_YAW_BITS);
+    gimbal[1] = yaw_motor_offline;
+    gimbal[2] = init_judge;
+#endif
+}
+
+/**
+ * @brief          每 CAN_BOARD_LOAD_PERIOD 统计一次板间通信的总线占用率
+ * @param[in]      now (ms)当前时刻
+ * @retval         none
+ */
+static void CanBoardLoadUpdate(uint32_t now)
+{
+    static uint32_t last_time = 0;
+    static uint32_t last_tx_frame = 0;
+    static uint32_t last_rx_frame = 0;
+
+    uint32_t period = now - last_time;
+    if (period < CAN_BOARD_LOAD_PERIOD) {
+        return;
+    }
+
+    fp32 bus_bits = (fp32)CAN_BOARD_BITRATE * period / 1000.0f;
+    CAN_BOARD_STATS.tx_load = (CAN_BOARD_TX.frame - last_tx_frame) * CAN_BOARD_BUS_BITS / bus_bits;
+    CAN_BOARD_STATS.rx_load = (CAN_BOARD_RX.frame - last_rx_frame) * CAN_BOARD_BUS_BITS / bus_bits;
+    last_time = now;
+    last_tx_frame = CAN_BOARD_TX.frame;
+    last_rx_frame = CAN_BOARD_RX.frame;
+}
+
 /*-------------------- Public functions --------------------*/
 
-void CanSendRcDataToBoard(uint8_t can, uint16_t target_id, uint16_t index)
+/**
+ * @brief          板间CAN通信，每1ms调用一次，选择到期的数据段打包发送
+ * @note           __BOARD_LINK_CAN 为0时不发送
+ * @retval         none
+ */
+void CanBoardLinkUpdate(void)
+{
+#if __BOARD_LINK_CAN
+    uint32_t now = HAL_GetTick();
+    uint8_t data[8];
+
+    CanBoardRenew();
+    if (CanBoardPack(&CAN_BOARD_TX, now, data)) {
+        uint16_t std_id = CAN_STD_ID_PACK_BASE | CAN_STD_ID_Board << TYPE_ID_OFFSET |
+                          (CAN_BOARD_TARGET_ID << TARGET_ID_OFFSET);
+        SendData(__BOARD_LINK_CAN, std_id, data);
+    }
+    CanBoardLoadUpdate(now);
+#endif
+}
+
+/**
+ * @brief          收到板间数据帧，在CAN接收中断中调用
+ * @param[in]      data 帧数据
+ * @retval         none
+ */
+void CanBoardReceive(const uint8_t data[8])
 {
-    // uint16_t std_id = CAN_STD_ID_PACK_BASE | CAN_STD_ID_Rc << TYPE_ID_OFFSET |
-    //                   (target_id << TARGET_ID_OFFSET) | index;
+    uint8_t mask = CanBoardUnpack(&CAN_BOARD_RX, data, HAL_GetTick());
+    if (mask & (1u << CAN_TOPIC_Gimbal)) {
+        CAN_GIMBAL_RX_US = GetBoardTimeUs();
+    }
+}
 
+/*-------------------- Get data --------------------*/
 
+bool GetCanRcOffline(void) { return GetCanRcType() == RC_TYPE_UNKNOW; }
+
+RC_Type_e GetCanRcType(void)
+{
+    uint32_t now = HAL_GetTick();
+    if (!CanBoardFresh(&CAN_BOARD_RX, CAN_TOPIC_Rc_Low, now) ||
+        !CanBoardFresh(&CAN_BOARD_RX, CAN_TOPIC_Rc_Type, now)) {
+        return RC_TYPE_UNKNOW;
+    }
+    return (RC_Type_e)CAN_BOARD_RX.topic[CAN_TOPIC_Rc_Type].value[0];
 }
 
-void CanSendGimbalDataToBoard(uint8_t can, uint16_t target_id, uint16_t index)
+/**
+ * @brief          获取通过CAN收到的遥控器通道值
+ * @param[in]      ch 通道id [0,7]
+ * @retval         通道值，数据过期或通道不在传输范围内时为中值
+ */
+uint16_t GetCanRcCh(uint8_t ch)
 {
-    uint16_t std_id = CAN_STD_ID_PACK_BASE | CAN_STD_ID_Gimbal << TYPE_ID_OFFSET |
-                      (target_id << TARGET_ID_OFFSET) | index;
+    uint8_t id = ch < 4 ? CAN_TOPIC_Rc_Low : CAN_TOPIC_Rc_High;
+    if (ch >= 8 || !CanBoardFresh(&CAN_BOARD_RX, id, HAL_GetTick())) {
+        return CAN_BOARD_RC_CH_MID;
+    }
+    return (uint16_t)CAN_BOARD_RX.topic[id].value[ch & 0x03];
+}
 
-    float delta_yaw_mid = 0.0f;
-    bool yaw_motor_offline = true;
-    bool init_judge = false;
+float GetCanGimbalYawMotorPos(void)
+{
+    if (!CanBoardFresh(&CAN_BOARD_RX, CAN_TOPIC_Gimbal, HAL_GetTick())) {
+        return 0;
+    }
+    return uint_to_float(
+        CAN_BOARD_RX.topic[CAN_TOPIC_Gimbal].value[0], -M_PI, M_PI, CAN_GIMBAL_YAW_BITS);
+}
+
+bool GetCanGimbalOffline(void)
+{
+    return !CanBoardFresh(&CAN_BOARD_RX, CAN_TOPIC_Gimbal, HAL_GetTick());
+}
 
-    SEND_CBC.gimbal_data.gimbal.packed_data.yaw = delta_yaw_mid;
-    SEND_CBC.gimbal_data.gimbal.packed_data.offline = yaw_motor_offline;
-    SEND_CBC.gimbal_data.gimbal.packed_data.init_judge = init_judge;
+/**
+ * @brief          云台数据段的样本时刻，数据段中没有发送端的采样时刻，以本板收到的时刻代替
+ * @retval         (us)GetBoardTimeUs 时基，与 GetUartGimbalSampleTime 相同
+ */
+uint32_t GetCanGimbalSampleTime(void) { return CAN_GIMBAL_RX_US; }
 
-    SendData(can, std_id, SEND_CBC.gimbal_data.gimbal.raw.data);
+bool GetCanGimbalInitJudge(void)
+{
+    if (!CanBoardFresh(&CAN_BOARD_RX, CAN_TOPIC_Gimbal, HAL_GetTick())) {
+        return false;
+    }
+    return CAN_BOARD_RX.topic[CAN_TOPIC_Gimbal].value[2];
+}
+
+const CanBoardLinkStats_s * GetCanBoardLinkStats(void)
+{
+    CAN_BOARD_STATS.tx_frame = CAN_BOARD_TX.frame;
+    CAN_BOARD_STATS.tx_topic = CAN_BOARD_TX.topic_count;
+    CAN_BOARD_STATS.rx_frame = CAN_BOARD_RX.frame;
+    CAN_BOARD_STATS.rx_topic = CAN_BOARD_RX.topic_count;
+    CAN_BOARD_STATS.rx_lost = CAN_BOARD_RX.rx_lost;
+    CAN_BOARD_STATS.rx_error = CAN_BOARD_RX.rx_error;
+    if (CAN_BOARD_TX.frame > 0) {
+        uint32_t frame_bits = CAN_BOARD_FRAME_BITS - CAN_BOARD_HEAD_BITS;
+        CAN_BOARD_STATS.tx_fill =
+            (fp32)CAN_BOARD_TX.payload_bits / (CAN_BOARD_TX.frame * frame_bits);
+    }
+    return &CAN_BOARD_STATS;
 }
 
 /*------------------------------ End of File ------------------------------*/
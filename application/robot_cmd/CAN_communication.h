@@ -5,6 +5,11 @@
   * @history
   *  Version    Date            Author          Modification
   *  V1.0.0     May-27-2024     Penguin         1. done
+  *  V2.0.0     Oct-19-2026     Penguin         1. 板间数据按位打包，多个数据段共享一帧
+  *  V2.0.1     Oct-19-2026     Penguin         1. 添加云台数据段的断线和接收时刻接口
+  *                                             2. 遥控器数据段中传输遥控器类型
+  *  V2.0.2     Oct-19-2026     Penguin         1. 遥控器类型单独为一个数据段，捎带在通道帧中
+  *                                             2. 云台数据段的样本时刻改为统一时基(us)
   *
   @verbatim
   ==============================================================================
@@ -15,6 +20,16 @@ bit 0-3: target_id
 bit 4-7: data_id
 bit 8-11: data_type
 
+板间数据帧(CAN_STD_ID_Board)：
+  帧内为按位打包的多个数据段和4位包序号，格式与发送选择见 CAN_board_codec.h，
+  数据段及其位宽、优先级和周期见 CAN_communication.c 中的 CAN_BOARD_SCHEMA。
+  遥控器通道按SBUS的11位传输，只传输通道0-7。通道0-3和4-7各44位，帧载荷56位，
+  两组通道不能放入同一帧；遥控器类型(发送端识别，离线时为RC_TYPE_UNKNOW)为单独的3位数据段，
+  周期较长，捎带在通道帧的剩余空间中，不单独占用帧。
+  云台yaw按16位量化到[-PI, PI]，云台板只发送这一个数据段。
+  GetCanGimbalSampleTime 为本板收到云台数据段时的 GetBoardTimeUs，与串口的样本时刻单位相同。
+  接收端按数据段各自的周期检查是否过期，过期的遥控器通道返回中值。
+  __BOARD_LINK_CAN 选择使用的CAN口，为0时不发送。
   ==============================================================================
   @endverbatim
   ****************************(C) COPYRIGHT 2024 Polarbear****************************
@@ -28,10 +43,40 @@ bit 8-11: data_type
 #include "CAN_cmd_dji.h"
 #include "CAN_cmd_lingkong.h"
 #include "CAN_cmd_SupCap.h"
+#include "CAN_board_codec.h"
 #include "CAN_receive.h"
 
-extern void CanSendRcDataToBoard(uint8_t can, uint16_t target_id, uint16_t index);
+typedef struct
+{
+    uint32_t tx_frame;   // 发送的板间数据帧数
+    uint32_t tx_topic;   // 发送的数据段数
+    fp32 tx_fill;        // 数据段占帧载荷的比例
+    fp32 tx_load;        // 发送占用的总线时间比例(不计填充位)
+    uint32_t rx_frame;   // 接收的板间数据帧数
+    uint32_t rx_topic;   // 接收的数据段数
+    uint32_t rx_lost;    // 按包序号统计的丢帧数
+    uint32_t rx_error;   // 与本板数据段表不一致的帧数
+    fp32 rx_load;        // 接收占用的总线时间比例(不计填充位)
+} CanBoardLinkStats_s;
 
-extern void CanSendGimbalDataToBoard(uint8_t can, uint16_t target_id, uint16_t index);
+extern void CanBoardLinkUpdate(void);
+
+extern void CanBoardReceive(const uint8_t data[8]);
+
+extern bool GetCanRcOffline(void);
+
+extern RC_Type_e GetCanRcType(void);
+
+extern uint16_t GetCanRcCh(uint8_t ch);
+
+extern float GetCanGimbalYawMotorPos(void);
+
+extern bool GetCanGimbalOffline(void);
+
+extern uint32_t GetCanGimbalSampleTime(void);
+
+extern bool GetCanGimbalInitJudge(void);
+
+extern const CanBoardLinkStats_s * GetCanBoardLinkStats(void);
 
 #endif  // CAN_COMMUNICATION_H
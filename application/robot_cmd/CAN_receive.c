@@ -13,6 +13,9 @@
   *  V2.2.0     May-22-2024     Penguin         1. 添加LK电机的适配
   *  V2.3.0     May-22-2024     Penguin         1. 添加板间通信数据解码
   *  V2.3.1     Apr-01-2024     Penguin         1. 添加了DJI电机离线的判断
+  *  V2.3.2     Oct-19-2026     Penguin         1. 添加电机反馈频率统计
+  *  V2.3.3     Oct-19-2026     Penguin         1. 添加超级电容离线判断
+  *  V2.4.0     Oct-19-2026     Penguin         1. 板间数据帧交由CAN_communication解包
   *
   @verbatim
   ==============================================================================
@@ -25,7 +28,9 @@
 
 #include "CAN_receive.h"
 
+#include "CAN_communication.h"
 #include "bsp_can.h"
+#include "bsp_dwt.h"
 #include "can_typedef.h"
 #include "cmsis_os.h"
 #include "detect_task.h"
@@ -37,6 +42,7 @@
 #define DATA_NUM 10
 
 #define CAN_OFFLINE_TIME 100  // ms
+#define SUP_CAP_OFFLINE_TIME 200  // ms
 
 // 接收数据
 static DjiMotorMeasure_t CAN1_DJI_MEASURE[11];
@@ -55,7 +61,6 @@ static SupCapMeasure_s SUP_CAP_MEASURE;
 
 // static uint8_t OTHER_BOARD_DATA_ANY[DATA_NUM][8];
 static uint16_t OTHER_BOARD_DATA_UINT16[DATA_NUM][4];
-static CanBoardCommunicate_t RECEIVE_CBC;
 
 static uint32_t LAST_RECEIVE_TIME = 0;  // 上次接收时间
 
@@ -81,6 +86,7 @@ void DmFdbData(DmMeasure_s * dm_measure, uint8_t * rx_data)
     dm_measure->t_rotor = (float)(rx_data[7]);
 
     dm_measure->last_fdb_time = HAL_GetTick();
+    RateMonitorUpdate(&dm_measure->rate, dwt_get_cycle());
 }
 
 /**
@@ -97,6 +103,7 @@ void DjiFdbData(DjiMotorMeasure_t * dji_measure, uint8_t * rx_data)
     dji_measure->temperate = (rx_data)[6];
 
     dji_measure->last_fdb_time = HAL_GetTick();
+    RateMonitorUpdate(&dji_measure->rate, dwt_get_cycle());
 }
 
 /**
@@ -114,6 +121,7 @@ void LkFdbData(LkMeasure_s * lk_measure, uint8_t * rx_data)
     lk_measure->encoder = (uint16_t)(rx_data[7] << 8 | rx_data[6]);
 
     lk_measure->last_fdb_time = HAL_GetTick();
+    RateMonitorUpdate(&lk_measure->rate, dwt_get_cycle());
 }
 
 /**
@@ -222,16 +230,8 @@ static void DecodeStdIdData(hcan_t * CAN, CAN_RxHeaderTypeDef * rx_header, uint8
         case CAN_STD_ID_Test: {
         } break;
 
-        case CAN_STD_ID_Rc: {
-
-#if __CONTROL_LINK_RC == CL_RC_CAN
-            const RC_ctrl_t * rc_ctrl = get_remote_control_point();
-            memcpy((RC_ctrl_t *)rc_ctrl, &RECEIVE_CBC.rc_data.rc_unpacked, sizeof(RC_ctrl_t));
-#endif
-        } break;
-
-        case CAN_STD_ID_Gimbal: {
-            memcpy(&RECEIVE_CBC.gimbal_data.gimbal.raw.data, rx_data, 8);
+        case CAN_STD_ID_Board: {
+            CanBoardReceive(rx_data);
         } break;
         default:
             break;
@@ -347,8 +347,10 @@ static void GetDjiFdbData(Motor_s * p_motor, const DjiMotorMeasure_t * p_dji_mot
     uint32_t now = HAL_GetTick();
     if (now - p_dji_motor_measure->last_fdb_time > MOTOR_STABLE_RUNNING_TIME) {
         p_motor->offline = true;
+        p_motor->fdb_rate = 0;
     } else {
         p_motor->offline = false;
+        p_motor->fdb_rate = RateMonitorGetHz(&p_dji_motor_measure->rate);
     }
 }
 
@@ -396,8 +398,10 @@ static void GetDmFdbData(Motor_s * motor, const DmMeasure_s * dm_measure)
     uint32_t now = HAL_GetTick();
     if (now - dm_measure->last_fdb_time > MOTOR_STABLE_RUNNING_TIME) {
         motor->offline = true;
+        motor->fdb_rate = 0;
     } else {
         motor->offline = false;
+        motor->fdb_rate = RateMonitorGetHz(&dm_measure->rate);
     }
 }
 
@@ -417,8 +421,10 @@ static void GetLkFdbData(Motor_s * motor, const LkMeasure_s * lk_measure)
     uint32_t now = HAL_GetTick();
     if (now - lk_measure->last_fdb_time > MOTOR_STABLE_RUNNING_TIME) {
         motor->offline = true;
+        motor->fdb_rate = 0;
     } else {
         motor->offline = false;
+        motor->fdb_rate = RateMonitorGetHz(&lk_measure->rate);
     }
 }
 
@@ -502,6 +508,8 @@ void GetSupCapMeasure(SupCap_s * p_sup_cap)
     p_sup_cap->fdb.voltage_cap = SUP_CAP_MEASURE.voltage_cap / 100.0f;
     p_sup_cap->fdb.current_in = SUP_CAP_MEASURE.current_in / 50.0f;
     p_sup_cap->fdb.power_target = SUP_CAP_MEASURE.power_target;
+    p_sup_cap->offline = (SUP_CAP_MEASURE.last_fdb_time == 0) ||
+                         (HAL_GetTick() - SUP_CAP_MEASURE.last_fdb_time > SUP_CAP_OFFLINE_TIME);
 }
 
 bool GetBoardCanOffline(void)
@@ -509,26 +517,4 @@ bool GetBoardCanOffline(void)
     if (HAL_GetTick() - LAST_RECEIVE_TIME > CAN_OFFLINE_TIME) return true;
     return false;
 }
-
-bool GetCanRcOffline(void)
-{
-    if (GetBoardCanOffline()) return true;
-    return true;
-}
-
-float GetCanGimbalYawMotorPos(void)
-{
-    if (GetBoardCanOffline()) {
-        return 0;
-    }
-    return RECEIVE_CBC.gimbal_data.gimbal.packed_data.yaw;
-}
-
-bool GetCanGimbalInitJudge(void)
-{
-    if (GetBoardCanOffline()) {
-        return false;
-    }
-    return RECEIVE_CBC.gimbal_data.gimbal.packed_data.init_judge;
-}
 /************************ END OF FILE ************************/
@@ -83,11 +83,5 @@ extern void GetSupCapMeasure(SupCap_s * p_sup_cap);
 
 extern bool GetBoardCanOffline(void);
 
-extern bool GetCanRcOffline(void);
-
-extern float GetCanGimbalYawMotorPos(void);
-
-extern bool GetCanGimbalInitJudge(void);
-
 #endif
 /*------------------------------ End of File ------------------------------*/
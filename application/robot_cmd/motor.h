@@ -20,6 +20,7 @@
 #include "robot_typedef.h"
 #include "stdbool.h"
 #include "struct_typedef.h"
+#include "user_lib.h"
 
 #define RPM_TO_OMEGA 0.1047197551f    // (1/60*2*pi) (rpm)->(rad/s)
 #define DEGREE_TO_RAD 0.0174532925f   // (pi/180) (degree)->(rad)
@@ -70,6 +71,7 @@ typedef struct _DjiMotorMeasure
     int16_t last_ecd;
 
     uint32_t last_fdb_time;  //上次反馈时间
+    RateMonitor_t rate;      //反馈频率监视
 } DjiMotorMeasure_t;
 
 /*-------------------- CyberGear --------------------*/
@@ -178,6 +180,7 @@ typedef struct
     float t_rotor;
 
     uint32_t last_fdb_time;  //上次反馈时间
+    RateMonitor_t rate;      //反馈频率监视
 } DmMeasure_s;
 
 /*-------------------- LK Motor --------------------*/
@@ -208,6 +211,7 @@ typedef struct
     uint16_t encoder;
 
     uint32_t last_fdb_time;  //上次反馈时间
+    RateMonitor_t rate;      //反馈频率监视
 } LkMeasure_s;
 
 /*-------------------- Motor struct --------------------*/
@@ -227,6 +231,7 @@ typedef struct __Motor
     int8_t direction;       // 电机和(执行机构在模型中定义的旋转方向)的关系（1或-1），例如：
     uint16_t mode;          // 电机模式
     bool offline;           // 电机是否离线
+    uint16_t fdb_rate;      // (Hz)反馈频率，低于正常值说明总线负载过高或通信不稳定
 
     /*状态量*/
     struct __fdb
@@ -0,0 +1,177 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       can_board_codec_test.c
+  * @brief      在PC上运行的板间CAN打包测试程序，检查按位打包、发送选择和丢帧统计
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+    编译运行：
+      cc -O2 -I.. -I../../typedef -o can_board_codec_test can_board_codec_test.c \
+         ../CAN_board_codec.c
+      ./can_board_codec_test
+    检查项(任一不满足返回非0)：
+      1. 随机字段值打包后解包不变，有符号字段还原正确
+      2. 每1ms调用一次时，各数据段的发送间隔不超过周期 + MAX_LATE，
+         帧数少于每个数据段单独成帧时的帧数
+      3. 随机丢帧(连续丢帧少于16帧)时，丢帧统计与实际相同
+      4. 帧中含有接收端表中没有的数据段时整帧丢弃，解包返回的掩码为0
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include <stdio.h>
+
+#include "CAN_board_codec.h"
+
+#define SIM_TIME 10000  // (ms)
+#define MAX_LATE 2      // (ms)
+#define LOSS_RATE 0.05
+
+// 位宽合计分别为 20, 20, 30, 50
+static const CanBoardSchema_s SCHEMA[] = {
+    {2, {11, 9}, 0, 10},
+    {3, {1, 3, 16}, 1, 20},
+    {2, {30}, 1, 50},
+    {4, {11, 11, 11, 17}, 2, 100},
+};
+#define TOPIC_NUM (sizeof(SCHEMA) / sizeof(SCHEMA[0]))
+
+static uint32_t SEED = 1;
+
+static uint32_t RandU32(void)
+{
+    SEED = SEED * 1664525u + 1013904223u;
+    return SEED;
+}
+
+static double Rand(double min, double max)
+{
+    return min + (max - min) * (RandU32() >> 8) / (double)(1u << 24);
+}
+
+static void RandomValues(CanBoardLink_s * tx)
+{
+    for (uint8_t id = 0; id < TOPIC_NUM; id++) {
+        for (uint8_t i = 0; i < SCHEMA[id].field_num; i++) {
+            uint8_t bits = SCHEMA[id].field_bits[i];
+            tx->topic[id].value[i] = RandU32() & (bits < 32 ? (1u << bits) - 1 : 0xFFFFFFFFu);
+        }
+    }
+}
+
+int main(void)
+{
+    int fail = 0;
+    uint8_t data[8];
+
+    // 1. 按位打包
+    {
+        int err = 0;
+        for (int c = 0; c < 10000; c++) {
+            CanBoardLink_s tx, rx;
+            CanBoardLinkInit(&tx, SCHEMA, TOPIC_NUM);
+            CanBoardLinkInit(&rx, SCHEMA, TOPIC_NUM);
+            for (uint8_t id = 0; id < TOPIC_NUM; id++) tx.topic[id].enable = RandU32() & 1;
+            RandomValues(&tx);
+            uint32_t now = 1000;
+            while (CanBoardPack(&tx, now, data)) CanBoardUnpack(&rx, data, now);
+            for (uint8_t id = 0; id < TOPIC_NUM; id++) {
+                if (rx.topic[id].enable != tx.topic[id].enable) err++;
+                if (!tx.topic[id].enable) continue;
+                for (uint8_t i = 0; i < SCHEMA[id].field_num; i++) {
+                    if (rx.topic[id].value[i] != tx.topic[id].value[i]) err++;
+                }
+            }
+        }
+        if (CanBoardSignExtend(0x7FF, 11) != -1 || CanBoardSignExtend(0x400, 11) != -1024 ||
+            CanBoardSignExtend(0x3FF, 11) != 1023 || CanBoardSignExtend(0xFFFFFFFFu, 32) != -1) {
+            err++;
+        }
+        printf("pack: %d errors\n", err);
+        if (err) fail = 1;
+    }
+
+    // 2. 发送选择
+    {
+        CanBoardLink_s tx, rx;
+        uint32_t last[TOPIC_NUM] = {0};
+        int32_t late[TOPIC_NUM] = {0};
+        uint32_t separate = 0;
+        int err = 0;
+
+        CanBoardLinkInit(&tx, SCHEMA, TOPIC_NUM);
+        CanBoardLinkInit(&rx, SCHEMA, TOPIC_NUM);
+        for (uint8_t id = 0; id < TOPIC_NUM; id++) {
+            tx.topic[id].enable = 1;
+            separate += SIM_TIME / SCHEMA[id].period;
+        }
+        for (uint32_t now = 1; now <= SIM_TIME; now++) {
+            RandomValues(&tx);
+            if (!CanBoardPack(&tx, now, data)) continue;
+            CanBoardUnpack(&rx, data, now);
+            for (uint8_t id = 0; id < TOPIC_NUM; id++) {
+                if (rx.topic[id].last_time != now) continue;
+                for (uint8_t i = 0; i < SCHEMA[id].field_num; i++) {
+                    if (rx.topic[id].value[i] != tx.topic[id].value[i]) err++;
+                }
+                if (last[id] && (int32_t)(now - last[id] - SCHEMA[id].period) > late[id]) {
+                    late[id] = now - last[id] - SCHEMA[id].period;
+                }
+                last[id] = now;
+            }
+        }
+        for (uint8_t id = 0; id < TOPIC_NUM; id++) {
+            printf("topic %u: max late %d ms\n", id, late[id]);
+            if (late[id] > MAX_LATE) fail = 1;
+        }
+        printf(
+            "schedule: %u frames (separate %u), fill %.2f, %d errors\n", tx.frame, separate,
+            (double)tx.payload_bits / (tx.frame * (CAN_BOARD_FRAME_BITS - CAN_BOARD_HEAD_BITS)),
+            err);
+        if (tx.frame >= separate || err) fail = 1;
+    }
+
+    // 3. 丢帧统计
+    {
+        CanBoardLink_s tx, rx;
+        uint32_t lost = 0;
+        int run = 0;
+
+        CanBoardLinkInit(&tx, SCHEMA, TOPIC_NUM);
+        CanBoardLinkInit(&rx, SCHEMA, TOPIC_NUM);
+        tx.topic[0].enable = 1;
+        for (uint32_t now = 1; now <= SIM_TIME * 10; now++) {
+            if (!CanBoardPack(&tx, now, data)) continue;
+            if (rx.rx_valid && run < 15 && Rand(0, 1) < LOSS_RATE) {
+                lost++;
+                run++;
+                continue;
+            }
+            run = 0;
+            CanBoardUnpack(&rx, data, now);
+        }
+        printf("loss: lost %u (actual %u)\n", rx.rx_lost, lost);
+        if (rx.rx_lost != lost) fail = 1;
+    }
+
+    // 4. 数据段表不一致
+    {
+        CanBoardLink_s tx, rx;
+        CanBoardLinkInit(&tx, SCHEMA, TOPIC_NUM);
+        CanBoardLinkInit(&rx, SCHEMA, 2);
+        tx.topic[3].enable = 1;
+        CanBoardPack(&tx, 1000, data);
+        uint8_t mask = CanBoardUnpack(&rx, data, 1000);
+        printf("mismatch: %u errors, %u frames\n", rx.rx_error, rx.frame);
+        if (rx.rx_error != 1 || rx.frame != 0 || mask != 0 || CanBoardFresh(&rx, 3, 1000)) {
+            fail = 1;
+        }
+    }
+
+    printf(fail ? "FAIL\n" : "PASS\n");
+    return fail;
+}
@@ -6,6 +6,8 @@
   *  Version    Date            Author          Modification
   *  V1.0.0     Mar-31-2024     Penguin         1. done
   *  V1.0.1     Apr-16-2024     Penguin         1. 添加云台和发射机构类型
+  *  V1.0.2     Oct-19-2026     Penguin         1. 添加机械臂结构参数默认值和笛卡尔空间控制开关
+  *                                             2. 添加机械臂动力学参数和力矩前馈比例默认值
   *
   @verbatim
   ==============================================================================
@@ -24,6 +26,7 @@
 
 //导入具体的机器人参数配置文件
 #include "robot_param_balanced_infantry.h"
+// #include "robot_param_steering_infantry.h"
 // #include "robot_param_test.h"
 
 // 选择机器人的各种类型
@@ -67,6 +70,11 @@
 // #define __CONTROL_LINK_PS2 CL_PS2_NONE
 #endif
 
+// 板间CAN通信使用的CAN口(1或2)，0为不通过CAN进行板间通信
+#ifndef __BOARD_LINK_CAN
+#define __BOARD_LINK_CAN 0
+#endif
+
 // 模块检查
 #ifndef CHASSIS_TYPE
 #define CHASSIS_TYPE CHASSIS_NONE
@@ -88,4 +96,97 @@
 #define CUSTOM_CONTROLLER_TYPE CUSTOM_CONTROLLER_NONE
 #endif
 
+// 机械臂参数默认值，具体机器人的参数配置文件中定义的值优先
+#if (MECHANICAL_ARM_TYPE == MECHANICAL_ARM_ENGINEER_ARM)
+// 结构参数，见 arm_kinematics.h
+#ifndef ARM_SHOULDER_HEIGHT
+#define ARM_SHOULDER_HEIGHT 0.10f  // (m)J1轴线到J0底部的高度
+#endif
+#ifndef ARM_LINK_1_LENGTH
+#define ARM_LINK_1_LENGTH 0.35f  // (m)J1到J2
+#endif
+#ifndef ARM_LINK_2_LENGTH
+#define ARM_LINK_2_LENGTH 0.30f  // (m)J2到腕点
+#endif
+#ifndef ARM_LINK_3_LENGTH
+#define ARM_LINK_3_LENGTH 0.12f  // (m)腕点到吸盘
+#endif
+
+// 动力学参数，质心距离从近端关节轴线量起，转动惯量绕质心、垂直于臂平面
+#ifndef ARM_LINK_1_MASS
+#define ARM_LINK_1_MASS 1.2f  // (kg)大臂
+#endif
+#ifndef ARM_LINK_1_COM
+#define ARM_LINK_1_COM 0.15f  // (m)
+#endif
+#ifndef ARM_LINK_1_INERTIA
+#define ARM_LINK_1_INERTIA 0.015f  // (kg*m^2)
+#endif
+#ifndef ARM_LINK_2_MASS
+#define ARM_LINK_2_MASS 0.8f  // (kg)小臂
+#endif
+#ifndef ARM_LINK_2_COM
+#define ARM_LINK_2_COM 0.12f  // (m)
+#endif
+#ifndef ARM_LINK_2_INERTIA
+#define ARM_LINK_2_INERTIA 0.008f  // (kg*m^2)
+#endif
+#ifndef ARM_WRIST_MASS
+#define ARM_WRIST_MASS 1.0f  // (kg)J3~J5电机与差速器
+#endif
+#ifndef ARM_TOOL_MASS
+#define ARM_TOOL_MASS 0.5f  // (kg)吸盘、气路与矿石
+#endif
+#ifndef ARM_TOOL_COM
+#define ARM_TOOL_COM 0.08f  // (m)吸盘质心到腕点
+#endif
+#ifndef ARM_BASE_INERTIA
+#define ARM_BASE_INERTIA 0.02f  // (kg*m^2)J0转动部分自身
+#endif
+
+// 左拨杆上档且自定义控制器未连接时进入笛卡尔空间控制模式，为0时保持跟随模式
+#ifndef ARM_CARTESIAN_ENABLE
+#define ARM_CARTESIAN_ENABLE 0
+#endif
+#elif (MECHANICAL_ARM_TYPE == MECHANICAL_ARM_PENGUIN_MINI_ARM)
+// 动力学参数，关节1为大臂对竖直方向的角度，关节2为小臂的绝对角度
+#ifndef ARM_LINK_1_LENGTH
+#define ARM_LINK_1_LENGTH 0.20f  // (m)
+#endif
+#ifndef ARM_LINK_2_LENGTH
+#define ARM_LINK_2_LENGTH 0.18f  // (m)
+#endif
+#ifndef ARM_LINK_1_MASS
+#define ARM_LINK_1_MASS 0.35f  // (kg)
+#endif
+#ifndef ARM_LINK_1_COM
+#define ARM_LINK_1_COM 0.10f  // (m)
+#endif
+#ifndef ARM_LINK_1_INERTIA
+#define ARM_LINK_1_INERTIA 0.0015f  // (kg*m^2)
+#endif
+#ifndef ARM_LINK_2_MASS
+#define ARM_LINK_2_MASS 0.25f  // (kg)
+#endif
+#ifndef ARM_LINK_2_COM
+#define ARM_LINK_2_COM 0.08f  // (m)
+#endif
+#ifndef ARM_LINK_2_INERTIA
+#define ARM_LINK_2_INERTIA 0.0008f  // (kg*m^2)
+#endif
+#ifndef ARM_WRIST_MASS
+#define ARM_WRIST_MASS 0.20f  // (kg)关节3 4电机
+#endif
+#ifndef ARM_BASE_INERTIA
+#define ARM_BASE_INERTIA 0.005f  // (kg*m^2)
+#endif
+#endif
+
+#if (MECHANICAL_ARM_TYPE != MECHANICAL_ARM_NONE)
+// 关节力矩前馈比例，默认关闭，在机器人上辨识动力学参数后再打开
+#ifndef ARM_FEEDFORWARD_RATIO
+#define ARM_FEEDFORWARD_RATIO 0.0f
+#endif
+#endif
+
 #endif /* ROBOT_PARAM_H */
@@ -139,13 +139,26 @@
 #define MOTOR_ECD_TO_ANGLE          0.000021305288720633905968306772076277f
 #define FULL_COUNT                  18
 
-/*BLOCK&REVERSE parameters------------*/
-
-//初版   看门狗防堵转
-#define BLOCK_TRIGGER_SPEED         5.0f
-#define BLOCK_TIME                  1000
-#define REVERSE_TIME                1250
-#define REVERSE_SPEED               (-20.0f)  
+/*FEEDER parameters ------------------*/
+
+//按格供弹 拨弹盘电机位置环
+#define TRIGGER_FEED_POS_KP         (40.0f)   // (1/s)
+#define TRIGGER_FEED_FIRE_LEAD      (0.3f)    // 连发时当前格剩余比例小于该值即放行下一发
+#define SHOOT_BURST_HOLD_TIME       (0.18f)   // (s)长按左键超过该时间进入连发
+
+//卡弹预测 空转负载模型(单位与电机电流/力矩反馈一致)
+#define TRIGGER_LOAD_K_ACC          (0.24f)
+#define TRIGGER_LOAD_K_VEL          (0.4f)
+#define TRIGGER_LOAD_K_STATIC       (100.0f)
+#define TRIGGER_JAM_EFFORT          (3000.0f)
+#define TRIGGER_JAM_PREDICT_TIME    (0.01f)   // (s)
+#define TRIGGER_JAM_CONFIRM_TIME    (0.004f)  // (s)
+
+//堵转兜底与回退
+#define BLOCK_TRIGGER_SPEED         5.0f      // (rad/s)
+#define BLOCK_TIME                  (0.3f)    // (s)
+#define REVERSE_SLOT                (0.3f)    // 回退角度(格)
+#define REVERSE_TIME                (0.1f)    // (s)
 
 /*MIT parameters ---------------------*/
 
@@ -177,7 +190,23 @@
 #define FRIC_PID_MAX_OUT (16000.0f)
 #define FRIC_PID_MAX_IOUT (1000.0f)
 
+//摩擦轮前馈与扰动观测(单位与电机电流控制量一致)
+#define FRIC_MODEL_K_ACC            (2.0f)
+#define FRIC_FF_K_VEL               (0.6f)
+#define FRIC_FF_K_STATIC            (200.0f)
+#define FRIC_FF_K_TEMP              (0.001f)  // (1/℃)
+#define FRIC_FF_TEMP_REF            (25.0f)   // (℃)
+#define FRIC_DOB_TIME               (0.004f)  // (s)
+#define FRIC_DOB_MAX                (8000.0f)
+#define FRIC_DIP_THRESHOLD          (10.0f)   // (rad/s)
+
+//射速闭环
+#define SHOOT_TARGET_SPEED          (27.5f)   // (m/s)
+#define SHOOT_SPEED_ADJUST_GAIN     (0.5f)
+#define SHOOT_SPEED_ADJUST_MAX      (0.1f)
+
 #define SHOOT_HEAT_REMAIN_VALUE     80//89
+#define SHOOT_HEAT_PER_SHOT         (10.0f)   // 每发热量，17mm为10，42mm为100
 
 // clang-format on
 #endif /* INCLUDED_ROBOT_PARAM_H */
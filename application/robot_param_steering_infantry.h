@@ -0,0 +1,92 @@
+/**
+  * @file       robot_param_steering_infantry.h
+  * @brief      这里是舵轮步兵机器人参数配置文件，包括物理参数、PID参数等
+  */
+
+#ifndef INCLUDED_ROBOT_PARAM_H
+#define INCLUDED_ROBOT_PARAM_H
+#include "robot_typedef.h"
+
+#define CHASSIS_TYPE CHASSIS_STEERING_WHEEL  // 选择底盘类型
+
+// clang-format off
+#define __GYRO_BIAS_YAW  0.0f  // 陀螺仪零飘，单位rad/s
+
+/*-------------------- Chassis --------------------*/
+// 底盘任务相关宏定义
+#define CHASSIS_TASK_INIT_TIME 357   // 任务开始空闲一段时间
+#define CHASSIS_CONTROL_TIME_MS 2    // 底盘任务控制间隔 2ms
+
+// 底盘的遥控器相关宏定义 ---------------------
+#define CHASSIS_MODE_CHANNEL   5  // 选择底盘状态 开关通道号
+#define CHASSIS_X_CHANNEL      2  // 前后的遥控器通道号码
+#define CHASSIS_Y_CHANNEL      3  // 左右的遥控器通道号码
+#define CHASSIS_WZ_CHANNEL     0  // 旋转的遥控器通道号码
+#define CHASSIS_RC_DEADLINE    20 // 摇杆死区
+
+// motor parameters ---------------------
+#define STEER_CAN (1)  // 舵向电机GM6020(电压控制，id 1~4)
+#define WHEEL_CAN (1)  // 驱动电机M3508(电流控制，id 1~4)，与舵向电机同一CAN时合并发送
+
+// 模块顺序：0-左前，1-左后，2-右后，3-右前
+#define S0_DIRECTION (1)
+#define S1_DIRECTION (1)
+#define S2_DIRECTION (1)
+#define S3_DIRECTION (1)
+
+#define W0_DIRECTION (1)
+#define W1_DIRECTION (1)
+#define W2_DIRECTION (-1)
+#define W3_DIRECTION (-1)
+
+#define S0_ANGLE_OFFSET (0.0f)  // (rad)舵向朝向底盘x正方向时的电机角度
+#define S1_ANGLE_OFFSET (0.0f)
+#define S2_ANGLE_OFFSET (0.0f)
+#define S3_ANGLE_OFFSET (0.0f)
+
+// physical parameters ---------------------
+#define MODULE_X       (0.2f)    // (m)模块到底盘中心的x方向距离
+#define MODULE_Y       (0.2f)    // (m)模块到底盘中心的y方向距离
+#define WHEEL_RADIUS   (0.06f)   // (m)驱动轮半径
+#define WHEEL_REDUCTION_RATIO (19.0f)  // M3508减速比
+
+// deadzone parameters ---------------------
+#define MODULE_SPEED_DEADZONE (0.02f)  // (m/s)模块速度死区，低于该速度舵向保持不动
+
+// speed limit parameters ---------------------
+#define MAX_SPEED_VECTOR_VX  (3.0f)
+#define MAX_SPEED_VECTOR_VY  (3.0f)
+#define MAX_SPEED_VECTOR_WZ  (6.0f)
+#define SPIN_SPEED_WZ        (6.0f)  // (rad/s)小陀螺转速
+
+//PID parameters ---------------------
+// 舵向角度环，输出舵向角速度(rad/s)
+#define KP_CHASSIS_STEER_ANGLE       (20.0f)
+#define KI_CHASSIS_STEER_ANGLE       (0.0f)
+#define KD_CHASSIS_STEER_ANGLE       (0.0f)
+#define MAX_IOUT_CHASSIS_STEER_ANGLE (0.0f)
+#define MAX_OUT_CHASSIS_STEER_ANGLE  (30.0f)
+
+// 舵向速度环，输出GM6020电压控制值
+#define KP_CHASSIS_STEER_VEL         (4000.0f)
+#define KI_CHASSIS_STEER_VEL         (10.0f)
+#define KD_CHASSIS_STEER_VEL         (0.0f)
+#define MAX_IOUT_CHASSIS_STEER_VEL   (5000.0f)
+#define MAX_OUT_CHASSIS_STEER_VEL    (25000.0f)
+
+// 驱动轮速度环，输入转子转速(rad/s)，输出M3508电流控制值
+#define KP_CHASSIS_WHEEL_VEL         (20.0f)
+#define KI_CHASSIS_WHEEL_VEL         (0.0f)
+#define KD_CHASSIS_WHEEL_VEL         (0.0f)
+#define MAX_IOUT_CHASSIS_WHEEL_VEL   (2000.0f)
+#define MAX_OUT_CHASSIS_WHEEL_VEL    (16000.0f)
+
+// 云台跟随用的pid
+#define KP_CHASSIS_FOLLOW_GIMBAL       (5.0f)
+#define KI_CHASSIS_FOLLOW_GIMBAL       (0.0f)
+#define KD_CHASSIS_FOLLOW_GIMBAL       (0.0f)
+#define MAX_IOUT_CHASSIS_FOLLOW_GIMBAL (1.0f)
+#define MAX_OUT_CHASSIS_FOLLOW_GIMBAL  (6.0f)
+
+// clang-format on
+#endif /* INCLUDED_ROBOT_PARAM_H */
@@ -0,0 +1,220 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       fric_wheel.c/h
+  * @brief      摩擦轮转速控制：前馈、弹丸负载扰动观测、单发掉速统计与射速闭环
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *  V1.0.1     Oct-19-2026     Penguin         1. 误差大或输出饱和时停止积分，避免启动和掉速后过冲
+  *                                             2. 掉速过程中目标转速改变(射速闭环修正)时仍计数
+  *
+  @verbatim
+  ==============================================================================
+
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include "fric_wheel.h"
+
+#include "math.h"
+
+#define FRIC_ACC_FILTER_TIME 0.002f  // (s)加速度低通时间常数
+
+static fp32 Clamp(fp32 x, fp32 max)
+{
+    if (x > max) return max;
+    if (x < -max) return -max;
+    return x;
+}
+
+static fp32 Sign(fp32 x) { return x > 0.0f ? 1.0f : (x < 0.0f ? -1.0f : 0.0f); }
+
+/**
+ * @brief          指数加权更新均值与方差
+ */
+static void EwmaUpdate(fp32 * mean, fp32 * var, fp32 x, uint32_t count)
+{
+    if (count == 0) {
+        *mean = x;
+        *var = 0.0f;
+        return;
+    }
+    fp32 diff = x - *mean;
+    *mean += FRIC_STATS_ALPHA * diff;
+    *var = (1.0f - FRIC_STATS_ALPHA) * (*var + FRIC_STATS_ALPHA * diff * diff);
+}
+
+/*-------------------- Wheel --------------------*/
+
+/**
+ * @brief          初始化摩擦轮控制器
+ * @param[out]     wheel 摩擦轮控制器
+ * @param[in]      param 参数，内部保存一份拷贝
+ * @param[in]      PID 速度环 0: kp, 1: ki, 2:kd
+ * @param[in]      max_out 最大输出(含前馈与扰动补偿)
+ * @param[in]      max_iout 速度环最大积分输出
+ * @retval         none
+ */
+void FricWheelInit(
+    FricWheel_s * wheel, const FricWheelParam_s * param, const fp32 PID[3], fp32 max_out,
+    fp32 max_iout)
+{
+    wheel->param = *param;
+    wheel->max_out = max_out;
+    PID_init(&wheel->pid, PID_POSITION, PID, max_out, max_iout);
+
+    wheel->vel = 0.0f;
+    wheel->acc = 0.0f;
+    wheel->temp = param->temp_ref;
+    wheel->ref = 0.0f;
+    wheel->ff = 0.0f;
+    wheel->dob = 0.0f;
+    wheel->out = 0.0f;
+
+    wheel->settled = 0;
+    wheel->dip = 0;
+    wheel->dip_timer = 0.0f;
+    wheel->dip_max = 0.0f;
+    wheel->drop = 0.0f;
+    wheel->recover_time = 0.0f;
+    wheel->drop_mean = 0.0f;
+    wheel->drop_var = 0.0f;
+    wheel->shot_count = 0;
+}
+
+/**
+ * @brief          更新摩擦轮状态，每个控制周期调用一次
+ * @param[in,out]  wheel 摩擦轮控制器
+ * @param[in]      vel (rad/s)转速反馈
+ * @param[in]      temp (℃)电机温度反馈
+ * @param[in]      dt (s)距上次调用的时间
+ * @retval         none
+ */
+void FricWheelObserve(FricWheel_s * wheel, fp32 vel, fp32 temp, fp32 dt)
+{
+    if (dt <= 0.0f) return;
+
+    fp32 alpha = dt / (FRIC_ACC_FILTER_TIME + dt);
+    wheel->acc += alpha * ((vel - wheel->vel) / dt - wheel->acc);
+    wheel->vel = vel;
+    wheel->temp = temp;
+}
+
+/**
+ * @brief          摩擦轮转速控制，同时统计单发掉速
+ * @param[in,out]  wheel 摩擦轮控制器
+ * @param[in]      ref (rad/s)目标转速
+ * @param[in]      dt (s)距上次调用的时间
+ * @retval         控制量(电流)
+ */
+fp32 FricWheelControl(FricWheel_s * wheel, fp32 ref, fp32 dt)
+{
+    const FricWheelParam_s * p = &wheel->param;
+    fp32 temp_gain = 1.0f + p->k_temp * (wheel->temp - p->temp_ref);
+
+    // 目标转速改变后需要重新稳定，避免把转速调整误判为发射；
+    // 射速闭环在掉速恢复过程中修正目标转速时，这一发仍然计数
+    if (ref != wheel->ref && !wheel->dip) {
+        wheel->settled = 0;
+    }
+    wheel->ref = ref;
+
+    if (ref == 0.0f) {
+        // 摩擦轮关闭，不做前馈与扰动补偿，避免反向制动
+        wheel->ff = 0.0f;
+        wheel->dob = 0.0f;
+        wheel->settled = 0;
+        wheel->dip = 0;
+        wheel->out = PID_calc(&wheel->pid, wheel->vel, ref);
+        return wheel->out;
+    }
+
+    // 扰动观测：上周期输出 - 空转模型
+    fp32 model = p->k_acc * wheel->acc +
+                 (p->k_vel * wheel->vel + p->k_static * Sign(wheel->vel)) * temp_gain;
+    fp32 alpha = dt / (p->dob_time + dt);
+    wheel->dob += alpha * (wheel->out - model - wheel->dob);
+    wheel->dob = Clamp(wheel->dob, p->dob_max);
+
+    wheel->ff = (p->k_vel * ref + p->k_static * Sign(ref)) * temp_gain;
+    fp32 iout = wheel->pid.Iout;
+    fp32 out = PID_calc(&wheel->pid, wheel->vel, ref) + wheel->ff + wheel->dob;
+    if (fabsf(ref - wheel->vel) > p->dip_threshold || fabsf(out) > wheel->max_out) {
+        // 稳态负载由前馈和扰动补偿承担，积分只修正小误差，启动和掉速时积分只会造成过冲
+        wheel->pid.Iout = iout;
+    }
+    wheel->out = Clamp(out, wheel->max_out);
+
+    // 单发掉速
+    fp32 drop = (ref - wheel->vel) * Sign(ref);
+    if (!wheel->dip) {
+        if (wheel->settled && drop > p->dip_threshold) {
+            wheel->dip = 1;
+            wheel->dip_timer = 0.0f;
+            wheel->dip_max = drop;
+        } else if (fabsf(drop) < 0.5f * p->dip_threshold) {
+            wheel->settled = 1;
+        }
+    } else {
+        wheel->dip_timer += dt;
+        if (drop > wheel->dip_max) wheel->dip_max = drop;
+        if (fabsf(drop) < 0.5f * p->dip_threshold) {
+            wheel->dip = 0;
+            wheel->drop = wheel->dip_max;
+            wheel->recover_time = wheel->dip_timer;
+            EwmaUpdate(&wheel->drop_mean, &wheel->drop_var, wheel->drop, wheel->shot_count);
+            wheel->shot_count++;
+        }
+    }
+
+    return wheel->out;
+}
+
+/*-------------------- Muzzle --------------------*/
+
+/**
+ * @brief          初始化射速闭环
+ * @param[out]     muzzle 射速闭环
+ * @param[in]      target (m/s)目标射速
+ * @param[in]      gain 每发修正比例
+ * @param[in]      max_adjust 转速修正比例上限
+ * @retval         none
+ */
+void FricMuzzleInit(FricMuzzle_s * muzzle, fp32 target, fp32 gain, fp32 max_adjust)
+{
+    muzzle->target = target;
+    muzzle->gain = gain;
+    muzzle->max_adjust = max_adjust;
+    muzzle->ratio = 1.0f;
+    muzzle->last_count = 0;
+    muzzle->speed = 0.0f;
+    muzzle->mean = 0.0f;
+    muzzle->var = 0.0f;
+    muzzle->count = 0;
+}
+
+/**
+ * @brief          根据裁判系统射速修正摩擦轮目标转速，每个控制周期调用一次
+ * @param[in,out]  muzzle 射速闭环
+ * @param[in]      speed (m/s)裁判系统最近一发射速
+ * @param[in]      count 裁判系统射速包序号，变化时说明有新的一发
+ * @retval         是否有新的一发
+ */
+bool_t FricMuzzleUpdate(FricMuzzle_s * muzzle, fp32 speed, uint32_t count)
+{
+    if (count == muzzle->last_count) return 0;
+    muzzle->last_count = count;
+    if (speed <= 0.0f) return 0;
+
+    muzzle->speed = speed;
+    EwmaUpdate(&muzzle->mean, &muzzle->var, speed, muzzle->count);
+    muzzle->count++;
+
+    muzzle->ratio += muzzle->gain * (muzzle->target - speed) / speed * muzzle->ratio;
+    if (muzzle->ratio > 1.0f + muzzle->max_adjust) muzzle->ratio = 1.0f + muzzle->max_adjust;
+    if (muzzle->ratio < 1.0f - muzzle->max_adjust) muzzle->ratio = 1.0f - muzzle->max_adjust;
+    return 1;
+}
+/*------------------------------ End of File ------------------------------*/
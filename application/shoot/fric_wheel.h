@@ -0,0 +1,102 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       fric_wheel.c/h
+  * @brief      摩擦轮转速控制：前馈、弹丸负载扰动观测、单发掉速统计与射速闭环
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *  V1.0.1     Oct-19-2026     Penguin         1. 误差大或输出饱和时停止积分
+  *
+  @verbatim
+  ==============================================================================
+    转速控制(FricWheel_s)：
+      输出 = PID + 前馈 + 扰动补偿
+      前馈 = (k_vel*ref + k_static*sign(ref)) * (1 + k_temp*(temp - temp_ref))
+        电机温度升高后转矩常数下降，维持同样转速需要更大的电流，温度取自电机反馈。
+      扰动观测：上周期输出减去空转模型(k_acc*acc + 前馈模型(vel))经过 dob_time 低通，
+        即为弹丸挤过摩擦轮时的负载，下周期直接加到输出上，PID只需处理剩余误差。
+      转速误差超过 dip_threshold 或总输出饱和时不累加积分，避免启动和掉速后过冲。
+      参数的仿真验证见 tools/fric_sim.c。
+    单发掉速：
+      转速误差超过 dip_threshold 视为一发弹丸经过，记录最大掉速，
+      误差回到 dip_threshold/2 以内时记录恢复时间，shot_count 加1。
+    射速闭环(FricMuzzle_s)：
+      裁判系统每发上报一次射速，按 (target - speed)/speed * gain 修正摩擦轮目标转速比例 ratio，
+      ratio 限制在 1±max_adjust 内，同时统计射速的指数加权均值与标准差。
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+#ifndef FRIC_WHEEL_H
+#define FRIC_WHEEL_H
+#include "pid.h"
+#include "struct_typedef.h"
+
+#define FRIC_STATS_ALPHA 0.1f  // 掉速、射速统计的指数加权系数，约为最近10发
+
+typedef struct
+{
+    fp32 k_acc;           // 空转模型加速度项系数
+    fp32 k_vel;           // 前馈/空转模型速度项系数
+    fp32 k_static;        // 前馈/空转模型静摩擦项
+    fp32 k_temp;          // (1/℃)温度对前馈的修正系数
+    fp32 temp_ref;        // (℃)前馈标定时的电机温度
+    fp32 dob_time;        // (s)扰动观测器低通时间常数
+    fp32 dob_max;         // 扰动补偿限幅
+    fp32 dip_threshold;   // (rad/s)判断一发弹丸经过的掉速阈值
+} FricWheelParam_s;
+
+typedef struct
+{
+    FricWheelParam_s param;
+    pid_type_def pid;
+    fp32 max_out;
+
+    // 观测
+    fp32 vel;   // (rad/s)
+    fp32 acc;   // (rad/s^2)
+    fp32 temp;  // (℃)
+
+    // 控制
+    fp32 ref;       // (rad/s)
+    fp32 ff;        // 前馈
+    fp32 dob;       // 扰动补偿
+    fp32 out;       // 输出
+
+    // 单发掉速
+    bool_t settled;      // 转速已稳定在目标附近
+    bool_t dip;          // 正在掉速
+    fp32 dip_timer;      // (s)
+    fp32 dip_max;        // (rad/s)本次最大掉速
+    fp32 drop;           // (rad/s)最近一发掉速
+    fp32 recover_time;   // (s)最近一发恢复时间
+    fp32 drop_mean;      // (rad/s)
+    fp32 drop_var;       // (rad/s)^2
+    uint32_t shot_count;
+} FricWheel_s;
+
+typedef struct
+{
+    fp32 target;      // (m/s)目标射速
+    fp32 gain;        // 每发修正比例
+    fp32 max_adjust;  // 转速修正比例上限
+    fp32 ratio;       // 摩擦轮目标转速修正系数
+
+    uint32_t last_count;  // 上次处理的裁判系统射速包序号
+    fp32 speed;           // (m/s)最近一发射速
+    fp32 mean;            // (m/s)
+    fp32 var;             // (m/s)^2
+    uint32_t count;       // 收到的射速数
+} FricMuzzle_s;
+
+extern void FricWheelInit(
+    FricWheel_s * wheel, const FricWheelParam_s * param, const fp32 PID[3], fp32 max_out,
+    fp32 max_iout);
+extern void FricWheelObserve(FricWheel_s * wheel, fp32 vel, fp32 temp, fp32 dt);
+extern fp32 FricWheelControl(FricWheel_s * wheel, fp32 ref, fp32 dt);
+
+extern void FricMuzzleInit(FricMuzzle_s * muzzle, fp32 target, fp32 gain, fp32 max_adjust);
+extern bool_t FricMuzzleUpdate(FricMuzzle_s * muzzle, fp32 speed, uint32_t count);
+
+#endif  // FRIC_WHEEL_H
+/*------------------------------ End of File ------------------------------*/
@@ -0,0 +1,281 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       shoot_feeder.c/h
+  * @brief      拨弹盘供弹控制：按格位置闭环、卡弹预测与热量令牌桶
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include "shoot_feeder.h"
+
+#include "math.h"
+#include "stddef.h"
+
+#define FEEDER_FILTER_TIME 0.005f     // (s)加速度与负载残差的低通时间常数
+#define FEEDER_MOVE_RATIO 0.05f       // 剩余角度大于 该比例*slot_angle 时认为拨盘应当转动
+#define FEEDER_REBASE_ANGLE 10000.0f  // (rad)展开位置超过该值时整体平移，避免浮点精度下降
+#define FEEDER_PENDING_MAX 100
+
+static fp32 Clamp(fp32 x, fp32 max)
+{
+    if (x > max) return max;
+    if (x < -max) return -max;
+    return x;
+}
+
+static fp32 Sign(fp32 x) { return x > 0.0f ? 1.0f : (x < 0.0f ? -1.0f : 0.0f); }
+
+/*-------------------- Feeder --------------------*/
+
+/**
+ * @brief          初始化供弹控制器
+ * @param[out]     feeder 供弹控制器
+ * @param[in]      param 参数，内部保存一份拷贝
+ * @retval         none
+ */
+void ShootFeederInit(ShootFeeder_s * feeder, const ShootFeederParam_s * param)
+{
+    feeder->param = *param;
+    feeder->init = 0;
+    feeder->pos = 0.0f;
+    feeder->vel = 0.0f;
+    feeder->acc = 0.0f;
+    feeder->effort = 0.0f;
+    feeder->load = 0.0f;
+    feeder->load_rate = 0.0f;
+    feeder->shot_count = 0;
+    feeder->jam_count = 0;
+    ShootFeederReset(feeder);
+}
+
+/**
+ * @brief          更新供弹电机状态与负载残差，每个控制周期调用一次
+ * @param[in,out]  feeder 供弹控制器
+ * @param[in]      pos (rad)电机位置反馈，周期为param.pos_range
+ * @param[in]      vel (rad/s)电机转速反馈
+ * @param[in]      effort 电机电流或力矩反馈，与负载模型单位一致
+ * @param[in]      dt (s)距上次调用的时间
+ * @retval         none
+ */
+void ShootFeederObserve(ShootFeeder_s * feeder, fp32 pos, fp32 vel, fp32 effort, fp32 dt)
+{
+    const ShootFeederParam_s * p = &feeder->param;
+
+    if (!feeder->init) {
+        feeder->last_raw_pos = pos;
+        feeder->vel = vel;
+        feeder->init = 1;
+        ShootFeederReset(feeder);
+        return;
+    }
+    if (dt <= 0.0f) return;
+
+    // 多圈展开
+    fp32 delta = pos - feeder->last_raw_pos;
+    if (delta > 0.5f * p->pos_range) {
+        delta -= p->pos_range;
+    } else if (delta < -0.5f * p->pos_range) {
+        delta += p->pos_range;
+    }
+    feeder->last_raw_pos = pos;
+    feeder->pos += delta;
+
+    if (fabsf(feeder->target) > FEEDER_REBASE_ANGLE) {
+        fp32 offset = feeder->target;
+        feeder->pos -= offset;
+        feeder->target -= offset;
+        feeder->pos_ref -= offset;
+    }
+
+    // 负载残差
+    fp32 alpha = dt / (FEEDER_FILTER_TIME + dt);
+    feeder->acc += alpha * ((vel - feeder->vel) / dt - feeder->acc);
+    feeder->effort += alpha * (effort - feeder->effort);
+    feeder->vel = vel;
+
+    fp32 model = p->k_acc * feeder->acc + p->k_vel * vel + p->k_static * Sign(vel);
+    fp32 last_load = feeder->load;
+    feeder->load = feeder->effort - model;
+    feeder->load_rate += alpha * ((feeder->load - last_load) / dt - feeder->load_rate);
+}
+
+/**
+ * @brief          请求发射num发，实际放行受热量和卡弹状态限制
+ */
+void ShootFeederFire(ShootFeeder_s * feeder, uint16_t num)
+{
+    feeder->pending += num;
+    if (feeder->pending > FEEDER_PENDING_MAX) feeder->pending = FEEDER_PENDING_MAX;
+}
+
+/**
+ * @brief          设置连发，连发时热量允许即持续放行
+ */
+void ShootFeederSetBurst(ShootFeeder_s * feeder, bool_t burst) { feeder->burst = burst; }
+
+/**
+ * @brief          停止放行新的弹丸，正在进行的一格会继续完成
+ */
+void ShootFeederStop(ShootFeeder_s * feeder)
+{
+    feeder->pending = 0;
+    feeder->burst = 0;
+}
+
+/**
+ * @brief          复位，目标位置设为当前位置，清除待发射弹数与卡弹状态
+ */
+void ShootFeederReset(ShootFeeder_s * feeder)
+{
+    ShootFeederStop(feeder);
+    feeder->state = FEEDER_READY;
+    feeder->target = feeder->pos;
+    feeder->pos_ref = feeder->pos;
+    feeder->vel_ref = 0.0f;
+    feeder->jam_timer = 0.0f;
+    feeder->stall_timer = 0.0f;
+    feeder->back_timer = 0.0f;
+}
+
+/**
+ * @brief          供弹控制，放行弹丸、检测卡弹并计算期望转速
+ * @param[in,out]  feeder 供弹控制器
+ * @param[in,out]  heat 热量令牌桶，为NULL时不限制热量
+ * @param[in]      dt (s)距上次调用的时间
+ * @retval         (rad/s)电机期望转速
+ */
+fp32 ShootFeederControl(ShootFeeder_s * feeder, ShootHeat_s * heat, fp32 dt)
+{
+    const ShootFeederParam_s * p = &feeder->param;
+    fp32 dir = Sign(p->slot_angle);
+    fp32 slot = fabsf(p->slot_angle);
+
+    if (feeder->state == FEEDER_READY) {
+        // 放行
+        fp32 remaining = (feeder->target - feeder->pos) * dir;
+        if ((feeder->pending > 0 || feeder->burst) && remaining < p->fire_lead * slot &&
+            (heat == NULL || ShootHeatAvailable(heat) > 0)) {
+            feeder->target += p->slot_angle;
+            remaining += slot;
+            if (feeder->pending > 0) feeder->pending--;
+            if (heat != NULL) ShootHeatConsume(heat);
+            feeder->shot_count++;
+        }
+        feeder->pos_ref = feeder->target;
+
+        // 卡弹预测与堵转兜底，只在拨盘减速时外推负载，避免加速段模型误差被放大
+        bool_t moving = remaining > FEEDER_MOVE_RATIO * slot;
+        fp32 predict = feeder->load * dir;
+        fp32 load_rate = feeder->load_rate * dir;
+        if (feeder->acc * dir < 0.0f && load_rate > 0.0f) {
+            predict += load_rate * p->jam_predict_time;
+        }
+
+        feeder->jam_timer = (moving && predict > p->jam_effort) ? feeder->jam_timer + dt : 0.0f;
+        feeder->stall_timer =
+            (moving && fabsf(feeder->vel) < p->stall_vel) ? feeder->stall_timer + dt : 0.0f;
+
+        if (feeder->jam_timer >= p->jam_confirm_time || feeder->stall_timer >= p->stall_time) {
+            feeder->state = FEEDER_JAM_BACK;
+            feeder->pos_ref = feeder->pos - p->slot_angle / slot * p->back_angle;
+            feeder->back_timer = 0.0f;
+            feeder->jam_count++;
+        }
+    } else if (feeder->state == FEEDER_JAM_BACK) {
+        feeder->back_timer += dt;
+        if (feeder->back_timer >= p->back_time) {
+            feeder->state = FEEDER_READY;
+            feeder->pos_ref = feeder->target;
+            feeder->jam_timer = 0.0f;
+            feeder->stall_timer = 0.0f;
+        }
+    }
+
+    feeder->vel_ref = Clamp(p->pos_kp * (feeder->pos_ref - feeder->pos), p->max_vel);
+    return feeder->vel_ref;
+}
+
+/**
+ * @brief          是否还有未完成的供弹动作
+ */
+bool_t ShootFeederIsBusy(const ShootFeeder_s * feeder)
+{
+    return feeder->state != FEEDER_READY || feeder->pending > 0 || feeder->burst ||
+           (feeder->target - feeder->pos) * Sign(feeder->param.slot_angle) >
+               FEEDER_MOVE_RATIO * fabsf(feeder->param.slot_angle);
+}
+
+/*-------------------- Heat --------------------*/
+
+/**
+ * @brief          初始化热量令牌桶
+ * @param[out]     heat 热量令牌桶
+ * @param[in]      heat_per_shot 每发热量，17mm为10，42mm为100
+ * @param[in]      margin 预留热量
+ * @retval         none
+ */
+void ShootHeatInit(ShootHeat_s * heat, fp32 heat_per_shot, fp32 margin)
+{
+    heat->heat_per_shot = heat_per_shot;
+    heat->margin = margin;
+    heat->limit = 0.0f;
+    heat->cooling = 0.0f;
+    heat->heat = 0.0f;
+    heat->since_shot = SHOOT_HEAT_SYNC_TIME;
+    heat->last_referee_heat = 0;
+}
+
+/**
+ * @brief          更新热量估计，每个控制周期调用一次
+ * @param[in,out]  heat 热量令牌桶
+ * @param[in]      limit 裁判系统热量上限
+ * @param[in]      cooling (1/s)裁判系统每秒冷却值
+ * @param[in]      referee_heat 裁判系统当前热量
+ * @param[in]      dt (s)距上次调用的时间
+ * @retval         none
+ */
+void ShootHeatUpdate(
+    ShootHeat_s * heat, uint16_t limit, uint16_t cooling, uint16_t referee_heat, fp32 dt)
+{
+    heat->limit = limit;
+    heat->cooling = cooling;
+    heat->since_shot += dt;
+
+    heat->heat -= cooling * dt;
+    if (heat->heat < 0.0f) heat->heat = 0.0f;
+
+    if (referee_heat != heat->last_referee_heat) {
+        heat->last_referee_heat = referee_heat;
+        if (heat->since_shot >= SHOOT_HEAT_SYNC_TIME || referee_heat > heat->heat) {
+            heat->heat = referee_heat;
+        }
+    }
+}
+
+/**
+ * @brief          当前热量允许发射的弹数
+ */
+uint16_t ShootHeatAvailable(const ShootHeat_s * heat)
+{
+    fp32 remain = heat->limit - heat->margin - heat->heat;
+    if (remain < heat->heat_per_shot) return 0;
+    return (uint16_t)(remain / heat->heat_per_shot);
+}
+
+/**
+ * @brief          记录发射一发
+ */
+void ShootHeatConsume(ShootHeat_s * heat)
+{
+    heat->heat += heat->heat_per_shot;
+    heat->since_shot = 0.0f;
+}
+/*------------------------------ End of File ------------------------------*/
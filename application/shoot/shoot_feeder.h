@@ -0,0 +1,118 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       shoot_feeder.c/h
+  * @brief      拨弹盘供弹控制：按格位置闭环、卡弹预测与热量令牌桶
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+    供弹：
+      电机位置多圈展开后按格(slot_angle)累加目标位置，每放行一发目标前进一格，
+      位置环输出期望转速，由调用者的速度环或电机自身的速度模式跟踪。
+      连发时当前格剩余角度小于 fire_lead*slot_angle 即放行下一发，拨盘连续转动不停顿。
+      每个控制周期调用一次，所有时间量使用实际dt，与任务周期无关。
+    卡弹预测：
+      负载模型 effort = k_acc*acc + k_vel*vel + k_static*sign(vel) 为空转时电机所需的电流(力矩)，
+      实际反馈减去模型得到负载残差(反馈与加速度经过相同的低通滤波)。
+      拨盘减速时残差沿供弹方向按变化率外推 jam_predict_time，
+      超过 jam_effort 并持续 jam_confirm_time 即判定为卡弹，此时拨盘尚未停转。
+      保留"期望转动但转速过低"的堵转判断作为兜底。
+      卡弹后回退 back_angle 保持 back_time，然后重新送当前格。
+    热量令牌桶：
+      本地热量估计每发增加 heat_per_shot，按裁判系统冷却值连续冷却，
+      裁判系统热量更新时取两者较大值；距上次发射超过 SHOOT_HEAT_SYNC_TIME 后直接采用裁判系统热量。
+      可发射弹数 = (热量上限 - 预留热量 - 估计热量) / heat_per_shot，
+      弥补裁判系统热量数据约100ms的延迟，持续射击时射频自动收敛到 冷却值/heat_per_shot。
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+#ifndef SHOOT_FEEDER_H
+#define SHOOT_FEEDER_H
+#include "struct_typedef.h"
+
+#define SHOOT_HEAT_SYNC_TIME 0.5f  // (s)距上次发射超过该时间后以裁判系统热量为准
+
+typedef struct
+{
+    fp32 slot_angle;        // (rad)每发弹丸对应的电机转角，符号为供弹方向
+    fp32 pos_range;         // (rad)电机位置反馈的周期，用于多圈展开
+    fp32 max_vel;           // (rad/s)供弹最大转速
+    fp32 pos_kp;            // (1/s)位置环比例系数
+    fp32 fire_lead;         // [0,1]当前格剩余角度比例小于该值时放行下一发
+    fp32 k_acc;             // 负载模型加速度项系数
+    fp32 k_vel;             // 负载模型速度项系数
+    fp32 k_static;          // 负载模型静摩擦项
+    fp32 jam_effort;        // 外推负载残差超过该值判定为即将卡弹
+    fp32 jam_predict_time;  // (s)负载残差外推时间
+    fp32 jam_confirm_time;  // (s)负载残差超过阈值的持续时间
+    fp32 stall_vel;         // (rad/s)堵转兜底：期望转动但转速低于该值
+    fp32 stall_time;        // (s)堵转兜底持续时间
+    fp32 back_angle;        // (rad)卡弹后回退角度
+    fp32 back_time;         // (s)卡弹后回退保持时间
+} ShootFeederParam_s;
+
+typedef enum {
+    FEEDER_READY,     // 正常供弹
+    FEEDER_JAM_BACK,  // 卡弹回退
+} ShootFeederState_e;
+
+typedef struct
+{
+    ShootFeederParam_s param;
+    ShootFeederState_e state;
+
+    // 观测
+    bool_t init;
+    fp32 last_raw_pos;  // (rad)上次电机位置反馈
+    fp32 pos;           // (rad)多圈展开后的电机位置
+    fp32 vel;           // (rad/s)
+    fp32 acc;           // (rad/s^2)滤波后的加速度
+    fp32 effort;        // 滤波后的电流(力矩)反馈
+    fp32 load;          // 负载残差
+    fp32 load_rate;     // (1/s)负载残差变化率
+
+    // 控制
+    fp32 target;    // (rad)当前格目标位置
+    fp32 pos_ref;   // (rad)位置环期望，回退时与target不同
+    fp32 vel_ref;   // (rad/s)输出的期望转速
+    uint16_t pending;  // 待发射弹数
+    bool_t burst;      // 连发
+    fp32 jam_timer;    // (s)
+    fp32 stall_timer;  // (s)
+    fp32 back_timer;   // (s)
+
+    uint32_t shot_count;  // 已放行弹数
+    uint32_t jam_count;   // 卡弹次数
+} ShootFeeder_s;
+
+typedef struct
+{
+    fp32 heat_per_shot;  // 每发热量
+    fp32 margin;         // 预留热量
+    fp32 limit;          // 热量上限
+    fp32 cooling;        // (1/s)每秒冷却值
+    fp32 heat;           // 本地估计热量
+    fp32 since_shot;     // (s)距上次发射的时间
+    uint16_t last_referee_heat;
+} ShootHeat_s;
+
+extern void ShootFeederInit(ShootFeeder_s * feeder, const ShootFeederParam_s * param);
+extern void ShootFeederObserve(ShootFeeder_s * feeder, fp32 pos, fp32 vel, fp32 effort, fp32 dt);
+extern void ShootFeederFire(ShootFeeder_s * feeder, uint16_t num);
+extern void ShootFeederSetBurst(ShootFeeder_s * feeder, bool_t burst);
+extern void ShootFeederStop(ShootFeeder_s * feeder);
+extern void ShootFeederReset(ShootFeeder_s * feeder);
+extern fp32 ShootFeederControl(ShootFeeder_s * feeder, ShootHeat_s * heat, fp32 dt);
+extern bool_t ShootFeederIsBusy(const ShootFeeder_s * feeder);
+
+extern void ShootHeatInit(ShootHeat_s * heat, fp32 heat_per_shot, fp32 margin);
+extern void ShootHeatUpdate(
+    ShootHeat_s * heat, uint16_t limit, uint16_t cooling, uint16_t referee_heat, fp32 dt);
+extern uint16_t ShootHeatAvailable(const ShootHeat_s * heat);
+extern void ShootHeatConsume(ShootHeat_s * heat);
+
+#endif  // SHOOT_FEEDER_H
+/*------------------------------ End of File ------------------------------*/
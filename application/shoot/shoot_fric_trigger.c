@@ -11,6 +11,11 @@
   *  V2.0.0     2025-3-3        CJH             1. 兼容了达妙4310拨弹盘和大疆2006拨弹盘
   *                                             2. 完善了单发功能，上位机火控功能
   *                                             3. 增加了热量限制
+  *  V2.1.0     Oct-19-2026     Penguin         1. 拨弹盘改为按格位置闭环供弹(shoot_feeder)
+  *                                             2. 卡弹预测替代看门狗防堵转
+  *                                             3. 热量限制改为本地热量估计的令牌桶
+  *  V2.2.0     Oct-19-2026     Penguin         1. 摩擦轮增加前馈、扰动观测与射速闭环(fric_wheel)
+  *                                             2. 单发掉速与射速统计通过USB发送
   @verbatim
   ==============================================================================
 
@@ -21,6 +26,9 @@
 
 #include "shoot_fric_trigger.h"
 
+#include "control_timer.h"
+#include "data_exchange.h"
+
 
 #if (SHOOT_TYPE == SHOOT_FRIC_TRIGGER)
 
@@ -28,16 +36,26 @@ static Shoot_s SHOOT = {
   .mode = LOAD_STOP,
   .state = FRIC_NOT_READY,
   .fric_flag = 0,
-  .move_flag = 0,
-  .ecd_count = 0,
+  .fire_flag = 0,
   .shoot_flag = 0,
+  .press_time = 0.0f,
   .heat = 0,
   .heat_limit = 0,
 };
 
 
 uint8_t fric_ui;
-fp32 delta;
+
+static void ShootUpdateFricStats(void);
+
+/*-------------------- Publish --------------------*/
+
+/**
+ * @brief          发布数据
+ * @param[in]      none
+ * @retval         none
+ */
+void ShootPublish(void) { Publish(&SHOOT.fric_stats, SHOOT_FRIC_STATS_NAME); }
 
 /*-------------------- Init --------------------*/
 
@@ -56,27 +74,58 @@ void ShootInit(void)
   MotorInit(&SHOOT.fric_motor[1],FRIC_MOTOR_L_ID, FRIC_MOTOR_L_CAN, FRIC_MOTOR_TYPE, 1, 1.0f, 0);//初始化L摩擦轮电机结构体
 
   const fp32 pid_fric[3] = {FRIC_SPEED_PID_KP, FIRC_SPEED_PID_KI, FRIC_SPEED_PID_KD};//摩擦轮速度环
-
-  PID_init(&SHOOT.fric_pid[0], PID_POSITION, pid_fric, FRIC_PID_MAX_OUT, FRIC_PID_MAX_IOUT);
-  PID_init(&SHOOT.fric_pid[1], PID_POSITION, pid_fric, FRIC_PID_MAX_OUT, FRIC_PID_MAX_IOUT);//摩擦轮初始化pid
+  const FricWheelParam_s fric_param = {
+    .k_acc = FRIC_MODEL_K_ACC,
+    .k_vel = FRIC_FF_K_VEL,
+    .k_static = FRIC_FF_K_STATIC,
+    .k_temp = FRIC_FF_K_TEMP,
+    .temp_ref = FRIC_FF_TEMP_REF,
+    .dob_time = FRIC_DOB_TIME,
+    .dob_max = FRIC_DOB_MAX,
+    .dip_threshold = FRIC_DIP_THRESHOLD,
+  };
+
+  FricWheelInit(&SHOOT.fric[0], &fric_param, pid_fric, FRIC_PID_MAX_OUT, FRIC_PID_MAX_IOUT);
+  FricWheelInit(&SHOOT.fric[1], &fric_param, pid_fric, FRIC_PID_MAX_OUT, FRIC_PID_MAX_IOUT);//摩擦轮初始化
+  FricMuzzleInit(&SHOOT.muzzle, SHOOT_TARGET_SPEED, SHOOT_SPEED_ADJUST_GAIN, SHOOT_SPEED_ADJUST_MAX);
 
   //拨弹盘相关
   MotorInit(&SHOOT.trigger_motor,TRIGGER_MOTOR_ID, TRIGGER_MOTOR_CAN, TRIGGER_MOTOR_TYPE, 1, 1.0f, 0);//初始化拨弹盘电机结构体
+
+  ShootFeederParam_s feeder_param = {
+    .max_vel = fabsf(TRIGGER_SPEED),
+    .pos_kp = TRIGGER_FEED_POS_KP,
+    .fire_lead = TRIGGER_FEED_FIRE_LEAD,
+    .k_acc = TRIGGER_LOAD_K_ACC,
+    .k_vel = TRIGGER_LOAD_K_VEL,
+    .k_static = TRIGGER_LOAD_K_STATIC,
+    .jam_effort = TRIGGER_JAM_EFFORT,
+    .jam_predict_time = TRIGGER_JAM_PREDICT_TIME,
+    .jam_confirm_time = TRIGGER_JAM_CONFIRM_TIME,
+    .stall_vel = BLOCK_TRIGGER_SPEED,
+    .stall_time = BLOCK_TIME,
+    .back_time = REVERSE_TIME,
+  };
  if (TRIGGER_MOTOR_TYPE == DJI_M2006)
  {
-  const fp32 pid_angel_trigger[3] = {TRIGGER_ANGEL_PID_KP, TRIGGER_ANGEL_PID_KI, TRIGGER_ANGEL_PID_KD};//拨弹盘角度环
   const fp32 pid_speed_trigger[3] = {TRIGGER_SPEED_PID_KP, TRIGGER_SPEED_PID_KI, TRIGGER_SPEED_PID_KD};//拨弹盘速度环
 
-  PID_init(&SHOOT.trigger_angel_pid, PID_POSITION, pid_angel_trigger, TRIGGER_ANGEL_PID_MAX_OUT, TRIGGER_ANGEL_PID_MAX_IOUT);
   PID_init(&SHOOT.trigger_speed_pid, PID_POSITION, pid_speed_trigger, TRIGGER_SPEED_PID_MAX_OUT, TRIGGER_SPEED_PID_MAX_IOUT);  //拨弹盘初始化pid
+
+  //位置、转速为转子侧(减速比36)，转子位置反馈范围[-PI, PI)
+  feeder_param.slot_angle = 2*PI/BULLET_NUM/TRIGGER_REDUCTION_RATIO*36;
+  feeder_param.pos_range = 2*PI;
  }
  else if (TRIGGER_MOTOR_TYPE == DM_4310)
  {
-  const fp32 pid_angel_trigger[3] = {TRIGGER_ANGEL_PID_KP, TRIGGER_ANGEL_PID_KI, TRIGGER_ANGEL_PID_KD};//拨弹盘角度环
-
-  PID_init(&SHOOT.trigger_angel_pid, PID_POSITION, pid_angel_trigger, TRIGGER_ANGEL_PID_MAX_OUT, TRIGGER_ANGEL_PID_MAX_IOUT); //拨弹盘初始化pid
+  //位置、转速为输出轴侧，位置反馈范围[-12.5, 12.5)，拨盘反向转动
+  feeder_param.slot_angle = -2*PI/BULLET_NUM/TRIGGER_REDUCTION_RATIO;
+  feeder_param.pos_range = 25.0f;
  }
- 
+  feeder_param.back_angle = REVERSE_SLOT*fabsf(feeder_param.slot_angle);
+
+  ShootFeederInit(&SHOOT.feeder, &feeder_param);
+  ShootHeatInit(&SHOOT.heat_bucket, SHOOT_HEAT_PER_SHOT, SHOOT_HEAT_REMAIN_VALUE);
 }
 
 /*-------------------- Set mode --------------------*/
@@ -147,6 +196,7 @@ void ShootSetMode(void)
         if (SHOOT.rc->mouse.press_l && !SHOOT.shoot_flag)
         {
           SHOOT.mode = LAOD_BULLET;
+          SHOOT.fire_flag = 1;
         }
         else if (SHOOT.rc->mouse.press_r)
         {
@@ -166,26 +216,26 @@ void ShootSetMode(void)
         
         SHOOT.shoot_flag = SHOOT.rc->mouse.press_l;
 
-        if (SHOOT.move_flag)
+        //单发未完成
+        if (SHOOT.mode == LOAD_STOP && ShootFeederIsBusy(&SHOOT.feeder))
         {
           SHOOT.mode = LAOD_BULLET;
         }
         
         if (SHOOT.rc->mouse.press_l)
         {
-          if (SHOOT.mr_time < 180)
+          if (SHOOT.press_time < SHOOT_BURST_HOLD_TIME)
           {
-            SHOOT.mr_time++;
+            SHOOT.press_time += SHOOT.dt;
           }
           else
           {
             SHOOT.mode = LOAD_BURSTFIRE;
-            SHOOT.move_flag = 0;
           }
         }
         else
         {
-          SHOOT.mr_time = 0;
+          SHOOT.press_time = 0.0f;
         }
     } 
     else if (switch_is_down(SHOOT.rc->rc.s[SHOOT_MODE_CHANNEL]))
@@ -207,28 +257,10 @@ void ShootSetMode(void)
         // }
     }
 
-    //防堵转
-    if (SHOOT.mode == LOAD_BURSTFIRE||SHOOT.mode == LAOD_BULLET)
+    //卡弹回退
+    if (SHOOT.feeder.state == FEEDER_JAM_BACK)
     {
-      if(SHOOT.block_time >= BLOCK_TIME)
-      {
-        SHOOT.mode = LOAD_BLOCK;                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                           
-      }
-  
-      if(fabs(SHOOT.last_trigger_vel)<BLOCK_TRIGGER_SPEED&&SHOOT.block_time<BLOCK_TIME)
-      {
-        SHOOT.block_time++;
-        SHOOT.reverse_time = 0;
-      }
-      else if(SHOOT.block_time== BLOCK_TIME&& SHOOT.reverse_time< REVERSE_TIME)
-      {
-        SHOOT.reverse_time++;  
-      }
-      else
-      {
-        SHOOT.block_time = 0;
-      }
-      
+      SHOOT.mode = LOAD_BLOCK;
     }
 
     //过热保护
@@ -242,21 +274,6 @@ void ShootSetMode(void)
       fric_ui = 1;
     }
     
-    //热量限制
-    if (TRIGGER_MOTOR_TYPE == DJI_M2006)
-    {
-      get_shoot_heat0_limit_and_heat0(&SHOOT.heat_limit, &SHOOT.heat);
-    }
-    else if (TRIGGER_MOTOR_TYPE == DM_4310)
-    {
-      get_shoot_heat42_limit_and_heat42(&SHOOT.heat_limit, &SHOOT.heat);
-    }
-
-    if ((SHOOT.heat + SHOOT_HEAT_REMAIN_VALUE) > SHOOT.heat_limit)
-    {
-      SHOOT.mode = LOAD_STOP;
-    }
-
     //安全档
     if ((switch_is_down(SHOOT.rc->rc.s[0])))
     {
@@ -290,85 +307,38 @@ void ShootObserver(void)
 
   SHOOT.FDB.trigger_speed_fdb = SHOOT.trigger_motor.fdb.vel;
 
+  SHOOT.dt = GetControlDt(CONTROL_TIMER_SHOOT);
+
+  FricWheelObserve(&SHOOT.fric[0], SHOOT.fric_motor[0].fdb.vel, SHOOT.fric_motor[0].fdb.temp, SHOOT.dt);
+  FricWheelObserve(&SHOOT.fric[1], SHOOT.fric_motor[1].fdb.vel, SHOOT.fric_motor[1].fdb.temp, SHOOT.dt);
+
+  //射速闭环，裁判系统每发上报一次
+  fp32 muzzle_speed;
+  uint32_t muzzle_count;
+  get_shoot_speed_and_count(&muzzle_speed, &muzzle_count);
+  FricMuzzleUpdate(&SHOOT.muzzle, muzzle_speed, muzzle_count);
+
+  //拨弹盘多圈位置与负载残差，每个周期都有新的CAN反馈
   if (TRIGGER_MOTOR_TYPE == DJI_M2006)
   {
-    if (SHOOT.trigger_motor.fdb.ecd - SHOOT.last_ecd > HALF_ECD_RANGE)
-    {
-        SHOOT.ecd_count--;
-    }
-    else if (SHOOT.trigger_motor.fdb.ecd - SHOOT.last_ecd < -HALF_ECD_RANGE)
-    {
-        
-        SHOOT.ecd_count++;
-    }
-
-    if (SHOOT.ecd_count == FULL_COUNT)
-    {
-        SHOOT.ecd_count = -(FULL_COUNT - 1);
-    }
-    else if (SHOOT.ecd_count == -FULL_COUNT)
-    {
-        SHOOT.ecd_count = FULL_COUNT-1;
-    }
-    //计算输出轴角度
-    SHOOT.FDB.trigger_angel_fdb = (SHOOT.ecd_count * ECD_RANGE + SHOOT.trigger_motor.fdb.ecd )* MOTOR_ECD_TO_ANGLE;
-
-    //记录上一个ecd值
-   SHOOT.last_ecd = SHOOT.trigger_motor.fdb.ecd;
-
-  //电机圈数重置， 因为输出轴旋转一圈， 电机轴旋转 36圈，将电机轴数据处理成输出轴数据，用于控制输出轴角度
-  //if(FULL_COUNT%2 == 0)
-  //{
-    // if (SHOOT.trigger_motor.fdb.ecd - SHOOT.last_ecd > HALF_ECD_RANGE)
-    // {
-    //     SHOOT.ecd_count--;
-    // }
-    // else if (SHOOT.trigger_motor.fdb.ecd - SHOOT.last_ecd < -HALF_ECD_RANGE)
-    // {
-        
-    //     SHOOT.ecd_count++;
-    // }
-
-    // if (SHOOT.ecd_count == FULL_COUNT)
-    // {
-    //     SHOOT.ecd_count = -(FULL_COUNT - 1);
-    // }
-    // else if (SHOOT.ecd_count == -FULL_COUNT)
-    // {
-    //     SHOOT.ecd_count = FULL_COUNT-1;
-    // }
-  //}
-  // //电机圈数重置， 因为输出轴旋转一圈， 电机轴旋转 51圈，将电机轴数据处理成输出轴数据，用于控制输出轴角度
-  // else
-  // {
-  //   if (SHOOT.trigger_motor.fdb.ecd - SHOOT.last_ecd > HALF_ECD_RANGE)
-  //   {
-  //       SHOOT.ecd_count--;
-  //   }
-  //   else if (SHOOT.trigger_motor.fdb.ecd - SHOOT.last_ecd < -HALF_ECD_RANGE)
-  //   {
-        
-  //       SHOOT.ecd_count++;
-  //   }
-
-  //   if (SHOOT.ecd_count == FULL_COUNT)
-  //   {
-  //       SHOOT.ecd_count = -FULL_COUNT;
-  //   }
-  //   else if (SHOOT.ecd_count == -FULL_COUNT)
-  //   {
-  //       SHOOT.ecd_count = FULL_COUNT;
-  //   }
-  //}
+    ShootFeederObserve(&SHOOT.feeder, SHOOT.trigger_motor.fdb.pos, SHOOT.trigger_motor.fdb.vel, SHOOT.trigger_motor.fdb.curr, SHOOT.dt);
+  }
+  else if (TRIGGER_MOTOR_TYPE == DM_4310)
+  {
+    ShootFeederObserve(&SHOOT.feeder, SHOOT.trigger_motor.fdb.pos, SHOOT.trigger_motor.fdb.vel, SHOOT.trigger_motor.fdb.tor, SHOOT.dt);
+  }
+  SHOOT.FDB.trigger_angel_fdb = SHOOT.feeder.pos;
 
+  //热量
+  if (TRIGGER_MOTOR_TYPE == DJI_M2006)
+  {
+    get_shoot_heat0_limit_and_heat0(&SHOOT.heat_limit, &SHOOT.heat);
   }
   else if (TRIGGER_MOTOR_TYPE == DM_4310)
   {
-    SHOOT.FDB.trigger_angel_fdb = theta_format(SHOOT.trigger_motor.fdb.pos);
+    get_shoot_heat42_limit_and_heat42(&SHOOT.heat_limit, &SHOOT.heat);
   }
-  
-    //记录上一个拨弹盘vel,用于堵转模式判断
-  SHOOT.last_trigger_vel = SHOOT.trigger_motor.fdb.vel;
+  ShootHeatUpdate(&SHOOT.heat_bucket, SHOOT.heat_limit, get_shoot_cooling_value(), SHOOT.heat, SHOOT.dt);
 
     //记录上一个摩擦轮vel,用于过热保护
   SHOOT.last_fric_vel = SHOOT.fric_motor[0].fdb.vel;
@@ -391,8 +361,8 @@ void ShootReference(void)
   break;
 
   case FRIC_READY:
-  SHOOT.REF.fric_speed_ref_R=FRIC_R_SPEED;
-  SHOOT.REF.fric_speed_ref_L=FRIC_L_SPEED;
+  SHOOT.REF.fric_speed_ref_R=FRIC_R_SPEED*SHOOT.muzzle.ratio;
+  SHOOT.REF.fric_speed_ref_L=FRIC_L_SPEED*SHOOT.muzzle.ratio;
   break;
   
   default:
@@ -402,58 +372,40 @@ void ShootReference(void)
   switch (SHOOT.mode)
   {
   case LOAD_STOP:
-  SHOOT.REF.trigger_speed_ref=0.0f;
+  if (SHOOT.state == FRIC_NOT_READY || !fric_ui)
+  {
+    //摩擦轮未转动时放弃正在供的弹
+    ShootFeederReset(&SHOOT.feeder);
+  }
+  else
+  {
+    ShootFeederStop(&SHOOT.feeder);
+  }
   break;
   
   case LAOD_BULLET:
-  if (TRIGGER_MOTOR_TYPE == DJI_M2006)
+  ShootFeederSetBurst(&SHOOT.feeder, 0);
+  if (SHOOT.fire_flag)
   {
-    if (SHOOT.move_flag == 0)
-    {
-      SHOOT.REF.trigger_angel_ref = theta_format(SHOOT.FDB.trigger_angel_fdb + 2*PI/BULLET_NUM/TRIGGER_REDUCTION_RATIO);
-    }
-
-    if (theta_format(SHOOT.REF.trigger_angel_ref - SHOOT.FDB.trigger_angel_fdb) > 0.01f)
-    {
-      SHOOT.move_flag = 1;
-    }
-    else
-    {
-      SHOOT.move_flag = 0;
-    }
-  }
-  else if (TRIGGER_MOTOR_TYPE == DM_4310)
-  {
-    if (SHOOT.move_flag == 0)
-    {
-      SHOOT.REF.trigger_angel_ref = theta_format(SHOOT.FDB.trigger_angel_fdb - 2*PI/BULLET_NUM/TRIGGER_REDUCTION_RATIO);
-    }
-
-    if (theta_format(SHOOT.FDB.trigger_angel_fdb - SHOOT.REF.trigger_angel_ref) > 0.01f)
-    {
-      SHOOT.move_flag = 1;
-    }
-    else
-    {
-      SHOOT.move_flag = 0;
-    }
+    ShootFeederFire(&SHOOT.feeder, 1);
   }
   break;
 
   case LOAD_BURSTFIRE:
-  SHOOT.REF.trigger_speed_ref = TRIGGER_SPEED;
+  ShootFeederSetBurst(&SHOOT.feeder, 1);
   break;
 
   case LOAD_BLOCK:
-  SHOOT.REF.trigger_speed_ref = REVERSE_SPEED;
   break;
 
   default:
     break;
   }
-  
+  SHOOT.fire_flag = 0;
 
-  
+  //放行受热量限制，卡弹时自动回退
+  SHOOT.REF.trigger_speed_ref = ShootFeederControl(&SHOOT.feeder, &SHOOT.heat_bucket, SHOOT.dt);
+  SHOOT.REF.trigger_angel_ref = SHOOT.feeder.pos_ref;
 }
 
 /*-------------------- Console --------------------*/
@@ -465,52 +417,45 @@ void ShootReference(void)
  */
 void ShootConsole(void) 
 {
-  SHOOT.fric_motor[0].set.curr= PID_calc(&SHOOT.fric_pid[0], SHOOT.FDB.fric_speed_fdb_R,SHOOT.REF.fric_speed_ref_R);
-  SHOOT.fric_motor[1].set.curr= PID_calc(&SHOOT.fric_pid[1], SHOOT.FDB.fric_speed_fdb_L,SHOOT.REF.fric_speed_ref_L);
+  SHOOT.fric_motor[0].set.curr= FricWheelControl(&SHOOT.fric[0], SHOOT.REF.fric_speed_ref_R, SHOOT.dt);
+  SHOOT.fric_motor[1].set.curr= FricWheelControl(&SHOOT.fric[1], SHOOT.REF.fric_speed_ref_L, SHOOT.dt);
+  ShootUpdateFricStats();
 
   if (TRIGGER_MOTOR_TYPE == DJI_M2006)
   {
-    if (SHOOT.mode == LOAD_STOP)
-    {
-        SHOOT.trigger_motor.set.curr = PID_calc(&SHOOT.trigger_speed_pid, SHOOT.FDB.trigger_speed_fdb, SHOOT.REF.trigger_speed_ref);
-    }
-    else if (SHOOT.mode == LOAD_BURSTFIRE)
-    {
-        SHOOT.trigger_motor.set.curr = PID_calc(&SHOOT.trigger_speed_pid, SHOOT.FDB.trigger_speed_fdb, SHOOT.REF.trigger_speed_ref);
-    }
-    else if (SHOOT.mode == LAOD_BULLET)
-    {
-        delta = theta_format(SHOOT.REF.trigger_angel_ref - SHOOT.FDB.trigger_angel_fdb);
-
-        SHOOT.REF.trigger_speed_ref = PID_calc(&SHOOT.trigger_angel_pid,0,delta);
-        SHOOT.trigger_motor.set.curr = PID_calc(&SHOOT.trigger_speed_pid,SHOOT.FDB.trigger_speed_fdb, SHOOT.REF.trigger_speed_ref);
-    }
-    else if (SHOOT.mode == LOAD_BLOCK) 
-    {
-        SHOOT.trigger_motor.set.curr = PID_calc(&SHOOT.trigger_speed_pid, SHOOT.FDB.trigger_speed_fdb, SHOOT.REF.trigger_speed_ref);
-    }
+    SHOOT.trigger_motor.set.curr = PID_calc(&SHOOT.trigger_speed_pid, SHOOT.FDB.trigger_speed_fdb, SHOOT.REF.trigger_speed_ref);
   }
   else if (TRIGGER_MOTOR_TYPE == DM_4310)
   {
-    if (SHOOT.mode == LOAD_STOP)
-    {
-        SHOOT.trigger_motor.set.vel = SHOOT.REF.trigger_speed_ref;
-    }
-    else if (SHOOT.mode == LOAD_BURSTFIRE)
-    {
-        SHOOT.trigger_motor.set.vel = SHOOT.REF.trigger_speed_ref;
-    }
-    else if (SHOOT.mode == LAOD_BULLET)
-    {
-        delta = theta_format(SHOOT.REF.trigger_angel_ref - SHOOT.FDB.trigger_angel_fdb);
-        SHOOT.trigger_motor.set.vel = PID_calc(&SHOOT.trigger_angel_pid,0,delta);
-    }
-    else if (SHOOT.mode == LOAD_BLOCK) 
-    {
-        SHOOT.trigger_motor.set.vel = SHOOT.REF.trigger_speed_ref;
-    }
+    SHOOT.trigger_motor.set.vel = SHOOT.REF.trigger_speed_ref;
   }
-  
+}
+
+/**
+ * @brief          更新摩擦轮单发统计，供USB发送
+ * @param[in]      none
+ * @retval         none
+ */
+static void ShootUpdateFricStats(void)
+{
+  ShootFricStats_t * stats = &SHOOT.fric_stats;
+
+  stats->shot_count = SHOOT.fric[0].shot_count;
+  stats->wheel_ref = SHOOT.REF.fric_speed_ref_R;
+  stats->speed_ratio = SHOOT.muzzle.ratio;
+  for (uint8_t i = 0; i < 2; i++)
+  {
+    stats->drop[i] = SHOOT.fric[i].drop;
+    stats->recover_time[i] = SHOOT.fric[i].recover_time;
+    stats->drop_mean[i] = SHOOT.fric[i].drop_mean;
+    stats->drop_std[i] = sqrtf(SHOOT.fric[i].drop_var);
+    stats->dob[i] = SHOOT.fric[i].dob;
+    stats->temp[i] = SHOOT.fric[i].temp;
+  }
+  stats->muzzle_count = SHOOT.muzzle.count;
+  stats->muzzle_speed = SHOOT.muzzle.speed;
+  stats->muzzle_mean = SHOOT.muzzle.mean;
+  stats->muzzle_std = sqrtf(SHOOT.muzzle.var);
 }
 
 /*-------------------- Cmd --------------------*/
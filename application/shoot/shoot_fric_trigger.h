@@ -11,6 +11,11 @@
   *  V2.0.0     2025-3-3        CJH             1. 兼容了达妙4310拨弹盘和大疆2006拨弹盘
   *                                             2. 完善了单发功能，上位机火控功能
   *                                             3. 增加了热量限制
+  *  V2.1.0     Oct-19-2026     Penguin         1. 拨弹盘改为按格位置闭环供弹(shoot_feeder)
+  *                                             2. 卡弹预测替代看门狗防堵转
+  *                                             3. 热量限制改为本地热量估计的令牌桶
+  *  V2.2.0     Oct-19-2026     Penguin         1. 摩擦轮增加前馈、扰动观测与射速闭环(fric_wheel)
+  *                                             2. 单发掉速与射速统计通过USB发送
   @verbatim
   ==============================================================================
 
@@ -35,6 +40,9 @@
 #include "arm_math.h"
 #include "referee.h"
 #include "detect_task.h"
+#include "shoot_feeder.h"
+#include "fric_wheel.h"
+#include "custom_typedef.h"
 
 
 typedef enum 
@@ -77,14 +85,17 @@ typedef struct
   Motor_s trigger_motor;  // 拨弹盘电机
 
     //pid
-  pid_type_def trigger_angel_pid;
   pid_type_def trigger_speed_pid;
-  pid_type_def fric_pid[2];
 
-    //block_reverse
-  uint16_t reverse_time;
-  uint16_t block_time;
-  fp32 last_trigger_vel;
+    //fric
+  FricWheel_s fric[2];
+  FricMuzzle_s muzzle;
+  ShootFricStats_t fric_stats;
+
+    //feeder
+  ShootFeeder_s feeder;
+  ShootHeat_s heat_bucket;  // 本地热量估计
+  fp32 dt;
   fp32 last_fric_vel;
     
     //feedback
@@ -95,17 +106,13 @@ typedef struct
 
     //flag
   uint16_t fric_flag; //    摩擦轮状态
-  uint16_t move_flag; //    拨弹盘角度状态，用于判断单发射击执行情况
+  uint16_t fire_flag; //    单发请求
   uint16_t shoot_flag;//    鼠标左键状态，用于判断弹发射击启动
-
-   //ecd
-  int16_t last_ecd; //     上一个ecd
-  int16_t ecd_count;//     ecd计数
+  fp32 press_time;    //    (s)鼠标左键按下时间，用于判断连发
 
   // heat
   uint16_t heat_limit;
   uint16_t heat;
-  uint16_t mr_time;
 } Shoot_s;
 
 
@@ -20,7 +20,10 @@
 
 #include "attribute_typedef.h"
 #include "cmsis_os.h"
+#include "control_timer.h"
+#include "mem_pool.h"
 #include "shoot_fric_trigger.h"
+#include "task_monitor.h"
 
 #ifndef SHOOT_TASK_INIT_TIME
 #define SHOOT_TASK_INIT_TIME 201
@@ -30,6 +33,10 @@
 #define SHOOT_CONTROL_TIME 1
 #endif  // SHOOT_CONTROL_TIME
 
+#ifndef SHOOT_CONTROL_PHASE
+#define SHOOT_CONTROL_PHASE 0  // (ms)控制周期内的释放相位偏移
+#endif  // SHOOT_CONTROL_PHASE
+
 #if INCLUDE_uxTaskGetStackHighWaterMark
 uint32_t shoot_high_water;
 #endif
@@ -55,8 +62,12 @@ void shoot_task(void const * pvParameters)
     vTaskDelay(SHOOT_TASK_INIT_TIME);
     // 射击初始化
     ShootInit();
+    mem_pool_init_release();
+    TaskMonitorRegister(SHOOT_CONTROL_TIME);
+    ControlTimerInit(CONTROL_TIMER_SHOOT, SHOOT_CONTROL_TIME, SHOOT_CONTROL_PHASE);
 
     while (1) {
+        TaskMonitorLoop();
         // 更新状态量
         ShootObserver();
         // 处理异常
@@ -71,7 +82,7 @@ void shoot_task(void const * pvParameters)
         ShootSendCmd();
 
         // 系统延时
-        vTaskDelay(SHOOT_CONTROL_TIME);
+        ControlTimerWait(CONTROL_TIMER_SHOOT);
 
 #if INCLUDE_uxTaskGetStackHighWaterMark
         shoot_high_water = uxTaskGetStackHighWaterMark(NULL);
@@ -0,0 +1,312 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       feeder_sim.c
+  * @brief      在PC上运行的拨弹盘供弹仿真，验证卡弹预测和热量令牌桶
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+    编译运行：
+      cc -Istub -I.. -I../../typedef -I../../../components/controller -o feeder_sim \
+        feeder_sim.c ../shoot_feeder.c ../../../components/controller/pid.c -lm
+      ./feeder_sim
+    仿真对象：
+      M2006：转子侧刚体 + 粘滞/库伦摩擦，电流控制，速度环使用 PID_calc，
+             反馈和控制周期1ms，电机真实惯量比控制器中的模型大15%。
+      DM4310：输出轴刚体，MIT速度模式(电机内部速度环，力矩限幅)。
+      每格推弹时有一段负载；卡弹时在格内某处出现一面柔性墙，负载随位置上升直至堵转，
+      回退越过墙 0.25*back_angle 后弹丸复位，墙消失。
+      裁判系统每100ms冷却一次并上报热量，上报有50ms延迟；弹丸转过一格后20ms计入热量。
+    检查项(任一不满足返回非0)：
+      1. 连发时热量不超过上限，不误报卡弹，发射数接近 (上限-预留)/每发热量 + 冷却量/每发热量
+      2. 同样的预留热量下只看裁判系统热量的旧方法会超热量(说明延迟的影响)
+      3. 单发5次，正好发射5发，停止后位置误差小于0.05格
+      4. 卡弹在拨盘转速降到堵转阈值之前被检测到，回退后继续发射
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include <math.h>
+#include <stdio.h>
+
+#include "pid.h"
+#include "shoot_feeder.h"
+
+#define SIM_DT 0.0001f       // (s)仿真步长
+#define CONTROL_DIV 10       // 控制周期 = CONTROL_DIV * SIM_DT
+#define REFEREE_PERIOD 0.1f  // (s)
+#define REFEREE_DELAY 0.05f  // (s)
+#define MUZZLE_DELAY 0.02f   // (s)
+
+#define HEAT_LIMIT 200
+#define HEAT_COOLING 40
+#define HEAT_PER_SHOT 10.0f
+#define HEAT_MARGIN 10.0f
+
+#define PI_F 3.14159265f
+
+typedef enum { PLANT_M2006, PLANT_DM4310 } PlantType_e;
+
+typedef struct
+{
+    PlantType_e type;
+    fp32 inertia;     // (kg*m^2)
+    fp32 viscous;     // (N*m/(rad/s))
+    fp32 coulomb;     // (N*m)
+    fp32 torque_max;  // (N*m)
+    fp32 effort_to_torque;
+    fp32 push_torque;  // (N*m)推弹负载
+    fp32 wall_k;       // (N*m/rad)卡弹时墙的刚度
+    fp32 dm_kd;        // (N*m/(rad/s))DM内部速度环增益
+    ShootFeederParam_s feeder;
+} Plant_s;
+
+// clang-format off
+static const Plant_s M2006 = {
+    .type = PLANT_M2006,
+    .inertia = 1.2e-6f * 1.15f, .viscous = 2e-6f, .coulomb = 5e-4f, .torque_max = 0.05f,
+    .effort_to_torque = 5e-6f,  // 转子侧转矩常数0.005N*m/A，控制量1对应1mA
+    .push_torque = 0.004f, .wall_k = 0.007f,
+    .feeder = {
+        .slot_angle = 2 * PI_F / 8 * 36, .pos_range = 2 * PI_F, .max_vel = 350.0f, .pos_kp = 40.0f,
+        .fire_lead = 0.3f,
+        .k_acc = 0.24f, .k_vel = 0.4f, .k_static = 100.0f,
+        .jam_effort = 3000.0f, .jam_predict_time = 0.01f, .jam_confirm_time = 0.004f,
+        .stall_vel = 5.0f, .stall_time = 0.3f, .back_angle = 0.3f * 2 * PI_F / 8 * 36, .back_time = 0.1f,
+    },
+};
+
+static const Plant_s DM4310 = {
+    .type = PLANT_DM4310,
+    .inertia = 2e-3f * 1.15f, .viscous = 0.01f, .coulomb = 0.1f, .torque_max = 7.0f,
+    .effort_to_torque = 1.0f,
+    .push_torque = 0.5f, .wall_k = 25.0f, .dm_kd = 2.0f,
+    .feeder = {
+        .slot_angle = -2 * PI_F / 6, .pos_range = 25.0f, .max_vel = 15.0f, .pos_kp = 30.0f,
+        .fire_lead = 0.3f,
+        .k_acc = 2e-3f, .k_vel = 0.01f, .k_static = 0.1f,
+        .jam_effort = 2.0f, .jam_predict_time = 0.01f, .jam_confirm_time = 0.004f,
+        .stall_vel = 0.2f, .stall_time = 0.3f, .back_angle = 0.3f * 2 * PI_F / 6, .back_time = 0.1f,
+    },
+};
+// clang-format on
+
+typedef struct
+{
+    uint32_t shots;        // 弹丸离开拨盘的数量
+    uint32_t jams;         // 控制器判断的卡弹次数
+    fp32 max_heat;         // 裁判系统热量最大值
+    fp32 detect_vel;       // 检测到卡弹时的转速
+    fp32 detect_delay;     // (s)卡弹开始到检测的时间
+    fp32 stall_delay;      // (s)卡弹开始到转速低于堵转阈值的时间，未发生为-1
+    fp32 final_error;      // 停止后剩余位置误差(格)
+} SimResult_t;
+
+typedef enum { CMD_BURST, CMD_SINGLE } Command_e;
+
+/**
+ * @param legacy 为1时不使用本地热量估计，只按上报的裁判系统热量判断
+ * @param jam_time (s)卡弹发生时刻，小于0表示不卡弹
+ */
+static SimResult_t Simulate(
+    const Plant_s * plant, Command_e cmd, fp32 sim_time, bool_t legacy, fp32 jam_time)
+{
+    SimResult_t r = {0, 0, 0.0f, 0.0f, -1.0f, -1.0f, 0.0f};
+    ShootFeeder_s feeder;
+    ShootHeat_s heat;
+    pid_type_def speed_pid;
+    const fp32 speed_pid_param[3] = {100.0f, 0.5f, 0.1f};
+    const fp32 slot = plant->feeder.slot_angle;
+    const fp32 dir = slot > 0 ? 1.0f : -1.0f;
+
+    ShootFeederInit(&feeder, &plant->feeder);
+    ShootHeatInit(&heat, HEAT_PER_SHOT, HEAT_MARGIN);
+    PID_init(&speed_pid, PID_POSITION, speed_pid_param, 10000.0f, 1000.0f);
+
+    fp32 pos = 0.3f, vel = 0.0f, effort_cmd = 0.0f, effort_fdb = 0.0f;
+    fp32 start = pos;
+    fp32 referee_heat = 0.0f, reported_heat = 0.0f;
+    fp32 report_queue_time = -1.0f, report_queue_value = 0.0f;
+    fp32 muzzle[64];
+    int muzzle_num = 0;
+    uint32_t passed = 0;  // 拨盘转过的格数
+    bool_t jam_active = 0, jam_armed = jam_time >= 0.0f;
+    fp32 wall = 0.0f, jam_start = 0.0f;
+
+    int steps = (int)(sim_time / SIM_DT);
+    for (int n = 0; n < steps; n++) {
+        fp32 t = n * SIM_DT;
+
+        /*---------- 控制器 ----------*/
+        if (n % CONTROL_DIV == 0) {
+            fp32 dt = SIM_DT * CONTROL_DIV;
+            fp32 raw = fmodf(pos, plant->feeder.pos_range);
+            if (raw < 0) raw += plant->feeder.pos_range;
+            ShootFeederObserve(&feeder, raw, vel, effort_fdb, dt);
+
+            if (cmd == CMD_BURST) {
+                ShootFeederSetBurst(&feeder, t < sim_time - 1.0f);
+            } else if (n % (int)(0.3f / SIM_DT) == 0 && t < 1.5f) {
+                ShootFeederFire(&feeder, 1);
+            }
+
+            ShootHeatUpdate(&heat, HEAT_LIMIT, HEAT_COOLING, (uint16_t)reported_heat, dt);
+            if (legacy) {
+                // 旧方法：只看上报的热量
+                heat.heat = reported_heat;
+            }
+            fp32 vel_ref = ShootFeederControl(&feeder, &heat, dt);
+
+            if (feeder.jam_count > r.jams) {
+                r.jams = feeder.jam_count;
+                if (jam_active && r.detect_delay < 0.0f) {
+                    r.detect_delay = t - jam_start;
+                    r.detect_vel = fabsf(vel);
+                }
+            }
+
+            if (plant->type == PLANT_M2006) {
+                effort_cmd = PID_calc(&speed_pid, vel, vel_ref);
+                effort_fdb = effort_cmd;  // 下一次反馈中的电流为本周期执行的控制量
+            } else {
+                effort_cmd = vel_ref;
+            }
+        }
+
+        /*---------- 电机与拨盘 ----------*/
+        fp32 torque;
+        if (plant->type == PLANT_M2006) {
+            torque = effort_cmd * plant->effort_to_torque;
+        } else {
+            torque = plant->dm_kd * (effort_cmd - vel);
+        }
+        if (torque > plant->torque_max) torque = plant->torque_max;
+        if (torque < -plant->torque_max) torque = -plant->torque_max;
+        if (plant->type == PLANT_DM4310 && n % CONTROL_DIV == CONTROL_DIV - 1) {
+            effort_fdb = torque;  // DM反馈实际输出力矩
+        }
+
+        fp32 progress = (pos - start) * dir / fabsf(slot);
+        fp32 in_slot = progress - floorf(progress);
+        fp32 load = 0.0f;
+        if (in_slot > 0.3f && in_slot < 0.7f) load += plant->push_torque;
+
+        if (jam_armed && t >= jam_time && in_slot > 0.1f && in_slot < 0.3f) {
+            jam_armed = 0;
+            jam_active = 1;
+            jam_start = t;
+            wall = pos;
+        }
+        if (jam_active) {
+            fp32 depth = (pos - wall) * dir;
+            if (depth > 0.0f) load += plant->wall_k * depth;
+            if (r.stall_delay < 0.0f && fabsf(vel) < plant->feeder.stall_vel && t - jam_start > 0.002f) {
+                r.stall_delay = t - jam_start;
+            }
+            if ((pos - wall) * dir < -0.25f * plant->feeder.back_angle) jam_active = 0;  // 回退越过墙后弹丸复位
+        }
+
+        fp32 friction = plant->viscous * vel;
+        if (fabsf(vel) > 1e-3f) {
+            friction += plant->coulomb * (vel > 0 ? 1.0f : -1.0f);
+        } else if (fabsf(torque - load * dir) < plant->coulomb) {
+            friction = torque - load * dir;
+        }
+        vel += (torque - load * dir - friction) / plant->inertia * SIM_DT;
+        pos += vel * SIM_DT;
+
+        /*---------- 发射与裁判系统 ----------*/
+        fp32 progress_now = (pos - start) * dir / fabsf(slot);
+        while (progress_now >= passed + 0.95f) {
+            passed++;
+            if (muzzle_num < 64) muzzle[muzzle_num++] = t + MUZZLE_DELAY;
+        }
+        for (int i = 0; i < muzzle_num; i++) {
+            if (t >= muzzle[i]) {
+                referee_heat += HEAT_PER_SHOT;
+                r.shots++;
+                muzzle[i--] = muzzle[--muzzle_num];
+            }
+        }
+        if (referee_heat > r.max_heat) r.max_heat = referee_heat;
+
+        int period = (int)(REFEREE_PERIOD / SIM_DT);
+        if (n % period == 0) {
+            referee_heat -= HEAT_COOLING * REFEREE_PERIOD;
+            if (referee_heat < 0.0f) referee_heat = 0.0f;
+            report_queue_time = t + REFEREE_DELAY;
+            report_queue_value = referee_heat;
+        }
+        if (report_queue_time >= 0.0f && t >= report_queue_time) {
+            reported_heat = report_queue_value;
+            report_queue_time = -1.0f;
+        }
+    }
+
+    fp32 remaining = (feeder.target - feeder.pos) * dir / fabsf(slot);
+    r.final_error = fabsf(remaining);
+    return r;
+}
+
+static void PrintResult(const char * name, SimResult_t r)
+{
+    printf(
+        "%-22s shots=%3u jams=%u max_heat=%5.1f detect=%6.1fms@%6.1frad/s stall=%6.1fms "
+        "final_error=%.3f\n",
+        name, (unsigned)r.shots, (unsigned)r.jams, r.max_heat, r.detect_delay * 1000.0f,
+        r.detect_vel, r.stall_delay * 1000.0f, r.final_error);
+}
+
+static int CheckPlant(const char * name, const Plant_s * plant)
+{
+    int fail = 0;
+    char label[32];
+    const fp32 burst_time = 11.0f;  // 最后1s停止连发
+
+    SimResult_t burst = Simulate(plant, CMD_BURST, burst_time, 0, -1.0f);
+    SimResult_t legacy = Simulate(plant, CMD_BURST, burst_time, 1, -1.0f);
+    SimResult_t single = Simulate(plant, CMD_SINGLE, 3.0f, 0, -1.0f);
+    SimResult_t jam = Simulate(plant, CMD_BURST, 3.0f, 0, 1.0f);
+
+    snprintf(label, sizeof(label), "%s burst", name);
+    PrintResult(label, burst);
+    snprintf(label, sizeof(label), "%s burst (legacy)", name);
+    PrintResult(label, legacy);
+    snprintf(label, sizeof(label), "%s single x5", name);
+    PrintResult(label, single);
+    snprintf(label, sizeof(label), "%s jam", name);
+    PrintResult(label, jam);
+
+    uint32_t expect = (uint32_t)((HEAT_LIMIT - HEAT_MARGIN) / HEAT_PER_SHOT +
+                                 HEAT_COOLING * (burst_time - 1.0f) / HEAT_PER_SHOT);
+    if (burst.max_heat > HEAT_LIMIT || burst.jams != 0 || burst.shots + 3 < expect) {
+        printf("FAIL: %s burst exceeds heat limit, jams falsely or fires too slowly (expect ~%u)\n", name, (unsigned)expect);
+        fail = 1;
+    }
+    if (legacy.max_heat <= HEAT_LIMIT) {
+        printf("FAIL: %s legacy heat control does not overshoot, test case too mild\n", name);
+        fail = 1;
+    }
+    if (single.shots != 5 || single.jams != 0 || single.final_error > 0.05f) {
+        printf("FAIL: %s single shot\n", name);
+        fail = 1;
+    }
+    if (jam.detect_delay < 0.0f || (jam.stall_delay >= 0.0f && jam.stall_delay < jam.detect_delay) ||
+        jam.jams != 1 || jam.shots < 10) {
+        printf("FAIL: %s jam not predicted before stall or not recovered\n", name);
+        fail = 1;
+    }
+    return fail;
+}
+
+int main(void)
+{
+    int fail = 0;
+    fail |= CheckPlant("M2006", &M2006);
+    fail |= CheckPlant("DM4310", &DM4310);
+    printf(fail ? "FAIL\n" : "PASS\n");
+    return fail;
+}
@@ -0,0 +1,383 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       fric_sim.c
+  * @brief      在PC上运行的摩擦轮仿真，验证前馈、扰动观测和射速闭环的参数
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+    编译运行：
+      cc -Istub -I.. -I../.. -I../../typedef -I../../../components/controller -o fric_sim \
+        fric_sim.c ../fric_wheel.c ../../../components/controller/pid.c -lm
+      ./fric_sim
+    控制参数直接取自 robot_param_balanced_infantry_gimbal.h，修改参数后重新运行即可。
+    仿真对象：
+      M3508(无减速箱)+摩擦轮：刚体 + 粘滞/库伦摩擦，电调电流环为0.5ms一阶惯性，
+      控制量1对应 20A/16384。真实惯量比控制器模型大15%，摩擦大10%，
+      转矩常数随温度下降的系数为 0.0012/℃(控制器中为 FRIC_FF_K_TEMP)。
+      速度反馈有约3rpm的噪声并按 rpm 取整，反馈和控制周期1ms。
+      每发弹丸在3ms内带走约0.6J动能(17mm弹丸27.5m/s，两个摩擦轮平分)，负载大小有±10%随机波动。
+      射速 = 弹丸进入时的轮速 * SHOOT_TARGET_SPEED/FRIC_R_SPEED * (1 + 偏差) + 0.2m/s 噪声，
+      裁判系统在弹丸离开后5ms上报。
+    检查项(任一不满足返回非0)：
+      1. 前馈：启动后200~300ms内的平均误差小于0.5rad/s，60℃时温度修正后仍成立；
+         只用PID时需要等积分项，误差至少大一倍
+      2. 扰动观测：单发恢复时间小于只用PID+前馈时的70%，过冲小于掉速阈值，
+         掉速检测计数与实际发数相同，启动和射速修正引起的转速变化不计为发射
+      3. 射速闭环：+5%偏差在8发内收敛到目标±0.3m/s，-15%偏差时修正比例停在上限，
+         噪声下射速标准差不超过开环时的1.25倍
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include <math.h>
+#include <stdio.h>
+
+#include "fric_wheel.h"
+#include "robot_param_balanced_infantry_gimbal.h"
+
+#define SIM_DT 0.00001f  // (s)仿真步长
+#define CONTROL_DIV 100  // 控制周期 = CONTROL_DIV * SIM_DT
+
+#define UNIT_TO_AMP (20.0f / 16384.0f)
+#define KT 0.0157f              // (N*m/A)M3508转子侧转矩常数
+#define CURRENT_LAG 0.0005f     // (s)电调电流环时间常数
+#define PLANT_K_TEMP 0.0012f    // (1/℃)转矩常数随温度下降的系数
+#define RPM_TO_RAD (2.0f * 3.14159265f / 60.0f)
+#define FDB_NOISE 3.0f          // (rpm)速度反馈噪声
+
+#define SHOT_TIME 1.0f          // (s)第一发的时刻
+#define SETTLE_FROM 0.2f        // (s)统计启动后误差的时间段
+#define SETTLE_TO 0.3f
+#define SHOT_ENERGY 0.6f        // (J)每发从一个摩擦轮带走的动能
+#define SHOT_CONTACT 0.003f     // (s)弹丸与摩擦轮接触时间
+#define REPORT_DELAY 0.005f     // (s)裁判系统射速上报延迟
+#define MUZZLE_NOISE 0.2f       // (m/s)
+#define NOISE_SHOTS 200         // 统计射速噪声的发数
+
+typedef struct
+{
+    bool_t ff;       // 前馈(关闭时只用PID)
+    bool_t dob;      // 扰动观测
+    bool_t muzzle;   // 射速闭环
+    fp32 temp;       // (℃)电机温度
+    fp32 bias;       // 射速相对转速的偏差
+    fp32 noise;      // (m/s)射速噪声
+    fp32 period;     // (s)发射间隔
+    int shots;       // 发数
+    fp32 dob_time;   // (s)不为0时替换 FRIC_DOB_TIME，用于比较
+    fp32 gain;       // 不为0时替换 SHOOT_SPEED_ADJUST_GAIN，用于比较
+} SimCase_t;
+
+typedef struct
+{
+    fp32 ss_error;        // (rad/s)启动后 SETTLE_FROM~SETTLE_TO 的平均误差绝对值
+    fp32 recover_mean;    // (s)平均恢复时间
+    fp32 drop_mean;       // (rad/s)平均最大掉速
+    fp32 overshoot;       // (rad/s)恢复后超过目标的最大值
+    fp32 out_std;         // 开火前稳态时控制量的标准差
+    uint32_t detected;    // 掉速检测计数
+    fp32 speed[NOISE_SHOTS];  // (m/s)每发射速
+    fp32 ratio;           // 最终修正比例
+} SimResult_t;
+
+static uint32_t SEED = 1;
+
+static fp32 RandUniform(void)
+{
+    SEED = SEED * 1664525u + 1013904223u;
+    return (fp32)(SEED >> 8) / 16777216.0f;
+}
+
+static fp32 RandNormal(void)
+{
+    fp32 sum = 0.0f;
+    for (int i = 0; i < 12; i++) sum += RandUniform();
+    return sum - 6.0f;
+}
+
+static SimResult_t Simulate(const SimCase_t * c)
+{
+    SimResult_t r = {0};
+    FricWheel_s wheel;
+    FricMuzzle_s muzzle;
+    const fp32 pid[3] = {FRIC_SPEED_PID_KP, FIRC_SPEED_PID_KI, FRIC_SPEED_PID_KD};
+    FricWheelParam_s param = {
+        .k_acc = FRIC_MODEL_K_ACC,
+        .k_vel = FRIC_FF_K_VEL,
+        .k_static = FRIC_FF_K_STATIC,
+        .k_temp = FRIC_FF_K_TEMP,
+        .temp_ref = FRIC_FF_TEMP_REF,
+        .dob_time = FRIC_DOB_TIME,
+        .dob_max = FRIC_DOB_MAX,
+        .dip_threshold = FRIC_DIP_THRESHOLD,
+    };
+    if (!c->ff) {
+        param.k_acc = param.k_vel = param.k_static = 0.0f;
+    }
+    if (!c->dob) {
+        param.dob_max = 0.0f;
+    }
+    if (c->dob_time > 0.0f) {
+        param.dob_time = c->dob_time;
+    }
+    fp32 gain = c->gain > 0.0f ? c->gain : SHOOT_SPEED_ADJUST_GAIN;
+
+    // 真实对象，控制量单位换算为力矩
+    const fp32 unit = UNIT_TO_AMP * KT;
+    const fp32 inertia = FRIC_MODEL_K_ACC * unit * 1.15f;
+    const fp32 viscous = FRIC_FF_K_VEL * unit * 1.1f;
+    const fp32 coulomb = FRIC_FF_K_STATIC * unit * 1.1f;
+    const fp32 torque_gain = 1.0f / (1.0f + PLANT_K_TEMP * (c->temp - FRIC_FF_TEMP_REF));
+    const fp32 speed_per_rad = SHOOT_TARGET_SPEED / FRIC_R_SPEED;
+
+    FricWheelInit(&wheel, &param, pid, FRIC_PID_MAX_OUT, FRIC_PID_MAX_IOUT);
+    FricMuzzleInit(&muzzle, SHOOT_TARGET_SPEED, gain, SHOOT_SPEED_ADJUST_MAX);
+
+    fp32 vel = 0.0f, current = 0.0f, cmd = 0.0f, ref = 0.0f;
+    fp32 ss_sum = 0.0f, out_sum = 0.0f, out_sq = 0.0f;
+    int ss_num = 0, out_num = 0;
+    int shot = -1;              // 最近一发的序号
+    bool_t contact = 0;         // 弹丸正在挤过摩擦轮
+    fp32 shot_start = 0.0f, shot_load = 0.0f, shot_vel = 0.0f;
+    fp32 recover_sum = 0.0f, drop_sum = 0.0f, drop = 0.0f;
+    int recovered = 0;
+    bool_t recovering = 0;
+    fp32 report_time = -1.0f, report_speed = 0.0f;
+    uint32_t report_count = 0;
+
+    fp32 sim_time = SHOT_TIME + c->shots * c->period + 0.1f;
+    int steps = (int)(sim_time / SIM_DT);
+    for (int n = 0; n < steps; n++) {
+        fp32 t = n * SIM_DT;
+
+        /*---------- 控制器 ----------*/
+        if (n % CONTROL_DIV == 0) {
+            fp32 dt = SIM_DT * CONTROL_DIV;
+            fp32 fdb = roundf(vel / RPM_TO_RAD + FDB_NOISE * RandNormal()) * RPM_TO_RAD;
+            FricWheelObserve(&wheel, fdb, c->temp, dt);
+            if (report_time >= 0.0f && t >= report_time) {
+                report_count++;
+                report_time = -1.0f;
+            }
+            if (c->muzzle) FricMuzzleUpdate(&muzzle, report_speed, report_count);
+            ref = FRIC_R_SPEED * muzzle.ratio;
+            cmd = FricWheelControl(&wheel, ref, dt);
+
+            if (t > SETTLE_FROM && t < SETTLE_TO) {
+                ss_sum += fabsf(ref - vel);
+                ss_num++;
+            }
+            if (t > SHOT_TIME - 0.5f && t < SHOT_TIME) {
+                out_sum += cmd;
+                out_sq += cmd * cmd;
+                out_num++;
+            }
+        }
+
+        /*---------- 弹丸 ----------*/
+        int k = (int)floorf((t - SHOT_TIME) / c->period);
+        if (t >= SHOT_TIME && k < c->shots && k != shot && k >= 0) {
+            shot = k;
+            shot_start = t;
+            shot_vel = vel;
+            // 冲量 = J * dw，dw 由动能变化 E = J*w*dw 得到
+            shot_load = SHOT_ENERGY / vel / SHOT_CONTACT * (1.0f + 0.2f * (RandUniform() - 0.5f));
+            drop = 0.0f;
+            recovering = 1;
+            contact = 1;
+        }
+        fp32 load = 0.0f;
+        if (contact && t - shot_start < SHOT_CONTACT) {
+            load = shot_load;
+        } else if (contact) {
+            // 弹丸离开
+            contact = 0;
+            fp32 speed = shot_vel * speed_per_rad * (1.0f + c->bias) + c->noise * RandNormal();
+            r.speed[shot] = speed;
+            report_speed = speed;
+            report_time = t + REPORT_DELAY;
+        }
+        if (recovering) {
+            if (ref - vel > drop) drop = ref - vel;
+            if (t - shot_start > SHOT_CONTACT && fabsf(ref - vel) < 0.5f * FRIC_DIP_THRESHOLD) {
+                recovering = 0;
+                recover_sum += t - shot_start;
+                drop_sum += drop;
+                recovered++;
+            }
+        } else if (shot >= 0 && vel - ref > r.overshoot) {
+            r.overshoot = vel - ref;
+        }
+
+        /*---------- 电机与摩擦轮 ----------*/
+        current += (cmd - current) * SIM_DT / CURRENT_LAG;
+        fp32 torque = current * unit * torque_gain;
+        fp32 friction = viscous * vel + (vel > 0.0f ? coulomb : 0.0f);
+        vel += (torque - friction - load) / inertia * SIM_DT;
+    }
+
+    r.ss_error = ss_num ? ss_sum / ss_num : 0.0f;
+    if (out_num) {
+        fp32 mean = out_sum / out_num;
+        r.out_std = sqrtf(fmaxf(out_sq / out_num - mean * mean, 0.0f));
+    }
+    r.recover_mean = recovered ? recover_sum / recovered : -1.0f;
+    r.drop_mean = recovered ? drop_sum / recovered : 0.0f;
+    r.detected = wheel.shot_count;
+    r.ratio = muzzle.ratio;
+    if (recovered != c->shots) r.recover_mean = -1.0f;
+    return r;
+}
+
+static fp32 Mean(const fp32 * x, int from, int to)
+{
+    fp32 sum = 0.0f;
+    for (int i = from; i < to; i++) sum += x[i];
+    return sum / (to - from);
+}
+
+static fp32 Std(const fp32 * x, int from, int to)
+{
+    fp32 mean = Mean(x, from, to), sum = 0.0f;
+    for (int i = from; i < to; i++) sum += (x[i] - mean) * (x[i] - mean);
+    return sqrtf(sum / (to - from));
+}
+
+int main(void)
+{
+    int fail = 0;
+
+    // 1. 前馈
+    {
+        SimCase_t pid_only = {.ff = 0, .dob = 0, .temp = 25.0f, .period = 0.1f, .shots = 0};
+        SimCase_t ff = {.ff = 1, .dob = 1, .temp = 25.0f, .period = 0.1f, .shots = 0};
+        SimCase_t ff_hot = ff;
+        ff_hot.temp = 60.0f;
+        SimResult_t a = Simulate(&pid_only);
+        SimResult_t b = Simulate(&ff);
+        SimResult_t h = Simulate(&ff_hot);
+        printf(
+            "feed-forward: steady error pid %.2f, ff %.2f, ff@60C %.2f rad/s\n", a.ss_error,
+            b.ss_error, h.ss_error);
+        if (b.ss_error > 0.5f || h.ss_error > 0.5f || a.ss_error < 2.0f * b.ss_error) {
+            printf("FAIL: feed-forward does not remove the steady error\n");
+            fail = 1;
+        }
+    }
+
+    // 2. 扰动观测
+    {
+        SimCase_t no_dob = {.ff = 1, .dob = 0, .temp = 25.0f, .period = 0.1f, .shots = 20};
+        SimCase_t dob = no_dob;
+        dob.dob = 1;
+        SEED = 1;
+        SimResult_t a = Simulate(&no_dob);
+        SEED = 1;
+        SimResult_t b = Simulate(&dob);
+        SimCase_t fast = dob;
+        fast.period = 0.05f;
+        fast.muzzle = 1;
+        fast.bias = 0.05f;
+        SimResult_t f = Simulate(&fast);
+        printf(
+            "dip: drop %.1f/%.1f rad/s, recover %.1f/%.1f ms, overshoot %.1f/%.1f rad/s "
+            "(without/with observer), detected %u/%u/%u\n",
+            a.drop_mean, b.drop_mean, a.recover_mean * 1000.0f, b.recover_mean * 1000.0f,
+            a.overshoot, b.overshoot, (unsigned)a.detected, (unsigned)b.detected,
+            (unsigned)f.detected);
+        if (a.recover_mean < 0.0f || b.recover_mean < 0.0f ||
+            b.recover_mean > 0.7f * a.recover_mean || b.overshoot > FRIC_DIP_THRESHOLD) {
+            printf("FAIL: observer does not speed up dip recovery\n");
+            fail = 1;
+        }
+        if (a.detected != 20 || b.detected != 20 || f.detected != 20) {
+            printf("FAIL: dip detector miscounts shots\n");
+            fail = 1;
+        }
+    }
+
+    // 3. 射速闭环
+    {
+        SimCase_t offset = {
+            .ff = 1, .dob = 1, .muzzle = 1, .temp = 25.0f, .bias = 0.05f, .period = 0.1f,
+            .shots = 20};
+        SimResult_t a = Simulate(&offset);
+        int settle = -1;
+        for (int i = 0; i < 20; i++) {
+            if (fabsf(a.speed[i] - SHOOT_TARGET_SPEED) > 0.3f) settle = -1;
+            else if (settle < 0) settle = i;
+        }
+
+        SimCase_t low = offset;
+        low.bias = -0.15f;
+        SimResult_t b = Simulate(&low);
+
+        SimCase_t noisy = offset;
+        noisy.bias = 0.0f;
+        noisy.noise = MUZZLE_NOISE;
+        noisy.shots = NOISE_SHOTS;
+        SEED = 7;
+        SimResult_t closed = Simulate(&noisy);
+        noisy.muzzle = 0;
+        SEED = 7;
+        SimResult_t open = Simulate(&noisy);
+        fp32 std_closed = Std(closed.speed, 10, NOISE_SHOTS);
+        fp32 std_open = Std(open.speed, 10, NOISE_SHOTS);
+
+        printf(
+            "muzzle: +5%% settles at shot %d (ratio %.3f), -15%% ratio %.3f, "
+            "noise std %.3f closed / %.3f open m/s\n",
+            settle, a.ratio, b.ratio, std_closed, std_open);
+        if (settle < 0 || settle > 8) {
+            printf("FAIL: muzzle loop does not converge within 8 shots\n");
+            fail = 1;
+        }
+        if (fabsf(b.ratio - (1.0f + SHOOT_SPEED_ADJUST_MAX)) > 1e-4f) {
+            printf("FAIL: muzzle loop exceeds or does not reach its limit\n");
+            fail = 1;
+        }
+        if (std_closed > 1.25f * std_open) {
+            printf("FAIL: muzzle loop amplifies the speed noise\n");
+            fail = 1;
+        }
+    }
+
+    // 参数对比(只打印)：观测器时间常数越短恢复越快，但速度反馈噪声进入控制量越多；
+    // 射速修正增益越大收敛越快，但放大射速噪声
+    {
+        const fp32 dob_time[3] = {0.5f * FRIC_DOB_TIME, FRIC_DOB_TIME, 2.0f * FRIC_DOB_TIME};
+        SimCase_t none = {.ff = 1, .dob = 0, .temp = 25.0f, .period = 0.1f, .shots = 20};
+        SEED = 1;
+        SimResult_t n = Simulate(&none);
+        printf(
+            "  no observer:    recover %.1f ms, overshoot %.1f rad/s, output std %.0f\n",
+            n.recover_mean * 1000.0f, n.overshoot, n.out_std);
+        for (int i = 0; i < 3; i++) {
+            SimCase_t c = {
+                .ff = 1, .dob = 1, .temp = 25.0f, .period = 0.1f, .shots = 20,
+                .dob_time = dob_time[i]};
+            SEED = 1;
+            SimResult_t r = Simulate(&c);
+            printf(
+                "  dob_time %3.1f ms: recover %.1f ms, overshoot %.1f rad/s, output std %.0f\n",
+                dob_time[i] * 1000.0f, r.recover_mean * 1000.0f, r.overshoot, r.out_std);
+        }
+        const fp32 gain[3] = {0.5f * SHOOT_SPEED_ADJUST_GAIN, SHOOT_SPEED_ADJUST_GAIN, 1.0f};
+        for (int i = 0; i < 3; i++) {
+            SimCase_t c = {
+                .ff = 1, .dob = 1, .muzzle = 1, .temp = 25.0f, .noise = MUZZLE_NOISE,
+                .period = 0.1f, .shots = NOISE_SHOTS, .gain = gain[i]};
+            SEED = 7;
+            SimResult_t r = Simulate(&c);
+            printf(
+                "  muzzle gain %.2f: noise std %.3f m/s\n", gain[i], Std(r.speed, 10, NOISE_SHOTS));
+        }
+    }
+
+    printf(fail ? "FAIL\n" : "PASS\n");
+    return fail;
+}
@@ -5,6 +5,9 @@
   * @history
   *  Version    Date            Author          Modification
   *  V1.0.0     2025-04-08      Penguin         1.done
+  *  V1.1.0     Oct-19-2026     Penguin         1. 板间数据改为按位打包的多数据段帧
+  *  V1.1.1     Oct-19-2026     Penguin         1. 遥控器数据段中传输遥控器类型
+  *  V1.1.2     Oct-19-2026     Penguin         1. 遥控器类型改为单独的数据段，捎带在通道帧中
   *
   @verbatim
   ==============================================================================
@@ -34,46 +37,25 @@
 #define CAN_STD_ID_PACK_BASE     ((uint16_t) 0x0400)
 
 #define CAN_STD_ID_Test     ((uint16_t) 1)
-#define CAN_STD_ID_Rc       ((uint16_t) 2)
-#define CAN_STD_ID_Gimbal   ((uint16_t) 3)
+#define CAN_STD_ID_Board    ((uint16_t) 2)  // 多数据段按位打包的板间数据帧
 
 #define CAN_Test_Duration   ((uint32_t)20) // ms
-#define CAN_Rc_Duration     ((uint32_t)16) // ms
-#define CAN_Gimbal_Duration ((uint32_t)10) // ms
 
 // 任意类型的数据包
 #define CAN_STD_ID_ANY_BASE     ((uint16_t)0x0601)
 
-// clang-format on
-
-/*-------------------- Send & Receive --------------------*/
+// 板间数据帧中的数据段编号
+#define CAN_TOPIC_Rc_Low    ((uint8_t)0)  // 遥控器通道0-3
+#define CAN_TOPIC_Rc_High   ((uint8_t)1)  // 遥控器通道4-7
+#define CAN_TOPIC_Rc_Type   ((uint8_t)2)  // 遥控器类型
+#define CAN_TOPIC_Gimbal    ((uint8_t)3)  // 云台yaw相对中值的角度和状态标志
+#define CAN_TOPIC_NUM       4
 
-// typedef union {
-//     struct
-//     {
-//     } __attribute__((packed)) data;
-// } Data_Test_u;
+#define CAN_RC_CH_BITS      11            // 与SBUS通道值相同
+#define CAN_RC_TYPE_BITS    3             // RC_Type_e，RC_TYPE_UNKNOW 为离线
+#define CAN_GIMBAL_YAW_BITS 16            // [-PI, PI]
 
-typedef struct
-{
-    struct
-    {
-        union {
-            struct
-            {
-                float yaw;
-                bool offline;
-                bool init_judge;
-                uint16_t reserved;
-            } __packed__ packed_data;
-            struct
-            {
-                uint8_t data[8];
-            } __packed__ raw;
-        } gimbal;
-
-    } gimbal_data;
-} CanBoardCommunicate_t;
+// clang-format on
 
 #endif
 /*------------------------------ End of File ------------------------------*/
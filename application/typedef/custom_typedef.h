@@ -10,6 +10,7 @@
 #define USB_OFFLINE_NAME "usb_offline"
 #define VIRTUAL_RC_NAME "virtual_rc_ctrl"
 #define CALI_BUZZER_STATE_NAME "CaliBuzzerState"
+#define SHOOT_FRIC_STATS_NAME "shoot_fric_stats"
 
 typedef enum {
     CALI_BUZZER_OFF = 0,
@@ -59,4 +60,21 @@ typedef struct
 
 } RobotCmdData_t;
 
+typedef struct  // 摩擦轮单发统计
+{
+    uint32_t shot_count;     // 摩擦轮掉速检测到的发射数
+    float wheel_ref;         // (rad/s)摩擦轮目标转速(含射速修正)
+    float speed_ratio;       // 射速闭环的转速修正系数
+    float drop[2];           // (rad/s)最近一发掉速 0:R 1:L
+    float recover_time[2];   // (s)最近一发恢复时间
+    float drop_mean[2];      // (rad/s)掉速加权均值
+    float drop_std[2];       // (rad/s)掉速加权标准差
+    float dob[2];            // 扰动补偿量
+    float temp[2];           // (℃)电机温度
+    uint32_t muzzle_count;   // 裁判系统射速数
+    float muzzle_speed;      // (m/s)最近一发射速
+    float muzzle_mean;       // (m/s)射速加权均值
+    float muzzle_std;        // (m/s)射速加权标准差
+} ShootFricStats_t;
+
 #endif  // __CUSTOM_TYPEDEF_H
@@ -6,9 +6,17 @@
   *  Version    Date            Author          Modification
   *  V1.0.0     2025-03-10      Harry_Wong      1.初始化uart2的传输结构体
   *  V1.1.0     2025-04-01      Penguin         1.优化宏
+  *  V2.0.0     Oct-19-2026     Penguin         1.一帧打包多个数据段，帧头加入包序号
+  *                                             2.数据段不再各自带帧头和校验
+  *                                             3.加入时钟同步数据段，云台数据段带采样时刻和速度
+  *  V2.1.0     Oct-19-2026     Penguin         1.云台数据段的速度改为云台yaw目标角速度
   *
   @verbatim
   ==============================================================================
+    帧格式：
+      FrameHeader_t | time_stamp(uint32, us) | TopicHeader_t + 数据段 | ... | crc16
+    帧头的len为帧头之后到crc16之前的长度(含时间戳)，num为数据段个数。
+    同一周期内到期的数据段打包在同一帧中发送，帧头和CRC只计算一次。
 
   ==============================================================================
   @endverbatim
@@ -24,113 +32,77 @@
 // clang-format off
 // UART2通信协议相关定义
 #define UART2_COMMUNICATE_SOF      ((uint8_t)0xA5) // 数据帧起始字节，固定值为 0xA5
-#define UART2_COMMUNICATE_TIMEOUT  ((uint32_t)50)  // 超时等待时间
 
 #define Uart2_Data_Test_ID              ((uint8_t)0x01)
 #define Uart2_Data_Rc_ID                ((uint8_t)0x02)
 #define Uart2_Data_Gimbal_ID            ((uint8_t)0x03)
+#define Uart2_Data_Sync_ID              ((uint8_t)0x04)
 
 #define Uart2_Data_Test_Duration        ((uint32_t)20) // ms
 #define Uart2_Data_Rc_Duration          ((uint32_t)16) // ms
-#define Uart2_Data_Gimbal_Duration      ((uint32_t)10) // ms
+#define Uart2_Data_Gimbal_Duration      ((uint32_t)1)  // ms
+#define Uart2_Data_Sync_Duration        ((uint32_t)10) // ms
 
 // UART2通信协议数据包长度定义
 #define UART2_FRAME_MAX_SIZE            ((uint8_t)250) // Byte
 
 #define UART2_FRAME_HEADER_SIZE         sizeof(FrameHeader_t)
+#define UART2_TOPIC_HEADER_SIZE         sizeof(TopicHeader_t)
 #define UART2_FRAME_TIMESTAMP_SIZE      ((uint8_t)sizeof(uint32_t))
 #define UART2_FRAME_CRC16_SIZE          ((uint8_t)sizeof(uint16_t))
 #define UART2_HEADER_CRC_LEN            (UART2_FRAME_HEADER_SIZE + UART2_FRAME_CRC16_SIZE)
-#define UART2_HEADER_CRC_TIMESTAMP_LEN  (UART2_FRAME_HEADER_SIZE + UART2_FRAME_CRC16_SIZE + UART2_FRAME_TIMESTAMP_SIZE)
 #define UART2_HEADER_TIMESTAMP_LEN      (UART2_FRAME_HEADER_SIZE + UART2_FRAME_TIMESTAMP_SIZE)
 // clang-format on
 
 /*-------------------- Send & Receive --------------------*/
 
-typedef enum {
-    STEP_HEADER_SOF = 0,
-    STEP_LENGTH = 1,
-    STEP_ID = 2,
-    STEP_TYPE = 3,
-    STEP_HEADER_CRC8 = 4,
-    STEP_DATA_CRC16 = 5,
-} UnpackStep_e;
-
-typedef struct
-{
-    uint32_t Interrupt;
-    uint32_t Data_Test;
-    uint32_t Data_Rc;
-    uint32_t Data_Gimbal;
-} LastTime_t;
-
 typedef struct
 {
-    uint8_t sof;   // 数据帧起始字节，固定值为 0xA5
-    uint8_t len;   // 数据段长度
-    uint8_t id;    // 数据段id
-    uint8_t type;  // 数据段类型
-    uint8_t crc;   // 数据帧头的 CRC8
+    uint8_t sof;  // 数据帧起始字节，固定值为 0xA5
+    uint8_t len;  // 时间戳和所有数据段的总长度
+    uint8_t seq;  // 包序号
+    uint8_t num;  // 数据段个数
+    uint8_t crc;  // 数据帧头的 CRC8
 } __attribute__((packed)) FrameHeader_t;
 
 typedef struct
 {
-    FrameHeader_t * p_header;
-    uint8_t data_len;
-    uint8_t protocol_packet[UART2_FRAME_MAX_SIZE];
-    UnpackStep_e unpack_step;
-    uint16_t index;
-} UnpackData_t;
+    uint8_t id;   // 数据段id
+    uint8_t len;  // 数据段长度
+} __attribute__((packed)) TopicHeader_t;
 
-//测试用数据包
+//测试用数据段
 typedef struct
 {
-    FrameHeader_t frame_header;
-
-    uint32_t time_stamp;  //数据段时间戳
-
-    struct
-    {
-        uint32_t index;
-        float test_float;
-        uint8_t reserved[42];
-    } __attribute__((packed)) data;
-
-    uint16_t crc16;  //crc16校验
+    uint32_t index;
+    float test_float;
+    uint8_t reserved[42];
 } __attribute__((packed)) Data_Test_s;
 
-//遥控器数据包
+//遥控器数据段
 typedef struct
 {
-    FrameHeader_t frame_header;
-
-    uint32_t time_stamp;  //数据段时间戳
-
-    struct
-    {
-        uint16_t ch[16];
-        uint8_t connect_flag;
-        bool rc_offline;
-    } __attribute__((packed)) data;
-
-    uint16_t crc16;  //crc16校验
+    uint16_t ch[16];
+    uint8_t connect_flag;
+    bool rc_offline;
 } __attribute__((packed)) Data_Rc_s;
 
-// 云台数据包
+// 云台数据段
 typedef struct
 {
-    FrameHeader_t frame_header;
-
-    uint32_t time_stamp;  //数据段时间戳
-
-    struct
-    {
-        float yaw_motor_pos;
-        bool yaw_motor_offline;
-        bool init_judge;
-    } __attribute__((packed)) data;
-
-    uint16_t crc16;  //crc16校验
+    uint32_t sample_time;  // (us)采样时刻，板间统一时基
+    float yaw_motor_pos;
+    float yaw_vel_cmd;     // (rad/s)云台yaw在世界坐标系下的目标角速度
+    bool yaw_motor_offline;
+    bool init_judge;
 } __attribute__((packed)) Data_Gimbal_s;
+
+// 时钟同步数据段，与所在帧的时间戳一起构成一次双向测量
+typedef struct
+{
+    uint32_t origin;   // (us)对方最近一帧的时间戳
+    uint32_t receive;  // (us)本板收到该帧的时刻
+    bool valid;        // 已收到过对方的帧
+} __attribute__((packed)) Data_Sync_s;
 #endif
 /*------------------------------ End of File ------------------------------*/
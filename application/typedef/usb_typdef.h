@@ -6,6 +6,7 @@
 #include "struct_typedef.h"
 
 #define DEBUG_PACKAGE_NUM 10
+#define TASK_MONITOR_PACKAGE_NUM 8
 
 #define DATA_DOMAIN_OFFSET 0x08
 
@@ -26,6 +27,8 @@
 #define ROBOT_STATUS_SEND_ID      ((uint8_t)0x0B)
 #define JOINT_STATE_SEND_ID       ((uint8_t)0x0C)
 #define BUFF_SEND_ID              ((uint8_t)0x0D)
+#define TASK_MONITOR_SEND_ID      ((uint8_t)0x0E)
+#define SHOOT_STATS_SEND_ID       ((uint8_t)0x0F)
 
 #define ROBOT_CMD_DATA_RECEIVE_ID  ((uint8_t)0x01)
 #define PID_DEBUG_DATA_RECEIVE_ID  ((uint8_t)0x02)
@@ -338,6 +341,57 @@ typedef struct
 
     uint16_t crc;
 } __packed__ SendDataBuff_s;
+
+// 任务运行统计数据包，每包携带 TASK_MONITOR_PACKAGE_NUM 个任务，轮流发送
+typedef struct
+{
+    FrameHeader_t frame_header;  // 数据段id = 0x0E
+    uint32_t time_stamp;
+
+    struct
+    {
+        uint16_t cpu_load;  // (0.1%)CPU总占用率
+        uint8_t task_num;   // 任务总数
+        uint8_t start;      // 本包第一个任务的序号
+        struct
+        {
+            uint8_t name[8];
+            uint16_t cpu;         // (0.1%)
+            uint16_t stack_free;  // (word)
+            uint32_t jitter;      // (us)
+            uint32_t latency;     // (us)
+            uint16_t miss;        // 窗口内控制周期超时次数
+        } __packed__ tasks[TASK_MONITOR_PACKAGE_NUM];
+    } __packed__ data;
+
+    uint16_t crc;
+} __packed__ SendDataTaskMonitor_s;
+
+// 摩擦轮单发统计数据包，字段顺序与 ShootFricStats_t 相同
+typedef struct
+{
+    FrameHeader_t frame_header;  // 数据段id = 0x0F
+    uint32_t time_stamp;
+
+    struct
+    {
+        uint32_t shot_count;    // 摩擦轮掉速检测到的发射数
+        float wheel_ref;        // (rad/s)
+        float speed_ratio;      // 射速闭环的转速修正系数
+        float drop[2];          // (rad/s)最近一发掉速 0:R 1:L
+        float recover_time[2];  // (s)
+        float drop_mean[2];     // (rad/s)
+        float drop_std[2];      // (rad/s)
+        float dob[2];           // 扰动补偿量
+        float temp[2];          // (℃)
+        uint32_t muzzle_count;  // 裁判系统射速数
+        float muzzle_speed;     // (m/s)
+        float muzzle_mean;      // (m/s)
+        float muzzle_std;       // (m/s)
+    } __packed__ data;
+
+    uint16_t crc;
+} __packed__ SendDataShootStats_s;
 /*-------------------- Receive --------------------*/
 typedef struct RobotCmdData
 {
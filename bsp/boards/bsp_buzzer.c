@@ -1,6 +1,12 @@
 #include "bsp_buzzer.h"
 #include "main.h"
 extern TIM_HandleTypeDef htim4;
+
+// TIM2的ARR为0时计数器不计数，音符至少3个音调周期，保证开始时的ARR = periods-2 >= 1
+#define BUZZER_SEQ_MIN_PERIODS 3
+
+static volatile uint8_t seq_loaded = 0;
+static volatile uint8_t seq_ending = 0;
 void buzzer_on(uint16_t psc, uint16_t pwm)
 {
     __HAL_TIM_PRESCALER(&htim4, psc);
@@ -37,6 +43,9 @@ void buzzer_note(uint16_t note,float volume)
     
     // 设置比较寄存器（CCR3），以控制PWM信号的占空比
     htim4.Instance->CCR3 = (8*10500 / note - 1) * volume * 1u;
+
+    // 开启预装载后需要产生更新事件才能使新的ARR和CCR3立即生效
+    htim4.Instance->EGR = TIM_EGR_UG;
     
     // 重新启用定时器
     __HAL_TIM_ENABLE(&htim4);
@@ -44,3 +53,127 @@ void buzzer_note(uint16_t note,float volume)
     // 启动PWM信号
     HAL_TIM_PWM_Start(&htim4, TIM_CHANNEL_3);
 }
+
+void buzzer_seq_init(void)
+{
+    // TIM4: ARR/CCR3预装载，在更新事件时切换音符不会产生毛刺；更新事件作为TRGO输出
+    htim4.Instance->CR1 |= TIM_CR1_ARPE;
+    htim4.Instance->CCMR2 |= TIM_CCMR2_OC3PE;
+    htim4.Instance->CR2 = (htim4.Instance->CR2 & ~TIM_CR2_MMS) | TIM_CR2_MMS_1;
+
+    // TIM2: 外部时钟模式1，触发源ITR3(TIM4 TRGO)，每个音调周期计数一次
+    __HAL_RCC_TIM2_CLK_ENABLE();
+    TIM2->CR1 = TIM_CR1_URS;
+    TIM2->PSC = 0;
+    TIM2->ARR = 0;
+    TIM2->SMCR = TIM_SMCR_TS_0 | TIM_SMCR_TS_1 | TIM_SMCR_SMS;
+    TIM2->EGR = TIM_EGR_UG;
+    TIM2->SR = 0;
+    TIM2->DIER = TIM_DIER_UIE;
+
+    HAL_NVIC_SetPriority(TIM2_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(TIM2_IRQn);
+}
+
+/**
+ * @brief 计算音符的TIM4参数，休止符使用1kHz的静音周期计时
+ * @param[out] periods 音符包含的音调周期数
+ */
+static void buzzer_seq_calc(
+    uint16_t note, uint16_t duration, uint8_t volume, uint32_t * arr, uint32_t * ccr,
+    uint32_t * periods)
+{
+    uint32_t tick_per_ms = HAL_RCC_GetPCLK1Freq() * 2 / (htim4.Instance->PSC + 1) / 1000;
+
+    if (note == 0) {
+        *arr = tick_per_ms - 1;
+        *ccr = 0;
+        *periods = duration;
+    } else {
+        *arr = 8 * 21000 / note - 1;
+        *ccr = ((8 * 10500 / note - 1) * volume) >> 8;
+        *periods = tick_per_ms * duration / (*arr + 1);
+    }
+
+    if (*periods < BUZZER_SEQ_MIN_PERIODS) {
+        *periods = BUZZER_SEQ_MIN_PERIODS;
+    }
+}
+
+void buzzer_seq_start(uint16_t note, uint16_t duration, uint8_t volume)
+{
+    uint32_t arr, ccr, periods;
+    buzzer_seq_calc(note, duration, volume, &arr, &ccr, &periods);
+
+    HAL_NVIC_DisableIRQ(TIM2_IRQn);
+    TIM2->CR1 &= ~TIM_CR1_CEN;
+    __HAL_TIM_DISABLE(&htim4);
+
+    htim4.Instance->CNT = 0;
+    htim4.Instance->ARR = arr;
+    htim4.Instance->CCR3 = ccr;
+    htim4.Instance->EGR = TIM_EGR_UG;
+
+    // 第一次中断在音符的最后一个音调周期开始时产生，给回调留出预装载下一个音符的时间：
+    // 计数 periods-1 次溢出，ARR = periods-2
+    seq_ending = 0;
+    TIM2->CNT = 0;
+    TIM2->ARR = periods - 2;
+    TIM2->SR = 0;
+    TIM2->CR1 |= TIM_CR1_CEN;
+    HAL_NVIC_ClearPendingIRQ(TIM2_IRQn);
+    HAL_NVIC_EnableIRQ(TIM2_IRQn);
+
+    __HAL_TIM_ENABLE(&htim4);
+    HAL_TIM_PWM_Start(&htim4, TIM_CHANNEL_3);
+}
+
+void buzzer_seq_load(uint16_t note, uint16_t duration, uint8_t volume)
+{
+    uint32_t arr, ccr, periods;
+    buzzer_seq_calc(note, duration, volume, &arr, &ccr, &periods);
+
+    // ARR/CCR3进入预装载寄存器，在当前音符最后一个周期结束时生效
+    htim4.Instance->ARR = arr;
+    htim4.Instance->CCR3 = ccr;
+    // TIM2不预装载，中断刚发生时计数器为0，直接修改即可。
+    // 下一次中断在新音符的最后一个周期开始时产生：1个旧周期 + (periods-1)个新周期
+    TIM2->ARR = periods - 1;
+    seq_loaded = 1;
+}
+
+void buzzer_seq_stop(void)
+{
+    HAL_NVIC_DisableIRQ(TIM2_IRQn);
+    TIM2->CR1 &= ~TIM_CR1_CEN;
+    seq_ending = 0;
+    buzzer_off();
+}
+
+__weak void buzzer_seq_next_callback(void) {}
+
+void TIM2_IRQHandler(void)
+{
+    if ((TIM2->SR & TIM_SR_UIF) == 0) {
+        return;
+    }
+    TIM2->SR = ~TIM_SR_UIF;
+
+    if (seq_ending) {
+        // 最后一个音符已经结束并静音了一个周期，停止序列
+        TIM2->CR1 &= ~TIM_CR1_CEN;
+        seq_ending = 0;
+        buzzer_off();
+        return;
+    }
+
+    seq_loaded = 0;
+    buzzer_seq_next_callback();
+
+    if (!seq_loaded) {
+        // 没有下一个音符：当前音符结束时静音，再过一个周期产生中断停止序列(ARR不能为0)
+        htim4.Instance->CCR3 = 0;
+        TIM2->ARR = 1;
+        seq_ending = 1;
+    }
+}
@@ -5,4 +5,37 @@ extern void buzzer_on(uint16_t psc, uint16_t pwm);
 extern void buzzer_off(void);
 extern void buzzer_note(uint16_t note,float volume);
 
+/**
+ * @brief 音符序列器：TIM4输出音调PWM，并用更新事件(TRGO)驱动TIM2计数音调周期，
+ *        TIM2只在音符边界产生中断，音符之间不需要CPU参与
+ */
+extern void buzzer_seq_init(void);
+
+/**
+ * @brief 立即开始播放一个音符(打断当前音符)，只能在任务中调用
+ * @param note 频率(Hz)，0为休止符
+ * @param duration 时长(ms)，不足3个音调周期(休止符为3ms)时按3个周期播放
+ * @param volume 音量[0,255]
+ */
+extern void buzzer_seq_start(uint16_t note, uint16_t duration, uint8_t volume);
+
+/**
+ * @brief 预装下一个音符，只能在buzzer_seq_next_callback中调用，在当前音符结束时无缝切换
+ * @param note 频率(Hz)，0为休止符
+ * @param duration 时长(ms)，不足3个音调周期(休止符为3ms)时按3个周期播放
+ * @param volume 音量[0,255]
+ */
+extern void buzzer_seq_load(uint16_t note, uint16_t duration, uint8_t volume);
+
+/**
+ * @brief 停止序列并静音，只能在任务中调用
+ */
+extern void buzzer_seq_stop(void);
+
+/**
+ * @brief 当前音符进入最后一个音调周期时在TIM2中断中调用，
+ *        回调中没有调用buzzer_seq_load时序列在当前音符结束后停止
+ */
+extern void buzzer_seq_next_callback(void);
+
 #endif
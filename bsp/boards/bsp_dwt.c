@@ -0,0 +1,64 @@
+#include "bsp_dwt.h"
+#include "main.h"
+
+static uint32_t cycle_per_us = 168;
+
+/**
+  * @brief          enable the DWT cycle counter, it counts at the core clock (168MHz)
+  *                 and overflows every ~25.5s, always use unsigned subtraction.
+  * @retval         none
+  */
+/**
+  * @brief          使能DWT周期计数器，以内核时钟计数(168MHz)，约25.5s溢出一次，计算时间差请使用无符号减法
+  * @retval         none
+  */
+void dwt_init(void)
+{
+    cycle_per_us = SystemCoreClock / 1000000;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0)
+    {
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+}
+
+uint32_t dwt_get_cycle(void)
+{
+    return DWT->CYCCNT;
+}
+
+uint32_t dwt_cycle_to_us(uint32_t cycle)
+{
+    return cycle / cycle_per_us;
+}
+
+/**
+  * @brief          microsecond timebase extended from the DWT cycle counter, it wraps every
+  *                 ~71.6min, it must be called at least once every 25s, the board link
+  *                 task does so. It can be called from tasks and interrupts.
+  * @retval         (us)
+  */
+/**
+  * @brief          由DWT周期计数器扩展的us时基，约71.6min回绕一次，
+  *                 至少每25s调用一次(板间通信任务会调用)，可以在任务和中断中调用
+  * @retval         (us)
+  */
+uint32_t dwt_get_us(void)
+{
+    static uint32_t us = 0;
+    static uint32_t last_cycle = 0;
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    uint32_t elapsed = (DWT->CYCCNT - last_cycle) / cycle_per_us;
+    us += elapsed;
+    last_cycle += elapsed * cycle_per_us;
+    __set_PRIMASK(primask);
+    return us;
+}
+
+fp32 dwt_cycle_to_s(uint32_t cycle)
+{
+    return (fp32)cycle / (fp32)SystemCoreClock;
+}
@@ -0,0 +1,10 @@
+#ifndef BSP_DWT_H
+#define BSP_DWT_H
+#include "struct_typedef.h"
+
+extern void dwt_init(void);
+extern uint32_t dwt_get_cycle(void);
+extern uint32_t dwt_cycle_to_us(uint32_t cycle);
+extern fp32 dwt_cycle_to_s(uint32_t cycle);
+extern uint32_t dwt_get_us(void);
+#endif
@@ -18,18 +18,19 @@ static uint32_t ger_sector(uint32_t address);
   * @brief          erase flash
   * @param[in]      address: flash address
   * @param[in]      len: page num
-  * @retval         none
+  * @retval         success 0, fail -1
   */
 /**
   * @brief          擦除flash
   * @param[in]      address: flash 地址
   * @param[in]      len: 页数量
-  * @retval         none
+  * @retval         success 0, fail -1
   */
-void flash_erase_address(uint32_t address, uint16_t len)
+int8_t flash_erase_address(uint32_t address, uint16_t len)
 {
     FLASH_EraseInitTypeDef flash_erase;
-    uint32_t error;
+    uint32_t error = 0;
+    HAL_StatusTypeDef status;
 
     flash_erase.Sector = ger_sector(address);
     flash_erase.TypeErase = FLASH_TYPEERASE_SECTORS;
@@ -37,8 +38,15 @@ void flash_erase_address(uint32_t address, uint16_t len)
     flash_erase.NbSectors = len;
 
     HAL_FLASH_Unlock();
-    HAL_FLASHEx_Erase(&flash_erase, &error);
+    status = HAL_FLASHEx_Erase(&flash_erase, &error);
     HAL_FLASH_Lock();
+
+    // 全部擦除成功时error为0xFFFFFFFF，否则为出错的扇区号
+    if (status != HAL_OK || error != 0xFFFFFFFFU)
+    {
+        return -1;
+    }
+    return 0;
 }
 
 /**
@@ -38,15 +38,15 @@
   * @brief          erase flash
   * @param[in]      address: flash address
   * @param[in]      len: page num
-  * @retval         none
+  * @retval         success 0, fail -1
   */
 /**
   * @brief          擦除flash
   * @param[in]      address: flash 地址
   * @param[in]      len: 页数量
-  * @retval         none
+  * @retval         success 0, fail -1
   */
-extern void flash_erase_address(uint32_t address, uint16_t len);
+extern int8_t flash_erase_address(uint32_t address, uint16_t len);
 
 /**
   * @brief          write data to one page of flash
@@ -262,8 +262,12 @@ void I2C2_DMA_transmit(uint16_t DevAddress, uint8_t *pData, uint16_t Size)
 }
 
 
-
-
-
-
-
+bool_t I2C2_DMA_is_busy(void)
+{
+    if((hi2c2.hdmatx->Instance->CR & DMA_SxCR_EN) && hi2c2.hdmatx->Instance->NDTR != 0)
+    {
+        return 1;
+    }
+    //wait for the stop condition set in DMA1_Stream7_IRQHandler
+    return (hi2c2.Instance->SR2 & 0x02) ? 1 : 0;
+}
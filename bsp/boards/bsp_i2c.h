@@ -13,6 +13,7 @@ extern bool_t bsp_I2C_check_ack(I2C_TypeDef *I2C, uint16_t I2C_address);
 
 extern void I2C2_tx_DMA_init(void);
 extern void I2C2_DMA_transmit(uint16_t DevAddress, uint8_t *pData, uint16_t Size);
+extern bool_t I2C2_DMA_is_busy(void);
 
 
 
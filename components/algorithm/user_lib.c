@@ -1,6 +1,7 @@
 #include "user_lib.h"
 
 #include "arm_math.h"
+#include "bsp_dwt.h"
 
 //快速开方
 fp32 invSqrt(fp32 num)
@@ -242,6 +243,54 @@ float LowPassFilterCalc(LowPassFilter_t * filter, float input)
     return output;
 }
 
+/**
+ * @brief 记录一次数据到达，更新到达间隔的EWMA(alpha=1/8)和间隔偏差直方图
+ * @param monitor 监视器结构体
+ * @param now_cycle 当前DWT周期计数
+ */
+void RateMonitorUpdate(RateMonitor_t * monitor, uint32_t now_cycle)
+{
+    uint32_t interval, mean;
+    int32_t dev;
+    uint8_t bin = 0;
+
+    if (monitor->count != 0) {
+        interval = dwt_cycle_to_us(now_cycle - monitor->last_cycle);
+        if (interval > RATE_MONITOR_INTERVAL_MAX) {
+            interval = RATE_MONITOR_INTERVAL_MAX;  // 放大16倍后不超过int32_t
+        }
+        if (monitor->interval == 0) {
+            monitor->interval = interval << 4;
+        } else {
+            monitor->interval += ((int32_t)(interval << 4) - (int32_t)monitor->interval) / 8;
+        }
+
+        mean = monitor->interval >> 4;
+        dev = interval > mean ? interval - mean : mean - interval;
+        while (bin < RATE_MONITOR_HIST_NUM - 1 && dev >= (25 << bin)) {
+            bin++;
+        }
+        if (monitor->hist[bin] < 0xFFFF) {
+            monitor->hist[bin]++;
+        }
+    }
+    monitor->last_cycle = now_cycle;
+    monitor->count++;
+}
+
+/**
+ * @brief 获取数据到达频率
+ * @param monitor 监视器结构体
+ * @return (Hz)频率，尚无数据时为0
+ */
+uint16_t RateMonitorGetHz(const RateMonitor_t * monitor)
+{
+    if (monitor->interval == 0) {
+        return 0;
+    }
+    return (uint16_t)(16000000UL / monitor->interval);
+}
+
 /**
  * @brief 角度范围限制，在-PI~PI之间对角度进行限制，如max < min能够过圈限幅
  * @param theta 角度
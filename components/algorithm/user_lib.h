@@ -27,6 +27,17 @@ typedef struct LowPassFilter
     float out;    // 输出
 } LowPassFilter_t;
 
+// 数据到达频率监视器，整数EWMA，可在中断中调用
+#define RATE_MONITOR_HIST_NUM 8        // 间隔偏差直方图分档：<25us, <50us, ... , <1600us, >=1600us
+#define RATE_MONITOR_INTERVAL_MAX ((uint32_t)0x7FFFFFFF >> 4)  // (us)到达间隔上限
+typedef struct RateMonitor
+{
+    uint32_t last_cycle;                   // (cycle)上次到达时刻，DWT周期计数
+    uint32_t interval;                     // (us/16)到达间隔的EWMA，放大16倍保留小数
+    uint32_t count;                        // 到达次数
+    uint16_t hist[RATE_MONITOR_HIST_NUM];  // 到达间隔偏离EWMA的直方图
+} RateMonitor_t;
+
 //快速开方
 extern fp32 invSqrt(fp32 num);
 
@@ -66,6 +77,10 @@ extern void LowPassFilterInit(LowPassFilter_t * filter, float alpha);
 
 extern float LowPassFilterCalc(LowPassFilter_t * filter, float input);
 
+extern void RateMonitorUpdate(RateMonitor_t * monitor, uint32_t now_cycle);
+
+extern uint16_t RateMonitorGetHz(const RateMonitor_t * monitor);
+
 extern float ThetaRangeLimit(float theta, float max, float min, uint8_t return_value);
 
 //弧度格式化为-PI~PI
@@ -0,0 +1,125 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       joint_observer.c/h
+  * @brief      多关节状态观测，一次调用完成多圈展开、减速比换算和速度、加速度估计
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include "joint_observer.h"
+
+#include "math.h"
+#include "stddef.h"
+
+void JointObserverInit(
+    JointObserver_s * obs, uint8_t mode, uint8_t num, fp32 range, fp32 ratio, const fp32 gain[3],
+    fp32 dt)
+{
+    if (num > JOINT_OBSERVER_MAX_NUM) {
+        num = JOINT_OBSERVER_MAX_NUM;
+    }
+    obs->mode = mode;
+    obs->num = num;
+    obs->dt = dt;
+    for (uint8_t i = 0; i < num; i++) {
+        obs->range[i] = range;
+        obs->ratio[i] = ratio;
+        obs->alpha[i] = gain[0];
+        obs->beta[i] = gain[1];
+        obs->acc_alpha[i] = gain[2];
+    }
+    JointObserverReset(obs);
+}
+
+void JointObserverReset(JointObserver_s * obs)
+{
+    obs->init = 0;
+    for (uint8_t i = 0; i < obs->num; i++) {
+        obs->last_raw[i] = 0.0f;
+        obs->round[i] = 0;
+        obs->pos[i] = 0.0f;
+        obs->vel[i] = 0.0f;
+        obs->acc[i] = 0.0f;
+    }
+}
+
+/**
+  * @brief          第一次反馈，直接作为初值，不计圈
+  */
+static void JointObserverStart(JointObserver_s * obs, const fp32 * raw_pos, const fp32 * raw_vel)
+{
+    for (uint8_t i = 0; i < obs->num; i++) {
+        obs->last_raw[i] = raw_pos[i];
+        obs->round[i] = 0;
+        obs->pos[i] = raw_pos[i] / obs->ratio[i];
+        obs->vel[i] = raw_vel != NULL ? raw_vel[i] / obs->ratio[i] : 0.0f;
+        obs->acc[i] = 0.0f;
+    }
+    obs->init = 1;
+}
+
+void JointObserverUpdate(JointObserver_s * obs, const fp32 * raw_pos, const fp32 * raw_vel)
+{
+    fp32 dt = obs->dt;
+    if (!obs->init) {
+        JointObserverStart(obs, raw_pos, raw_vel);
+        return;
+    }
+
+    // 多圈展开，取与速度预测最接近的位置差
+    for (uint8_t i = 0; i < obs->num; i++) {
+        fp32 range = obs->range[i];
+        if (range > 0.0f) {
+            fp32 predict = raw_vel != NULL ? raw_vel[i] * dt : obs->vel[i] * obs->ratio[i] * dt;
+            fp32 delta = raw_pos[i] - obs->last_raw[i];
+            obs->round[i] -= (int32_t)floorf((delta - predict) / range + 0.5f);
+        }
+        obs->last_raw[i] = raw_pos[i];
+    }
+
+    if (obs->mode == JOINT_OBSERVER_ALPHA_BETA) {
+        for (uint8_t i = 0; i < obs->num; i++) {
+            fp32 z = (obs->last_raw[i] + obs->round[i] * obs->range[i]) / obs->ratio[i];
+            fp32 last_vel = obs->vel[i];
+            fp32 predict = obs->pos[i] + last_vel * dt;
+            fp32 r = z - predict;
+            obs->pos[i] = predict + obs->alpha[i] * r;
+            obs->vel[i] = last_vel + obs->beta[i] * r / dt;
+            obs->acc[i] = obs->acc_alpha[i] * obs->acc[i] +
+                          (1.0f - obs->acc_alpha[i]) * (obs->vel[i] - last_vel) / dt;
+        }
+    } else {
+        for (uint8_t i = 0; i < obs->num; i++) {
+            fp32 last_vel = obs->vel[i];
+            fp32 vel = raw_vel[i] / obs->ratio[i];
+            obs->pos[i] = (obs->last_raw[i] + obs->round[i] * obs->range[i]) / obs->ratio[i];
+            obs->vel[i] = obs->alpha[i] * last_vel + (1.0f - obs->alpha[i]) * vel;
+            obs->acc[i] = obs->acc_alpha[i] * obs->acc[i] +
+                          (1.0f - obs->acc_alpha[i]) * (obs->vel[i] - last_vel) / dt;
+        }
+    }
+}
+
+/**
+  * @note           匀速模型、分段常值加速度扰动下的稳态解(Kalata)：
+  *                 lambda = acc_noise * dt^2 / pos_noise
+  *                 r = (4 + lambda - sqrt(8*lambda + lambda^2)) / 4
+  *                 alpha = 1 - r^2，beta = 2*(2 - alpha) - 4*sqrt(1 - alpha)
+  */
+void JointObserverKalmanGain(fp32 acc_noise, fp32 pos_noise, fp32 dt, fp32 gain[3])
+{
+    fp32 lambda = acc_noise * dt * dt / pos_noise;
+    fp32 r = (4.0f + lambda - sqrtf(8.0f * lambda + lambda * lambda)) / 4.0f;
+    fp32 alpha = 1.0f - r * r;
+    gain[0] = alpha;
+    gain[1] = 2.0f * (2.0f - alpha) - 4.0f * sqrtf(1.0f - alpha);
+}
+/*------------------------------ End of File ------------------------------*/
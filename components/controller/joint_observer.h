@@ -0,0 +1,107 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       joint_observer.c/h
+  * @brief      多关节状态观测，一次调用完成多圈展开、减速比换算和速度、加速度估计
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+    输入：
+      电机侧的原始位置 raw_pos(已按零点和方向换算，范围为 [-range/2, range/2))
+      和原始速度 raw_vel(同方向)，按数组传入，每个控制周期调用一次 JointObserverUpdate。
+    多圈展开：
+      两次采样之间的位置差先按原始速度预测为 raw_vel*dt，再取与预测值最接近的那一个
+      delta + k*range，只要速度反馈的误差在一个周期内不超过 range/2，
+      即使每周期转过的角度超过半圈也能正确计圈；raw_vel 为NULL时用上一周期的速度估计预测。
+      range = 0 的关节不展开。
+    关节量：
+      pos = (raw_pos + round*range) / ratio，vel、acc 同样除以 ratio。
+    速度估计(所有关节相同的模式)：
+      JOINT_OBSERVER_LPF        对速度反馈一阶低通，alpha = 0 时直接使用反馈值
+      JOINT_OBSERVER_ALPHA_BETA 只用展开后的位置的 alpha-beta 滤波，
+                                增益可由 JointObserverKalmanGain 按稳态卡尔曼滤波计算
+      加速度由相邻两次速度估计的差分经一阶低通得到。
+    参数：
+      JointObserverInit 对所有关节设置相同的参数，之后可以直接修改各关节的 range/ratio/gain。
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+#ifndef JOINT_OBSERVER_H
+#define JOINT_OBSERVER_H
+#include "struct_typedef.h"
+
+#define JOINT_OBSERVER_MAX_NUM 8
+
+typedef enum {
+    JOINT_OBSERVER_LPF = 0,
+    JOINT_OBSERVER_ALPHA_BETA,
+} JointObserverMode_e;
+
+typedef struct
+{
+    uint8_t mode;   // JointObserverMode_e，所有关节相同
+    uint8_t num;    // 关节数
+    bool_t init;    // 已收到第一次反馈
+    fp32 dt;        // (s)更新周期
+
+    // 参数
+    fp32 range[JOINT_OBSERVER_MAX_NUM];      // (rad)原始位置的周期，0表示不展开
+    fp32 ratio[JOINT_OBSERVER_MAX_NUM];      // 减速比，关节量 = 电机量 / ratio
+    fp32 alpha[JOINT_OBSERVER_MAX_NUM];      // LPF:速度低通系数 ALPHA_BETA:位置修正增益
+    fp32 beta[JOINT_OBSERVER_MAX_NUM];       // ALPHA_BETA:速度修正增益
+    fp32 acc_alpha[JOINT_OBSERVER_MAX_NUM];  // 加速度低通系数
+
+    // 状态
+    fp32 last_raw[JOINT_OBSERVER_MAX_NUM];  // (rad)上次的原始位置
+    int32_t round[JOINT_OBSERVER_MAX_NUM];  // 圈数
+    fp32 pos[JOINT_OBSERVER_MAX_NUM];       // (rad)关节位置
+    fp32 vel[JOINT_OBSERVER_MAX_NUM];       // (rad/s)关节速度
+    fp32 acc[JOINT_OBSERVER_MAX_NUM];       // (rad/s^2)关节加速度
+} JointObserver_s;
+
+/**
+  * @brief          初始化多关节观测器，所有关节使用相同的参数
+  * @param[out]     obs: 观测器
+  * @param[in]      mode: JOINT_OBSERVER_LPF 或 JOINT_OBSERVER_ALPHA_BETA
+  * @param[in]      num: 关节数，不超过JOINT_OBSERVER_MAX_NUM
+  * @param[in]      range: (rad)原始位置的周期，0表示不展开
+  * @param[in]      ratio: 减速比
+  * @param[in]      gain: 0: alpha, 1: beta, 2: acc_alpha
+  * @param[in]      dt: (s)更新周期
+  * @retval         none
+  */
+extern void JointObserverInit(
+    JointObserver_s * obs, uint8_t mode, uint8_t num, fp32 range, fp32 ratio, const fp32 gain[3],
+    fp32 dt);
+
+/**
+  * @brief          多关节状态更新
+  * @param[in,out]  obs: 观测器
+  * @param[in]      raw_pos: (rad)各关节电机侧原始位置
+  * @param[in]      raw_vel: (rad/s)各关节电机侧速度反馈，ALPHA_BETA模式下可以为NULL
+  * @retval         none
+  */
+extern void JointObserverUpdate(JointObserver_s * obs, const fp32 * raw_pos, const fp32 * raw_vel);
+
+/**
+  * @brief          清除圈数和估计值，下次更新时从反馈重新开始
+  * @param[out]     obs: 观测器
+  * @retval         none
+  */
+extern void JointObserverReset(JointObserver_s * obs);
+
+/**
+  * @brief          稳态卡尔曼滤波对应的alpha-beta增益
+  * @param[in]      acc_noise: (rad/s^2)加速度扰动的标准差
+  * @param[in]      pos_noise: (rad)位置测量噪声的标准差
+  * @param[in]      dt: (s)更新周期
+  * @param[out]     gain: 0: alpha, 1: beta，gain[2]不修改
+  * @retval         none
+  */
+extern void JointObserverKalmanGain(fp32 acc_noise, fp32 pos_noise, fp32 dt, fp32 gain[3]);
+
+#endif
+/*------------------------------ End of File ------------------------------*/
@@ -0,0 +1,233 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       pid_bank.c/h
+  * @brief      多通道PID，一次调用更新多个相同模式的PID控制器
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *  V1.1.0     Oct-19-2026     Penguin         1. 增加PID_DELTA模式
+  *                                             2. 增加Q31/Q15定点多通道PID
+  *
+  @verbatim
+  ==============================================================================
+
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include "pid_bank.h"
+
+#include "stddef.h"
+
+#define LimitMax(input, max)       \
+    {                              \
+        if (input > max) {         \
+            input = max;           \
+        } else if (input < -max) { \
+            input = -max;          \
+        }                          \
+    }
+
+/**
+  * @brief          浮点数转换为定点数，超出[-1, 1)的部分饱和
+  */
+static q31_t FloatToQ31(fp32 x)
+{
+    if (x >= 1.0f) {
+        return 0x7FFFFFFF;
+    } else if (x <= -1.0f) {
+        return (q31_t)0x80000000;
+    }
+    return (q31_t)(x * 2147483648.0f);
+}
+
+static q15_t FloatToQ15(fp32 x)
+{
+    if (x >= 1.0f) {
+        return 0x7FFF;
+    } else if (x <= -1.0f) {
+        return (q15_t)0x8000;
+    }
+    return (q15_t)(x * 32768.0f);
+}
+
+/*-------------------- 浮点 --------------------*/
+
+void PidBankInit(
+    PidBank_s * bank, uint8_t mode, uint8_t num, const fp32 PID[3], fp32 max_out,
+    fp32 max_iout)
+{
+    if (num > PID_BANK_MAX_NUM) {
+        num = PID_BANK_MAX_NUM;
+    }
+    bank->mode = mode;
+    bank->num = num;
+    for (uint8_t i = 0; i < num; i++) {
+        bank->Kp[i] = PID[0];
+        bank->Ki[i] = PID[1];
+        bank->Kd[i] = PID[2];
+        bank->N[i] = 0.0f;
+        bank->max_out[i] = max_out;
+        bank->max_iout[i] = max_iout;
+    }
+    PidBankClear(bank);
+}
+
+void PidBankCalc(PidBank_s * bank, const fp32 * fdb, const fp32 * set, fp32 * out)
+{
+    if (bank->mode == PID_POSITION) {
+        for (uint8_t i = 0; i < bank->num; i++) {
+            fp32 error = set[i] - fdb[i];
+
+            fp32 iout = bank->Iout[i] + bank->Ki[i] * error;
+            LimitMax(iout, bank->max_iout[i]);
+            bank->Iout[i] = iout;
+
+            fp32 dbuf =
+                bank->N[i] * bank->Dbuf[i] + (1.0f - bank->N[i]) * (error - bank->last_error[i]);
+            bank->Dbuf[i] = dbuf;
+            bank->last_error[i] = error;
+
+            fp32 output = bank->Kp[i] * error + iout + bank->Kd[i] * dbuf;
+            LimitMax(output, bank->max_out[i]);
+            bank->out[i] = output;
+        }
+    } else if (bank->mode == PID_DELTA) {
+        for (uint8_t i = 0; i < bank->num; i++) {
+            fp32 error = set[i] - fdb[i];
+            fp32 last_error = bank->last_error[i];
+
+            fp32 iout = bank->Ki[i] * error;
+            bank->Iout[i] = iout;
+
+            fp32 dbuf = error - 2.0f * last_error + bank->prev_error[i];
+            bank->Dbuf[i] = dbuf;
+            bank->prev_error[i] = last_error;
+            bank->last_error[i] = error;
+
+            fp32 output =
+                bank->out[i] + (bank->Kp[i] * (error - last_error) + iout + bank->Kd[i] * dbuf);
+            LimitMax(output, bank->max_out[i]);
+            bank->out[i] = output;
+        }
+    }
+
+    if (out != NULL) {
+        for (uint8_t i = 0; i < bank->num; i++) {
+            out[i] = bank->out[i];
+        }
+    }
+}
+
+void PidBankClear(PidBank_s * bank)
+{
+    for (uint8_t i = 0; i < PID_BANK_MAX_NUM; i++) {
+        bank->Iout[i] = 0.0f;
+        bank->Dbuf[i] = 0.0f;
+        bank->last_error[i] = 0.0f;
+        bank->prev_error[i] = 0.0f;
+        bank->out[i] = 0.0f;
+    }
+}
+
+/*-------------------- Q31 --------------------*/
+
+void PidBankQ31Init(PidBankQ31_s * bank, uint8_t num, const fp32 PID[3], fp32 max_out)
+{
+    if (num > PID_BANK_MAX_NUM) {
+        num = PID_BANK_MAX_NUM;
+    }
+    bank->num = num;
+    for (uint8_t i = 0; i < num; i++) {
+        bank->A0[i] = FloatToQ31(PID[0] + PID[1] + PID[2]);
+        bank->A1[i] = FloatToQ31(-PID[0] - 2.0f * PID[2]);
+        bank->A2[i] = FloatToQ31(PID[2]);
+        bank->max_out[i] = FloatToQ31(max_out);
+    }
+    PidBankQ31Clear(bank);
+}
+
+void PidBankQ31Calc(PidBankQ31_s * bank, const q31_t * fdb, const q31_t * set, q31_t * out)
+{
+    for (uint8_t i = 0; i < bank->num; i++) {
+        q31_t error = __QSUB(set[i], fdb[i]);
+
+        q63_t acc = (q63_t)bank->A0[i] * error;
+        acc += (q63_t)bank->A1[i] * bank->last_error[i];
+        acc += (q63_t)bank->A2[i] * bank->prev_error[i];
+        q31_t output = clip_q63_to_q31((acc >> 31) + bank->out[i]);
+
+        bank->prev_error[i] = bank->last_error[i];
+        bank->last_error[i] = error;
+
+        LimitMax(output, bank->max_out[i]);
+        bank->out[i] = output;
+    }
+
+    if (out != NULL) {
+        for (uint8_t i = 0; i < bank->num; i++) {
+            out[i] = bank->out[i];
+        }
+    }
+}
+
+void PidBankQ31Clear(PidBankQ31_s * bank)
+{
+    for (uint8_t i = 0; i < PID_BANK_MAX_NUM; i++) {
+        bank->last_error[i] = 0;
+        bank->prev_error[i] = 0;
+        bank->out[i] = 0;
+    }
+}
+
+/*-------------------- Q15 --------------------*/
+
+void PidBankQ15Init(PidBankQ15_s * bank, uint8_t num, const fp32 PID[3], fp32 max_out)
+{
+    if (num > PID_BANK_MAX_NUM) {
+        num = PID_BANK_MAX_NUM;
+    }
+    bank->num = num;
+    for (uint8_t i = 0; i < num; i++) {
+        q15_t a1 = FloatToQ15(-PID[0] - 2.0f * PID[2]);
+        q15_t a2 = FloatToQ15(PID[2]);
+        bank->A0[i] = FloatToQ15(PID[0] + PID[1] + PID[2]);
+        bank->A12[i] = (q31_t)(((uint32_t)(uint16_t)a2 << 16) | (uint16_t)a1);
+        bank->max_out[i] = FloatToQ15(max_out);
+    }
+    PidBankQ15Clear(bank);
+}
+
+void PidBankQ15Calc(PidBankQ15_s * bank, const q15_t * fdb, const q15_t * set, q15_t * out)
+{
+    for (uint8_t i = 0; i < bank->num; i++) {
+        q15_t error = (q15_t)__SSAT((q31_t)set[i] - fdb[i], 16);
+
+        // acc = A0 * e[n] + A1 * e[n-1] + A2 * e[n-2] + y[n-1]
+        q63_t acc = (q31_t)bank->A0[i] * error;
+        acc = (q63_t)__SMLALD(bank->A12[i], bank->error12[i], acc);
+        acc += (q31_t)bank->out[i] << 15;
+        q15_t output = (q15_t)__SSAT((q31_t)(acc >> 15), 16);
+
+        bank->error12[i] = (q31_t)(((uint32_t)bank->error12[i] << 16) | (uint16_t)error);
+
+        LimitMax(output, bank->max_out[i]);
+        bank->out[i] = output;
+    }
+
+    if (out != NULL) {
+        for (uint8_t i = 0; i < bank->num; i++) {
+            out[i] = bank->out[i];
+        }
+    }
+}
+
+void PidBankQ15Clear(PidBankQ15_s * bank)
+{
+    for (uint8_t i = 0; i < PID_BANK_MAX_NUM; i++) {
+        bank->error12[i] = 0;
+        bank->out[i] = 0;
+    }
+}
+/*------------------------------ End of File ------------------------------*/
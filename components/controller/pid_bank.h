@@ -0,0 +1,180 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       pid_bank.c/h
+  * @brief      多通道PID，一次调用更新多个相同模式的PID控制器
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *  V1.1.0     Oct-19-2026     Penguin         1. 增加PID_DELTA模式
+  *                                             2. 增加Q31/Q15定点多通道PID
+  *
+  @verbatim
+  ==============================================================================
+    浮点版本(PidBank_s)：
+      与 PID_calc 的计算结果相同，状态按数组存放(struct of arrays)，模式在进入循环前判断一次，
+      同一个循环中依次处理各个通道，省去逐个调用 PID_calc 时的空指针检查、模式分支和误差移位。
+      适合底盘驱动轮、摩擦轮、关节电机等参数相同、同时更新的一组电机。
+
+    定点版本(PidBankQ31_s / PidBankQ15_s)：
+      与CMSIS-DSP的 arm_pid_q31/arm_pid_q15 相同的增量式结构，等价于 PID_DELTA 模式：
+        y[n] = y[n-1] + A0 * e[n] + A1 * e[n-1] + A2 * e[n-2]
+        A0 = Kp + Ki + Kd, A1 = -Kp - 2Kd, A2 = Kd
+      在此基础上增加了输出限幅，y[n-1] 取限幅后的值，积分不会超出输出范围。
+      输入输出为归一化到[-1, 1)的定点数，初始化时传入的增益需要先归一化：
+        K_norm = K * fdb_range / out_range
+      其中 fdb_range 为反馈量的满量程，out_range 为输出的满量程，
+      归一化后 |A0|、|A1|、|A2| 需小于1，超出部分会被饱和；误差 set - fdb 超出[-1, 1)时同样饱和。
+      Q15版本将 A1/A2 与 e[n-1]/e[n-2] 两两打包，使用 __SMLALD 一条指令完成两次乘加。
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+#ifndef PID_BANK_H
+#define PID_BANK_H
+#include "arm_math.h"
+#include "pid.h"
+#include "struct_typedef.h"
+
+#define PID_BANK_MAX_NUM 8
+
+typedef struct
+{
+    uint8_t mode;  // PID_POSITION 或 PID_DELTA，所有通道相同
+    uint8_t num;   // 通道数
+
+    // 参数
+    fp32 Kp[PID_BANK_MAX_NUM];
+    fp32 Ki[PID_BANK_MAX_NUM];
+    fp32 Kd[PID_BANK_MAX_NUM];
+    fp32 N[PID_BANK_MAX_NUM];  // [0,1]微分滤波系数，仅PID_POSITION模式使用
+    fp32 max_out[PID_BANK_MAX_NUM];
+    fp32 max_iout[PID_BANK_MAX_NUM];
+
+    // 状态
+    fp32 Iout[PID_BANK_MAX_NUM];
+    fp32 Dbuf[PID_BANK_MAX_NUM];
+    fp32 last_error[PID_BANK_MAX_NUM];  // e[n-1]
+    fp32 prev_error[PID_BANK_MAX_NUM];  // e[n-2]，仅PID_DELTA模式使用
+    fp32 out[PID_BANK_MAX_NUM];
+} PidBank_s;
+
+typedef struct
+{
+    uint8_t num;
+
+    // 参数
+    q31_t A0[PID_BANK_MAX_NUM];
+    q31_t A1[PID_BANK_MAX_NUM];
+    q31_t A2[PID_BANK_MAX_NUM];
+    q31_t max_out[PID_BANK_MAX_NUM];
+
+    // 状态
+    q31_t last_error[PID_BANK_MAX_NUM];
+    q31_t prev_error[PID_BANK_MAX_NUM];
+    q31_t out[PID_BANK_MAX_NUM];
+} PidBankQ31_s;
+
+typedef struct
+{
+    uint8_t num;
+
+    // 参数
+    q15_t A0[PID_BANK_MAX_NUM];
+    q31_t A12[PID_BANK_MAX_NUM];  // 低16位A1，高16位A2
+    q15_t max_out[PID_BANK_MAX_NUM];
+
+    // 状态
+    q31_t error12[PID_BANK_MAX_NUM];  // 低16位e[n-1]，高16位e[n-2]
+    q15_t out[PID_BANK_MAX_NUM];
+} PidBankQ15_s;
+
+/**
+  * @brief          初始化多通道PID，所有通道使用相同的参数
+  * @param[out]     bank: 多通道PID
+  * @param[in]      mode: PID_POSITION:普通PID
+  *                 PID_DELTA: 差分PID
+  * @param[in]      num: 通道数，不超过PID_BANK_MAX_NUM
+  * @param[in]      PID: 0: kp, 1: ki, 2:kd
+  * @param[in]      max_out: pid最大输出
+  * @param[in]      max_iout: pid最大积分输出
+  * @retval         none
+  */
+extern void PidBankInit(
+    PidBank_s * bank, uint8_t mode, uint8_t num, const fp32 PID[3], fp32 max_out,
+    fp32 max_iout);
+
+/**
+  * @brief          多通道PID计算
+  * @param[in,out]  bank: 多通道PID
+  * @param[in]      fdb: 各通道反馈数据
+  * @param[in]      set: 各通道设定值
+  * @param[out]     out: 各通道输出，可以为NULL，结果同时保存在bank->out
+  * @retval         none
+  */
+extern void PidBankCalc(PidBank_s * bank, const fp32 * fdb, const fp32 * set, fp32 * out);
+
+/**
+  * @brief          多通道PID输出清除
+  * @param[out]     bank: 多通道PID
+  * @retval         none
+  */
+extern void PidBankClear(PidBank_s * bank);
+
+/**
+  * @brief          初始化Q31多通道PID，所有通道使用相同的参数
+  * @param[out]     bank: 多通道PID
+  * @param[in]      num: 通道数，不超过PID_BANK_MAX_NUM
+  * @param[in]      PID: 归一化后的增益 0: kp, 1: ki, 2:kd
+  * @param[in]      max_out: 归一化后的最大输出，范围(0, 1)
+  * @retval         none
+  */
+extern void PidBankQ31Init(PidBankQ31_s * bank, uint8_t num, const fp32 PID[3], fp32 max_out);
+
+/**
+  * @brief          Q31多通道PID计算
+  * @param[in,out]  bank: 多通道PID
+  * @param[in]      fdb: 各通道反馈数据
+  * @param[in]      set: 各通道设定值
+  * @param[out]     out: 各通道输出，可以为NULL，结果同时保存在bank->out
+  * @retval         none
+  */
+extern void PidBankQ31Calc(
+    PidBankQ31_s * bank, const q31_t * fdb, const q31_t * set, q31_t * out);
+
+/**
+  * @brief          Q31多通道PID输出清除
+  * @param[out]     bank: 多通道PID
+  * @retval         none
+  */
+extern void PidBankQ31Clear(PidBankQ31_s * bank);
+
+/**
+  * @brief          初始化Q15多通道PID，所有通道使用相同的参数
+  * @param[out]     bank: 多通道PID
+  * @param[in]      num: 通道数，不超过PID_BANK_MAX_NUM
+  * @param[in]      PID: 归一化后的增益 0: kp, 1: ki, 2:kd
+  * @param[in]      max_out: 归一化后的最大输出，范围(0, 1)
+  * @retval         none
+  */
+extern void PidBankQ15Init(PidBankQ15_s * bank, uint8_t num, const fp32 PID[3], fp32 max_out);
+
+/**
+  * @brief          Q15多通道PID计算
+  * @param[in,out]  bank: 多通道PID
+  * @param[in]      fdb: 各通道反馈数据
+  * @param[in]      set: 各通道设定值
+  * @param[out]     out: 各通道输出，可以为NULL，结果同时保存在bank->out
+  * @retval         none
+  */
+extern void PidBankQ15Calc(
+    PidBankQ15_s * bank, const q15_t * fdb, const q15_t * set, q15_t * out);
+
+/**
+  * @brief          Q15多通道PID输出清除
+  * @param[out]     bank: 多通道PID
+  * @retval         none
+  */
+extern void PidBankQ15Clear(PidBankQ15_s * bank);
+
+#endif
+/*------------------------------ End of File ------------------------------*/
@@ -0,0 +1,250 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       joint_observer_test.c
+  * @brief      在PC上运行的多关节观测器测试程序，随机生成关节运动检查多圈展开与速度估计，并统计耗时
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+    编译运行：
+      cc -O2 -I.. -I../../../application/typedef -o joint_observer_test \
+        joint_observer_test.c ../joint_observer.c -lm
+      ./joint_observer_test
+    检查项(任一不满足返回非0)：
+      1. 随机的周期、减速比和运动(每周期最多转过1.5圈，速度反馈带噪声)下，
+         每一步的圈数都与真实位置对应的圈数相同
+      2. 不传速度反馈时，每周期转过的角度小于半圈的随机运动圈数同样正确
+      3. 速度反馈滤波系数为0时，低速下与原来各模块中的 round += dpos < 0 ? 1 : -1 写法结果相同
+      4. 稳态卡尔曼增益的alpha-beta模式，位置带噪声的匀速运动，
+         速度估计的最大误差小于位置直接差分的 VEL_RATIO 倍
+    耗时：
+      8个关节一次更新的耗时，PC上的耗时只用于比较，
+      C板上的周期数用 develop_task 中的 DEVELOP_JOINT_OBSERVER_BENCH 测量
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "joint_observer.h"
+
+#define JOINT_NUM 8
+#define CASE_NUM 200
+#define STEP_NUM 5000
+#define BENCH_NUM 2000000
+#define DT 0.001f
+#define POS_NOISE 2e-4  // (rad)
+#define VEL_RATIO 0.25f
+
+static uint32_t SEED = 1;
+
+static double Rand(double min, double max)
+{
+    SEED = SEED * 1664525u + 1013904223u;
+    return min + (max - min) * (SEED >> 8) / (double)(1u << 24);
+}
+
+static double Now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief 真实位置折算到 [-range/2, range/2) 的原始位置和对应圈数
+ */
+static double Wrap(double x, double range, int32_t * round)
+{
+    double k = floor(x / range + 0.5);
+    if (round != NULL) *round = (int32_t)k;
+    return x - k * range;
+}
+
+/**
+ * @brief 随机运动下检查圈数，max_turn 为每周期最多转过的圈数
+ * @retval 圈数出错的步数
+ */
+static int WrapCase(int use_vel, double max_turn)
+{
+    const fp32 gain[3] = {0.0f, 0.0f, 0.9f};
+    JointObserver_s obs;
+    double x[JOINT_NUM], v[JOINT_NUM], range[JOINT_NUM];
+    fp32 raw_pos[JOINT_NUM], raw_vel[JOINT_NUM];
+    int err = 0;
+
+    JointObserverInit(
+        &obs, use_vel ? JOINT_OBSERVER_LPF : JOINT_OBSERVER_ALPHA_BETA, JOINT_NUM, 0.0f, 1.0f, gain,
+        DT);
+    for (int i = 0; i < JOINT_NUM; i++) {
+        range[i] = 2.0 * M_PI * (1 + (int)Rand(0, 4));
+        obs.range[i] = (fp32)range[i];
+        obs.ratio[i] = (fp32)Rand(1.0, 40.0);
+        x[i] = Rand(-range[i], range[i]);
+        v[i] = Rand(-1, 1) * max_turn * range[i] / DT;
+        if (!use_vel) {
+            // 只用位置时使用较快的alpha-beta增益
+            obs.alpha[i] = 0.8f;
+            obs.beta[i] = 0.5f;
+        }
+    }
+
+    for (int n = 0; n < STEP_NUM; n++) {
+        int32_t round0[JOINT_NUM];
+        for (int i = 0; i < JOINT_NUM; i++) {
+            double vmax = max_turn * range[i] / DT;
+            v[i] += Rand(-0.02, 0.02) * vmax;
+            if (v[i] > vmax) v[i] = vmax;
+            if (v[i] < -vmax) v[i] = -vmax;
+            x[i] += v[i] * DT;
+            raw_pos[i] = (fp32)Wrap(x[i], range[i], NULL);
+            raw_vel[i] = (fp32)(v[i] * (1.0 + Rand(-0.05, 0.05)));
+            if (n == 0) Wrap(x[i], range[i], &round0[i]);
+        }
+        static int32_t base[JOINT_NUM];
+        if (n == 0) {
+            for (int i = 0; i < JOINT_NUM; i++) base[i] = round0[i];
+        }
+        JointObserverUpdate(&obs, raw_pos, use_vel ? raw_vel : NULL);
+        for (int i = 0; i < JOINT_NUM; i++) {
+            int32_t expect;
+            Wrap(x[i], range[i], &expect);
+            if (obs.round[i] != expect - base[i]) {
+                err++;
+                break;
+            }
+        }
+    }
+    return err;
+}
+
+/**
+ * @brief 原来各模块中的多圈计数写法
+ */
+typedef struct
+{
+    float last_angle;
+    int16_t round;
+} Legacy_s;
+
+static float LegacyUpdate(Legacy_s * l, float angle, float ratio)
+{
+    float dpos = angle - l->last_angle;
+    if (fabs(dpos) > M_PI) {
+        l->round += (dpos) < 0 ? 1 : -1;
+    }
+    l->last_angle = angle;
+    return (angle + M_PI * 2 * l->round) / ratio;
+}
+
+int main(void)
+{
+    int fail = 0;
+
+    // 1. 带速度反馈，每周期最多1.5圈
+    {
+        int err = 0;
+        for (int c = 0; c < CASE_NUM; c++) err += WrapCase(1, 1.5);
+        printf("wrap with velocity (<=1.5 turn/step): %d errors\n", err);
+        if (err) fail = 1;
+    }
+
+    // 2. 不带速度反馈，每周期最多0.3圈
+    {
+        int err = 0;
+        for (int c = 0; c < CASE_NUM; c++) err += WrapCase(0, 0.3);
+        printf("wrap without velocity (<=0.3 turn/step): %d errors\n", err);
+        if (err) fail = 1;
+    }
+
+    // 3. 与原写法对比
+    {
+        const fp32 gain[3] = {0.0f, 0.0f, 0.0f};
+        JointObserver_s obs;
+        Legacy_s legacy[JOINT_NUM] = {0};
+        fp32 raw_pos[JOINT_NUM], raw_vel[JOINT_NUM];
+        double x[JOINT_NUM] = {0}, v[JOINT_NUM] = {0};
+        float max_err = 0;
+        JointObserverInit(&obs, JOINT_OBSERVER_LPF, JOINT_NUM, 2.0f * M_PI, 1.0f, gain, DT);
+        for (int i = 0; i < JOINT_NUM; i++) obs.ratio[i] = 1.0f + i;
+        for (int n = 0; n < STEP_NUM * 10; n++) {
+            for (int i = 0; i < JOINT_NUM; i++) {
+                v[i] += Rand(-2.0, 2.0);
+                if (fabs(v[i]) > 100.0) v[i] *= 0.9;
+                x[i] += v[i] * DT;
+                raw_pos[i] = (fp32)Wrap(x[i], 2.0 * M_PI, NULL);
+                raw_vel[i] = (fp32)v[i];
+            }
+            JointObserverUpdate(&obs, raw_pos, raw_vel);
+            for (int i = 0; i < JOINT_NUM; i++) {
+                float ref = LegacyUpdate(&legacy[i], raw_pos[i], obs.ratio[i]);
+                max_err = fmaxf(max_err, fabsf(ref - obs.pos[i]));
+                max_err = fmaxf(max_err, fabsf(raw_vel[i] / obs.ratio[i] - obs.vel[i]));
+            }
+        }
+        printf("legacy: max error %.2e\n", max_err);
+        if (max_err > 1e-3f) fail = 1;
+    }
+
+    // 4. 稳态卡尔曼增益
+    {
+        fp32 gain[3] = {0.0f, 0.0f, 0.9f};
+        JointObserver_s obs;
+        fp32 raw_pos[JOINT_NUM];
+        double x = 0, v = 30.0;
+        float max_err = 0, diff_err = 0, last_z = 0;
+        JointObserverKalmanGain(50.0f, POS_NOISE, DT, gain);
+        JointObserverInit(&obs, JOINT_OBSERVER_ALPHA_BETA, JOINT_NUM, 2.0f * M_PI, 1.0f, gain, DT);
+        for (int n = 0; n < 2000; n++) {
+            x += v * DT;
+            for (int i = 0; i < JOINT_NUM; i++) {
+                raw_pos[i] = (fp32)Wrap(x + Rand(-POS_NOISE, POS_NOISE), 2.0 * M_PI, NULL);
+            }
+            JointObserverUpdate(&obs, raw_pos, NULL);
+            if (n > 500) {
+                for (int i = 0; i < JOINT_NUM; i++) {
+                    max_err = fmaxf(max_err, fabsf(obs.vel[i] - (float)v));
+                }
+                fp32 diff = (fp32)Wrap(raw_pos[0] - last_z, 2.0 * M_PI, NULL);
+                diff_err = fmaxf(diff_err, fabsf(diff / DT - (float)v));
+            }
+            last_z = raw_pos[0];
+        }
+        printf(
+            "kalman gain: alpha %.3f beta %.4f, velocity error %.3f rad/s (difference %.3f)\n",
+            gain[0], gain[1], max_err, diff_err);
+        if (max_err > VEL_RATIO * diff_err) fail = 1;
+    }
+
+    // 耗时
+    {
+        const fp32 gain[3] = {0.5f, 0.0f, 0.9f};
+        JointObserver_s obs;
+        fp32 raw_pos[JOINT_NUM], raw_vel[JOINT_NUM];
+        for (int i = 0; i < JOINT_NUM; i++) {
+            raw_pos[i] = 0.1f * i;
+            raw_vel[i] = 10.0f;
+        }
+        JointObserverInit(&obs, JOINT_OBSERVER_LPF, JOINT_NUM, 2.0f * M_PI, 19.0f, gain, DT);
+        volatile fp32 sink = 0;
+        double t0 = Now();
+        for (int n = 0; n < BENCH_NUM; n++) {
+            for (int i = 0; i < JOINT_NUM; i++) {
+                raw_pos[i] += 0.01f;
+                if (raw_pos[i] > M_PI) raw_pos[i] -= 2.0f * M_PI;
+            }
+            JointObserverUpdate(&obs, raw_pos, raw_vel);
+            sink += obs.pos[0];
+        }
+        double t1 = Now();
+        printf("update time: %.1f ns (%d joints)\n", (t1 - t0) / BENCH_NUM * 1e9, JOINT_NUM);
+    }
+
+    printf(fail ? "FAIL\n" : "PASS\n");
+    return fail;
+}
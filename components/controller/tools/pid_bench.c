@@ -0,0 +1,220 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       pid_bench.c
+  * @brief      在PC上运行的多通道PID测试程序，检查计算结果并比较逐个调用PID_calc与多通道PID的耗时
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+    编译运行：
+      cc -O2 -Istub -I.. -I../../../application/typedef -o pid_bench \
+        pid_bench.c ../pid.c ../pid_bank.c -lm
+      ./pid_bench
+    检查项(任一不满足返回非0)：
+      1. PID_POSITION/PID_DELTA 模式下多通道PID与 PID_calc 结果完全相同
+      2. 闭环控制一阶对象时，Q31/Q15版本与浮点PID_DELTA的输出误差分别小于1e-5和2e-3(归一化单位)
+    耗时：
+      输出每个控制器每次计算的平均耗时。PC上没有 __SMLALD 等DSP指令，定点版本用C实现，
+      结果只用于比较浮点写法，C板上的周期数见 develop_task.c 中的 DEVELOP_PID_BANK_BENCH
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "pid.h"
+#include "pid_bank.h"
+
+#define CHANNEL_NUM 8
+#define TEST_NUM 100000
+#define BENCH_NUM 2000000
+
+#define PLANT_GAIN 0.05f         // 一阶对象 v += (u - v) * PLANT_GAIN
+#define SET_CHANGE_PERIOD 500    // 设定值阶跃周期
+#define Q31_MAX_ERROR 1e-5f
+#define Q15_MAX_ERROR 2e-3f
+
+static const fp32 FLOAT_PID[3] = {15000.0f, 10.0f, 100.0f};
+static const fp32 NORM_PID[3] = {0.5f, 0.05f, 0.1f};  // 归一化增益
+#define NORM_MAX_OUT 0.9f
+
+static uint32_t SEED = 1;
+
+static fp32 Rand(fp32 min, fp32 max)
+{
+    SEED = SEED * 1664525u + 1013904223u;
+    return min + (max - min) * (SEED >> 8) / (fp32)(1u << 24);
+}
+
+static double Now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief 检查多通道PID与PID_calc结果是否完全相同
+ */
+static int CheckFloat(uint8_t mode)
+{
+    pid_type_def pid[CHANNEL_NUM];
+    PidBank_s bank;
+    fp32 max_err = 0.0f;
+
+    for (int i = 0; i < CHANNEL_NUM; i++) {
+        PID_init(&pid[i], mode, FLOAT_PID, 16000.0f, 2000.0f);
+        pid[i].N = 0.3f;
+    }
+    PidBankInit(&bank, mode, CHANNEL_NUM, FLOAT_PID, 16000.0f, 2000.0f);
+    for (int i = 0; i < CHANNEL_NUM; i++) bank.N[i] = 0.3f;
+
+    for (int n = 0; n < TEST_NUM; n++) {
+        fp32 fdb[CHANNEL_NUM], set[CHANNEL_NUM], out[CHANNEL_NUM];
+        for (int i = 0; i < CHANNEL_NUM; i++) {
+            fdb[i] = Rand(-6, 6);
+            set[i] = Rand(-6, 6);
+        }
+        PidBankCalc(&bank, fdb, set, out);
+        for (int i = 0; i < CHANNEL_NUM; i++) {
+            fp32 err = fabsf(PID_calc(&pid[i], fdb[i], set[i]) - out[i]);
+            if (err > max_err) max_err = err;
+        }
+    }
+    printf(
+        "%-14s max difference to PID_calc: %.2e\n",
+        mode == PID_POSITION ? "PID_POSITION" : "PID_DELTA", max_err);
+    return max_err != 0.0f;
+}
+
+/**
+ * @brief 闭环控制一阶对象，比较定点版本与浮点版本的输出
+ */
+static int CheckFixed(void)
+{
+    PidBank_s bank;
+    PidBankQ31_s bank_q31;
+    PidBankQ15_s bank_q15;
+    fp32 v[3][CHANNEL_NUM] = {{0}};
+    fp32 set[CHANNEL_NUM];
+    fp32 err_q31 = 0.0f, err_q15 = 0.0f;
+
+    PidBankInit(&bank, PID_DELTA, CHANNEL_NUM, NORM_PID, NORM_MAX_OUT, 0.0f);
+    PidBankQ31Init(&bank_q31, CHANNEL_NUM, NORM_PID, NORM_MAX_OUT);
+    PidBankQ15Init(&bank_q15, CHANNEL_NUM, NORM_PID, NORM_MAX_OUT);
+
+    for (int n = 0; n < TEST_NUM; n++) {
+        if (n % SET_CHANGE_PERIOD == 0) {
+            // 保证误差不超出[-1, 1)
+            for (int i = 0; i < CHANNEL_NUM; i++) set[i] = Rand(-0.45f, 0.45f);
+        }
+
+        fp32 out[CHANNEL_NUM];
+        q31_t fdb_q31[CHANNEL_NUM], set_q31[CHANNEL_NUM], out_q31[CHANNEL_NUM];
+        q15_t fdb_q15[CHANNEL_NUM], set_q15[CHANNEL_NUM], out_q15[CHANNEL_NUM];
+        for (int i = 0; i < CHANNEL_NUM; i++) {
+            fdb_q31[i] = (q31_t)(v[1][i] * 2147483648.0f);
+            set_q31[i] = (q31_t)(set[i] * 2147483648.0f);
+            fdb_q15[i] = (q15_t)(v[2][i] * 32768.0f);
+            set_q15[i] = (q15_t)(set[i] * 32768.0f);
+        }
+        PidBankCalc(&bank, v[0], set, out);
+        PidBankQ31Calc(&bank_q31, fdb_q31, set_q31, out_q31);
+        PidBankQ15Calc(&bank_q15, fdb_q15, set_q15, out_q15);
+
+        for (int i = 0; i < CHANNEL_NUM; i++) {
+            fp32 u_q31 = out_q31[i] / 2147483648.0f;
+            fp32 u_q15 = out_q15[i] / 32768.0f;
+            if (fabsf(u_q31 - out[i]) > err_q31) err_q31 = fabsf(u_q31 - out[i]);
+            if (fabsf(u_q15 - out[i]) > err_q15) err_q15 = fabsf(u_q15 - out[i]);
+            v[0][i] += (out[i] - v[0][i]) * PLANT_GAIN;
+            v[1][i] += (u_q31 - v[1][i]) * PLANT_GAIN;
+            v[2][i] += (u_q15 - v[2][i]) * PLANT_GAIN;
+        }
+    }
+    printf("Q31 max difference to float: %.2e\n", err_q31);
+    printf("Q15 max difference to float: %.2e\n", err_q15);
+    return err_q31 > Q31_MAX_ERROR || err_q15 > Q15_MAX_ERROR;
+}
+
+static void Bench(void)
+{
+    static fp32 input[1024][CHANNEL_NUM];
+    static q31_t input_q31[1024][CHANNEL_NUM];
+    static q15_t input_q15[1024][CHANNEL_NUM];
+    pid_type_def pid[CHANNEL_NUM];
+    PidBank_s bank_pos, bank_delta;
+    PidBankQ31_s bank_q31;
+    PidBankQ15_s bank_q15;
+    fp32 set[CHANNEL_NUM] = {0}, out[CHANNEL_NUM];
+    q31_t set_q31[CHANNEL_NUM] = {0}, out_q31[CHANNEL_NUM];
+    q15_t set_q15[CHANNEL_NUM] = {0}, out_q15[CHANNEL_NUM];
+    volatile fp32 sink = 0.0f;
+    double t[6];
+
+    for (int n = 0; n < 1024; n++) {
+        for (int i = 0; i < CHANNEL_NUM; i++) {
+            input[n][i] = Rand(-1, 1);
+            input_q31[n][i] = (q31_t)(input[n][i] * 2147483647.0f);
+            input_q15[n][i] = (q15_t)(input[n][i] * 32767.0f);
+        }
+    }
+    for (int i = 0; i < CHANNEL_NUM; i++) PID_init(&pid[i], PID_POSITION, NORM_PID, 1.0f, 0.5f);
+    PidBankInit(&bank_pos, PID_POSITION, CHANNEL_NUM, NORM_PID, 1.0f, 0.5f);
+    PidBankInit(&bank_delta, PID_DELTA, CHANNEL_NUM, NORM_PID, 1.0f, 0.5f);
+    PidBankQ31Init(&bank_q31, CHANNEL_NUM, NORM_PID, NORM_MAX_OUT);
+    PidBankQ15Init(&bank_q15, CHANNEL_NUM, NORM_PID, NORM_MAX_OUT);
+
+    t[0] = Now();
+    for (int n = 0; n < BENCH_NUM; n++) {
+        const fp32 * fdb = input[n & 1023];
+        for (int i = 0; i < CHANNEL_NUM; i++) out[i] = PID_calc(&pid[i], fdb[i], set[i]);
+        sink += out[0];
+    }
+    t[1] = Now();
+    for (int n = 0; n < BENCH_NUM; n++) {
+        PidBankCalc(&bank_pos, input[n & 1023], set, out);
+        sink += out[0];
+    }
+    t[2] = Now();
+    for (int n = 0; n < BENCH_NUM; n++) {
+        PidBankCalc(&bank_delta, input[n & 1023], set, out);
+        sink += out[0];
+    }
+    t[3] = Now();
+    for (int n = 0; n < BENCH_NUM; n++) {
+        PidBankQ31Calc(&bank_q31, input_q31[n & 1023], set_q31, out_q31);
+        sink += out_q31[0];
+    }
+    t[4] = Now();
+    for (int n = 0; n < BENCH_NUM; n++) {
+        PidBankQ15Calc(&bank_q15, input_q15[n & 1023], set_q15, out_q15);
+        sink += out_q15[0];
+    }
+    t[5] = Now();
+
+    static const char * NAME[5] = {
+        "PID_calc x8", "bank position", "bank delta", "bank q31", "bank q15"};
+    for (int k = 0; k < 5; k++) {
+        printf(
+            "%-14s %6.2f ns/controller\n", NAME[k],
+            (t[k + 1] - t[k]) / ((double)BENCH_NUM * CHANNEL_NUM) * 1e9);
+    }
+}
+
+int main(void)
+{
+    int fail = 0;
+    fail |= CheckFloat(PID_POSITION);
+    fail |= CheckFloat(PID_DELTA);
+    fail |= CheckFixed();
+    Bench();
+
+    printf(fail ? "FAIL\n" : "PASS\n");
+    return fail;
+}
@@ -0,0 +1,29 @@
+// PC上没有CMSIS-DSP库，这里给出测试用到的类型和内联指令的等价C实现
+#ifndef ARM_MATH_H_STUB
+#define ARM_MATH_H_STUB
+#include "struct_typedef.h"
+
+/*-------------------- 定点 --------------------*/
+
+typedef int16_t q15_t;
+typedef int32_t q31_t;
+typedef int64_t q63_t;
+
+static inline q31_t clip_q63_to_q31(q63_t x)
+{
+    return ((q31_t)(x >> 32) != ((q31_t)x >> 31)) ? ((0x7FFFFFFF ^ ((q31_t)(x >> 63)))) : (q31_t)x;
+}
+
+static inline q31_t __SSAT(q31_t x, uint32_t y)
+{
+    q31_t max = (q31_t)((1u << (y - 1)) - 1);
+    return x > max ? max : (x < -max - 1 ? -max - 1 : x);
+}
+
+static inline q31_t __QSUB(q31_t x, q31_t y) { return clip_q63_to_q31((q63_t)x - y); }
+
+static inline uint64_t __SMLALD(uint32_t x, uint32_t y, uint64_t sum)
+{
+    return sum + (q63_t)((q15_t)x * (q15_t)y) + (q63_t)((q15_t)(x >> 16) * (q15_t)(y >> 16));
+}
+#endif
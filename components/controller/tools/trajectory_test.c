@@ -0,0 +1,219 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       trajectory_test.c
+  * @brief      在PC上运行的轨迹生成测试程序，检查速度、加速度、加加速度限幅与到达时间
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+    编译运行：
+      cc -O2 -I.. -I../../../application/typedef -o trajectory_test \
+        trajectory_test.c ../trajectory.c -lm
+      ./trajectory_test
+    检查项(任一不满足返回非0)：
+      1. 阶跃：不同距离和限幅下速度、加速度、加加速度不超过限幅，超调量小于 OVERSHOOT_TOL，
+         到达时间不超过理论最短时间的 TIME_RATIO_TOL 倍
+      2. 目标随机跳变(包括运动中反向)：限幅同样成立，且由差分得到的加速度与加加速度也不超限
+      3. 多轴同步：各轴从静止出发同时到达，到达时间之差小于 SYNC_TOL
+    耗时：
+      单轴每次更新的平均耗时，PC上的耗时只用于比较
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "trajectory.h"
+
+#define DT 0.001f
+#define LIMIT_TOL 1e-3f       // 速度、加速度允许超出限幅的比例
+#define OVERSHOOT_TOL 1e-4f   // 超调量
+#define TIME_RATIO_TOL 1.05f  // 到达时间/理论最短时间
+#define SYNC_TOL 0.02f        // (s)
+#define MAX_STEP 200000
+#define BENCH_NUM 10000000
+
+static uint32_t SEED = 1;
+
+static fp32 Rand(fp32 min, fp32 max)
+{
+    SEED = SEED * 1664525u + 1013904223u;
+    return min + (max - min) * (SEED >> 8) / (fp32)(1u << 24);
+}
+
+static double Now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief 理论最短时间，与 trajectory.c 独立推导：加速段 + 匀速段 + 对称减速段
+ */
+static double OptimalTime(const TrajLimit_s * l, double d)
+{
+    double V = l->max_vel, A = l->max_acc, J = l->max_jerk;
+    // 二分峰值速度 v，使 v * t_acc(v) = d
+    double lo = 0, hi = V;
+    for (int i = 0; i < 100; i++) {
+        double v = 0.5 * (lo + hi);
+        double t = v * J >= A * A ? v / A + A / J : 2 * sqrt(v / J);
+        if (v * t > d) hi = v; else lo = v;
+    }
+    double v = lo;
+    double t = v * J >= A * A ? v / A + A / J : 2 * sqrt(v / J);
+    return 2 * t + (d - v * t) / V * (v >= V * (1 - 1e-9));
+}
+
+typedef struct
+{
+    fp32 max_vel, max_acc, max_jerk, max_diff_acc, max_diff_jerk;
+} Peak_s;
+
+static void Track(const TrajAxis_s * axis, fp32 last_vel, fp32 last_acc, Peak_s * peak)
+{
+    fp32 diff_acc = (axis->vel - last_vel) / DT;
+    fp32 diff_jerk = (axis->acc - last_acc) / DT;
+    if (fabsf(axis->vel) > peak->max_vel) peak->max_vel = fabsf(axis->vel);
+    if (fabsf(axis->acc) > peak->max_acc) peak->max_acc = fabsf(axis->acc);
+    if (fabsf(axis->jerk) > peak->max_jerk) peak->max_jerk = fabsf(axis->jerk);
+    if (fabsf(diff_acc) > peak->max_diff_acc) peak->max_diff_acc = fabsf(diff_acc);
+    if (fabsf(diff_jerk) > peak->max_diff_jerk) peak->max_diff_jerk = fabsf(diff_jerk);
+}
+
+static int CheckPeak(const TrajLimit_s * l, const Peak_s * p)
+{
+    return p->max_vel <= l->max_vel * (1 + LIMIT_TOL) && p->max_acc <= l->max_acc * (1 + LIMIT_TOL) &&
+           p->max_jerk <= l->max_jerk * (1 + LIMIT_TOL) &&
+           p->max_diff_acc <= l->max_acc * (1 + LIMIT_TOL) &&
+           p->max_diff_jerk <= l->max_jerk * (1 + LIMIT_TOL);
+}
+
+int main(void)
+{
+    int fail = 0;
+    static const TrajLimit_s LIMITS[] = {
+        {10.0f, 40.0f, 400.0f},   // 云台
+        {2.0f, 8.0f, 60.0f},      // 大关节
+        {20.0f, 200.0f, 8000.0f}, // 小关节
+    };
+    static const fp32 DIST[] = {1e-4f, 1e-3f, 0.01f, 0.05f, 0.2f, 1.0f, 3.0f, 10.0f};
+
+    // 1. 阶跃
+    fp32 worst_ratio = 0, worst_overshoot = 0;
+    for (int li = 0; li < 3; li++) {
+        const TrajLimit_s * l = &LIMITS[li];
+        for (int di = 0; di < 8; di++) {
+            for (int dir = -1; dir <= 1; dir += 2) {
+                TrajAxis_s axis;
+                Peak_s peak = {0};
+                TrajAxisInit(&axis, l, 0.5f);
+                fp32 target = 0.5f + dir * DIST[di];
+                TrajAxisSetTarget(&axis, target);
+                int n = 0;
+                fp32 overshoot = 0;
+                while (!TrajAxisReached(&axis) && n < MAX_STEP) {
+                    fp32 v = axis.vel, a = axis.acc;
+                    TrajAxisUpdate(&axis, DT);
+                    Track(&axis, v, a, &peak);
+                    fp32 os = (axis.pos - target) * dir;
+                    if (os > overshoot) overshoot = os;
+                    n++;
+                }
+                double ratio = n * DT / fmax(OptimalTime(l, DIST[di]), DT);
+                if (ratio > worst_ratio && DIST[di] > 1e-3f) worst_ratio = ratio;
+                if (overshoot > worst_overshoot) worst_overshoot = overshoot;
+                if (!CheckPeak(l, &peak) || n >= MAX_STEP) {
+                    printf(
+                        "step fail: limit %d dist %g: vel %.4f acc %.4f jerk %.2f steps %d\n", li,
+                        DIST[di], peak.max_vel, peak.max_acc, peak.max_jerk, n);
+                    fail = 1;
+                }
+            }
+        }
+    }
+    printf("step: worst time ratio %.4f, worst overshoot %.2e\n", worst_ratio, worst_overshoot);
+    if (worst_ratio > TIME_RATIO_TOL || worst_overshoot > OVERSHOOT_TOL) fail = 1;
+
+    // 2. 目标随机跳变
+    for (int li = 0; li < 3; li++) {
+        const TrajLimit_s * l = &LIMITS[li];
+        TrajAxis_s axis;
+        Peak_s peak = {0};
+        TrajAxisInit(&axis, l, 0.0f);
+        for (int n = 0; n < 1000000; n++) {
+            if (n % 137 == 0) TrajAxisSetTarget(&axis, Rand(-3.0f, 3.0f));
+            fp32 v = axis.vel, a = axis.acc;
+            TrajAxisUpdate(&axis, DT);
+            Track(&axis, v, a, &peak);
+        }
+        printf(
+            "random target %d: vel %.4f/%.1f acc %.4f/%.1f jerk %.2f/%.1f diff jerk %.2f\n", li,
+            peak.max_vel, l->max_vel, peak.max_acc, l->max_acc, peak.max_jerk, l->max_jerk,
+            peak.max_diff_jerk);
+        if (!CheckPeak(l, &peak)) fail = 1;
+    }
+
+    // 3. 多轴同步
+    {
+        static const fp32 MOVE[4] = {2.0f, -0.3f, 0.02f, 1.0f};
+        TrajAxis_s axis[4];
+        fp32 arrive[4] = {0};
+        Peak_s peak[4] = {0};
+        for (int i = 0; i < 4; i++) {
+            TrajAxisInit(&axis[i], &LIMITS[1], 0.0f);
+            TrajAxisSetTarget(&axis[i], MOVE[i]);
+        }
+        for (int n = 1; n < MAX_STEP; n++) {
+            fp32 v[4], a[4];
+            for (int i = 0; i < 4; i++) {
+                v[i] = axis[i].vel;
+                a[i] = axis[i].acc;
+            }
+            TrajectorySync(axis, 4, DT);
+            int done = 1;
+            for (int i = 0; i < 4; i++) {
+                Track(&axis[i], v[i], a[i], &peak[i]);
+                if (!TrajAxisReached(&axis[i])) {
+                    done = 0;
+                } else if (arrive[i] == 0) {
+                    arrive[i] = n * DT;
+                }
+            }
+            if (done) break;
+        }
+        fp32 t_min = arrive[0], t_max = arrive[0];
+        for (int i = 0; i < 4; i++) {
+            if (arrive[i] < t_min) t_min = arrive[i];
+            if (arrive[i] > t_max) t_max = arrive[i];
+            if (!CheckPeak(&LIMITS[1], &peak[i])) fail = 1;
+        }
+        printf(
+            "sync: arrive %.3f %.3f %.3f %.3f s, optimal for longest %.3f s\n", arrive[0], arrive[1],
+            arrive[2], arrive[3], OptimalTime(&LIMITS[1], 2.0));
+        if (t_min <= 0 || t_max - t_min > SYNC_TOL) fail = 1;
+    }
+
+    // 耗时
+    {
+        TrajAxis_s axis;
+        TrajAxisInit(&axis, &LIMITS[0], 0.0f);
+        volatile fp32 sink = 0;
+        double t0 = Now();
+        for (int n = 0; n < BENCH_NUM; n++) {
+            if ((n & 255) == 0) TrajAxisSetTarget(&axis, (n & 256) ? 1.0f : -1.0f);
+            sink += TrajAxisUpdate(&axis, DT);
+        }
+        double t1 = Now();
+        printf("update time: %.1f ns per axis\n", (t1 - t0) / BENCH_NUM * 1e9);
+    }
+
+    printf(fail ? "FAIL\n" : "PASS\n");
+    return fail;
+}
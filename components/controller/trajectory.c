@@ -0,0 +1,312 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       trajectory.c/h
+  * @brief      在线加加速度限制轨迹生成，每个控制周期由当前状态和新目标重新规划
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include "trajectory.h"
+
+#include "math.h"
+
+#define TRAJ_SETTLE_RATIO 1.0f     // 误差小于 该比例*(J*dt^3, J*dt^2, J*dt) 时直接到达目标
+#define TRAJ_SEARCH_ITERATION 12  // 加加速度二分次数，分辨率 2J/2^12
+
+static fp32 Sign(fp32 x) { return x > 0.0f ? 1.0f : (x < 0.0f ? -1.0f : 0.0f); }
+
+/**
+ * @brief          按时间最优的加加速度限制制动到静止后的位置
+ * @note           先以最大加加速度把加速度推向制动方向的峰值(不超过A)，必要时保持，
+ *                 再把加速度减回0，速度恰好为0
+ */
+static fp32 StopPos(fp32 p, fp32 v, fp32 a, fp32 A, fp32 J)
+{
+    fp32 d = -Sign(v + a * fabsf(a) / (2.0f * J));  // 制动方向
+    if (d == 0.0f) {
+        // 直接把加速度减到0即可停下
+        fp32 t = fabsf(a) / J;
+        return p + (v + (0.5f * a - Sign(a) * J * t / 6.0f) * t) * t;
+    }
+
+    fp32 ap2 = 0.5f * a * a - d * v * J;
+    fp32 ap = ap2 < A * A ? d * sqrtf(ap2) : d * A;
+
+    // 加速度由a变为峰值ap
+    fp32 j = Sign(ap - a) * J;
+    fp32 t = fabsf(ap - a) / J;
+    p += (v + (0.5f * a + j * t / 6.0f) * t) * t;
+    v += (a + 0.5f * j * t) * t;
+
+    // 保持峰值，达到最大加速度时才有这一段
+    t = -(v + ap * fabsf(ap) / (2.0f * J)) / ap;
+    if (t > 0.0f) {
+        p += (v + 0.5f * ap * t) * t;
+        v += ap * t;
+    }
+
+    // 加速度由ap减回0
+    t = fabsf(ap) / J;
+    return p + (v + (0.5f * ap - d * J * t / 6.0f) * t) * t;
+}
+
+/**
+ * @brief          从静止加速到v(加速度回到0)所需的时间
+ */
+static fp32 AccTime(fp32 A, fp32 J, fp32 v)
+{
+    if (v * J >= A * A) return v / A + A / J;
+    return 2.0f * sqrtf(v / J);
+}
+
+/**
+ * @brief          从静止出发移动距离d并停下的最短时间
+ */
+static fp32 RestToRestTime(const TrajLimit_s * l, fp32 d)
+{
+    fp32 V = l->max_vel, A = l->max_acc, J = l->max_jerk;
+    fp32 t_v = AccTime(A, J, V);
+    if (d >= V * t_v) {
+        return t_v + d / V;  // 能达到最大速度
+    }
+    if (d * J * J >= 2.0f * A * A * A) {
+        fp32 k = A / J;
+        fp32 v_peak = 0.5f * A * (sqrtf(k * k + 4.0f * d / A) - k);  // 能达到最大加速度
+        return 2.0f * AccTime(A, J, v_peak);
+    }
+    fp32 v_peak = cbrtf(0.25f * J * d * d);
+    return 4.0f * sqrtf(v_peak / J);
+}
+
+/**
+ * @brief          从静止出发移动距离d，恰好用时T所需的最大速度，不超过l->max_vel
+ */
+static fp32 VelForTime(const TrajLimit_s * l, fp32 d, fp32 T)
+{
+    fp32 A = l->max_acc, J = l->max_jerk;
+    if (d <= 0.0f || T <= 0.0f) return l->max_vel;
+
+    // T = v/A + A/J + d/v
+    fp32 c = T - A / J;
+    fp32 disc = c * c - 4.0f * d / A;
+    fp32 v = disc > 0.0f ? 0.5f * A * (c - sqrtf(disc)) : l->max_vel;
+
+    if (v * J < A * A) {
+        // 达不到最大加速度时 T = 2*sqrt(v/J) + d/v，从上面的解出发迭代，两次已足够
+        if (v > l->max_vel) v = l->max_vel;
+        for (uint8_t i = 0; i < 2; i++) {
+            fp32 den = T - 2.0f * sqrtf(v / J);
+            if (den <= 0.0f) break;
+            v = d / den;
+        }
+    }
+    return v < l->max_vel ? v : l->max_vel;
+}
+
+/**
+ * @brief          初始化单轴轨迹，静止于pos
+ * @param[out]     axis 单轴轨迹
+ * @param[in]      limit 速度、加速度、加加速度限幅，均为正数
+ * @param[in]      pos 初始位置
+ * @retval         none
+ */
+void TrajAxisInit(TrajAxis_s * axis, const TrajLimit_s * limit, fp32 pos)
+{
+    axis->limit = *limit;
+    axis->vel_limit = limit->max_vel;
+    TrajAxisReset(axis, pos, 0.0f);
+}
+
+/**
+ * @brief          从给定状态重新开始规划，目标设为当前位置，用于模式切换时从反馈值出发
+ */
+void TrajAxisReset(TrajAxis_s * axis, fp32 pos, fp32 vel)
+{
+    axis->target = pos;
+    axis->pos = pos;
+    axis->err = 0.0f;
+    axis->vel = vel;
+    axis->acc = 0.0f;
+    axis->jerk = 0.0f;
+    axis->replan = 1;
+}
+
+/**
+ * @brief          设置目标位置，可以每个周期调用
+ */
+void TrajAxisSetTarget(TrajAxis_s * axis, fp32 target)
+{
+    if (target != axis->target) axis->replan = 1;
+    axis->err += axis->target - target;
+    axis->target = target;
+}
+
+/**
+ * @brief          位置与目标同时平移，用于角度过圈后整体移回 [-pi, pi]
+ */
+void TrajAxisShift(TrajAxis_s * axis, fp32 offset)
+{
+    axis->pos += offset;
+    axis->target += offset;
+}
+
+/**
+ * @brief          加加速度取s*u时，一个周期后的状态能否不越过目标停下且速度不超限
+ */
+static bool_t Feasible(const TrajAxis_s * axis, fp32 s, fp32 u, fp32 dt)
+{
+    fp32 A = axis->limit.max_acc, J = axis->limit.max_jerk;
+    fp32 j = s * u;
+    fp32 e = axis->err + (axis->vel + (0.5f * axis->acc + j * dt / 6.0f) * dt) * dt;
+    fp32 v = axis->vel + (axis->acc + 0.5f * j * dt) * dt;
+    fp32 a = axis->acc + j * dt;
+
+    if (s * (v + a * fabsf(a) / (2.0f * J)) > axis->vel_limit) return 0;
+    return s * StopPos(e, v, a, A, J) <= 0.0f;
+}
+
+/**
+ * @brief          单轴轨迹更新，每个控制周期调用一次
+ * @param[in,out]  axis 单轴轨迹
+ * @param[in]      dt (s)距上次调用的时间
+ * @retval         规划的位置
+ */
+fp32 TrajAxisUpdate(TrajAxis_s * axis, fp32 dt)
+{
+    fp32 A = axis->limit.max_acc, J = axis->limit.max_jerk;
+    if (dt <= 0.0f) return axis->pos;
+
+    fp32 jdt = J * dt;
+    if (fabsf(axis->err) < TRAJ_SETTLE_RATIO * jdt * dt * dt &&
+        fabsf(axis->vel) < TRAJ_SETTLE_RATIO * jdt * dt && fabsf(axis->acc) < TRAJ_SETTLE_RATIO * jdt) {
+        TrajAxisReset(axis, axis->target, 0.0f);
+        return axis->pos;
+    }
+
+    // 朝目标方向(s)取尽量大的加加速度u，同时保证加速度不超限
+    fp32 s = StopPos(axis->err, axis->vel, axis->acc, A, J) <= 0.0f ? 1.0f : -1.0f;
+    fp32 lo = -J, hi = J;
+    fp32 u_min = (-A - s * axis->acc) / dt, u_max = (A - s * axis->acc) / dt;
+    if (lo < u_min) lo = u_min;
+    if (hi > u_max) hi = u_max;
+    if (lo > hi) lo = hi;
+
+    fp32 u;
+    if (Feasible(axis, s, hi, dt)) {
+        u = hi;
+    } else if (!Feasible(axis, s, lo, dt)) {
+        u = lo;
+    } else {
+        for (uint8_t i = 0; i < TRAJ_SEARCH_ITERATION; i++) {
+            fp32 mid = 0.5f * (lo + hi);
+            if (Feasible(axis, s, mid, dt)) {
+                lo = mid;
+            } else {
+                hi = mid;
+            }
+        }
+        u = lo;
+    }
+    axis->jerk = s * u;
+
+    axis->err += (axis->vel + (0.5f * axis->acc + axis->jerk * dt / 6.0f) * dt) * dt;
+    axis->vel += (axis->acc + 0.5f * axis->jerk * dt) * dt;
+    axis->acc += axis->jerk * dt;
+    axis->pos = axis->target + axis->err;
+    return axis->pos;
+}
+
+/**
+ * @brief          把轴的当前状态看作更早从静止出发的一段运动
+ * @note           先按最大加加速度把加速度减到0，若此时仍朝目标运动，
+ *                 就把它看作从静止以最大能力加速到当前速度的结果
+ * @param[out]     t_off 等效运动已经过的时间，剩余时间 = RestToRestTime(返回值) - t_off
+ * @retval         等效运动的总距离
+ */
+static fp32 VirtualStart(const TrajAxis_s * axis, fp32 * t_off)
+{
+    fp32 J = axis->limit.max_jerk;
+    fp32 dir = -Sign(axis->err);
+    fp32 v = dir * axis->vel, a = dir * axis->acc;
+
+    fp32 t = fabsf(a) / J;
+    fp32 d = fabsf(axis->err) - (v + (0.5f * a - Sign(a) * J * t / 6.0f) * t) * t;
+    v += 0.5f * a * fabsf(a) / J;
+    if (d < 0.0f) d = 0.0f;
+    if (v <= 0.0f) {
+        *t_off = -t;
+        return d;
+    }
+    fp32 t_acc = AccTime(axis->limit.max_acc, J, v);
+    *t_off = t_acc - t;
+    return d + 0.5f * v * t_acc;
+}
+
+/**
+ * @brief          估计的最短到达时间，正在朝目标运动时计入已有速度
+ */
+fp32 TrajAxisTimeToGo(const TrajAxis_s * axis)
+{
+    fp32 t_off;
+    fp32 d = VirtualStart(axis, &t_off);
+    return RestToRestTime(&axis->limit, d) - t_off;
+}
+
+/**
+ * @brief          是否已停在目标位置
+ */
+bool_t TrajAxisReached(const TrajAxis_s * axis)
+{
+    return axis->err == 0.0f && axis->vel == 0.0f && axis->acc == 0.0f;
+}
+
+/**
+ * @brief          多轴同步更新，各轴同时到达目标
+ * @param[in,out]  axis 轨迹数组
+ * @param[in]      num 轴数
+ * @param[in]      dt (s)距上次调用的时间
+ * @retval         none
+ */
+void TrajectorySync(TrajAxis_s * axis, uint8_t num, fp32 dt)
+{
+    bool_t replan = 0;
+    for (uint8_t i = 0; i < num; i++) {
+        replan |= axis[i].replan;
+        axis[i].replan = 0;
+    }
+
+    if (replan) {
+        // 目标改变时重新分配各轴最大速度，最慢的轴按自身能力运动，其余轴降速到同时到达
+        fp32 T = 0.0f;
+        uint8_t leader = 0;
+        for (uint8_t i = 0; i < num; i++) {
+            fp32 t = TrajAxisTimeToGo(&axis[i]);
+            if (t > T) {
+                T = t;
+                leader = i;
+            }
+        }
+        for (uint8_t i = 0; i < num; i++) {
+            if (i == leader) {
+                axis[i].vel_limit = axis[i].limit.max_vel;
+            } else {
+                fp32 t_off;
+                fp32 d = VirtualStart(&axis[i], &t_off);
+                axis[i].vel_limit = VelForTime(&axis[i].limit, d, T + t_off);
+            }
+        }
+    }
+
+    for (uint8_t i = 0; i < num; i++) {
+        TrajAxisUpdate(&axis[i], dt);
+    }
+}
+/*------------------------------ End of File ------------------------------*/
@@ -0,0 +1,65 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       trajectory.c/h
+  * @brief      在线加加速度限制轨迹生成，每个控制周期由当前状态和新目标重新规划
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+    单轴(TrajAxis_s)：
+      状态为规划输出相对目标的偏差、速度、加速度，每个周期只决定一次加加速度：
+        1. StopPos：从当前状态按最大加加速度、最大加速度时间最优地制动到静止，得到停下的位置，
+           由它在目标的哪一侧决定朝哪个方向(s)施加加加速度
+        2. 在 [-J, J] 内取尽量大的 s*u，使一个周期后的状态仍能不越过目标停下、
+           且把加速度减到0时速度不超过 vel_limit；先试两端，不行再二分 TRAJ_SEARCH_ITERATION 次
+        3. 按所选加加速度精确积分一个周期
+      位置、速度、加速度误差都小于一个周期最大加加速度对应的量时直接置为目标，避免在目标附近来回抖动。
+      目标可以每个周期改变，规划输出始终连续，速度、加速度、加加速度不超过限幅，计算量固定。
+    多轴同步(TrajectorySync)：
+      目标改变时按各轴当前状态估计最短到达时间(把运动中的轴看作更早从静止出发)，取最大值作为共同到达时间，
+      最慢的轴按自身能力运动，其余轴只降低最大速度使到达时间一致，加速度和加加速度限幅不变，
+      保证各轴随时都能按原能力制动。目标不变时沿用上次分配的最大速度。
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+#ifndef TRAJECTORY_H
+#define TRAJECTORY_H
+#include "struct_typedef.h"
+
+typedef struct
+{
+    fp32 max_vel;   // 最大速度
+    fp32 max_acc;   // 最大加速度
+    fp32 max_jerk;  // 最大加加速度
+} TrajLimit_s;
+
+typedef struct
+{
+    TrajLimit_s limit;
+    fp32 vel_limit;  // 本周期使用的最大速度，多轴同步时小于limit.max_vel
+
+    fp32 target;
+    fp32 pos;  // target + err
+    fp32 err;  // 规划位置相对目标的偏差，积分在偏差上进行，目标数值较大时接近目标仍有足够精度
+    fp32 vel;
+    fp32 acc;
+    fp32 jerk;
+
+    bool_t replan;  // 目标改变，多轴同步需要重新分配最大速度
+} TrajAxis_s;
+
+extern void TrajAxisInit(TrajAxis_s * axis, const TrajLimit_s * limit, fp32 pos);
+extern void TrajAxisReset(TrajAxis_s * axis, fp32 pos, fp32 vel);
+extern void TrajAxisSetTarget(TrajAxis_s * axis, fp32 target);
+extern void TrajAxisShift(TrajAxis_s * axis, fp32 offset);
+extern fp32 TrajAxisUpdate(TrajAxis_s * axis, fp32 dt);
+extern fp32 TrajAxisTimeToGo(const TrajAxis_s * axis);
+extern bool_t TrajAxisReached(const TrajAxis_s * axis);
+
+extern void TrajectorySync(TrajAxis_s * axis, uint8_t num, fp32 dt);
+
+#endif  // TRAJECTORY_H
+/*------------------------------ End of File ------------------------------*/
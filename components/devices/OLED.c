@@ -11,6 +11,33 @@
 
 OLED_GRAM_strutct_t oled_gram;
 
+// the content already on the screen, used to diff against oled_gram
+static uint8_t oled_shadow[8][128];
+// dirty column range of each page, x_min > x_max means the page is clean
+static oled_dirty_t oled_dirty[8];
+// window transmit buffer, the first byte is the data control byte 0x40
+static uint8_t oled_tx_buf[1 + MAX_COLUMN];
+// next page to check, round-robin so that no page is starved
+static uint8_t oled_dirty_page = 0;
+
+/**
+ * @brief   mark the column range [x_min, x_max] of page as dirty
+ * @param   page: page of gram, [0, 7]
+ * @param   x_min, x_max: column range, [0, X_WIDTH-1]
+ * @retval  none
+ */
+static void oled_mark_dirty(uint8_t page, uint8_t x_min, uint8_t x_max)
+{
+    if (x_min < oled_dirty[page].x_min)
+    {
+        oled_dirty[page].x_min = x_min;
+    }
+    if (x_max > oled_dirty[page].x_max || oled_dirty[page].x_min > oled_dirty[page].x_max)
+    {
+        oled_dirty[page].x_max = x_max;
+    }
+}
+
 
 
 void OLED_com_reset(void)
@@ -187,6 +214,7 @@ void OLED_operate_gram(pen_typedef pen)
                 oled_gram.OLED_GRAM[i][n] = 0xff - oled_gram.OLED_GRAM[i][n];
             }
         }
+        oled_mark_dirty(i, 0, X_WIDTH - 1);
     }
 }
 
@@ -244,6 +272,7 @@ void OLED_draw_point(uint8_t x, uint8_t y, pen_typedef pen)
     {
         oled_gram.OLED_GRAM[page][x] &= ~(1 << row);
     }
+    oled_mark_dirty(page, x, x);
 }
 
 
@@ -396,9 +425,101 @@ void OLED_printf(uint8_t col, uint8_t row, const char *fmt,...)
  */
 void OLED_refresh_gram(void)
 {
+    uint8_t i;
+
     OLED_set_pos(0, 0);
     oled_gram.cmd_data = 0x40;
     I2C2_DMA_transmit(OLED_I2C_ADDRESS, (uint8_t*)&oled_gram, 1025);
+
+    memcpy(oled_shadow, oled_gram.OLED_GRAM, sizeof(oled_shadow));
+    for (i = 0; i < 8; i++)
+    {
+        oled_dirty[i].x_min = X_WIDTH - 1;
+        oled_dirty[i].x_max = 0;
+    }
+}
+
+/**
+ * @brief   send only the changed window of one dirty page to oled screen.
+ *          the dirty column range is shrunk by comparing with the content already on the
+ *          screen, so redrawing the same content costs no i2c bandwidth.
+ * @param   none
+ * @retval  1: a window is being sent, call again later to send the rest
+ *          0: nothing changed or i2c dma is busy
+ */
+uint8_t OLED_refresh_dirty(void)
+{
+    uint8_t i, page, x_min, x_max;
+    uint8_t len;
+
+    if (I2C2_DMA_is_busy())
+    {
+        return 0;
+    }
+
+    for (i = 0; i < 8; i++)
+    {
+        page = oled_dirty_page;
+        oled_dirty_page = (oled_dirty_page + 1) & 0x07;
+
+        x_min = oled_dirty[page].x_min;
+        x_max = oled_dirty[page].x_max;
+        oled_dirty[page].x_min = X_WIDTH - 1;
+        oled_dirty[page].x_max = 0;
+        if (x_min > x_max)
+        {
+            continue;
+        }
+
+        while (x_min <= x_max && oled_gram.OLED_GRAM[page][x_min] == oled_shadow[page][x_min])
+        {
+            x_min++;
+        }
+        while (x_max > x_min && oled_gram.OLED_GRAM[page][x_max] == oled_shadow[page][x_max])
+        {
+            x_max--;
+        }
+        if (x_min > x_max)
+        {
+            continue;
+        }
+
+        len = x_max - x_min + 1;
+        oled_write_byte(0x21, OLED_CMD);
+        oled_write_byte(x_min, OLED_CMD);
+        oled_write_byte(x_max, OLED_CMD);
+        oled_write_byte(0x22, OLED_CMD);
+        oled_write_byte(page, OLED_CMD);
+        oled_write_byte(page, OLED_CMD);
+
+        oled_tx_buf[0] = 0x40;
+        memcpy(&oled_tx_buf[1], &oled_gram.OLED_GRAM[page][x_min], len);
+        memcpy(&oled_shadow[page][x_min], &oled_gram.OLED_GRAM[page][x_min], len);
+        I2C2_DMA_transmit(OLED_I2C_ADDRESS, oled_tx_buf, len + 1);
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief   treat the whole screen as unknown, the next OLED_refresh_dirty calls will resend
+ *          all pages. call it after the oled is re-initialized.
+ * @param   none
+ * @retval  none
+ */
+void OLED_invalidate(void)
+{
+    uint8_t i, n;
+
+    for (i = 0; i < 8; i++)
+    {
+        for (n = 0; n < 128; n++)
+        {
+            oled_shadow[i][n] = ~oled_gram.OLED_GRAM[i][n];
+        }
+        oled_mark_dirty(i, 0, X_WIDTH - 1);
+    }
 }
 
 
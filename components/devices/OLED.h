@@ -48,6 +48,12 @@ typedef  __packed struct
     uint8_t OLED_GRAM[8][128];
 }OLED_GRAM_strutct_t;
 
+typedef struct
+{
+    uint8_t x_min;
+    uint8_t x_max;
+}oled_dirty_t;
+
 
 
 extern void OLED_com_reset(void);
@@ -163,6 +169,20 @@ extern void OLED_printf(uint8_t row, uint8_t col, const char *fmt,...);
  */
 extern void OLED_refresh_gram(void);
 
+/**
+ * @brief   send only the changed window of one dirty page to oled screen
+ * @param   none
+ * @retval  1: a window is being sent, 0: nothing to send or i2c dma is busy
+ */
+extern uint8_t OLED_refresh_dirty(void);
+
+/**
+ * @brief   force the next OLED_refresh_dirty calls to resend the whole screen
+ * @param   none
+ * @retval  none
+ */
+extern void OLED_invalidate(void);
+
 
 
 
@@ -1,6 +1,8 @@
 #include "clist.h"
 
-#include <stdlib.h>
+#include <stddef.h>
+
+#include "mem_pool.h"
 
 /*
  *    ListCreate 创建一个链表
@@ -25,7 +27,7 @@
 /// @brief 创建一个链表
 List * ListCreate(void)
 {
-    List * list = (List *)malloc(sizeof(List));
+    List * list = (List *)mem_pool_alloc(sizeof(List));
     if (list == NULL) {
         return NULL;
     }
@@ -41,7 +43,7 @@ void ListPushBack(List * list, void * data)
         return;
     }
 
-    Node * node = (Node *)malloc(sizeof(Node));
+    Node * node = (Node *)mem_pool_alloc(sizeof(Node));
     if (node == NULL) {
         return;
     }
@@ -66,7 +68,7 @@ void ListPushFront(List * list, void * data)
         return;
     }
 
-    Node * node = (Node *)malloc(sizeof(Node));
+    Node * node = (Node *)mem_pool_alloc(sizeof(Node));
     if (node == NULL) {
         return;
     }
@@ -88,7 +90,7 @@ int8_t ListInsert(List * list, uint32_t pos, void * data)
         return 0;
     }
 
-    Node * node = (Node *)malloc(sizeof(Node));
+    Node * node = (Node *)mem_pool_alloc(sizeof(Node));
     if (node == NULL) {
         return -1;
     }
@@ -117,7 +119,7 @@ int8_t ListInsertForNode(List * list, Node * pos, void * data)
         return 0;
     }
 
-    Node * node = (Node *)malloc(sizeof(Node));
+    Node * node = (Node *)mem_pool_alloc(sizeof(Node));
     if (node == NULL) {
         return -1;
     }
@@ -147,7 +149,7 @@ void ListEraseBack(List * list)
     }
 
     if (list->head->next == NULL) {
-        free(list->head);
+        mem_pool_free(list->head);
         list->head = NULL;
         list->len--;
         return;
@@ -160,7 +162,7 @@ void ListEraseBack(List * list)
         p = q;
         q = q->next;
     }
-    free(q);
+    mem_pool_free(q);
     p->next = NULL;
     list->len--;
 }
@@ -174,7 +176,7 @@ void ListEraseFront(List * list)
 
     Node * p = list->head;
     list->head = p->next;
-    free(p);
+    mem_pool_free(p);
     list->len--;
 }
 
@@ -202,7 +204,7 @@ void ListEraseForNode(List * list, Node * pos)
     }
 
     p->next = pos->next;
-    free(pos);
+    mem_pool_free(pos);
     list->len--;
 }
 
@@ -263,8 +265,8 @@ void ListDestroy(List * list)
     Node * q = NULL;
     while (p != NULL) {
         q = p->next;
-        free(p);
+        mem_pool_free(p);
         p = q;
     }
-    free(list);
+    mem_pool_free(list);
 }
@@ -24,7 +24,7 @@
 /* must be power of 2, at least 8 */
 #define BYTE_ALIGNMENT (8)
 #define BYTE_ALIGNMENT_MASK (BYTE_ALIGNMENT - 1)
-#define POINTER_SIZE_TYPE unsigned int
+#define POINTER_SIZE_TYPE uintptr_t
 
 /* A few bytes might be lost to byte aligning the heap start address. */
 #define ADJUSTED_HEAP_SIZE (TOTAL_HEAP_SIZE - BYTE_ALIGNMENT)
@@ -1,6 +1,8 @@
 
 #include "mem_mang.h"
 
+#include "mem_pool.h"
+
 MUTEX_DECLARE(mem_mutex);
 /* Define the linked list structure.  This is used to link free blocks in order
 of their memory address. */
@@ -65,6 +67,17 @@ void *heap_malloc(uint32_t wanted_size)
   block_link_t *block, *prev_block, *new_block;
   void *reval = NULL;
 
+  /* Small blocks come from the fixed-block pool first, which is O(1) and does
+  not fragment the heap.  Fall back to the heap when the pool is exhausted. */
+  if ((wanted_size > 0) && (wanted_size <= MEM_POOL_MAX_SIZE))
+  {
+    reval = mem_pool_alloc(wanted_size);
+    if (reval != NULL)
+    {
+      return reval;
+    }
+  }
+
   if (mutex_init == 0)
   {
     mutex_init = 1;
@@ -173,6 +186,12 @@ void heap_free(void *pv)
   uint8_t *puc = (uint8_t *)pv;
   block_link_t *block;
 
+  if (mem_pool_owns(pv))
+  {
+    mem_pool_free(pv);
+    return;
+  }
+
   MUTEX_LOCK(mem_mutex);
 
   if (pv != NULL)
@@ -224,17 +243,17 @@ static void heap_init(void)
 {
   block_link_t *first_free_block;
   uint8_t *aligned_heap;
-  uint32_t address;
+  POINTER_SIZE_TYPE address;
   uint32_t total_heap_size = TOTAL_HEAP_SIZE;
 
   /* Ensure the heap starts on a correctly aligned boundary. */
-  address = (uint32_t)heap;
+  address = (POINTER_SIZE_TYPE)heap;
 
   if ((address & BYTE_ALIGNMENT_MASK) != 0)
   {
     address += (BYTE_ALIGNMENT - 1);
-    address &= ~((uint32_t)BYTE_ALIGNMENT_MASK);
-    total_heap_size -= address - (uint32_t)heap;
+    address &= ~((POINTER_SIZE_TYPE)BYTE_ALIGNMENT_MASK);
+    total_heap_size -= (uint32_t)(address - (POINTER_SIZE_TYPE)heap);
   }
 
   aligned_heap = (uint8_t *)address;
@@ -246,9 +265,9 @@ static void heap_init(void)
 
   /* end is used to mark the end of the list of free blocks and is inserted
     at the end of the heap space. */
-  address = ((uint32_t)aligned_heap) + total_heap_size;
+  address = ((POINTER_SIZE_TYPE)aligned_heap) + total_heap_size;
   address -= STRUCT_SIZE;
-  address &= ~((uint32_t)BYTE_ALIGNMENT_MASK);
+  address &= ~((POINTER_SIZE_TYPE)BYTE_ALIGNMENT_MASK);
   end = (void *)address;
   end->block_size = 0;
   end->next_free = NULL;
@@ -256,7 +275,7 @@ static void heap_init(void)
   /* To start with there is a single free block that is sized to take up the
     entire heap space, minus the space taken by end. */
   first_free_block = (void *)aligned_heap;
-  first_free_block->block_size = address - (uint32_t)first_free_block;
+  first_free_block->block_size = (uint32_t)(address - (POINTER_SIZE_TYPE)first_free_block);
   first_free_block->next_free = end;
 
   /* Only one block exists - and it covers the entire usable heap space. */
@@ -0,0 +1,228 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       mem_pool.c/h
+  * @brief      固定块内存池，替代 malloc 为链表、数据交换中心等模块分配内存
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *  V1.0.1     Oct-19-2026     Penguin         1. 各任务初始化完成后冻结，冻结后的分配默认只记录
+  *                                                2. heap_malloc 的小块分配使用内存池
+  *
+  @verbatim
+  ==============================================================================
+    每一级内存池的空闲块通过块首的指针串成单向链表，分配和释放只操作链表头。
+    释放时通过地址范围判断块所属的级别，因此可直接用 mem_pool_free 释放任意级别的块。
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include "mem_pool.h"
+
+#include "macro_mutex.h"
+
+#if defined(__CC_ARM)
+#define MEM_POOL_CALLER() ((void *)__return_address())
+#elif defined(__GNUC__)
+#define MEM_POOL_CALLER() __builtin_return_address(0)
+#else
+#define MEM_POOL_CALLER() NULL
+#endif
+
+typedef struct MemBlock
+{
+    struct MemBlock * next;
+} MemBlock_t;
+
+typedef struct
+{
+    uint8_t * start;
+    uint8_t * end;
+    MemBlock_t * free_list;
+    mem_pool_info_t info;
+} MemPool_t;
+
+// 使用 uint64_t 保证块按8字节对齐
+static uint64_t POOL_0_BUF[MEM_POOL_0_SIZE * MEM_POOL_0_NUM / 8];
+static uint64_t POOL_1_BUF[MEM_POOL_1_SIZE * MEM_POOL_1_NUM / 8];
+static uint64_t POOL_2_BUF[MEM_POOL_2_SIZE * MEM_POOL_2_NUM / 8];
+
+static MemPool_t POOLS[MEM_POOL_CLASS_NUM] = {
+    {(uint8_t *)POOL_0_BUF, (uint8_t *)POOL_0_BUF + sizeof(POOL_0_BUF), NULL,
+     {MEM_POOL_0_SIZE, MEM_POOL_0_NUM, 0, 0, 0}},
+    {(uint8_t *)POOL_1_BUF, (uint8_t *)POOL_1_BUF + sizeof(POOL_1_BUF), NULL,
+     {MEM_POOL_1_SIZE, MEM_POOL_1_NUM, 0, 0, 0}},
+    {(uint8_t *)POOL_2_BUF, (uint8_t *)POOL_2_BUF + sizeof(POOL_2_BUF), NULL,
+     {MEM_POOL_2_SIZE, MEM_POOL_2_NUM, 0, 0, 0}},
+};
+
+static uint8_t INITED = 0;
+static uint8_t FROZEN = 0;
+static uint8_t INIT_HOLD = 0;  // 尚未完成初始化的任务数量
+static mem_pool_fault_t FAULT = {0, 0, NULL};
+
+MUTEX_DECLARE(pool_mutex);
+
+/**
+ * @brief          将每一级内存池的所有块串成空闲链表，在第一次分配时调用
+ * @retval         none
+ */
+static void mem_pool_init(void)
+{
+    uint8_t i;
+    uint16_t j;
+    MemBlock_t * block;
+
+    for (i = 0; i < MEM_POOL_CLASS_NUM; i++) {
+        POOLS[i].free_list = NULL;
+        // 倒序插入，使低地址的块先被分配
+        for (j = POOLS[i].info.block_num; j > 0; j--) {
+            block = (MemBlock_t *)(POOLS[i].start + (j - 1) * POOLS[i].info.block_size);
+            block->next = POOLS[i].free_list;
+            POOLS[i].free_list = block;
+        }
+    }
+    INITED = 1;
+}
+
+/**
+ * @brief          分配内存
+ * @param[in]      size 需要的字节数
+ * @retval         内存地址，没有合适的空闲块时返回NULL
+ */
+void * mem_pool_alloc(uint32_t size)
+{
+    uint8_t i;
+    MemBlock_t * block = NULL;
+
+    MUTEX_LOCK(pool_mutex);
+    if (!INITED) {
+        mem_pool_init();
+    }
+
+    if (FROZEN) {
+        // 冻结后的分配照常进行，只记录下来，避免控制任务因此停止
+        FAULT.count++;
+        FAULT.last_size = size;
+        FAULT.last_caller = MEM_POOL_CALLER();
+#if MEM_POOL_DEBUG
+        MEM_POOL_FAULT();
+#endif
+    }
+
+    for (i = 0; i < MEM_POOL_CLASS_NUM; i++) {
+        if (size > POOLS[i].info.block_size) {
+            continue;
+        }
+        block = POOLS[i].free_list;
+        if (block == NULL) {
+            // 本级已满，记录失败后尝试更大一级
+            POOLS[i].info.fail++;
+            continue;
+        }
+        POOLS[i].free_list = block->next;
+        POOLS[i].info.used++;
+        if (POOLS[i].info.used > POOLS[i].info.high_water) {
+            POOLS[i].info.high_water = POOLS[i].info.used;
+        }
+        break;
+    }
+    MUTEX_UNLOCK(pool_mutex);
+
+    return block;
+}
+
+/**
+ * @brief          释放由 mem_pool_alloc 分配的内存
+ * @param[in]      p 内存地址，为NULL或不属于内存池时不做处理
+ * @retval         none
+ */
+void mem_pool_free(void * p)
+{
+    uint8_t i;
+
+    if (p == NULL) {
+        return;
+    }
+
+    MUTEX_LOCK(pool_mutex);
+    for (i = 0; i < MEM_POOL_CLASS_NUM; i++) {
+        if ((uint8_t *)p >= POOLS[i].start && (uint8_t *)p < POOLS[i].end) {
+            ((MemBlock_t *)p)->next = POOLS[i].free_list;
+            POOLS[i].free_list = (MemBlock_t *)p;
+            POOLS[i].info.used--;
+            break;
+        }
+    }
+    MUTEX_UNLOCK(pool_mutex);
+}
+
+/**
+ * @brief          判断地址是否属于内存池
+ * @param[in]      p 内存地址
+ * @retval         1:属于内存池 0:不属于
+ */
+uint8_t mem_pool_owns(const void * p)
+{
+    uint8_t i;
+
+    for (i = 0; i < MEM_POOL_CLASS_NUM; i++) {
+        if ((const uint8_t *)p >= POOLS[i].start && (const uint8_t *)p < POOLS[i].end) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief          冻结内存池，之后的分配会被记录到 mem_pool_get_fault
+ * @retval         none
+ */
+void mem_pool_freeze(void) { FROZEN = 1; }
+
+/**
+ * @brief          登记一个需要在初始化时分配内存的任务，在创建任务前调用
+ * @retval         none
+ */
+void mem_pool_init_hold(void)
+{
+    MUTEX_LOCK(pool_mutex);
+    INIT_HOLD++;
+    MUTEX_UNLOCK(pool_mutex);
+}
+
+/**
+ * @brief          任务初始化完成，所有登记的任务都完成后冻结内存池
+ * @retval         none
+ */
+void mem_pool_init_release(void)
+{
+    MUTEX_LOCK(pool_mutex);
+    if (INIT_HOLD > 0) {
+        INIT_HOLD--;
+        if (INIT_HOLD == 0) {
+            FROZEN = 1;
+        }
+    }
+    MUTEX_UNLOCK(pool_mutex);
+}
+
+/**
+ * @brief          获取某一级内存池的使用情况
+ * @param[in]      index 级别 [0, MEM_POOL_CLASS_NUM)
+ * @retval         使用情况，index越界时返回NULL
+ */
+const mem_pool_info_t * mem_pool_get_info(uint8_t index)
+{
+    if (index >= MEM_POOL_CLASS_NUM) {
+        return NULL;
+    }
+    return &POOLS[index].info;
+}
+
+/**
+ * @brief          获取冻结后的分配记录
+ * @retval         分配记录
+ */
+const mem_pool_fault_t * mem_pool_get_fault(void) { return &FAULT; }
+/*------------------------------ End of File ------------------------------*/
@@ -0,0 +1,86 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       mem_pool.c/h
+  * @brief      固定块内存池，替代 malloc 为链表、数据交换中心等模块分配内存
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *  V1.0.1     Oct-19-2026     Penguin         1. 各任务初始化完成后冻结，冻结后的分配默认只记录
+  *                                                2. heap_malloc 的小块分配使用内存池
+  *
+  @verbatim
+  ==============================================================================
+    内存池按块大小分为若干级，每级的块数量在编译期确定（MEM_POOL_x_NUM）。
+    mem_pool_alloc 从能容纳所需大小的最小一级中取块，分配和释放均为 O(1)。
+    各级记录当前使用量、历史最大使用量和分配失败次数，可用 mem_pool_get_info 查看。
+
+    冻结：
+      创建需要在初始化时分配内存的任务前调用 mem_pool_init_hold()，任务初始化(发布数据)
+      完成后调用 mem_pool_init_release()，所有任务都完成后内存池自动冻结；也可以直接调用
+      mem_pool_freeze()。释放不受冻结影响。
+      冻结后的分配仍正常进行，但会计入 mem_pool_get_fault() 的次数并记录最后一次的大小和
+      调用位置，用于发现控制循环中的动态分配。MEM_POOL_DEBUG 为1时再调用 MEM_POOL_FAULT()
+      停机等待调试器，只在调试时使用，避免运动中的机器人因此失控。
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#ifndef MEM_POOL_H
+#define MEM_POOL_H
+#include "struct_typedef.h"
+
+/* 块大小必须为8的整数倍 */
+#define MEM_POOL_0_SIZE 8
+#define MEM_POOL_0_NUM 64
+#define MEM_POOL_1_SIZE 32
+#define MEM_POOL_1_NUM 32
+#define MEM_POOL_2_SIZE 128
+#define MEM_POOL_2_NUM 8
+
+#define MEM_POOL_CLASS_NUM 3
+
+#define MEM_POOL_MAX_SIZE MEM_POOL_2_SIZE
+
+/* 调试时设为1，冻结后发生分配时调用 MEM_POOL_FAULT() */
+#ifndef MEM_POOL_DEBUG
+#define MEM_POOL_DEBUG 0
+#endif  // MEM_POOL_DEBUG
+
+/* 冻结后发生分配时的调试处理，默认停机等待调试器 */
+#ifndef MEM_POOL_FAULT
+#define MEM_POOL_FAULT() \
+    do {                 \
+        __disable_irq(); \
+        while (1) {      \
+        }                \
+    } while (0)
+#endif  // MEM_POOL_FAULT
+
+typedef struct
+{
+    uint16_t block_size;  // (byte)块大小
+    uint16_t block_num;   // 块数量
+    uint16_t used;        // 当前使用的块数量
+    uint16_t high_water;  // 历史最大使用块数量
+    uint16_t fail;        // 分配失败次数
+} mem_pool_info_t;
+
+typedef struct
+{
+    uint32_t count;      // 冻结后的分配次数
+    uint32_t last_size;  // (byte)最后一次分配的大小
+    void * last_caller;  // 最后一次分配的调用位置
+} mem_pool_fault_t;
+
+extern void * mem_pool_alloc(uint32_t size);
+extern void mem_pool_free(void * p);
+extern uint8_t mem_pool_owns(const void * p);
+extern void mem_pool_freeze(void);
+extern void mem_pool_init_hold(void);
+extern void mem_pool_init_release(void);
+extern const mem_pool_info_t * mem_pool_get_info(uint8_t index);
+extern const mem_pool_fault_t * mem_pool_get_fault(void);
+
+#endif  // MEM_POOL_H
+/*------------------------------ End of File ------------------------------*/
@@ -0,0 +1,220 @@
+/**
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  * @file       mem_pool_bench.c
+  * @brief      在PC上运行的内存池测试程序，检查分配结果并比较内存池与首次适配堆的耗时
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     Penguin         1. done
+  *
+  @verbatim
+  ==============================================================================
+    编译运行：
+      cc -O2 -Istub -I.. -o mem_pool_bench mem_pool_bench.c ../mem_pool.c ../mem_mang4.c
+      ./mem_pool_bench
+    检查项(任一不满足返回非0)：
+      1. 随机分配释放时，内存池返回的块8字节对齐、互不重叠、大小满足要求，
+         使用量和历史最大使用量与实际一致；某一级用完后从更大一级分配，全部用完后返回NULL
+      2. heap_malloc 的小块分配来自内存池，大块来自堆，heap_free 都能正确归还
+      3. 登记的任务全部完成初始化后才冻结；冻结后的分配照常返回，并记录次数和大小
+    耗时：
+      随机大小的分配释放(同时保持 LIVE_NUM 个已分配的块)，比较内存池、经过内存池的
+      heap_malloc 和不经过内存池的首次适配堆(碎片化后)，PC上的耗时只用于比较
+  ==============================================================================
+  @endverbatim
+  ****************************(C) COPYRIGHT 2024 Polarbear****************************
+  */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "mem_mang.h"
+#include "mem_pool.h"
+
+#define BENCH_NUM 2000000
+#define LIVE_NUM 32
+#define SIZE_TABLE_NUM 0x10000  // 预先生成的随机大小，2的整数次幂
+
+static const uint16_t NUM[MEM_POOL_CLASS_NUM] = {MEM_POOL_0_NUM, MEM_POOL_1_NUM, MEM_POOL_2_NUM};
+#define BLOCK_TOTAL (MEM_POOL_0_NUM + MEM_POOL_1_NUM + MEM_POOL_2_NUM)
+
+static uint32_t SEED = 1;
+
+static uint32_t RandU32(void)
+{
+    SEED = SEED * 1664525u + 1013904223u;
+    return SEED >> 8;
+}
+
+static double Seconds(void) { return (double)clock() / CLOCKS_PER_SEC; }
+
+static uint16_t UsedTotal(void)
+{
+    uint16_t used = 0;
+    for (uint8_t i = 0; i < MEM_POOL_CLASS_NUM; i++) used += mem_pool_get_info(i)->used;
+    return used;
+}
+
+/**
+ * @brief          保持 LIVE_NUM 个块，每次随机释放一个再分配一个
+ * @param[in]      alloc 分配函数
+ * @param[in]      release 释放函数
+ * @param[in]      min_size 最小分配大小
+ * @param[in]      max_size 最大分配大小
+ * @retval         (ns)一次分配加一次释放的平均耗时
+ */
+static double Bench(
+    void * (*alloc)(uint32_t), void (*release)(void *), uint32_t min_size, uint32_t max_size)
+{
+    static uint32_t size[SIZE_TABLE_NUM];
+    void * live[LIVE_NUM];
+    volatile uintptr_t sink = 0;
+
+    for (uint32_t i = 0; i < SIZE_TABLE_NUM; i++) {
+        size[i] = min_size + RandU32() % (max_size - min_size + 1);
+    }
+    for (int i = 0; i < LIVE_NUM; i++) live[i] = alloc(size[i]);
+
+    double t0 = Seconds();
+    for (uint32_t i = 0; i < BENCH_NUM; i++) {
+        uint32_t k = (i * 7u) % LIVE_NUM;
+        release(live[k]);
+        live[k] = alloc(size[i & (SIZE_TABLE_NUM - 1)]);
+        sink += (uintptr_t)live[k];
+    }
+    double t1 = Seconds();
+
+    for (int i = 0; i < LIVE_NUM; i++) release(live[i]);
+    return (t1 - t0) * 1e9 / BENCH_NUM;
+}
+
+int main(void)
+{
+    int fail = 0;
+
+    // 1. 随机分配释放
+    {
+        static uint8_t * block[BLOCK_TOTAL];
+        static uint32_t block_size[BLOCK_TOTAL];
+        uint16_t high_water[MEM_POOL_CLASS_NUM] = {0};
+        uint16_t used[MEM_POOL_CLASS_NUM] = {0};
+        int live = 0;
+        int err = 0;
+
+        for (int step = 0; step < 100000; step++) {
+            if (live > 0 && (RandU32() & 1)) {
+                int k = RandU32() % live;
+                mem_pool_free(block[k]);
+                block[k] = block[live - 1];
+                block_size[k] = block_size[live - 1];
+                live--;
+            } else if (live < BLOCK_TOTAL) {
+                uint32_t size = 1 + RandU32() % MEM_POOL_MAX_SIZE;
+                uint8_t * p = mem_pool_alloc(size);
+                if (p == NULL) continue;
+                if (((uintptr_t)p & 0x07) != 0 || !mem_pool_owns(p)) err++;
+                memset(p, live & 0xFF, size);
+                block[live] = p;
+                block_size[live] = size;
+                live++;
+            }
+            // 已分配的块互不重叠(检查新分配的块)
+            if (live > 1) {
+                uint8_t * p = block[live - 1];
+                for (int i = 0; i < live - 1; i++) {
+                    if (p < block[i] + block_size[i] && block[i] < p + block_size[live - 1]) {
+                        err++;
+                    }
+                }
+            }
+            for (uint8_t c = 0; c < MEM_POOL_CLASS_NUM; c++) {
+                used[c] = mem_pool_get_info(c)->used;
+                if (used[c] > high_water[c]) high_water[c] = used[c];
+            }
+            if (UsedTotal() != live) err++;
+        }
+        for (uint8_t c = 0; c < MEM_POOL_CLASS_NUM; c++) {
+            if (mem_pool_get_info(c)->high_water != high_water[c]) err++;
+        }
+        while (live > 0) mem_pool_free(block[--live]);
+        if (UsedTotal() != 0) err++;
+
+        // 用完8字节一级后从32字节一级分配，全部用完后返回NULL
+        int n = 0;
+        while (n < BLOCK_TOTAL && (block[n] = mem_pool_alloc(MEM_POOL_0_SIZE)) != NULL) n++;
+        if (n != BLOCK_TOTAL || mem_pool_alloc(1) != NULL) err++;
+        if (mem_pool_get_info(0)->used != NUM[0] || mem_pool_get_info(2)->used != NUM[2]) err++;
+        if (mem_pool_get_info(0)->fail == 0) err++;
+        while (n > 0) mem_pool_free(block[--n]);
+        if (UsedTotal() != 0) err++;
+
+        printf(
+            "pool: %d errors, high water %u/%u %u/%u %u/%u\n", err, high_water[0], NUM[0],
+            high_water[1], NUM[1], high_water[2], NUM[2]);
+        if (err) fail = 1;
+    }
+
+    // 2. heap_malloc 经过内存池
+    {
+        int err = 0;
+        heap_free(heap_malloc(MEM_POOL_MAX_SIZE + 1));  // 第一次分配时初始化堆
+        void * small = heap_malloc(MEM_POOL_MAX_SIZE);
+        uint32_t heap_free_before = heap_get_free();
+        void * large = heap_malloc(MEM_POOL_MAX_SIZE + 1);
+        if (small == NULL || !mem_pool_owns(small) || UsedTotal() != 1) err++;
+        if (large == NULL || mem_pool_owns(large) || heap_get_free() >= heap_free_before) err++;
+        heap_free(small);
+        heap_free(large);
+        if (UsedTotal() != 0 || heap_get_free() != heap_free_before) err++;
+        if (heap_malloc(0) != NULL) err++;
+        printf("heap_malloc: %d errors\n", err);
+        if (err) fail = 1;
+    }
+
+    // 耗时
+    {
+        double pool = Bench(mem_pool_alloc, mem_pool_free, 1, MEM_POOL_MAX_SIZE);
+        double routed = Bench(heap_malloc, heap_free, 1, MEM_POOL_MAX_SIZE);
+
+        // 首次适配堆：先制造碎片，再分配内存池放不下的块
+        static void * frag[256];
+        for (int i = 0; i < 256; i++) frag[i] = heap_malloc(MEM_POOL_MAX_SIZE + 8 + i);
+        for (int i = 0; i < 256; i += 2) heap_free(frag[i]);
+        double heap = Bench(heap_malloc, heap_free, MEM_POOL_MAX_SIZE + 1, 2 * MEM_POOL_MAX_SIZE);
+        for (int i = 1; i < 256; i += 2) heap_free(frag[i]);
+
+        printf(
+            "alloc+free: pool %.1f ns, heap_malloc(pool) %.1f ns, first-fit heap %.1f ns\n",
+            pool, routed, heap);
+    }
+
+    // 3. 初始化完成后冻结
+    {
+        int err = 0;
+        mem_pool_init_hold();
+        mem_pool_init_hold();
+        mem_pool_init_release();
+        void * p = mem_pool_alloc(4);
+        if (p == NULL || mem_pool_get_fault()->count != 0) err++;
+        mem_pool_free(p);
+
+        mem_pool_init_release();
+        p = mem_pool_alloc(20);
+        const mem_pool_fault_t * fault = mem_pool_get_fault();
+        if (p == NULL || fault->count != 1 || fault->last_size != 20) err++;
+        mem_pool_free(p);
+        p = heap_malloc(6);
+        if (p == NULL || fault->count != 2 || fault->last_size != 6) err++;
+        heap_free(p);
+        if (UsedTotal() != 0) err++;
+
+        // 多余的释放不影响计数
+        mem_pool_init_release();
+        printf("freeze: %d errors, %u allocations after freeze\n", err, fault->count);
+        if (err) fail = 1;
+    }
+
+    printf(fail ? "FAIL\n" : "PASS\n");
+    return fail;
+}
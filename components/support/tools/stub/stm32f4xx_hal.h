@@ -0,0 +1,7 @@
+// 在PC上编译内存池和堆时使用的头文件，只提供 macro_mutex.h 中用到的关中断函数
+#ifndef STM32F4XX_HAL_H_STUB
+#define STM32F4XX_HAL_H_STUB
+#define __get_PRIMASK() 0UL
+#define __set_PRIMASK(x) ((void)(x))
+#define __disable_irq()
+#endif
@@ -0,0 +1,11 @@
+// 在PC上编译时使用的类型定义，mem_mang.h 同时包含了 stdint.h，64位PC上不能使用原来的 int64_t 定义
+#ifndef STRUCT_TYPEDEF_H
+#define STRUCT_TYPEDEF_H
+#include <stddef.h>
+#include <stdint.h>
+
+typedef unsigned char bool_t;
+typedef float fp32;
+typedef double fp64;
+
+#endif